@@ -32,12 +32,15 @@ AppFrame::AppFrame()
 
     contentAreaLayout->addWidget(disassemblyArea);
 
-    painterFrameBufferView = new SIPainterFrameBufferView(this, machine.cpu->memory);
+    painterFrameBufferView = new SIPainterFrameBufferView(this, machine.video_frames);
 
     contentAreaLayout->addSpacerItem(new QSpacerItem(1, 1, QSizePolicy::MinimumExpanding, QSizePolicy::Minimum));
 
     contentAreaLayout->addWidget(painterFrameBufferView);
 
+    heatmapView = new MemoryHeatmapView(this, machine.cpu);
+    contentAreaLayout->addWidget(heatmapView);
+
     alignContentLeftSpacer = new QSpacerItem(1, 1, QSizePolicy::MinimumExpanding, QSizePolicy::Minimum);
     contentAreaLayout->addSpacerItem(alignContentLeftSpacer);
 
@@ -107,6 +110,13 @@ AppFrame::AppFrame()
             &AppFrame::powerTurnedOn,
             machine.cpu,
             &CPU::emulate);
+
+    // Queued from the emulator thread, its arguments need a metatype.
+    qRegisterMetaType<uint16_t>("uint16_t");
+    connect(machine.cpu,
+            &CPU::watchpointReached,
+            this,
+            &AppFrame::watchpointReached);
 }
 AppFrame::~AppFrame() {
     this->saveUXSettings();
@@ -119,6 +129,7 @@ void AppFrame::powerButtonToggled(bool checked)
         disassemblyArea->pauseButton->setChecked(false);
         disassemblyArea->pauseButton->blockSignals(false);
         this->machine.cpu->flags |= (1 << 6); // enable the processor
+        title->setText("Emulation Environment");
         emit powerTurnedOn();
     } else {
         disassemblyArea->pauseButton->blockSignals(true);
@@ -141,10 +152,25 @@ void AppFrame::pauseButtonToggled(bool checked)
         disassemblyArea->powerButton->setChecked(true);
         disassemblyArea->powerButton->blockSignals(false);
         this->machine.cpu->flags |= (1 << 6); // enable the processor
+        title->setText("Emulation Environment");
         emit powerTurnedOn();
     }
 }
 
+// The processor has already disabled itself, show it as paused.
+void AppFrame::watchpointReached(uint16_t addr, bool write)
+{
+    disassemblyArea->pauseButton->blockSignals(true);
+    disassemblyArea->pauseButton->setChecked(true);
+    disassemblyArea->pauseButton->blockSignals(false);
+    disassemblyArea->powerButton->blockSignals(true);
+    disassemblyArea->powerButton->setChecked(false);
+    disassemblyArea->powerButton->blockSignals(false);
+    title->setText(QString("Watchpoint: %1 $%2")
+                   .arg(write ? "write" : "read")
+                   .arg(addr, 4, 16, QChar('0')));
+}
+
 void AppFrame::captureButtonToggled(bool checked)
 {
     if (checked) {
@@ -20,6 +20,7 @@
 #include "machine.h"
 #include "disassemblystatelistwidget.h"
 #include "sipainterframebufferview.h"
+#include "memoryheatmapview.h"
 
 namespace EE {
 
@@ -39,6 +40,7 @@ public:
 
     DisassemblyStateListWidget *disassemblyArea;
     SIPainterFrameBufferView *painterFrameBufferView;
+    MemoryHeatmapView *heatmapView;
 private:
     QSettings settings;
     QTimer interactionTimer;
@@ -64,6 +66,7 @@ public slots:
     void powerButtonToggled(bool checked);
     void pauseButtonToggled(bool checked);
     void captureButtonToggled(bool checked);
+    void watchpointReached(uint16_t addr, bool write);
 signals:
     void userActivity(bool active);
     void powerTurnedOn(void);
@@ -0,0 +1,240 @@
+#include "blockcache.h"
+#include "i8080fused.h"
+
+// True for instructions that may not continue at the next instruction.
+static bool EndsBlock(uint8_t op)
+{
+    return op == 0xc3 ||          // JMP
+           op == 0xcd ||          // CALL
+           op == 0xc9 ||          // RET
+           op == 0xe9 ||          // PCHL
+           op == 0x76 ||          // HLT
+           (op & 0xc7) == 0xc2 || // Jcc
+           (op & 0xc7) == 0xc4 || // Ccc
+           (op & 0xc7) == 0xc0 || // Rcc
+           (op & 0xc7) == 0xc7;   // RST
+}
+
+BlockCache::BlockCache(CPU *processor)
+{
+    cpu = processor;
+    generation = 0;
+    blocks.fill(0, 0x10000);
+}
+
+BlockCache::~BlockCache()
+{
+    clear();
+    for (Block *block : retired) {
+        delete block;
+    }
+}
+
+int BlockCache::run(int cycles)
+{
+    CPU *processor = cpu;
+    int executed = 0;
+    // A fused pair would run its second instruction past a watchpoint hit.
+    bool fuse = !processor->memory->watch_count;
+
+    while (executed < cycles && (processor->flags&(1 << 6))) {
+        if (processor->hasRoutine(processor->pc)) {
+            int routine_cycles = processor->runRoutine(cycles - executed);
+            if (routine_cycles > 0) {
+                executed += routine_cycles;
+                continue;
+            }
+        }
+
+        Block *block = lookup(processor->pc);
+
+        if (!block) {
+            // Unknown instruction, step() reports it.
+            int inst_cycles = processor->step();
+            if (inst_cycles == 0) {
+                break;
+            }
+            executed += inst_cycles;
+            continue;
+        }
+
+        uint32_t start_generation = generation;
+        const MicroOp *op = block->ops.constData();
+        const MicroOp *end = op + block->ops.size();
+        for (; op != end; ++op) {
+            if (op->fused && fuse && executed + op->lead_cycles < cycles) {
+                uint16_t next = processor->pc + op->fused_length;
+                executed += (*op->fused)(processor, *op->opcode);
+                op += op->fused_count - 1;
+                // Left the block, or stopped after a write to code.
+                if (processor->pc != next) {
+                    break;
+                }
+            } else {
+                executed += (*op->handler)(processor, *op->opcode);
+            }
+
+            // Stop on budget like step() would, or if HLT, a PUSH outside
+            // of safe memory or a machine callback disabled the processor,
+            // or if the block overwrote code.
+            if (executed >= cycles || !(processor->flags&(1 << 6)) || generation != start_generation) {
+                break;
+            }
+        }
+    }
+
+    return executed;
+}
+
+Block *BlockCache::lookup(uint16_t pc)
+{
+    if (!retired.isEmpty()) {
+        for (Block *block : retired) {
+            delete block;
+        }
+        retired.clear();
+    }
+
+    Block *block = blocks[pc];
+    if (!block) {
+        block = decode(pc);
+    }
+    return block;
+}
+
+Block *BlockCache::decode(uint16_t pc)
+{
+    const uint8_t *mem = cpu->memory->data;
+    uint16_t addr = pc;
+    QVector<MicroOp> ops;
+
+    while (ops.size() < max_block_length) {
+        // run() dispatches native routines, see CPU::addRoutine().
+        if (addr != pc && cpu->hasRoutine(addr)) {
+            break;
+        }
+
+        uint8_t op = mem[addr];
+        const InstructionDef &opcode = i8080_instructions[op];
+
+        // Same dispatch as CPU::step(), core handlers before machine callbacks.
+        int (*handler)(INSTDEF) = cpu->instruction_handlers[op];
+        if (!handler) {
+            handler = cpu->instruction_callbacks[op];
+        }
+        if (!opcode.defined || !handler) {
+            break;
+        }
+
+        ops.append(MicroOp { handler, &opcode, 0, 0, 0, 0 });
+        addr += opcode.length;
+
+        if (EndsBlock(op)) {
+            break;
+        }
+    }
+
+    if (ops.isEmpty()) {
+        return 0;
+    }
+
+    Block *block = new Block;
+    block->start = pc;
+    block->length = (uint16_t)(addr - pc);
+    block->ops = ops;
+    fuse(block);
+    blocks[pc] = block;
+
+    // Pages of the first and the last byte, blocks may wrap around 0xffff.
+    int first_page = pc >> 8;
+    int last_page = (uint16_t)(pc + block->length - 1) >> 8;
+    for (int page = first_page; ; page = (page + 1) & 0xff) {
+        page_blocks[page].append(block);
+        cpu->memory->code_pages[page] |= 1;
+        if (page == last_page) {
+            break;
+        }
+    }
+
+    return block;
+}
+
+// Marks the sequences of `block` that have a fused handler, longest first.
+// The micro-ops stay, for when the budget ends within a sequence.
+void BlockCache::fuse(Block *block)
+{
+    MicroOp *ops = block->ops.data();
+    int count = block->ops.size();
+
+    for (int i = 0; i < count; ) {
+        const FusedHandler *match = 0;
+        for (int f = 0; f < fused_handler_count && !match; f++) {
+            const FusedHandler &fused = fused_handlers[f];
+            bool same = i + fused.length <= count;
+            for (int k = 0; same && k < fused.length; k++) {
+                uint8_t op = ops[i + k].opcode - i8080_instructions;
+                same = op == fused.ops[k] && ops[i + k].handler == cpu->instruction_handlers[op];
+            }
+            if (same) {
+                match = &fused;
+            }
+        }
+        if (!match) {
+            i++;
+            continue;
+        }
+
+        MicroOp &first = ops[i];
+        first.fused = match->handler;
+        first.fused_count = match->length;
+        for (int k = 0; k < match->length; k++) {
+            first.fused_length += ops[i + k].opcode->length;
+            if (k < match->length - 1) {
+                first.lead_cycles += ops[i + k].opcode->cycles;
+            }
+        }
+        i += match->length;
+    }
+}
+
+void BlockCache::drop(Block *block)
+{
+    int first_page = block->start >> 8;
+    int last_page = (uint16_t)(block->start + block->length - 1) >> 8;
+    for (int page = first_page; ; page = (page + 1) & 0xff) {
+        page_blocks[page].removeOne(block);
+        if (page_blocks[page].isEmpty()) {
+            cpu->memory->code_pages[page] &= ~1;
+        }
+        if (page == last_page) {
+            break;
+        }
+    }
+
+    blocks[block->start] = 0;
+    retired.append(block);
+    generation++;
+}
+
+void BlockCache::invalidate(uint16_t addr)
+{
+    QVector<Block *> hit;
+
+    for (Block *block : page_blocks[addr >> 8]) {
+        if ((uint16_t)(addr - block->start) < block->length) {
+            hit.append(block);
+        }
+    }
+    for (Block *block : hit) {
+        drop(block);
+    }
+}
+
+void BlockCache::clear()
+{
+    for (int page = 0; page < 0x100; page++) {
+        while (!page_blocks[page].isEmpty()) {
+            drop(page_blocks[page].first());
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef BLOCKCACHE_H
+#define BLOCKCACHE_H
+
+#include <stdint.h>
+
+#include <QVector>
+
+#include "cpu.h"
+
+/*
+ Basic block cache
+
+ CPU::BlockEngine decodes straight-line runs of code once, into blocks of
+ micro-ops holding the handler and the InstructionDef of each instruction.
+ Executing a block skips the opcode fetch, the table lookups and the
+ per-instruction checks of CPU::step(). Handlers still read their
+ immediate operands relative to processor->pc, as with the handler table.
+
+ A block starts at the address it is first entered at, and ends after the
+ first instruction that may leave it (jumps, calls, returns, RST, PCHL and
+ HLT), before an instruction without a handler, or after max_block_length
+ instructions. Frequent sequences of micro-ops run through one fused
+ handler, see i8080fused.h.
+
+ Blocks are registered with each 256 byte page they span, and the page is
+ marked in MemoryMap::code_pages. A MemoryMap::write() to a marked page
+ drops the blocks covering the address. Dropped blocks are freed on the
+ next lookup, and `generation` stops a block that overwrote its own code
+ before it executes stale micro-ops.
+*/
+
+struct MicroOp {
+    int (*handler)(INSTDEF);
+    const InstructionDef *opcode;
+    // A fused handler for the sequence starting here, see i8080fused.h,
+    // or 0. It replaces `fused_count` micro-ops of `fused_length` bytes
+    // when the budget outlasts all but the last, `lead_cycles`.
+    int (*fused)(INSTDEF);
+    int fused_count;
+    int fused_length;
+    int lead_cycles;
+};
+
+struct Block {
+    uint16_t start;
+    uint16_t length;   // bytes of code decoded
+    QVector<MicroOp> ops;
+};
+
+class BlockCache
+{
+public:
+    BlockCache(CPU *processor);
+    ~BlockCache();
+    // Executes blocks until at least `cycles` cycles have been emulated,
+    // or the processor is disabled or reaches an unknown instruction.
+    // Returns the cycles emulated.
+    int run(int cycles);
+    // Drops every block decoded from `addr`.
+    void invalidate(uint16_t addr);
+    // Drops all blocks, e.g. when instruction handlers change.
+    void clear(void);
+private:
+    static const int max_block_length = 64;
+    Block *lookup(uint16_t pc);
+    Block *decode(uint16_t pc);
+    void drop(Block *block);
+    void fuse(Block *block);
+    CPU *cpu;
+    uint32_t generation;
+    QVector<Block *> blocks;              // by start address
+    QVector<Block *> page_blocks[0x100];  // blocks spanning each page
+    QVector<Block *> retired;             // dropped, freed on the next lookup
+};
+
+#endif // BLOCKCACHE_H
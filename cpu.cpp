@@ -1,8 +1,16 @@
 #include "cpu.h"
 #include "disassembler.h"
+#include "blockcache.h"
+#include "i8080jit.h"
+#include "i8080aot.h"
+#include "opcodeprofile.h"
+#include "memoryheatmap.h"
+#include "i8080switchengine.h"
 
 #include "i8080.h"
 
+#include <string.h>
+
 #include <QDebug>
 
 #include <QCoreApplication>
@@ -11,13 +19,28 @@ CPU::CPU(QMutex *mu, MemoryMap *mem)
 {
     mutex = mu;
     memory = mem;
-    memory->data.resize(0x10000); // 16 address pins, for 2^16=65536 (0x10000 in hex)
-                                  // possible addresses.
-                                  // Some memory cannot be written to (ROM),
-                                  // so a custom QByteArray might be necessary.
+    memory->processor = this;
     sp = 0;
     pc = 0;
     flags = 0;
+    engine = HandlerTableEngine;
+    cycle_count = 0;
+    throttled = true;
+    skip_idle_loops = true;
+    idle_cycles = 0;
+    verify_routines = false;
+    memset(routine_entries, 0, sizeof(routine_entries));
+    save_devices = 0;
+    restore_devices = 0;
+    lazy_flags = true;
+    switch_engine = RunSwitchEngine<FlatBus>;
+    aot_program = &invaders_aot;
+    memset(break_entries, 0, sizeof(break_entries));
+    breakpoint_count = 0;
+    resumed_breakpoint = -1;
+    slice_mode = 0;
+    zsp_result = 0;
+    zsp_pending = false;
 
     instruction_handlers[0x0] = noop;
     instruction_handlers[0x01] = lxi_b;
@@ -54,6 +77,7 @@ CPU::CPU(QMutex *mu, MemoryMap *mem)
     instruction_handlers[0x24] = inr_h;
     instruction_handlers[0x25] = dcr_h;
     instruction_handlers[0x26] = mvi_h;
+    instruction_handlers[0x27] = daa;
     instruction_handlers[0x29] = dad_h;
     instruction_handlers[0x2a] = lhld;
     instruction_handlers[0x2b] = dcx_h;
@@ -245,23 +269,24 @@ CPU::CPU(QMutex *mu, MemoryMap *mem)
     instruction_handlers[0xfc] = cm;
     instruction_handlers[0xfe] = cpi;
 
-    // Load instruction definitions. These are used by ::emulate() and
-    // any Disassemblers. This loads data such as how many cycles
-    // instructions take to execute.
-    QFile cpu_defs_file("://assets/8080_instructions.json");
-    cpu_defs_file.open(QIODevice::ReadOnly);
-    QByteArray cpu_instruction_defs = cpu_defs_file.readAll();
-    QJsonDocument doc(QJsonDocument::fromJson(cpu_instruction_defs));
-    QJsonObject cpu_defs = doc.object();
-    this->instruction_list = cpu_defs.value("opcodes").toVariant().toMap();
-
     this->executed_instructions = new ExecutedInstructionsListModel();
 
     disassembler = new Disassembler(this);
+
+    block_cache = new BlockCache(this);
+    memory->code_cache = block_cache;
+    jit = 0;
+    aot = 0;
+    profile = 0;
 }
 
 CPU::~CPU()
 {
+    memory->code_cache = 0;
+    delete block_cache;
+    delete jit;
+    delete aot;
+    delete profile;
     delete disassembler;
     delete this->executed_instructions;
 }
@@ -282,9 +307,147 @@ void CPU::reset()
     mutex->unlock();
 }
 
-void CPU::setCallback(uint8_t opcode, int (*cb)(CPU *, QList<QString>))
+void CPU::setCallback(uint8_t opcode, int (*cb)(INSTDEF))
 {
     instruction_callbacks[opcode] = cb;
+    block_cache->clear(); // blocks hold the previous handler
+}
+
+void CPU::addCycleEvent(uint64_t first, int period, void (*handler)(CPU *, void *), void *context)
+{
+    mutex->lock();
+    events.append(CycleEvent { first, period, handler, context });
+    mutex->unlock();
+}
+
+void CPU::addRoutine(const NativeRoutine &routine)
+{
+    routines.insert(routine.addr, routine);
+    routine_entries[routine.addr >> 3] |= 1 << (routine.addr & 7);
+    block_cache->clear(); // blocks may run through the entry
+    if (jit) {
+        jit->flush();
+    }
+}
+
+void CPU::setDeviceSnapshot(void (*save)(void), void (*restore)(void))
+{
+    save_devices = save;
+    restore_devices = restore;
+}
+
+int CPU::runRoutine(int cycles)
+{
+    // Routines access memory directly, past the watchpoint checks and
+    // the heatmap.
+    if (memory->watch_count || memory->heatmap) {
+        return 0;
+    }
+    const NativeRoutine &routine = routines[pc];
+    if (verify_routines) {
+        return verifyRoutine(routine, cycles);
+    }
+    return (*routine.native)(this, cycles);
+}
+
+void CPU::addWatchpoint(uint16_t addr, int size, int kinds)
+{
+    memory->addWatchpoint(addr, size, kinds);
+}
+
+void CPU::removeWatchpoint(uint16_t addr, int size, int kinds)
+{
+    memory->removeWatchpoint(addr, size, kinds);
+}
+
+void CPU::watchpointHit(uint16_t addr, bool write)
+{
+    qDebug() << "Watchpoint" << (write ? "write to" : "read of") << QString::number(addr, 16);
+    this->flags &= ~(1 << 6); // Disable the processor after the instruction
+    emit watchpointReached(addr, write);
+}
+
+void CPU::setHeatmap(MemoryHeatmap *heatmap)
+{
+    mutex->lock();
+    memory->setHeatmap(heatmap);
+    mutex->unlock();
+}
+
+void CPU::addBreakpoint(uint16_t addr)
+{
+    if (!isBreakpoint(addr)) {
+        break_entries[addr >> 3] |= 1 << (addr & 7);
+        breakpoint_count++;
+    }
+}
+
+void CPU::removeBreakpoint(uint16_t addr)
+{
+    if (isBreakpoint(addr)) {
+        break_entries[addr >> 3] &= ~(1 << (addr & 7));
+        breakpoint_count--;
+    }
+}
+
+/*
+ Runs the native routine, then rolls the processor, memory and devices
+ back and interprets the same number of cycles. Differences are logged,
+ the interpreted state is kept.
+*/
+int CPU::verifyRoutine(const NativeRoutine &routine, int cycles)
+{
+    // Copies, memory->data has to keep its buffer for the engines.
+    QByteArray start_mem((const char *)memory->data, 0x10000);
+    uint8_t start_regs[7] = { a, b, c, d, e, h, l };
+    uint16_t start_sp = sp, start_pc = pc;
+    int start_flags = flags;
+    if (save_devices) {
+        (*save_devices)();
+    }
+
+    int native_cycles = (*routine.native)(this, cycles);
+    if (native_cycles == 0) {
+        return 0;
+    }
+
+    QByteArray native_mem((const char *)memory->data, 0x10000);
+    uint8_t native_regs[7] = { a, b, c, d, e, h, l };
+    uint16_t native_sp = sp, native_pc = pc;
+    int native_flags = flags;
+
+    // Only the pages the routine changed, ROM storage may be read only.
+    for (int page = 0; page < 0x10000; page += 0x100) {
+        if (memcmp(memory->data + page, start_mem.constData() + page, 0x100) != 0) {
+            memcpy(memory->data + page, start_mem.constData() + page, 0x100);
+        }
+    }
+    a = start_regs[0]; b = start_regs[1]; c = start_regs[2]; d = start_regs[3];
+    e = start_regs[4]; h = start_regs[5]; l = start_regs[6];
+    sp = start_sp;
+    pc = start_pc;
+    flags = start_flags;
+    if (restore_devices) {
+        (*restore_devices)();
+    }
+
+    int executed = 0;
+    while (executed < native_cycles) {
+        int inst_cycles = step();
+        if (inst_cycles == 0) {
+            break;
+        }
+        executed += inst_cycles;
+    }
+
+    uint8_t regs[7] = { a, b, c, d, e, h, l };
+    if (executed != native_cycles || pc != native_pc || sp != native_sp || flags != native_flags ||
+            memcmp(regs, native_regs, sizeof(regs)) != 0 || memcmp(memory->data, native_mem.constData(), 0x10000) != 0) {
+        qWarning() << "Native routine" << routine.name << "at" << QString::number(routine.addr, 16)
+                   << "differs from the ROM code it replaces, cycles" << native_cycles << "instead of" << executed;
+    }
+
+    return executed;
 }
 
 void CPU::interrupt(int memory_vector) {
@@ -292,110 +455,455 @@ void CPU::interrupt(int memory_vector) {
     // PUSH PC
     // Set PC
     // DI
-    this->memory->data[this->sp-1] = (this->pc&0xFF00)>>8;
-    this->memory->data[this->sp-2] = (this->pc&0xFF);
+    this->memory->write(this->sp-1, (this->pc&0xFF00)>>8);
+    this->memory->write(this->sp-2, (this->pc&0xFF));
     this->sp -= 2;
     this->pc = 8 * memory_vector;
     this->flags &= ~(1<<5);
+    if (profile) {
+        profile->restart();
+    }
 }
 
-void CPU::emulate() {
-    int nowms = 0;
-    int mspassed = 0;
-    float roll_avg_mspassed = 0;
-    int mstoint = 0;
-    int whichinterrupt = 1;
-    bool interrupts_enabled = true;
-    forever {
-        mutex->lock();
+int CPU::currentMode() const
+{
+    int mode = 0;
+    if (this->flags&(1 << 8)) {
+        mode |= CaptureMode;
+    }
+    if (this->flags&(1 << 7)) {
+        mode |= DiagnosticMode;
+    }
+    if (breakpoint_count) {
+        mode |= BreakpointMode;
+    }
+    if (profile) {
+        mode |= ProfileMode;
+    }
+    if (memory->heatmap) {
+        mode |= HeatmapMode;
+    }
+    return mode;
+}
 
-        if ( QThread::currentThread()->isInterruptionRequested() || !(this->flags&(1<<6)) ) {
-            mutex->unlock();
-            return;
-        }
+int CPU::step()
+{
+    static int (CPU::*const steps[ModeCount])(void) = {
+        &CPU::step<0>,  &CPU::step<1>,  &CPU::step<2>,  &CPU::step<3>,
+        &CPU::step<4>,  &CPU::step<5>,  &CPU::step<6>,  &CPU::step<7>,
+        &CPU::step<8>,  &CPU::step<9>,  &CPU::step<10>, &CPU::step<11>,
+        &CPU::step<12>, &CPU::step<13>, &CPU::step<14>, &CPU::step<15>,
+        &CPU::step<16>, &CPU::step<17>, &CPU::step<18>, &CPU::step<19>,
+        &CPU::step<20>, &CPU::step<21>, &CPU::step<22>, &CPU::step<23>,
+        &CPU::step<24>, &CPU::step<25>, &CPU::step<26>, &CPU::step<27>,
+        &CPU::step<28>, &CPU::step<29>, &CPU::step<30>, &CPU::step<31>
+    };
+    return (this->*steps[slice_mode])();
+}
+
+template<int Mode>
+int CPU::step()
+{
+    QString disassembly;
+    QList<QVariant> opcode_with_state;
+    int cycles = 0;
+
+    if (Mode & HeatmapMode) {
+        memory->heatmap->executed(this->pc);
+    }
+
+    uint8_t opcode_val = (unsigned char)(this->memory->read(this->pc));
+    const InstructionDef &opcode = i8080_instructions[opcode_val];
+
+    if (Mode & HeatmapMode) {
+        memory->heatmap->decoded(opcode.length);
+    }
+
+    // The disassembler reports unknown opcodes and halts the
+    // processor if Disassembly/HaltAtUnknownInstruction is set.
+    // Otherwise it is only needed for capturing instructions.
+    if (!opcode.defined) {
+        disassembly = disassembler->Disassemble(this->pc).value(0);
+    } else if (Mode & CaptureMode) {
+        char text[Disassembler::text_size];
+        disassembler->Disassemble(this->pc, text);
+        disassembly = QString::fromLatin1(text);
+    }
+
+    // Last check if the processor has been disabled,
+    // e.g. by a machine or disassembler.
+    if (!(this->flags&(1<<6))) {
+        return 0;
+    }
+
+    if (Mode & ProfileMode) {
+        profile->record(opcode_val);
+    }
 
-        // determine how much time has passed since the last iteration
-        // determine how many cycles could be performed in that amount of time.
-        // emulate instructions until that many cycles have been exhausted.
+    // Diagnostic Mode expects a string printing function at 0x5
+    if ((Mode & DiagnosticMode) && opcode_val == 0xcd &&
+            this->memory->read(this->pc+1) == 5 && this->memory->read(this->pc+2) == 0) {
+        DiagnosticPrint(this);
+        cycles += opcode.cycles;
+    } else if (this->engine == SwitchEngine) {
+        cycles += (*switch_engine)(this, 1); // a single instruction
+    } else {
+        // big array of byte values to instruction callbacks...
+        int (*inst_handler)(INSTDEF) = this->instruction_handlers[opcode_val];
+        int (*inst_cb)(INSTDEF) = this->instruction_callbacks[opcode_val];
 
-        if (!this->now.isValid()) {
-            this->now.start();
+        if (inst_handler) {
+            cycles += (*inst_handler)(this, opcode); // cpu provided instruction handler
+        } else if (inst_cb) {
+            cycles += (*inst_cb)(this, opcode); // machine provided instruction handler callback
+                                                // (eg, for IN/OUT instructions, specific to the machine hardware)
+        } else {
+            qDebug() << "Unknown instruction" << disassembler->Disassemble(this->pc);
         }
+    }
+
+    if (Mode & CaptureMode) {
+        opcode_with_state.append(QVariant(disassembly));
+        opcode_with_state.append(QVariant(this->pc));
+        opcode_with_state.append(QVariant(this->sp));
+        opcode_with_state.append(QVariant(this->a));
+        opcode_with_state.append(QVariant(this->b));
+        opcode_with_state.append(QVariant(this->c));
+        opcode_with_state.append(QVariant(this->d));
+        opcode_with_state.append(QVariant(this->e));
+        opcode_with_state.append(QVariant(this->h));
+        opcode_with_state.append(QVariant(this->l));
+        opcode_with_state.append(QVariant(this->flags));
+
+        executed_instructions->addInstruction(opcode_with_state);
+    }
 
-        nowms = this->now.elapsed();
-        interrupts_enabled = (this->flags&(1<<5));
+    return cycles;
+}
 
-        if (mspassed == 0) {
-          mspassed = nowms;
-          mstoint = nowms + 16;
+int CPU::execute(int cycles)
+{
+    // Slices without a mode run on the engine.
+    if (slice_mode == 0) {
+        if (this->engine == SwitchEngine) {
+            return (*switch_engine)(this, cycles);
+        }
+        if (this->engine == BlockEngine) {
+            return block_cache->run(cycles);
+        }
+        if (this->engine == JitEngine) {
+            if (!jit) {
+                jit = new Jit(this);
+            }
+            return jit->run(cycles);
+        }
+        if (this->engine == StaticEngine) {
+            if (!aot) {
+                aot = new Aot(this, *aot_program);
+            }
+            return aot->run(cycles);
         }
+    }
+
+    static int (CPU::*const loops[ModeCount])(int cycles) = {
+        &CPU::executeLoop<0>,  &CPU::executeLoop<1>,  &CPU::executeLoop<2>,  &CPU::executeLoop<3>,
+        &CPU::executeLoop<4>,  &CPU::executeLoop<5>,  &CPU::executeLoop<6>,  &CPU::executeLoop<7>,
+        &CPU::executeLoop<8>,  &CPU::executeLoop<9>,  &CPU::executeLoop<10>, &CPU::executeLoop<11>,
+        &CPU::executeLoop<12>, &CPU::executeLoop<13>, &CPU::executeLoop<14>, &CPU::executeLoop<15>,
+        &CPU::executeLoop<16>, &CPU::executeLoop<17>, &CPU::executeLoop<18>, &CPU::executeLoop<19>,
+        &CPU::executeLoop<20>, &CPU::executeLoop<21>, &CPU::executeLoop<22>, &CPU::executeLoop<23>,
+        &CPU::executeLoop<24>, &CPU::executeLoop<25>, &CPU::executeLoop<26>, &CPU::executeLoop<27>,
+        &CPU::executeLoop<28>, &CPU::executeLoop<29>, &CPU::executeLoop<30>, &CPU::executeLoop<31>
+    };
+    return (this->*loops[slice_mode])(cycles);
+}
 
-        // generate interrupts
-        if (interrupts_enabled && (nowms > mstoint))  {
-            this->interrupt(whichinterrupt);
-            whichinterrupt = (whichinterrupt == 1)?2:1;
-            mstoint = nowms + 8;
+// Executes instructions one at a time through the handler table.
+template<int Mode>
+int CPU::executeLoop(int cycles)
+{
+    int executed = 0;
+
+    while (executed < cycles && (this->flags&(1 << 6))) {
+        if (Mode & BreakpointMode) {
+            if (isBreakpoint(this->pc) && this->pc != resumed_breakpoint) {
+                qDebug() << "Breakpoint at" << QString::number(this->pc, 16);
+                resumed_breakpoint = this->pc;
+                this->flags &= ~(1 << 6); // Disable the processor
+                break;
+            }
+            resumed_breakpoint = -1;
+        }
+        if (!(Mode & CaptureMode) && hasRoutine(this->pc)) {
+            int routine_cycles = runRoutine(cycles - executed);
+            if (routine_cycles > 0) {
+                executed += routine_cycles;
+                continue;
+            }
         }
+        int inst_cycles = step<Mode>();
+        if (inst_cycles == 0) {
+            break; // Unknown instruction, let the caller re-check state.
+        }
+        executed += inst_cycles;
+    }
 
-        //mutex->unlock();
+    return executed;
+}
 
-        // i8080 clocked at 2MHz.
-        // 2M cycles / 1 sec, or 2 cycles / 1MS
-        // so 2*(elapsed ms).
+// True for instructions an idle loop may contain. They neither write
+// memory nor touch the stack, I/O or interrupts, so their effect only
+// depends on the registers and on memory nobody writes while the loop runs.
+static bool IdleLoopInstruction(uint8_t op)
+{
+    if (!i8080_instructions[op].defined) {
+        return false;
+    }
+    if (op >= 0x40 && op < 0x80) {
+        return (op & 0x38) != 0x30; // MOV r,r and MOV r,M, but not MOV M,r or HLT
+    }
+    if (op >= 0x80 && op < 0xc0) {
+        return true; // ALU ops with a register or M
+    }
 
-        int cycles = 0;
-        //int cycles_elapsed = (2*(nowms-mspassed));
-        QList<QString> opcode;
-        QList<QVariant> opcode_with_state;
+    switch (op) {
+    case 0x00:                                     // NOP
+    case 0x01: case 0x11: case 0x21: case 0x31:    // LXI
+    case 0x03: case 0x13: case 0x23: case 0x33:    // INX
+    case 0x0b: case 0x1b: case 0x2b: case 0x3b:    // DCX
+    case 0x04: case 0x0c: case 0x14: case 0x1c: case 0x24: case 0x2c: case 0x3c: // INR r
+    case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x3d: // DCR r
+    case 0x06: case 0x0e: case 0x16: case 0x1e: case 0x26: case 0x2e: case 0x3e: // MVI r
+    case 0x09: case 0x19: case 0x29: case 0x39:    // DAD
+    case 0x0a: case 0x1a: case 0x3a: case 0x2a:    // LDAX, LDA, LHLD
+    case 0x07: case 0x0f: case 0x17: case 0x1f:    // RLC, RRC, RAL, RAR
+    case 0x2f: case 0x37: case 0x3f:               // CMA, STC, CMC
+    case 0xeb:                                     // XCHG
+    case 0xc6: case 0xce: case 0xd6: case 0xde:    // ADI, ACI, SUI, SBI
+    case 0xe6: case 0xee: case 0xf6: case 0xfe:    // ANI, XRI, ORI, CPI
+        return true;
+    default:
+        return false;
+    }
+}
 
+// True if the instruction at the processor's pc reads data from a page
+// marked in MemoryMap::indirect_pages, a device, a mirror or a watched
+// page, which may read differently on every pass.
+static bool ReadsIndirectPage(const CPU *processor)
+{
+    const MemoryMap *memory = processor->memory;
+    const uint8_t *mem = memory->data;
+    uint8_t op = mem[processor->pc];
+    uint16_t addr;
+    int size = 1;
+
+    if (op >= 0x40 && op < 0xc0 && (op & 7) == 6) {
+        addr = (processor->h << 8) | processor->l; // MOV r,M and ALU ops with M
+    } else if (op == 0x0a) {
+        addr = (processor->b << 8) | processor->c; // LDAX B
+    } else if (op == 0x1a) {
+        addr = (processor->d << 8) | processor->e; // LDAX D
+    } else if (op == 0x3a || op == 0x2a) {
+        addr = (mem[(uint16_t)(processor->pc+2)] << 8) | mem[(uint16_t)(processor->pc+1)]; // LDA, LHLD
+        size = (op == 0x2a) ? 2 : 1;
+    } else {
+        return false;
+    }
+    for (int i = 0; i < size; i++) {
+        if (memory->indirect_pages[(uint16_t)(addr + i) >> 8]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Number of instructions of a loop through `pc` made of IdleLoopInstruction()s
+// and closed by a JMP or Jcc back to its start, or 0. Other Jccs may leave it.
+// Code is read from the storage, as the engines fetch it, so a loop on a
+// page that does not read its own storage is not one.
+static int IdleLoopLength(const MemoryMap *memory, uint16_t pc)
+{
+    static const int max_length = 8;
+    const uint8_t *mem = memory->data;
+    uint16_t start = 0, end = 0, addr = pc;
+    bool closed = false;
+
+    // Find the jump closing the loop.
+    for (int i = 0; i < max_length && !closed; i++) {
+        uint8_t op = mem[addr];
+        if (op == 0xc3 || (op & 0xc7) == 0xc2) {
+            uint16_t target = (uint16_t)((mem[(uint16_t)(addr+2)] << 8) | mem[(uint16_t)(addr+1)]);
+            if (target <= pc && pc <= addr) {
+                start = target;
+                end = addr;
+                closed = true;
+            } else if (op == 0xc3) {
+                return 0;
+            }
+        } else if (!IdleLoopInstruction(op)) {
+            return 0;
+        }
+        addr += i8080_instructions[op].length;
+    }
+    if (!closed) {
+        return 0;
+    }
+
+    // Count it from its start, pc has to be on an instruction boundary.
+    bool on_boundary = false;
+    int length = 0;
+    for (addr = start; addr != end; length++) {
+        uint8_t op = mem[addr];
+        if (length == max_length || op == 0xc3 || ((op & 0xc7) != 0xc2 && !IdleLoopInstruction(op))) {
+            return 0;
+        }
+        if (memory->indirect_pages[addr >> 8] ||
+                memory->indirect_pages[(uint16_t)(addr + i8080_instructions[op].length - 1) >> 8]) {
+            return 0;
+        }
+        on_boundary |= addr == pc;
+        addr += i8080_instructions[op].length;
+        if (addr > end) {
+            return 0;
+        }
+    }
+    on_boundary |= addr == pc;
+    if (memory->indirect_pages[end >> 8] || memory->indirect_pages[(uint16_t)(end + 2) >> 8]) {
+        return 0;
+    }
 
-        opcode = disassembler->Disassemble(this->pc);
+    return (on_boundary && length < max_length) ? length + 1 : 0;
+}
 
-        //mutex->lock();
+/*
+ Fast-forwards an idle loop, e.g. the Space Invaders main loop waiting
+ for the interrupt handlers to update work RAM.
+
+ If pc is in a loop that passes IdleLoopLength(), one pass through it is
+ interpreted. If that pass returns to pc with exactly the same registers
+ and flags, and read no device, mirror or watched page, every further
+ pass does the same: the loop writes nothing, and nothing else writes
+ memory before run() fires the next event. So
+ whole passes are skipped up to the last one that still ends before
+ `cycles`, and run() executes the rest. The instructions execute() stops
+ at and the state are the same as without skipping.
+
+ Returns the cycles of the interpreted and the skipped passes, or 0 if
+ pc is not in an idle loop.
+*/
+int CPU::skipIdleLoop(int cycles)
+{
+    int length = IdleLoopLength(memory, pc);
+    if (length == 0) {
+        return 0;
+    }
 
-        // Last check if the processor has been disabled,
-        // e.g. by a machine or disassembler.
-        if (!(this->flags&(1<<6))) {
-            mutex->unlock();
-            return;
+    uint8_t regs[7] = { a, b, c, d, e, h, l };
+    uint16_t start_sp = sp, start_pc = pc;
+    int start_flags = flags;
+    int executed = 0;
+    bool indirect = false;
+
+    for (int i = 0; i < length; i++) {
+        indirect = indirect || ReadsIndirectPage(this);
+        int inst_cycles = step();
+        executed += inst_cycles;
+        if (inst_cycles == 0 || executed >= cycles) {
+            return executed;
         }
+    }
 
-        // big array of byte values to instruction callbacks...
-        uint8_t opcode_val = (unsigned char)(this->memory->data.at(this->pc));
-        int (*inst_handler)(CPU*, QList<QString>) = this->instruction_handlers[opcode_val];
-        int (*inst_cb)(CPU*, QList<QString>) = this->instruction_callbacks[opcode_val];
+    uint8_t now[7] = { a, b, c, d, e, h, l };
+    if (indirect || pc != start_pc || sp != start_sp || flags != start_flags || memcmp(regs, now, sizeof(regs)) != 0) {
+        return executed;
+    }
 
-        if (inst_handler) {
-          cycles += (*inst_handler)(this, opcode); // cpu provided instruction handler
-        } else if (inst_cb) {
-            cycles += (*inst_cb)(this, opcode); // machine provided instruction handler callback
-                                                // (eg, for IN/OUT instructions, specific to the machine hardware)
-        } else {
-            qDebug() << "Unknown instruction" << opcode;
+    int skipped = (cycles - executed - 1) / executed * executed;
+    idle_cycles += skipped;
+    return executed + skipped;
+}
+
+int CPU::run(int cycles)
+{
+    int executed = 0;
+
+    mutex->lock();
+
+    // Modes toggled by the UI take effect here, between slices.
+    slice_mode = currentMode();
+
+    while (executed < cycles && (this->flags&(1 << 6))) {
+        // Fire due events, and stop the next batch of
+        // instructions at the earliest pending event.
+        int budget = cycles - executed;
+        for (CycleEvent &event : events) {
+            while (event.next <= cycle_count) {
+                event.next += event.period;
+                (*event.handler)(this, event.context);
+            }
+            if (event.next - cycle_count < (uint64_t)budget) {
+                budget = (int)(event.next - cycle_count);
+            }
         }
 
-        if (this->flags&(1 << 8)) {
-            opcode_with_state.clear();
-            opcode_with_state.append(QVariant(opcode.at(0)));
-            opcode_with_state.append(QVariant(this->pc));
-            opcode_with_state.append(QVariant(this->sp));
-            opcode_with_state.append(QVariant(this->a));
-            opcode_with_state.append(QVariant(this->b));
-            opcode_with_state.append(QVariant(this->c));
-            opcode_with_state.append(QVariant(this->d));
-            opcode_with_state.append(QVariant(this->e));
-            opcode_with_state.append(QVariant(this->h));
-            opcode_with_state.append(QVariant(this->l));
-            opcode_with_state.append(QVariant(this->flags));
-
-            executed_instructions->addInstruction(opcode_with_state);
+        int ran = 0;
+        if (skip_idle_loops && !(slice_mode & (CaptureMode | BreakpointMode | HeatmapMode))) {
+            ran = skipIdleLoop(budget);
+        }
+        if (ran < budget) {
+            ran += execute(budget - ran);
+        }
+        if (ran == 0) {
+            break;
         }
+        executed += ran;
+        cycle_count += ran;
+    }
 
-        roll_avg_mspassed = ((1.0 / 25) * (nowms - mspassed)) + (1.0 - (1.0 / 25)) * roll_avg_mspassed;
+    mutex->unlock();
 
-        mspassed = nowms;
+    return executed;
+}
+
+void CPU::emulate() {
+    uint64_t start_cycles = 0;
+    forever {
+        // The lock, interruption requests and the clock are only
+        // checked between slices, run() holds the lock for a slice.
+        mutex->lock();
+
+        if ( QThread::currentThread()->isInterruptionRequested() || !(this->flags&(1<<6)) ) {
+            this->clock.invalidate();
+            mutex->unlock();
+            return;
+        }
+
+        // Interrupts are scheduled by the machine in emulated cycles,
+        // so the wall clock is only used to pace emulation.
+        if (!this->clock.isValid()) {
+            this->clock.start();
+            start_cycles = this->cycle_count;
+        }
+
+        bool throttle = this->throttled;
+        qint64 emulated_ns = (qint64)(this->cycle_count - start_cycles) * (1000000000 / clock_hz);
 
         mutex->unlock();
+
+        if (throttle) {
+            qint64 ahead_ns = emulated_ns - this->clock.nsecsElapsed();
+            if (ahead_ns > 1000000) {
+                QThread::usleep(ahead_ns / 1000);
+            } else if (ahead_ns < -100000000) {
+                // The host fell far behind, e.g. while debugging,
+                // don't try to catch up with a burst.
+                this->clock.start();
+                start_cycles = this->cycle_count;
+            }
+        }
+
+        run(slice_cycles);
     }
 
 }
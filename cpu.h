@@ -5,30 +5,312 @@
 #include <QThread>
 #include <QMutex>
 #include <QMap>
-#include <QTime>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QVariant>
 #include <QVector>
+#include <QByteArray>
+
+#include <atomic>
 
 #include "executedinstructionslistmodel.h"
+#include "i8080instructiontable.h"
+#include "memoryexport.h"
 
-#define INSTDEF CPU *processor, QList<QString> opcode
+#define INSTDEF CPU *processor, const InstructionDef &opcode
 
 class Disassembler;
+class BlockCache;
+class Jit;
+class Aot;
+struct AotProgram;
+class OpcodeProfile;
+class CPU;
+class MemorySnapshot;
+class RomImage;
+class MemoryHeatmap;
+
+/*
+ Memory map
+
+ 64KB of page aligned storage, reached through a table of 256 pages of
+ 256 bytes. Each page has a read and a write pointer into the storage:
+
+   RAM     both pointers at the page's own storage
+   ROM     a read pointer only, writes are dropped
+   mirror  both pointers at the storage of the page it mirrors
+   open    no pointers, reads return 0xff and writes are dropped
+
+ A device mapped with mapDevice() over any range of addresses takes the
+ reads and writes to it, through its own functions. The pages it covers
+ lose both pointers, and their accesses look the device up in the page's
+ own short list, so only those pages pay for the indirect call. The
+ addresses of those pages that no device covers still reach the page's
+ RAM, ROM, mirror or open bus.
+
+ Every page starts as RAM, diagnostic mode runs on that. The machine maps
+ its ROM and mirrors with mapRom() and mirror(). The storage of a
+ RomImage mapped with mapRom() may be shared with other machines and
+ read only, nothing writes the storage of ROM directly.
+
+ The engines that address the storage directly, through `data`, fetch
+ opcodes from it, so code runs from RAM and ROM at their own addresses.
+ Pages that are not plain RAM are marked in code_pages, so those engines
+ leave writes to them to write(), as they do for writes to code, and
+ mirrors and devices in indirect_pages, for their data reads. Code is
+ marked and invalidated at its storage address, which writes through a
+ mirror reach as well.
+
+ Writes to the pages given to trackWrites() set a bit per byte in
+ `dirty`, which any thread takes with takeDirty(), even while the
+ processor runs, e.g. to copy video RAM only when it was written.
+
+ A page holding a watchpoint loses its read or write pointer and is
+ marked in indirect_pages or code_pages, so that every engine reaches it
+ through the checks in readSlow() and writeSlow(). Other pages keep
+ their direct access, watchpoints cost nothing while they are not hit.
+ While a MemoryHeatmap is set every page is treated that way, and
+ readSlow() and writeSlow() count the accesses.
+
+ A MemorySnapshot shares the storage's pages. Taking one marks every
+ writable page in code_pages and drops its write pointer. The first
+ write to a page then copies it for the snapshots sharing it, and gives
+ the page its write pointer back. ROM is never written, so it is never
+ copied.
+
+ Created with an export name, the map keeps a POSIX shared memory
+ segment other processes read while the processor runs, and
+ exportStorage() copies the storage into it, see memoryexport.h.
+*/
+
+/*
+ A memory mapped device, see MemoryMap::mapDevice(). `read` and `write`
+ get the device's `context` and the address as the processor put it on
+ the bus. Either may be 0, for a device that reads as an open bus or
+ ignores writes.
+*/
+struct MemoryDevice {
+    uint16_t addr;
+    int size;
+    uint8_t (*read)(void *context, uint16_t addr);
+    void (*write)(void *context, uint16_t addr, uint8_t val);
+    void *context;
+};
 
 class MemoryMap {
 public:
-    QByteArray data;
+    enum WatchKind { WatchRead = 1, WatchWrite = 2 };
+
+    uint8_t *data;               // the storage, 0x10000 bytes aligned to a page
+    const uint8_t *read_pages[0x100];  // direct reads, 0 for open, device, watched and counted pages
+    uint8_t *write_pages[0x100];       // direct writes, 0 for ROM, open, device, watched, counted and shared pages
+    BlockCache *code_cache;      // pre-decoded code to invalidate on writes, or 0
+    Jit *jit;                    // translated code to invalidate on writes, or 0
+    Aot *aot;                    // recompiled ROM to invalidate on writes, or 0
+    CPU *processor;              // told about watchpoint hits, see CPU::watchpointHit()
+    MemoryHeatmap *heatmap;      // counting every access, see CPU::setHeatmap(), or 0
+    uint8_t code_pages[0x100];   // bit 0 pre-decoded, bit 1 translated, bit 2 recompiled code in a 256 byte page,
+                                 // bit 3 not plain RAM, bit 4 writes tracked in dirty, bit 5 write watched or counted,
+                                 // bit 6 storage shared with a snapshot
+    uint8_t indirect_pages[0x100]; // bit 0 reads do not reach the page's own storage, bit 1 read watched or counted
+    uint32_t code_writes;        // writes to pages marked in code_pages
+    std::atomic<uint64_t> dirty[0x10000 / 64]; // storage written since taken, bit addr & 63 of word addr >> 6
 
-    MemoryMap();
+    // Keeps the storage in the shared memory segment `export_name`, e.g.
+    // "/ee-ram", or privately when empty or the host has none.
+    explicit MemoryMap(const QString &export_name = QString());
     ~MemoryMap();
-    //ReadStuff
-    //WriteStuff
+
+    // Maps the pages of `size` bytes at `addr`, a multiple of 256 bytes.
+    void mapRam(uint16_t addr, int size);
+    void mapRom(uint16_t addr, int size);
+    // Maps `image` as ROM at `addr`, a multiple of 256 bytes, sharing
+    // its pages where the host allows, see RomImage.
+    void mapRom(uint16_t addr, const RomImage *image);
+    void unmap(uint16_t addr, int size);
+    // Maps `read` and `write` over the `size` bytes at `addr`, any range
+    // of addresses up to 0x10000, on top of the pages' mapping. A device
+    // mapped later over the same addresses takes precedence. Mapping the
+    // pages again with the functions above drops their devices. Call
+    // with the processor stopped or its mutex held.
+    void mapDevice(uint16_t addr, int size,
+                   uint8_t (*read)(void *context, uint16_t addr),
+                   void (*write)(void *context, uint16_t addr, uint8_t val),
+                   void *context);
+    // Maps the pages at `addr` onto the storage of those at `target`,
+    // repeating the `size` bytes at `target` up to `end` (exclusive, up to 0x10000).
+    void mirror(uint16_t addr, int end, uint16_t target, int size);
+
+    // Tracks writes to the storage of the `size` bytes at `addr`, through
+    // any page mapped onto it. The bytes start out dirty. Call after
+    // mapping and before the processor runs, it changes code_pages.
+    void trackWrites(uint16_t addr, int size);
+    // Copies the dirty bits of the `size` bytes at `addr`, both multiples
+    // of 64, to `bits` and clears them. Safe while the processor runs.
+    void takeDirty(uint16_t addr, int size, uint64_t *bits);
+
+    // Reports `kinds` of accesses, WatchRead and WatchWrite, to the `size`
+    // bytes at `addr` to the processor. Call with the processor stopped or
+    // its mutex held.
+    void addWatchpoint(uint16_t addr, int size, int kinds);
+    void removeWatchpoint(uint16_t addr, int size, int kinds);
+    int watch_count;             // watched addresses, counting reads and writes separately
+    // Counts every access in `heatmap`, or stops with 0. Call with the
+    // processor stopped or its mutex held.
+    void setHeatmap(MemoryHeatmap *heatmap);
+    inline bool isWatched(uint16_t addr, int kind) const {
+        return watch_entries[kind >> 1][addr >> 3] & (1 << (addr & 7));
+    }
+
+    // Writes `snapshot` back into the storage, which shares its pages
+    // again. Call with the processor stopped or its mutex held.
+    void restore(MemorySnapshot *snapshot);
+
+    // Copies the storage into the exported segment, see memoryexport.h,
+    // with the processor's mutex held, e.g. as the machine completes a
+    // frame. Does nothing without an export.
+    void exportStorage(uint64_t cycle_count);
+
+    inline uint8_t read(uint16_t addr) const {
+        const uint8_t *page = read_pages[addr >> 8];
+        if (page) {
+            return page[addr & 0xff];
+        }
+        return readSlow(addr);
+    }
+
+    // CPU writes go through here, so that pre-decoded
+    // code overwritten by the write is dropped.
+    inline void write(uint16_t addr, uint8_t val) {
+        uint8_t *page = write_pages[addr >> 8];
+        if (page) {
+            page[addr & 0xff] = val;
+            if (code_pages[addr >> 8]) {
+                wrote(page, addr);
+            }
+        } else {
+            writeSlow(addr, val);
+        }
+    }
+
+    // Sets the dirty bit of `addr` in the storage, for engines that write
+    // tracked pages directly. Only the processor's thread writes, a plain
+    // load and store is enough. A bit taken in between is set again,
+    // never lost.
+    inline void markDirty(uint16_t addr) {
+        std::atomic<uint64_t> &word = dirty[addr >> 6];
+        word.store(word.load(std::memory_order_relaxed) | ((uint64_t)1 << (addr & 63)), std::memory_order_relaxed);
+    }
+private:
+    friend class MemorySnapshot;
+    // Code runs from the storage at its own address, so a write through
+    // a mirror reaches the code of the page it mirrors.
+    inline void wrote(uint8_t *page, uint16_t addr) {
+        const uint16_t storage = (uint16_t)(page - data) + (addr & 0xff);
+        if (code_pages[storage >> 8] & 7) {
+            invalidateCode(storage);
+        }
+        if (code_pages[addr >> 8] & 16) {
+            markDirty(storage);
+        }
+    }
+    void mapPages(uint16_t addr, int size, const uint8_t *read, uint8_t *write);
+    void updatePage(int page);
+    inline const MemoryDevice *deviceAt(uint16_t addr) const {
+        const QVector<MemoryDevice *> &page = page_devices[addr >> 8];
+        for (int i = page.size() - 1; i >= 0; i--) {
+            if ((uint16_t)(addr - page[i]->addr) < page[i]->size) {
+                return page[i];
+            }
+        }
+        return 0;
+    }
+    uint8_t readSlow(uint16_t addr) const;
+    void writeSlow(uint16_t addr, uint8_t val);
+    void invalidateCode(uint16_t addr);
+    void share(MemorySnapshot *snapshot);
+    void unshare(int storage_page);
+    const uint8_t *mapped_read[0x100];  // the mapping, read_pages without watchpoints
+    uint8_t *mapped_write[0x100];
+    uint8_t watch_entries[2][0x10000 / 8];  // bit per watched address, reads and writes
+    QVector<MemorySnapshot *> snapshots;
+    uint8_t shared_pages[0x100];  // 1 where a snapshot may still share the storage page
+    QVector<MemoryDevice *> devices;           // every device mapped, owned
+    QVector<MemoryDevice *> page_devices[0x100]; // the devices covering part of each page, in mapping order
+    MemoryExportHeader *export_header;  // at the start of the exported segment, or 0
+    QByteArray export_name;
 };
 
+/*
+ Copy-on-write snapshot of the storage of a MemoryMap
+
+ Taking one copies nothing, see MemoryMap. A page written after the
+ snapshot was taken is copied once, for every snapshot sharing it at the
+ time, so frequent snapshots cost the pages written between them. Take,
+ restore and read snapshots on the processor's thread, or with the
+ processor stopped or its mutex held. A snapshot must not outlive its
+ MemoryMap.
+*/
+class MemorySnapshot {
+public:
+    explicit MemorySnapshot(MemoryMap *memory);
+    ~MemorySnapshot();
+
+    // The storage byte at `addr` when the snapshot was taken, not
+    // through the page table.
+    inline uint8_t read(uint16_t addr) const {
+        const QByteArray &page = pages[addr >> 8];
+        if (page.isNull()) {
+            return memory->data[addr];
+        }
+        return page.at(addr & 0xff);
+    }
+    // Copies the 64KB of storage to `storage`.
+    void copy(uint8_t *storage) const;
+    // Pages copied since the snapshot was taken, they may be shared with
+    // later snapshots.
+    int copiedPages() const;
+private:
+    friend class MemoryMap;
+    MemoryMap *memory;
+    QByteArray pages[0x100];     // the page as it was, null while the storage still holds it
+};
+
+
+/*
+ An event fired by CPU::run() every `period` cycles, the first time
+ once cycle_count reaches `next`. Events are fired between instructions,
+ so they are delayed by at most the length of one instruction but never
+ drift, `next` advances by exactly `period`. `handler` gets the event's
+ `context`, e.g. the machine's device it updates.
+*/
+struct CycleEvent {
+    uint64_t next;
+    int period;
+    void (*handler)(CPU *processor, void *context);
+    void *context;
+};
+
+/*
+ A native replacement for a ROM routine, run instead of the instructions
+ at `addr` when the engine dispatches pc == addr, see CPU::addRoutine().
+
+ `native` gets the cycles left before the engine has to stop. It either
+ returns 0 without changing anything, and the ROM code is interpreted,
+ or it executes a whole number of instructions as the ROM code would:
+ registers, flags, pc, sp, every memory write including the stack and
+ devices end up the same, and it returns their cycles. It may only stop
+ where the interpreter would not have stopped earlier, i.e. its cycles
+ must not exceed the cycles it was given.
+*/
+struct NativeRoutine {
+    uint16_t addr;
+    const char *name;
+    int (*native)(CPU *processor, int cycles);
+};
 
 class CPU : public QObject
 {
@@ -76,28 +358,135 @@ class CPU : public QObject
  direct addressing: LDA 1234H (note: in the machine code the low byte precedes the high byte of the address)
 */
 public:
+    /*
+     Execution engines
+
+     HandlerTableEngine calls one instruction_handlers function per instruction.
+     SwitchEngine runs the whole opcode space in a single switch, see
+     i8080switchengine.h. BlockEngine runs the handlers from pre-decoded
+     basic blocks, see blockcache.h. JitEngine translates hot blocks into
+     native code on x86-64 hosts, see i8080jit.h. StaticEngine runs the ROM
+     recompiled ahead of time into C++, see i8080aot.h. All share the
+     machine's instruction_callbacks.
+    */
+    enum Engine { HandlerTableEngine, SwitchEngine, BlockEngine, JitEngine, StaticEngine };
+
+    /*
+     Modes
+
+     Instrumentation a run() slice executes with, taken from flags, the
+     breakpoints and the profile when the slice starts. The interpreted
+     loop and step() are instantiated for every combination, so that a
+     mode costs nothing while it is off. Slices without any mode run on
+     the engine, the others go through the handler table one instruction
+     at a time.
+    */
+    enum Mode {
+        CaptureMode    = 1 << 0, // flags bit 8, instructions are disassembled and captured
+        DiagnosticMode = 1 << 1, // flags bit 7, CALL 5 prints like CP/M, see DiagnosticPrint()
+        BreakpointMode = 1 << 2, // breakpoints are set
+        ProfileMode    = 1 << 3, // profile records opcode sequences
+        HeatmapMode    = 1 << 4, // memory->heatmap counts accesses, see memoryheatmap.h
+        ModeCount      = 1 << 5
+    };
+
     uint8_t a, b, c, d,
             e, h, l;
     uint16_t sp, pc;
     int flags;
-    QMap<QString, QVariant> instruction_list;
+    Engine engine;
+    uint64_t cycle_count; // cycles emulated since power on
+    bool throttled;       // pace emulate() at clock_hz, or run at max speed
+    bool skip_idle_loops; // fast-forward spin loops to the end of a run() batch
+    uint64_t idle_cycles; // cycles fast-forwarded, part of cycle_count
+    bool verify_routines; // interpret native routines as well and compare, see runRoutine()
+    bool lazy_flags;      // SwitchEngine defers Z, S and P until they are read
+    int (*switch_engine)(CPU *processor, int cycles); // SwitchEngine instance for the machine's bus
+    uint8_t zsp_result;   // last result Z, S and P derive from while zsp_pending
+    bool zsp_pending;
     MemoryMap *memory;
+    BlockCache *block_cache;
+    Jit *jit;             // created on the first JitEngine slice
+    Aot *aot;             // created on the first StaticEngine slice
+    const AotProgram *aot_program; // what StaticEngine runs, invaders_aot unless set before its first slice
+    OpcodeProfile *profile; // opcode sequences step() executed, or 0
     Disassembler *disassembler;
     ExecutedInstructionsListModel *executed_instructions;
     CPU(QMutex *mu, MemoryMap *mem);
     ~CPU();
     void interrupt(int memory_vector);
     void setCallback(uint8_t opcode, int (*cb)(INSTDEF));
+    void addCycleEvent(uint64_t first, int period, void (*handler)(CPU *processor, void *context), void *context);
+    // Runs `routine` instead of the ROM code at routine.addr, unless
+    // instructions are captured. save() and restore() snapshot the machine's
+    // devices while verify_routines compares a routine with the ROM code.
+    void addRoutine(const NativeRoutine &routine);
+    void setDeviceSnapshot(void (*save)(void), void (*restore)(void));
+    inline bool hasRoutine(uint16_t addr) const {
+        return routine_entries[addr >> 3] & (1 << (addr & 7));
+    }
+    // Runs the native routine at pc with at most `cycles`, returns the
+    // cycles emulated or 0 if the instructions have to be interpreted.
+    int runRoutine(int cycles);
+    // Stops the processor after an instruction that accesses the `size`
+    // bytes at `addr` in one of the `kinds` of MemoryMap::WatchKind, and
+    // reports it with watchpointReached(). Every engine honours them,
+    // native routines are not run while any are set.
+    void addWatchpoint(uint16_t addr, int size = 1, int kinds = MemoryMap::WatchRead | MemoryMap::WatchWrite);
+    void removeWatchpoint(uint16_t addr, int size = 1, int kinds = MemoryMap::WatchRead | MemoryMap::WatchWrite);
+    void watchpointHit(uint16_t addr, bool write);
+    // Stops the processor before it executes the instruction at `addr`.
+    // Enabled again, it executes the instruction and goes on.
+    void addBreakpoint(uint16_t addr);
+    void removeBreakpoint(uint16_t addr);
+    inline bool isBreakpoint(uint16_t addr) const {
+        return break_entries[addr >> 3] & (1 << (addr & 7));
+    }
+    // Counts every memory access and executed instruction in `heatmap`
+    // from the next slice on, or stops with 0. Safe from any thread.
+    void setHeatmap(MemoryHeatmap *heatmap);
     void reset(void);
+    // Executes instructions for a slice of at least `cycles` cycles, or
+    // until the processor is disabled or reaches an unknown instruction.
+    // Cycle events that come due within the slice are fired on time.
+    // The mutex is held for the whole slice. Returns the cycles emulated.
+    int run(int cycles);
+
+    static const int clock_hz = 2000000;
 private:
-    QTime now;
+    // Cycles emulated per slice of emulate(), 1ms at 2MHz.
+    static const int slice_cycles = 2000;
+    int currentMode(void) const;
+    int execute(int cycles);
+    template<int Mode> int executeLoop(int cycles);
+    // Executes one instruction in the slice's mode.
+    int step(void);
+    template<int Mode> int step(void);
+    int skipIdleLoop(int cycles);
+    int verifyRoutine(const NativeRoutine &routine, int cycles);
+    QVector<CycleEvent> events;
+    QMap<uint16_t, NativeRoutine> routines;
+    uint8_t routine_entries[0x10000 / 8];   // bit per address with a routine
+    uint8_t break_entries[0x10000 / 8];     // bit per breakpoint address
+    int breakpoint_count;
+    int resumed_breakpoint;   // breakpoint stopped at, not hit again when resuming, or -1
+    int slice_mode;           // Mode bits of the current run() slice
+    void (*save_devices)(void);
+    void (*restore_devices)(void);
+    QElapsedTimer clock;
     QMutex *mutex;
-    int (*instruction_handlers[0xFF]) (CPU* processor, QList<QString> opcode) = { 0 };
-    int (*instruction_callbacks[0xFF]) (CPU* processor, QList<QString> opcode) = { 0 };
+    int (*instruction_handlers[0x100]) (INSTDEF) = { 0 };
+    int (*instruction_callbacks[0x100]) (INSTDEF) = { 0 };
+    template<class Bus, bool LazyFlags> friend int RunSwitchEngineLoop(CPU *processor, int cycles);
+    friend class BlockCache;
+    friend class Jit;
+    friend class Aot;
 public slots:
     void emulate();
 signals:
     void halted();
+    // Emitted from the emulator thread, the processor is disabled.
+    void watchpointReached(uint16_t addr, bool write);
 };
 
 #endif // CPU_H
@@ -1,58 +1,69 @@
 #include "disassembler.h"
 #include "cpu.h"
 
+#include <string.h>
+
 #include <QDebug>
 
-#define INS_STR_BUFF_LEN 80
-
-
-
-char *str_replace(char *orig, char const *rep, char const *with) {
-    char *result;  // the return string
-    char *ins;     // the next insert point
-    char *tmp;     // varies
-    int len_rep;   // length of rep (the string to remove)
-    int len_with;  // length of with (the string to replace rep with)
-    int len_front; // distance between rep and end of last rep
-    int count;     // number of replacements
-
-    // sanity checks and initialization
-    if (!orig || !rep)
-        return NULL;
-    len_rep = strlen(rep);
-    if (len_rep == 0)
-        return NULL; // empty rep causes infinite loop during count
-    if (!with)
-        with = "";
-    len_with = strlen(with);
-
-    // count the number of replacements needed
-    ins = orig;
-    for (count = 0; (tmp = strstr(ins, rep)); ++count) {
-        ins = tmp + len_rep;
+enum OperandKind : uint8_t {
+    OperandNone,
+    OperandAddress,   // a16, "$hhll"
+    OperandData16,    // d16, "#$hhll"
+    OperandData8      // d8, "#$nn"
+};
+
+// The mnemonic of an opcode up to its operand, and how to format the
+// operand, from the i8080_instructions mnemonic, e.g. "JMP a16".
+struct DecodeEntry {
+    char mnemonic[12];
+    uint8_t mnemonic_length;
+    uint8_t operand;
+    uint8_t length;
+    bool defined;
+};
+
+struct DecodeTable {
+    DecodeEntry entries[0x100];
+
+    DecodeTable() {
+        static const struct { const char *placeholder; OperandKind kind; } operands[] = {
+            { "a16", OperandAddress }, { "d16", OperandData16 }, { "d8", OperandData8 }
+        };
+        for (int op = 0; op < 0x100; op++) {
+            const InstructionDef &def = i8080_instructions[op];
+            DecodeEntry &entry = entries[op];
+            int length = strlen(def.mnemonic);
+            entry.operand = OperandNone;
+            if (def.mode == AddressingImmediate) {
+                for (const auto &operand : operands) {
+                    int placeholder = strlen(operand.placeholder);
+                    if (length >= placeholder && !strcmp(def.mnemonic + length - placeholder, operand.placeholder)) {
+                        entry.operand = operand.kind;
+                        length -= placeholder;
+                        break;
+                    }
+                }
+            }
+            Q_ASSERT(length < (int)sizeof(entry.mnemonic));
+            memcpy(entry.mnemonic, def.mnemonic, length);
+            entry.mnemonic_length = length;
+            entry.length = def.length;
+            entry.defined = def.defined;
+        }
     }
+};
 
-    tmp = result = (char*)malloc(strlen(orig) + (len_with - len_rep) * count + 1);
-
-    if (!result)
-        return NULL;
-
-    // first time through the loop, all the variable are set correctly
-    // from here on,
-    //    tmp points to the end of the result string
-    //    ins points to the next occurrence of rep in orig
-    //    orig points to the remainder of orig after "end of rep"
-    while (count--) {
-        ins = strstr(orig, rep);
-        len_front = ins - orig;
-        tmp = strncpy(tmp, orig, len_front) + len_front;
-        tmp = strcpy(tmp, with) + len_with;
-        orig += len_front + len_rep; // move to next "end of rep"
-    }
-    strcpy(tmp, orig);
-    return result;
-}
+static const DecodeTable decode_table;
+
+static const char upper_hex[] = "0123456789ABCDEF";
+static const char lower_hex[] = "0123456789abcdef";
 
+static inline char *Hex8(char *out, uint8_t val, const char *digits)
+{
+    out[0] = digits[val >> 4];
+    out[1] = digits[val & 0xf];
+    return out + 2;
+}
 
 Disassembler::Disassembler(CPU *processor) {
     this->cpu = processor;
@@ -61,87 +72,74 @@ Disassembler::Disassembler(CPU *processor) {
 Disassembler::~Disassembler() {
 }
 
-QList<QString> Disassembler::OpCode(uint16_t addr) {
-    char opcode_str[5];
-    snprintf(opcode_str, 5, "0x%02x", (unsigned char)(this->cpu->memory->data.at(addr)));
-    QVariant list_v = this->cpu->instruction_list.value(opcode_str);
-    if (!list_v.isValid()) {
-        qDebug() << "Unknown instruction " << opcode_str;
-        if (settings.value("Disassembly/HaltAtUnknownInstruction", true).toBool()) {
-            this->cpu->flags &= ~(1 << 6); // Disable the processor.
-        }
-        QList<QString> empty = QList<QString>();
-        empty.append(QString(""));
-        return empty;
+int Disassembler::Format(uint16_t addr, const uint8_t *code, char *text)
+{
+    const DecodeEntry &entry = decode_table.entries[code[0]];
+    char *out = text;
+    out = Hex8(out, addr >> 8, upper_hex);
+    out = Hex8(out, addr & 0xff, upper_hex);
+    *out++ = ' ';
+    out = Hex8(out, code[0], upper_hex);
+    if (!entry.defined) {
+        *out = 0;
+        return 0;
+    }
+    *out++ = ' ';
+    memcpy(out, entry.mnemonic, entry.mnemonic_length);
+    out += entry.mnemonic_length;
+    switch (entry.operand) {
+    case OperandData16:
+        *out++ = '#';
+        // fall through
+    case OperandAddress:
+        *out++ = '$';
+        out = Hex8(out, code[2], lower_hex);
+        out = Hex8(out, code[1], lower_hex);
+        break;
+    case OperandData8:
+        *out++ = '#';
+        *out++ = '$';
+        out = Hex8(out, code[1], lower_hex);
+        break;
     }
-    QList<QString> opcode;
-    QList<QVariant> opcode_def = list_v.toList();
-    opcode.append(opcode_def.at(2).toString()); // length
-    return opcode;
+    *out = 0;
+    return entry.length;
 }
+
+// Reads the opcode at `addr` and its operands, each byte once.
+void Disassembler::Fetch(uint16_t addr, uint8_t *code) const
+{
+    code[0] = cpu->memory->read(addr);
+    code[1] = code[2] = 0;
+    for (int i = 1; i < decode_table.entries[code[0]].length; i++) {
+        code[i] = cpu->memory->read(addr + i);
+    }
+}
+
+int Disassembler::Disassemble(uint16_t addr, char *text) const
+{
+    uint8_t code[3];
+    Fetch(addr, code);
+    return Format(addr, code, text);
+}
+
 QList<QString> Disassembler::Disassemble(uint16_t addr) {
-    char opcode_str[5];
-    snprintf(opcode_str, 5, "0x%02x", (unsigned char)(this->cpu->memory->data.at(addr)));
-    QVariant list_v = this->cpu->instruction_list.value(opcode_str);
-    if (!list_v.isValid()) {
-        qDebug() << "Unknown instruction " << opcode_str;
+    char text[text_size];
+    uint8_t code[3];
+    Fetch(addr, code);
+    if (!Format(addr, code, text)) {
+        qDebug() << "Unknown instruction " << text;
         if (settings.value("Disassembly/HaltAtUnknownInstruction", true).toBool()) {
             this->cpu->flags &= ~(1 << 6); // Disable the processor.
         }
         return QList<QString>();
     }
 
-    QList<QVariant> opcode_def = list_v.toList();
-    QString nemonic = opcode_def.at(0).toString();
-    QString mode = opcode_def.at(1).toString();
-    QString length = opcode_def.at(2).toString();
-    QString duration = opcode_def.at(3).toString();
-
-    char out[INS_STR_BUFF_LEN];
-    char formatting[INS_STR_BUFF_LEN];
-    char* tmp = NULL;
-    if (mode == "IMM") {
-        snprintf(out, INS_STR_BUFF_LEN, "%04X %02X %s", addr, (unsigned char)(this->cpu->memory->data.at(addr)), nemonic.toStdString().c_str());
-        if (strlen(out)>3 && !strcmp(out+strlen(out)-3, "a16")) {
-            tmp = str_replace(out, "a16", "$%02x%02x");
-            if (tmp != NULL) {
-                strncpy(out, tmp, sizeof(out));
-                free(tmp);
-                tmp = NULL;
-            }
-            snprintf(formatting, INS_STR_BUFF_LEN, out,
-                     (unsigned char)(this->cpu->memory->data.at(addr+2)),
-                     (unsigned char)(this->cpu->memory->data.at(addr+1)));
-        } else if (strlen(out)>3 && !strcmp(out+strlen(out)-3, "d16")) {
-            tmp = str_replace(out, "d16", "#$%02x%02x");
-            if (tmp != NULL) {
-                strncpy(out, tmp, sizeof(out));
-                free(tmp);
-                tmp = NULL;
-            }
-            snprintf(formatting, INS_STR_BUFF_LEN, out,
-                     (unsigned char)(this->cpu->memory->data.at(addr+2)),
-                     (unsigned char)(this->cpu->memory->data.at(addr+1)));
-        } else if (strlen(out)>2 && !strcmp(out+strlen(out)-2, "d8")) {
-            tmp = str_replace(out, "d8", "#$%02x");
-            if (tmp != NULL) {
-                strncpy(out, tmp, sizeof(out));
-                free(tmp);
-                tmp = NULL;
-            }
-            snprintf(formatting, INS_STR_BUFF_LEN, out,
-                     (unsigned char)(this->cpu->memory->data.at(addr+1)));
-        }
-
-        strncpy(out, formatting, sizeof(out));
-    } else {
-        snprintf(out, INS_STR_BUFF_LEN, "%04X %02X %s", addr, (unsigned char)(this->cpu->memory->data.at(addr)), nemonic.toStdString().c_str());
-    }
-    //qDebug() << out;
+    const InstructionDef &opcode = i8080_instructions[code[0]];
     QList<QString> ret;
-    ret.append(out);
-    ret.append(length);
-    ret.append(duration);
+    ret.append(text);
+    ret.append(QString::number(opcode.length));
+    ret.append(QString::number(opcode.cycles));
     return ret;
 }
 
@@ -1,23 +1,52 @@
 #ifndef DISASSEMBLER_H
 #define DISASSEMBLER_H
 
-#include <QVariant>
+#include <stdint.h>
+
 #include <QList>
+#include <QVariant>
 #include <QSettings>
 
 class CPU;
 
-char *str_replace(char *orig, char const *rep, char const *with);
+/*
+ Disassembler
+
+ Formats instructions from a decode table built once from
+ i8080_instructions, with no allocation: the text goes to a buffer of
+ text_size bytes the caller provides, as
+
+   18DC C3 JMP $18d4
+   01E6 11 LXI D,#$1b00
+   0A93 FE CPI #$ff
+
+ address and opcode in upper case hex, operands in lower case hex,
+ addresses with $ and data with #$. Format() disassembles any bytes,
+ e.g. a ROM image, Disassemble() the processor's memory.
+*/
 
 class Disassembler
 {
 public:
+    static const int text_size = 32;
+
     Disassembler(CPU *processor);
     ~Disassembler();
+    // Formats the instruction at `addr`, whose bytes start at `code`, to
+    // `text`. Returns its length, or 0 for an undefined opcode, which is
+    // formatted as its address and opcode only. `code` must hold the
+    // instruction's operands, up to 3 bytes from the opcode.
+    static int Format(uint16_t addr, const uint8_t *code, char *text);
+    // Formats the instruction at `addr` in the processor's memory, read
+    // through MemoryMap::read(), opcode and operands only.
+    int Disassemble(uint16_t addr, char *text) const;
+    // The instruction at `addr` as a list of text, length and cycles. An
+    // undefined opcode is reported, halts the processor if
+    // Disassembly/HaltAtUnknownInstruction is set, and gives an empty list.
     QList<QString> Disassemble(uint16_t addr);
     QList<QVariant> Disassemble(uint16_t addr, int diss_n_instructions);
-    QList<QString> OpCode(uint16_t addr);
 private:
+    void Fetch(uint16_t addr, uint8_t *code) const;
     QSettings settings;
     CPU *cpu;
 };
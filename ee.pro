@@ -7,6 +7,9 @@ TEMPLATE = app
 
 LIBS += -lOpengl32
 
+# shm_open() for RomImage and exported memory maps, in librt before glibc 2.34
+unix:!macx: LIBS += -lrt
+
 DEFINES += QT_DEPRECATED_WARNINGS
 
 SOURCES += \
@@ -14,21 +17,50 @@ SOURCES += \
     appframe.cpp \
     machine.cpp \
     cpu.cpp \
+    blockcache.cpp \
     disassembler.cpp \
     i8080.cpp \
+    i8080aot.cpp \
+    i8080flags.cpp \
+    i8080fused.cpp \
+    i8080jit.cpp \
+    invadersaot.cpp \
+    invadersroutines.cpp \
+    opcodeprofile.cpp \
+    memoryheatmap.cpp \
+    romimage.cpp \
+    triplebuffer.cpp \
+    i8080switchengine.cpp \
     executedinstructionslistmodel.cpp \
     disassemblystatelistwidget.cpp \
-    sipainterframebufferview.cpp
+    sipainterframebufferview.cpp \
+    memoryheatmapview.cpp
 
 HEADERS += \
     appframe.h \
     machine.h \
     cpu.h \
+    blockcache.h \
     disassembler.h \
     i8080.h \
+    i8080aot.h \
+    i8080bus.h \
+    i8080flags.h \
+    i8080fused.h \
+    i8080jit.h \
+    i8080switchengine.h \
+    i8080instructiontable.h \
+    invadersbus.h \
+    invadersroutines.h \
+    opcodeprofile.h \
+    memoryheatmap.h \
+    memoryexport.h \
+    romimage.h \
+    triplebuffer.h \
     executedinstructionslistmodel.h \
     disassemblystatelistwidget.h \
-    sipainterframebufferview.h
+    sipainterframebufferview.h \
+    memoryheatmapview.h
 
 RESOURCES += \
     ee.qrc
@@ -36,5 +68,10 @@ RESOURCES += \
 DISTFILES += \
     ee.qss \
     assets/8080_instructions.json \
+    tools/geninstructiontable.py \
+    tools/recompilerom.py \
+    tools/genfusedhandlers.py \
+    tools/watchram.py \
+    assets/opcodeprofile.txt \
     assets/shaders/si.vert \
     assets/shaders/si.frag
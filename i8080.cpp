@@ -2,120 +2,57 @@
 
 #include <QDebug>
 
-int parity(uint8_t n) {
-    uint8_t y;
-
-    y = n^(n>>1);
-    y = y^(y>>2);
-    y = y^(y>>4);
-
-    // 1 = odd,
-    // 0 = even.
-    return y & 1;
-}
-
-void SetFlagsZ(CPU *processor, int8_t val) {
-    // Set Zero bit
-    if (val == 0) {
-        processor->flags |= (1<<0);
-    } else {
-        processor->flags &= ~(1<<0);
-    }
+void SetFlagsAdd(CPU *processor, uint8_t a, uint8_t val, int carry) {
+    // Flags of A + val + carry, see i8080flags.h
+    processor->flags = (processor->flags & ~ALU_FLAGS) | add_flags[carry][a][val];
 }
 
-void SetFlagsS(CPU *processor, int8_t val) {
-    // Set Sign bit
-    if ((val & 0x80) == 0x80) {
-        processor->flags |= (1 << 1);
-    } else {
-        processor->flags &= ~(1 << 1);
-    }
+void SetFlagsSub(CPU *processor, uint8_t a, uint8_t val, int borrow) {
+    // Flags of A - val - borrow, see i8080flags.h
+    processor->flags = (processor->flags & ~ALU_FLAGS) | sub_flags[borrow][a][val];
 }
 
-void SetFlagsP(CPU *processor, uint8_t val) {
-    // Set parity bit
-    if (parity(val) == 0) {
-        processor->flags |= (1 << 2);
-    } else {
-        processor->flags &= ~(1 << 2);
-    }
+void SetFlagsInr(CPU *processor, uint8_t res) {
+    // INR leaves Carry alone
+    processor->flags = (processor->flags & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[res];
 }
 
-void SetFlagsAfterArithmeticOperation(CPU *processor, uint16_t val) {
-    // The last instruction emulated changed the
-    // processor state (a +b a, a - c, etc), so
-    // update the various flags.
-
-    // Set Carry bit
-    if (val > 0xff) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor->flags &= ~(1 << 3);
-    }
-
-    // Set Zero bit
-    if ((val&0xff) == 0) {
-        processor->flags |= (1 << 0);
-    } else {
-        processor->flags &= ~(1 << 0);
-    }
-
-    // Set Sign bit
-    if ((val & 0x80) == 0x80) {
-        processor->flags |= (1 << 1);
-    } else {
-        processor->flags &= ~(1 << 1);
-    }
-
-    // Set Parity bit
-    if (parity(val&0xff) == 0) {
-        processor->flags |= (1 << 2);
-    } else {
-        processor->flags &= ~(1 << 2);
-    }
+void SetFlagsDcr(CPU *processor, uint8_t res) {
+    // DCR leaves Carry alone
+    processor->flags = (processor->flags & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[res];
 }
 
 void SetFlagsAfterLogicalOperation(CPU *processor) {
     // The last instruction emulated changed the
     // processor state (a ^ a, a & d8, etc), so
-    // update the various flags.
-
-    // Turn off Carry and Aux Carry bits
-    processor->flags &= ~(1<<3);
-    processor->flags &= ~(1<<4);
-
-    // Set Zero bit
-    if (processor->a == 0) {
-        processor->flags |= (1 << 0);
-    } else {
-        processor->flags &= ~(1 << 0);
-    }
-
-    // Set Sign bit
-    if ((processor->a & 0x80) == 0x80) {
-        processor->flags |= (1 << 1);
-    } else {
-        processor->flags &= ~(1 << 1);
-    }
-
-    // Set Parity bit
-    if (parity(processor->a) == 0) {
-        processor->flags |= (1 << 2);
-    } else {
-        processor->flags &= ~(1 << 2);
-    }
+    // set Zero, Sign and Parity from A and turn
+    // off Carry and Aux Carry.
+    processor->flags = (processor->flags & ~ALU_FLAGS) | zsp_flags[processor->a];
 }
 
 void SetFlagsZSP(CPU *processor, uint8_t val) {
-    SetFlagsZ(processor, val);
-    SetFlagsS(processor, val);
-    SetFlagsP(processor, val);
+    processor->flags = (processor->flags & ~(FlagZero|FlagSign|FlagParity)) | zsp_flags[val];
+}
+
+void DiagnosticPrint(CPU *processor) {
+    // CP/M BDOS print string (C=9), the string at DE is terminated by '$'.
+    if (processor->c == 9)
+    {
+        uint16_t addr = (processor->d<<8)|processor->e;
+        unsigned char ayyy = processor->memory->read(addr+3);
+        while(ayyy != '$') {
+            ayyy = processor->memory->read(addr+3);
+            printf("%c", ayyy);
+            addr += 1;
+        }
+        printf("\n");
+    }
 }
 
 int noop(INSTDEF) {
     Q_UNUSED(processor);
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     //qDebug() << "In noop() instruction handler.";
 
@@ -125,8 +62,8 @@ int noop(INSTDEF) {
 
 // HLT
 int hlt(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->flags &= ~(1 << 6); // Disable the processor
 
@@ -136,12 +73,12 @@ int hlt(INSTDEF) {
 
 // DCR A
 int dcr_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->a-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->a = res;
 
@@ -151,12 +88,12 @@ int dcr_a(INSTDEF) {
 
 // DCR B
 int dcr_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->b-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->b = res;
 
@@ -166,12 +103,12 @@ int dcr_b(INSTDEF) {
 
 // DCR C
 int dcr_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->c-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->c = res;
 
@@ -181,12 +118,12 @@ int dcr_c(INSTDEF) {
 
 // DCR D
 int dcr_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->d-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->d = res;
 
@@ -196,12 +133,12 @@ int dcr_d(INSTDEF) {
 
 // DCR E
 int dcr_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->e-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->e = res;
 
@@ -211,12 +148,12 @@ int dcr_e(INSTDEF) {
 
 // DCR H
 int dcr_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->h-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->h = res;
 
@@ -226,12 +163,12 @@ int dcr_h(INSTDEF) {
 
 // DCR L
 int dcr_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->l-1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsDcr(processor, res);
 
     processor->l = res;
 
@@ -242,11 +179,11 @@ int dcr_l(INSTDEF) {
 
 // JNZ addr
 int jnz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    unsigned char highaddr = processor->memory->data.at(processor->pc+1);
-    unsigned char lowaddr = processor->memory->data.at(processor->pc+2);
+    unsigned char highaddr = processor->memory->read(processor->pc+1);
+    unsigned char lowaddr = processor->memory->read(processor->pc+2);
 
     if (processor->flags&(1<<0)) {
         processor->pc += inst_length;
@@ -259,20 +196,20 @@ int jnz(INSTDEF) {
 
 // JMP addr
 int jmp(INSTDEF) {
-    int inst_cycles = opcode.at(2).toInt();
-    unsigned char highaddr = processor->memory->data.at(processor->pc+1);
-    unsigned char lowaddr = processor->memory->data.at(processor->pc+2);
+    int inst_cycles = opcode.cycles;
+    unsigned char highaddr = processor->memory->read(processor->pc+1);
+    unsigned char lowaddr = processor->memory->read(processor->pc+2);
     processor->pc = (lowaddr << 8) | highaddr;
     return inst_cycles;
 }
 
 // LXI B,d16
 int lxi_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    unsigned char highaddr = processor->memory->data.at(processor->pc+1);
-    unsigned char lowaddr = processor->memory->data.at(processor->pc+2);
+    unsigned char highaddr = processor->memory->read(processor->pc+1);
+    unsigned char lowaddr = processor->memory->read(processor->pc+2);
 
     processor->c = highaddr;
     processor->b = lowaddr;
@@ -283,11 +220,11 @@ int lxi_b(INSTDEF) {
 
 // LXI D,d16
 int lxi_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    unsigned char highaddr = processor->memory->data.at(processor->pc+1);
-    unsigned char lowaddr = processor->memory->data.at(processor->pc+2);
+    unsigned char highaddr = processor->memory->read(processor->pc+1);
+    unsigned char lowaddr = processor->memory->read(processor->pc+2);
 
     processor->e = highaddr;
     processor->d = lowaddr;
@@ -298,22 +235,22 @@ int lxi_d(INSTDEF) {
 
 // LDAX B
 int ldax_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->b << 8) | processor->c;
-    processor->a = processor->memory->data.at(addr);
+    processor->a = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
 }
 // LDAX D
 int ldax_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->d << 8) | processor->e;
-    processor->a = processor->memory->data.at(addr);
+    processor->a = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -321,11 +258,11 @@ int ldax_d(INSTDEF) {
 
 // LXI H,d16
 int lxi_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->l = processor->memory->data.at(processor->pc+1);
-    processor->h = processor->memory->data.at(processor->pc+2);
+    processor->l = processor->memory->read(processor->pc+1);
+    processor->h = processor->memory->read(processor->pc+2);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -333,11 +270,11 @@ int lxi_h(INSTDEF) {
 
 // LXI SP,d16
 int lxi_sp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    unsigned char highaddr = processor->memory->data.at(processor->pc+1);
-    unsigned char lowaddr = processor->memory->data.at(processor->pc+2);
+    unsigned char highaddr = processor->memory->read(processor->pc+1);
+    unsigned char lowaddr = processor->memory->read(processor->pc+2);
 
     processor->sp = (lowaddr << 8) | highaddr;
 
@@ -347,15 +284,15 @@ int lxi_sp(INSTDEF) {
 
 // STA addr
 int sta(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     uint16_t addr = (uint16_t)((uint16_t)(lowaddr<<8)|(uint16_t)highaddr);
 
-    processor->memory->data[addr] = processor->a;
+    processor->memory->write(addr, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -363,15 +300,15 @@ int sta(INSTDEF) {
 
 // LDA addr
 int lda(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     uint16_t addr = ((uint16_t)(lowaddr<<8)|(uint16_t)highaddr);
 
-    processor->a = processor->memory->data[addr];
+    processor->a = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -379,10 +316,10 @@ int lda(INSTDEF) {
 
 // MVI A,d8
 int mvi_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->a = processor->memory->data.at(processor->pc+1);
+    processor->a = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -390,10 +327,10 @@ int mvi_a(INSTDEF) {
 
 // MVI B,d8
 int mvi_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->b = processor->memory->data.at(processor->pc+1);
+    processor->b = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -401,10 +338,10 @@ int mvi_b(INSTDEF) {
 
 // MVI C,d8
 int mvi_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->c = processor->memory->data.at(processor->pc+1);
+    processor->c = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -412,10 +349,10 @@ int mvi_c(INSTDEF) {
 
 // MVI D,d8
 int mvi_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->d = processor->memory->data.at(processor->pc+1);
+    processor->d = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -423,10 +360,10 @@ int mvi_d(INSTDEF) {
 
 // MVI E,d8
 int mvi_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->e = processor->memory->data.at(processor->pc+1);
+    processor->e = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -435,10 +372,10 @@ int mvi_e(INSTDEF) {
 
 // MVI H,d8
 int mvi_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->h = processor->memory->data.at(processor->pc+1);
+    processor->h = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -446,10 +383,10 @@ int mvi_h(INSTDEF) {
 
 // MVI L,d8
 int mvi_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->l = processor->memory->data.at(processor->pc+1);
+    processor->l = processor->memory->read(processor->pc+1);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -458,12 +395,12 @@ int mvi_l(INSTDEF) {
 
 // MVI M,d8
 int mvi_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = val;
+    processor->memory->write(addr, val);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -471,11 +408,11 @@ int mvi_m(INSTDEF) {
 
 // JZ addr
 int jz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if (processor->flags&(1<<0)) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -487,11 +424,11 @@ int jz(INSTDEF) {
 
 // JNC addr
 int jnc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if ((processor->flags&(1<<3)) == 0) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -503,11 +440,11 @@ int jnc(INSTDEF) {
 
 // JPE addr
 int jpe(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if (processor->flags&(1<<2)) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -519,11 +456,11 @@ int jpe(INSTDEF) {
 
 // JPO addr
 int jpo(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if ((processor->flags&(1<<2)) == 0) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -535,11 +472,11 @@ int jpo(INSTDEF) {
 
 // JP addr
 int jp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if ((processor->flags&(1<<1)) == 0) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -551,11 +488,11 @@ int jp(INSTDEF) {
 
 // JC addr
 int jc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if (processor->flags&(1<<3)) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -567,11 +504,11 @@ int jc(INSTDEF) {
 
 // JM addr
 int jm(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
 
     if (processor->flags&(1<<1)) {
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
@@ -583,43 +520,27 @@ int jm(INSTDEF) {
 
 // CALL addr
 int call(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
     uint16_t addr = processor->pc+inst_length;
 
-    // Diagnostic Mode expects a string printing function at 0x5
-    if ((processor->flags&(1 << 7)) && (5 == ((lowaddr << 8) | highaddr))) {
-        if (processor->c == 9)
-        {
-            uint16_t addr = (processor->d<<8)|processor->e;
-            unsigned char ayyy = processor->memory->data[addr+3];
-            while(ayyy != '$') {
-                ayyy = processor->memory->data[addr+3];
-                printf("%c", ayyy);
-                addr += 1;
-            }
-            printf("\n");
-        }
+    // Diagnostic Mode prints through CALL 5 before the handler, see CPU::step().
 
-        //processor->flags &= ~(1<<6);
-        return inst_cycles;
-    }
-
-    processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-    processor->memory->data[processor->sp-2] = addr & 0xFF;
+    processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+    processor->memory->write(processor->sp-2, addr & 0xFF);
     processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
     processor->sp -= 2;
 
     /*
-    highaddr = processor->memory->data.at(processor->sp);
-    lowaddr = processor->memory->data.at(processor->sp+1);
+    highaddr = processor->memory->read(processor->sp);
+    lowaddr = processor->memory->read(processor->sp+1);
     qDebug() << hex << "hmm... " << (uint16_t)((lowaddr << 8) | highaddr);
 
     qDebug() << "In call, new addr - " << hex << processor->pc;
-    qDebug() << "New return addr - " << hex << ((((uint8_t)(processor->memory->data[processor->sp+1])) << 8) | ((uint8_t)(processor->memory->data[processor->sp])));
+    qDebug() << "New return addr - " << hex << ((((uint8_t)(processor->memory->read(processor->sp+1))) << 8) | ((uint8_t)(processor->memory->read(processor->sp))));
     */
 
     return inst_cycles;
@@ -627,19 +548,19 @@ int call(INSTDEF) {
 
 // RET
 int ret(INSTDEF) {
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_cycles = opcode.cycles;
 
     /*
     char debug[100];
     snprintf(debug, 100, "pc - 0x%04x", (unsigned char)(processor->pc));
     qDebug();
-    snprintf(debug, 100, "data[sp] - 0x%02x", (unsigned char)(processor->memory->data.at(processor->sp)));
+    snprintf(debug, 100, "data[sp] - 0x%02x", (unsigned char)(processor->memory->read(processor->sp)));
     qDebug() << debug;
-    snprintf(debug, 100, "data[sp+1] - 0x%02x", (unsigned char)(processor->memory->data.at(processor->sp+1)));
+    snprintf(debug, 100, "data[sp+1] - 0x%02x", (unsigned char)(processor->memory->read(processor->sp+1)));
     qDebug() << debug;
 
-    uint8_t highaddr = processor->memory->data.at(processor->sp);
-    uint8_t lowaddr = processor->memory->data.at(processor->sp+1);
+    uint8_t highaddr = processor->memory->read(processor->sp);
+    uint8_t lowaddr = processor->memory->read(processor->sp+1);
 
     processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
 
@@ -649,7 +570,7 @@ int ret(INSTDEF) {
     qDebug() << hex << "0x" << processor->pc;
     */
 
-    processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+    processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
 
     processor->sp += 2;
 
@@ -658,18 +579,13 @@ int ret(INSTDEF) {
 
 // ADI d8
 int adi(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)val;
-    SetFlagsZSP(processor, res);
-    if (res>0xff) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor->flags &= ~(1 << 3);
-    }
+    SetFlagsAdd(processor, processor->a, val, 0);
     processor->a = res & 0xff;
 
     processor->pc += inst_length;
@@ -678,11 +594,11 @@ int adi(INSTDEF) {
 
 // MOV M,A
 int mvm_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->a;
+    processor->memory->write(addr, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -690,11 +606,11 @@ int mvm_a(INSTDEF) {
 
 // MOV M,B
 int mvm_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->b;
+    processor->memory->write(addr, processor->b);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -702,11 +618,11 @@ int mvm_b(INSTDEF) {
 
 // MOV M,C
 int mvm_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->c;
+    processor->memory->write(addr, processor->c);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -714,11 +630,11 @@ int mvm_c(INSTDEF) {
 
 // MOV M,D
 int mvm_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->d;
+    processor->memory->write(addr, processor->d);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -726,11 +642,11 @@ int mvm_d(INSTDEF) {
 
 // MOV M,E
 int mvm_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->e;
+    processor->memory->write(addr, processor->e);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -738,11 +654,11 @@ int mvm_e(INSTDEF) {
 
 // MOV M,H
 int mvm_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->h;
+    processor->memory->write(addr, processor->h);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -750,11 +666,11 @@ int mvm_h(INSTDEF) {
 
 // MOV M,L
 int mvm_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->memory->data[addr] = processor->l;
+    processor->memory->write(addr, processor->l);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -762,8 +678,8 @@ int mvm_l(INSTDEF) {
 
 // ANA A
 int ana_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->a;
 
@@ -775,8 +691,8 @@ int ana_a(INSTDEF) {
 
 // ANA B
 int ana_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->b;
 
@@ -788,8 +704,8 @@ int ana_b(INSTDEF) {
 
 // ANA C
 int ana_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->c;
 
@@ -801,8 +717,8 @@ int ana_c(INSTDEF) {
 
 // ANA D
 int ana_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->d;
 
@@ -814,8 +730,8 @@ int ana_d(INSTDEF) {
 
 // ANA E
 int ana_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->e;
 
@@ -827,8 +743,8 @@ int ana_e(INSTDEF) {
 
 // ANA H
 int ana_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->h;
 
@@ -840,8 +756,8 @@ int ana_h(INSTDEF) {
 
 // ANA L
 int ana_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a & processor->l;
 
@@ -853,11 +769,11 @@ int ana_l(INSTDEF) {
 
 // ANA M
 int ana_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->a = processor->a & processor->memory->data[addr];
+    processor->a = processor->a & processor->memory->read(addr);
     SetFlagsAfterLogicalOperation(processor);
 
     processor->pc += inst_length;
@@ -866,8 +782,8 @@ int ana_m(INSTDEF) {
 
 // XRA A
 int xra_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->a;
 
@@ -879,8 +795,8 @@ int xra_a(INSTDEF) {
 
 // XRA B
 int xra_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->b;
 
@@ -892,8 +808,8 @@ int xra_b(INSTDEF) {
 
 // XRA C
 int xra_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->c;
 
@@ -905,8 +821,8 @@ int xra_c(INSTDEF) {
 
 // XRA D
 int xra_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->d;
 
@@ -918,8 +834,8 @@ int xra_d(INSTDEF) {
 
 // XRA E
 int xra_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->e;
 
@@ -931,8 +847,8 @@ int xra_e(INSTDEF) {
 
 // XRA H
 int xra_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->h;
 
@@ -944,8 +860,8 @@ int xra_h(INSTDEF) {
 
 // XRA L
 int xra_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a ^ processor->l;
 
@@ -957,11 +873,11 @@ int xra_l(INSTDEF) {
 
 // XRA M
 int xra_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->a = processor->a ^ processor->memory->data[addr];
+    processor->a = processor->a ^ processor->memory->read(addr);
     SetFlagsAfterLogicalOperation(processor);
 
     processor->pc += inst_length;
@@ -970,8 +886,8 @@ int xra_m(INSTDEF) {
 
 // INX B
 int inx_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c++;
     if (processor->c == 0) processor->b++;
@@ -982,8 +898,8 @@ int inx_b(INSTDEF) {
 
 // INX H
 int inx_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l++;
     if (processor->l == 0) processor->h++;
@@ -994,8 +910,8 @@ int inx_h(INSTDEF) {
 
 // INX D
 int inx_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e++;
     if (processor->e == 0) processor->d++;
@@ -1006,8 +922,8 @@ int inx_d(INSTDEF) {
 
 // INX SP
 int inx_sp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->sp++;
 
@@ -1017,8 +933,8 @@ int inx_sp(INSTDEF) {
 
 // DCX B
 int dcx_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c--;
     if (processor->c == 0xFF) processor->b--;
@@ -1029,8 +945,8 @@ int dcx_b(INSTDEF) {
 
 // DCX D
 int dcx_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e--;
     if (processor->e == 0xFF) processor->d--;
@@ -1041,8 +957,8 @@ int dcx_d(INSTDEF) {
 
 // DCX H
 int dcx_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l--;
     if (processor->l == 0xFF) processor->h--;
@@ -1053,8 +969,8 @@ int dcx_h(INSTDEF) {
 
 // DCX SP
 int dcx_sp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->sp--;
 
@@ -1064,8 +980,8 @@ int dcx_sp(INSTDEF) {
 
 // DAD B
 int dad_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint32_t add = ((processor->h << 8) | processor->l) +
                    ((processor->b << 8) | processor->c);
@@ -1085,8 +1001,8 @@ int dad_b(INSTDEF) {
 
 // DAD D
 int dad_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint32_t add = ((processor->h << 8) | processor->l) +
                    ((processor->d << 8) | processor->e);
@@ -1106,8 +1022,8 @@ int dad_d(INSTDEF) {
 
 // DAD H
 int dad_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint32_t add = ((processor->h << 8) | processor->l) +
                    ((processor->h << 8) | processor->l);
@@ -1127,8 +1043,8 @@ int dad_h(INSTDEF) {
 
 // DAD SP
 int dad_sp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint32_t add = ( ((processor->h << 8) | processor->l) +
                      processor->sp );
@@ -1146,11 +1062,11 @@ int dad_sp(INSTDEF) {
 
 // POP B
 int pop_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->b = processor->memory->data[processor->sp+1];
-    processor->c = processor->memory->data[processor->sp];
+    processor->b = processor->memory->read(processor->sp+1);
+    processor->c = processor->memory->read(processor->sp);
     processor->sp += 2;
 
     processor->pc += inst_length;
@@ -1159,16 +1075,16 @@ int pop_b(INSTDEF) {
 
 // PUSH B
 int push_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (((processor->flags&(1 << 7)) == 0) && (((processor->sp-2) < 0x2000) || ((processor->sp-1) >= 0x4000))) {
         qDebug() << "Writing outside of safe memory";
         processor->flags &= ~(1 << 6); // Disable the processor.
     }
 
-    processor->memory->data[processor->sp-1] = processor->b;
-    processor->memory->data[processor->sp-2] = processor->c;
+    processor->memory->write(processor->sp-1, processor->b);
+    processor->memory->write(processor->sp-2, processor->c);
     processor->sp -= 2;
 
     processor->pc += inst_length;
@@ -1177,15 +1093,15 @@ int push_b(INSTDEF) {
 
 // PUSH D
 int push_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
     if (((processor->flags&(1 << 7)) == 0) && (((processor->sp-2) < 0x2000) || ((processor->sp-1) >= 0x4000))) {
         qDebug() << "Writing outside of safe memory";
         processor->flags &= ~(1 << 6); // Disable the processor.
     }
 
-    processor->memory->data[processor->sp-1] = processor->d;
-    processor->memory->data[processor->sp-2] = processor->e;
+    processor->memory->write(processor->sp-1, processor->d);
+    processor->memory->write(processor->sp-2, processor->e);
     processor->sp -= 2;
 
     processor->pc += inst_length;
@@ -1194,11 +1110,11 @@ int push_d(INSTDEF) {
 
 // POP H
 int pop_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->h = processor->memory->data[processor->sp+1];
-    processor->l = processor->memory->data[processor->sp];
+    processor->h = processor->memory->read(processor->sp+1);
+    processor->l = processor->memory->read(processor->sp);
     processor->sp += 2;
 
     processor->pc += inst_length;
@@ -1207,16 +1123,16 @@ int pop_h(INSTDEF) {
 
 // PUSH H
 int push_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (((processor->flags&(1 << 7)) == 0) && (((processor->sp-2) < 0x2000) || ((processor->sp-1) >= 0x4000))) {
         qDebug() << "Writing outside of safe memory";
         processor->flags &= ~(1 << 6); // Disable the processor.
     }
 
-    processor->memory->data[processor->sp-1] = processor->h;
-    processor->memory->data[processor->sp-2] = processor->l;
+    processor->memory->write(processor->sp-1, processor->h);
+    processor->memory->write(processor->sp-2, processor->l);
     processor->sp -= 2;
 
     processor->pc += inst_length;
@@ -1225,8 +1141,8 @@ int push_h(INSTDEF) {
 
 // MOV L,A
 int mvl_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->a;
 
@@ -1236,10 +1152,10 @@ int mvl_a(INSTDEF) {
 
 // ANI d8
 int ani(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
     processor->a = processor->a & val;
 
@@ -1251,8 +1167,8 @@ int ani(INSTDEF) {
 
 // XCHG
 int xchg(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t tmpd, tmpe;
     tmpd = processor->d;
@@ -1268,8 +1184,8 @@ int xchg(INSTDEF) {
 
 // EI
 int ei(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->flags |= (1 << 5);
 
@@ -1279,19 +1195,12 @@ int ei(INSTDEF) {
 
 // CPI d8
 int cpi(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
-    uint8_t res = processor->a - val;
-
-    SetFlagsZSP(processor, res);
-    if (processor->a < val) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor-> flags &= ~(1 << 3);
-    }
+    SetFlagsSub(processor, processor->a, val, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1299,18 +1208,13 @@ int cpi(INSTDEF) {
 
 // ACI d8
 int aci(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)val + ((processor->flags&(1 << 3))?1:0);
-    SetFlagsZSP(processor, res&0xff);
-    if (res>0xff) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor->flags &= ~(1 << 3);
-    }
+    SetFlagsAdd(processor, processor->a, val, ((processor->flags&(1 << 3))?1:0));
     processor->a = res & 0xff;
 
     processor->pc += inst_length;
@@ -1319,19 +1223,14 @@ int aci(INSTDEF) {
 
 // SUI d8
 int sui(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
     uint8_t res = processor->a - val;
 
-    SetFlagsZSP(processor, res);
-    if (processor->a < val) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor->flags &= ~(1 << 3);
-    }
+    SetFlagsSub(processor, processor->a, val, 0);
     processor->a = res;
 
     processor->pc += inst_length;
@@ -1340,19 +1239,14 @@ int sui(INSTDEF) {
 
 // SBI d8
 int sbi(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)val - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsZSP(processor, res&0xff);
-    if (res>0xff) {
-        processor->flags |= (1 << 3);
-    } else {
-        processor->flags &= ~(1 << 3);
-    }
+    SetFlagsSub(processor, processor->a, val, ((processor->flags&(1 << 3))?1:0));
     processor->a = res&0xff;
 
     processor->pc += inst_length;
@@ -1361,10 +1255,10 @@ int sbi(INSTDEF) {
 
 // ORI d8
 int ori(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
     uint8_t res = processor->a | val;
     SetFlagsZSP(processor, res);
     processor->flags &= ~(1 << 3);
@@ -1376,10 +1270,10 @@ int ori(INSTDEF) {
 
 // XRI d8
 int xri(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t val = processor->memory->data.at(processor->pc+1);
+    uint8_t val = processor->memory->read(processor->pc+1);
     uint8_t res = processor->a ^ val;
     SetFlagsZSP(processor, res);
     processor->flags &= ~(1 << 3);
@@ -1391,8 +1285,8 @@ int xri(INSTDEF) {
 
 // MOV A,H
 int mva_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->h;
 
@@ -1402,11 +1296,11 @@ int mva_h(INSTDEF) {
 
 // POP D
 int pop_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->d = processor->memory->data[processor->sp+1];
-    processor->e = processor->memory->data[processor->sp];
+    processor->d = processor->memory->read(processor->sp+1);
+    processor->e = processor->memory->read(processor->sp);
     processor->sp += 2;
 
     processor->pc += inst_length;
@@ -1415,11 +1309,11 @@ int pop_d(INSTDEF) {
 
 // MOV E,M
 int mve_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) |  processor->l;
-    processor->e = processor->memory->data.at(addr);
+    processor->e = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1427,11 +1321,11 @@ int mve_m(INSTDEF) {
 
 // MOV D,M
 int mvd_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) |  processor->l;
-    processor->d = processor->memory->data.at(addr);
+    processor->d = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1439,11 +1333,11 @@ int mvd_m(INSTDEF) {
 
 // MOV A,M
 int mva_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) |  processor->l;
-    processor->a = processor->memory->data.at(addr);
+    processor->a = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1451,11 +1345,11 @@ int mva_m(INSTDEF) {
 
 // MOV H,M
 int mvh_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) |  processor->l;
-    processor->h = processor->memory->data.at(addr);
+    processor->h = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1463,8 +1357,8 @@ int mvh_m(INSTDEF) {
 
 // MOV A,D
 int mva_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->d;
 
@@ -1474,8 +1368,8 @@ int mva_d(INSTDEF) {
 
 // MOV A,E
 int mva_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->e;
 
@@ -1485,11 +1379,11 @@ int mva_e(INSTDEF) {
 
 // PUSH PSW
 int push_psw(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->memory->data[processor->sp-1] = processor->a;
-    processor->memory->data[processor->sp-2] = (uint8_t)processor->flags;
+    processor->memory->write(processor->sp-1, processor->a);
+    processor->memory->write(processor->sp-2, (uint8_t)processor->flags);
     processor->sp -= 2;
 
     processor->pc += inst_length;
@@ -1498,11 +1392,11 @@ int push_psw(INSTDEF) {
 
 // POP PSW
 int pop_psw(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->flags = ((processor->flags & 0xff00) | processor->memory->data[processor->sp]);
-    processor->a = processor->memory->data[processor->sp+1];
+    processor->flags = ((processor->flags & 0xff00) | (uint8_t)processor->memory->read(processor->sp));
+    processor->a = processor->memory->read(processor->sp+1);
     processor->sp += 2;
 
     processor->pc += inst_length;
@@ -1511,8 +1405,8 @@ int pop_psw(INSTDEF) {
 
 // RLC
 int rlc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t val = processor->a;
     processor->a = ((val & 0x80) >> 7) | (val << 1);
@@ -1528,8 +1422,8 @@ int rlc(INSTDEF) {
 
 // RRC
 int rrc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t val = processor->a;
     processor->a = ((val & 1) << 7) | (val >> 1);
@@ -1545,8 +1439,8 @@ int rrc(INSTDEF) {
 
 // RAL
 int ral(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t val = processor->a;
     processor->a = ((processor->flags&(1 << 3))?1:0) | (val << 1);
@@ -1562,8 +1456,8 @@ int ral(INSTDEF) {
 
 // RAR
 int rar(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t val = processor->a;
     processor->a = (((processor->flags&(1 << 3))?1:0) << 7) | (val >> 1);
@@ -1579,16 +1473,16 @@ int rar(INSTDEF) {
 
 // CC addr
 int cc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 3)) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1602,16 +1496,16 @@ int cc(INSTDEF) {
 // CPO addr
 // Call if parity odd
 int cpo(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 2)) == 0) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1626,16 +1520,16 @@ int cpo(INSTDEF) {
 // Call if minus
 // Call if sign is set (last operation was negative)
 int cm(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 1)) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1649,16 +1543,16 @@ int cm(INSTDEF) {
 // CNZ addr
 // Call if zero is not set
 int cnz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 0)) == 0) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1672,16 +1566,16 @@ int cnz(INSTDEF) {
 // CNC addr
 // Call if carry is not set
 int cnc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 3)) == 0) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1695,16 +1589,16 @@ int cnc(INSTDEF) {
 // CPE addr
 // Call if parity even
 int cpe(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 2)) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1719,16 +1613,16 @@ int cpe(INSTDEF) {
 // Call if plus
 // Call if sign bit is not set (last operation was positive)
 int cp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 1)) == 0) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1742,16 +1636,16 @@ int cp(INSTDEF) {
 // CZ addr
 // Call if zero is set
 int cz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 0)) {
-        uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-        uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+        uint8_t highaddr = processor->memory->read(processor->pc+1);
+        uint8_t lowaddr = processor->memory->read(processor->pc+2);
         uint16_t addr = processor->pc+inst_length;
 
-        processor->memory->data[processor->sp-1] = (addr >> 8) & 0xFF;
-        processor->memory->data[processor->sp-2] = addr & 0xFF;
+        processor->memory->write(processor->sp-1, (addr >> 8) & 0xFF);
+        processor->memory->write(processor->sp-2, addr & 0xFF);
         processor->pc = (uint16_t)((lowaddr << 8) | highaddr);
         processor->sp -= 2;
 
@@ -1765,11 +1659,11 @@ int cz(INSTDEF) {
 // RPE
 // Return if parity is set
 int rpe(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 2)) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1782,11 +1676,11 @@ int rpe(INSTDEF) {
 // RPO
 // Return if parity is not set
 int rpo(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 2)) == 0) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1800,11 +1694,11 @@ int rpo(INSTDEF) {
 // Return if plus
 // Return if sign bit is not set (last operation was positive)
 int rp(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 1)) == 0) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1818,11 +1712,11 @@ int rp(INSTDEF) {
 // Return if minus
 // Return if sign is set (last operation was negative)
 int rm(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 1)) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1835,11 +1729,11 @@ int rm(INSTDEF) {
 // RC
 // Return if carry is set
 int rc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 3)) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1853,11 +1747,11 @@ int rc(INSTDEF) {
 // RNC
 // Return if carry is not set
 int rnc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 3)) == 0) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1871,11 +1765,11 @@ int rnc(INSTDEF) {
 // RZ
 // Return if zero is set
 int rz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 0)) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1889,11 +1783,11 @@ int rz(INSTDEF) {
 // RNZ
 // Return if zero is not set
 int rnz(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if ((processor->flags&(1 << 0)) == 0) {
-        processor->pc = (uint16_t)(((uint8_t)processor->memory->data[processor->sp+1] << 8) | (uint8_t)processor->memory->data[processor->sp]);
+        processor->pc = (uint16_t)(((uint8_t)processor->memory->read(processor->sp+1) << 8) | (uint8_t)processor->memory->read(processor->sp));
         processor->sp += 2;
 
         return inst_cycles;
@@ -1907,12 +1801,12 @@ int rnz(INSTDEF) {
 // INR A
 // Increment A
 int inr_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->a+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->a = res;
 
@@ -1922,8 +1816,8 @@ int inr_a(INSTDEF) {
 
 // MOV B,A
 int mvb_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->a;
 
@@ -1934,12 +1828,12 @@ int mvb_a(INSTDEF) {
 // INR B
 // Increment B
 int inr_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->b+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->b = res;
 
@@ -1949,13 +1843,13 @@ int inr_b(INSTDEF) {
 
 // INR M
 int inr_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint8_t res = processor->memory->data[addr] + 1;
-    SetFlagsZSP(processor, res);
-    processor->memory->data[addr] = res;
+    uint8_t res = processor->memory->read(addr) + 1;
+    SetFlagsInr(processor, res);
+    processor->memory->write(addr, res);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1964,13 +1858,13 @@ int inr_m(INSTDEF) {
 
 // DCR M
 int dcr_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint8_t res = processor->memory->data[addr] - 1;
-    SetFlagsZSP(processor, res);
-    processor->memory->data[addr] = res;
+    uint8_t res = processor->memory->read(addr) - 1;
+    SetFlagsDcr(processor, res);
+    processor->memory->write(addr, res);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -1978,8 +1872,8 @@ int dcr_m(INSTDEF) {
 
 // MOV C,B
 int mvc_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->b;
 
@@ -1989,8 +1883,8 @@ int mvc_b(INSTDEF) {
 
 // MOV D,C
 int mvd_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->c;
 
@@ -2000,8 +1894,8 @@ int mvd_c(INSTDEF) {
 
 // MOV E,D
 int mve_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->d;
 
@@ -2011,8 +1905,8 @@ int mve_d(INSTDEF) {
 
 // MOV H,E
 int mvh_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->e;
 
@@ -2022,8 +1916,8 @@ int mvh_e(INSTDEF) {
 
 // MOV L,H
 int mvl_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->h;
 
@@ -2033,8 +1927,8 @@ int mvl_h(INSTDEF) {
 
 // MOV A,L
 int mva_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->l;
 
@@ -2044,8 +1938,8 @@ int mva_l(INSTDEF) {
 
 // MOV C,A
 int mvc_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->a;
 
@@ -2055,8 +1949,8 @@ int mvc_a(INSTDEF) {
 
 // MOV E,C
 int mve_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->c;
 
@@ -2066,8 +1960,8 @@ int mve_c(INSTDEF) {
 
 // MOV L,E
 int mvl_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->e;
 
@@ -2077,8 +1971,8 @@ int mvl_e(INSTDEF) {
 
 // MOV B,L
 int mvb_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->l;
 
@@ -2088,8 +1982,8 @@ int mvb_l(INSTDEF) {
 
 // MOV D,B
 int mvd_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->b;
 
@@ -2099,8 +1993,8 @@ int mvd_b(INSTDEF) {
 
 // MOV H,D
 int mvh_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->d;
 
@@ -2110,8 +2004,8 @@ int mvh_d(INSTDEF) {
 
 // MOV D,A
 int mvd_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->a;
 
@@ -2121,8 +2015,8 @@ int mvd_a(INSTDEF) {
 
 // MOV L,D
 int mvl_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->d;
 
@@ -2132,8 +2026,8 @@ int mvl_d(INSTDEF) {
 
 // MOV C,L
 int mvc_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->l;
 
@@ -2143,8 +2037,8 @@ int mvc_l(INSTDEF) {
 
 // MOV H,C
 int mvh_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->c;
 
@@ -2154,8 +2048,8 @@ int mvh_c(INSTDEF) {
 
 // MOV B,H
 int mvb_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->h;
 
@@ -2165,8 +2059,8 @@ int mvb_h(INSTDEF) {
 
 // MOV E,B
 int mve_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->b;
 
@@ -2176,8 +2070,8 @@ int mve_b(INSTDEF) {
 
 // MOV E,A
 int mve_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->a;
 
@@ -2187,8 +2081,8 @@ int mve_a(INSTDEF) {
 
 // MOV B,E
 int mvb_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->e;
 
@@ -2198,8 +2092,8 @@ int mvb_e(INSTDEF) {
 
 // MOV H,B
 int mvh_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->b;
 
@@ -2209,8 +2103,8 @@ int mvh_b(INSTDEF) {
 
 // MOV C,H
 int mvc_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->h;
 
@@ -2220,10 +2114,10 @@ int mvc_h(INSTDEF) {
 
 // MOV C,M
 int mvc_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    processor->c = processor->memory->data[((processor->h << 8) | processor->l)];
+    processor->c = processor->memory->read(((processor->h << 8) | processor->l));
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -2231,8 +2125,8 @@ int mvc_m(INSTDEF) {
 
 // MOV L,C
 int mvl_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->c;
 
@@ -2242,8 +2136,8 @@ int mvl_c(INSTDEF) {
 
 // MOV D,L
 int mvd_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->l;
 
@@ -2253,8 +2147,8 @@ int mvd_l(INSTDEF) {
 
 // MOV H,A
 int mvh_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->a;
 
@@ -2264,8 +2158,8 @@ int mvh_a(INSTDEF) {
 
 // MOV D,H
 int mvd_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->h;
 
@@ -2275,8 +2169,8 @@ int mvd_h(INSTDEF) {
 
 // MOV B,D
 int mvb_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->d;
 
@@ -2286,8 +2180,8 @@ int mvb_d(INSTDEF) {
 
 // MOV L,B
 int mvl_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->l = processor->b;
 
@@ -2297,8 +2191,8 @@ int mvl_b(INSTDEF) {
 
 // MOV E,L
 int mve_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->l;
 
@@ -2308,8 +2202,8 @@ int mve_l(INSTDEF) {
 
 // MOV C,E
 int mvc_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->e;
 
@@ -2319,8 +2213,8 @@ int mvc_e(INSTDEF) {
 
 // MOV A,C
 int mva_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->c;
 
@@ -2330,8 +2224,8 @@ int mva_c(INSTDEF) {
 
 // MOV H,L
 int mvh_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->h = processor->l;
 
@@ -2341,8 +2235,8 @@ int mvh_l(INSTDEF) {
 
 // MOV E,H
 int mve_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->e = processor->h;
 
@@ -2352,8 +2246,8 @@ int mve_h(INSTDEF) {
 
 // MOV D,E
 int mvd_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->d = processor->e;
 
@@ -2363,8 +2257,8 @@ int mvd_e(INSTDEF) {
 
 // MOV C,D
 int mvc_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->c = processor->d;
 
@@ -2374,8 +2268,8 @@ int mvc_d(INSTDEF) {
 
 // MOV B,C
 int mvb_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->b = processor->c;
 
@@ -2385,8 +2279,8 @@ int mvb_c(INSTDEF) {
 
 // MOV A,B
 int mva_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->b;
 
@@ -2397,12 +2291,12 @@ int mva_b(INSTDEF) {
 // INR C
 // Increment C
 int inr_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->c+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->c = res;
 
@@ -2414,12 +2308,12 @@ int inr_c(INSTDEF) {
 // INR D
 // Increment D
 int inr_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->d+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->d = res;
 
@@ -2430,12 +2324,12 @@ int inr_d(INSTDEF) {
 // INR E
 // Increment E
 int inr_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->e+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->e = res;
 
@@ -2446,12 +2340,12 @@ int inr_e(INSTDEF) {
 // INR H
 // Increment H
 int inr_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->h+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->h = res;
 
@@ -2461,12 +2355,12 @@ int inr_h(INSTDEF) {
 
 // INR L
 int inr_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t res = processor->l+1;
 
-    SetFlagsZSP(processor, res);
+    SetFlagsInr(processor, res);
 
     processor->l = res;
 
@@ -2476,12 +2370,12 @@ int inr_l(INSTDEF) {
 
 // ADD A
 int add_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->a;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->a, 0);
 
     processor->a = (res&0xFF);
 
@@ -2491,12 +2385,12 @@ int add_a(INSTDEF) {
 
 // ADD B
 int add_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->b;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->b, 0);
 
     processor->a = (res&0xFF);
 
@@ -2506,12 +2400,12 @@ int add_b(INSTDEF) {
 
 // ADD C
 int add_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->c;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->c, 0);
 
     processor->a = (res&0xFF);
 
@@ -2521,12 +2415,12 @@ int add_c(INSTDEF) {
 
 // ADD D
 int add_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->d;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->d, 0);
 
     processor->a = (res&0xFF);
 
@@ -2536,12 +2430,12 @@ int add_d(INSTDEF) {
 
 // ADD E
 int add_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->e;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->e, 0);
 
     processor->a = (res&0xFF);
 
@@ -2551,12 +2445,12 @@ int add_e(INSTDEF) {
 
 // ADD H
 int add_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->h;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->h, 0);
 
     processor->a = (res&0xFF);
 
@@ -2566,12 +2460,12 @@ int add_h(INSTDEF) {
 
 // ADD L
 int add_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->l;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->l, 0);
 
     processor->a = (res&0xFF);
 
@@ -2581,12 +2475,13 @@ int add_l(INSTDEF) {
 
 // ADD M
 int add_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint16_t res = ((uint16_t)(processor->a)) + ((uint16_t)(processor->memory->data[addr]));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    uint8_t val = processor->memory->read(addr);
+    uint16_t res = ((uint16_t)(processor->a)) + ((uint16_t)val);
+    SetFlagsAdd(processor, processor->a, val, 0);
     processor->a = (res&0xFF);
 
     processor->pc += inst_length;
@@ -2595,12 +2490,12 @@ int add_m(INSTDEF) {
 
 // SUB B
 int sub_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->b;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->b, 0);
 
     processor->a = (res&0xFF);
 
@@ -2610,12 +2505,12 @@ int sub_b(INSTDEF) {
 
 // SUB C
 int sub_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->c;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->c, 0);
 
     processor->a = (res&0xFF);
 
@@ -2625,12 +2520,12 @@ int sub_c(INSTDEF) {
 
 // SUB D
 int sub_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->d;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->d, 0);
 
     processor->a = (res&0xFF);
 
@@ -2640,12 +2535,12 @@ int sub_d(INSTDEF) {
 
 // SUB E
 int sub_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->e;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->e, 0);
 
     processor->a = (res&0xFF);
 
@@ -2655,12 +2550,12 @@ int sub_e(INSTDEF) {
 
 // SUB H
 int sub_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->h;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->h, 0);
 
     processor->a = (res&0xFF);
 
@@ -2670,12 +2565,12 @@ int sub_h(INSTDEF) {
 
 // SUB L
 int sub_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->l;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->l, 0);
 
     processor->a = (res&0xFF);
 
@@ -2685,12 +2580,12 @@ int sub_l(INSTDEF) {
 
 // SUB A
 int sub_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->a;
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->a, 0);
 
     processor->a = (res&0xFF);
 
@@ -2700,12 +2595,13 @@ int sub_a(INSTDEF) {
 
 // SUB M
 int sub_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->memory->data[addr]));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    uint8_t val = processor->memory->read(addr);
+    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)val);
+    SetFlagsSub(processor, processor->a, val, 0);
     processor->a = (res&0xFF);
 
     processor->pc += inst_length;
@@ -2714,12 +2610,12 @@ int sub_m(INSTDEF) {
 
 // ADC A
 int adc_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->a + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->a, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2729,12 +2625,12 @@ int adc_a(INSTDEF) {
 
 // ADC B
 int adc_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->b + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->b, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2743,12 +2639,12 @@ int adc_b(INSTDEF) {
 }
 // ADC C
 int adc_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->c + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->c, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2758,12 +2654,12 @@ int adc_c(INSTDEF) {
 
 // ADC d
 int adc_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->d + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->d, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2773,12 +2669,12 @@ int adc_d(INSTDEF) {
 
 // ADC E
 int adc_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->e + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->e, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2788,12 +2684,12 @@ int adc_e(INSTDEF) {
 
 // ADC H
 int adc_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->h + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->h, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2803,12 +2699,12 @@ int adc_h(INSTDEF) {
 
 // ADC L
 int adc_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a + (uint16_t)processor->l + ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsAdd(processor, processor->a, processor->l, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2818,12 +2714,13 @@ int adc_l(INSTDEF) {
 
 // ADC M
 int adc_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint16_t res = ((uint16_t)(processor->a)) + ((uint16_t)(processor->memory->data[addr])) + ((processor->flags&(1 << 3))?1:0);
-    SetFlagsAfterArithmeticOperation(processor, res);
+    uint8_t val = processor->memory->read(addr);
+    uint16_t res = ((uint16_t)(processor->a)) + ((uint16_t)val) + ((processor->flags&(1 << 3))?1:0);
+    SetFlagsAdd(processor, processor->a, val, ((processor->flags&(1 << 3))?1:0));
     processor->a = (res&0xFF);
 
     processor->pc += inst_length;
@@ -2832,12 +2729,12 @@ int adc_m(INSTDEF) {
 
 // SBB A
 int sbb_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->a - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->a, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2847,12 +2744,12 @@ int sbb_a(INSTDEF) {
 
 // SBB B
 int sbb_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->b - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->b, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2862,12 +2759,12 @@ int sbb_b(INSTDEF) {
 
 // SBB C
 int sbb_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->c - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->c, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2877,12 +2774,12 @@ int sbb_c(INSTDEF) {
 
 // SBB D
 int sbb_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->d - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->d, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2892,12 +2789,12 @@ int sbb_d(INSTDEF) {
 
 // SBB E
 int sbb_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->e - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->e, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2907,12 +2804,12 @@ int sbb_e(INSTDEF) {
 
 // SBB H
 int sbb_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->h - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->h, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2922,12 +2819,12 @@ int sbb_h(INSTDEF) {
 
 // SBB L
 int sbb_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = (uint16_t)processor->a - (uint16_t)processor->l - ((processor->flags&(1 << 3))?1:0);
 
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->l, ((processor->flags&(1 << 3))?1:0));
 
     processor->a = (res&0xFF);
 
@@ -2937,12 +2834,13 @@ int sbb_l(INSTDEF) {
 
 // SBB M
 int sbb_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->memory->data[addr])) - ((processor->flags&(1 << 3))?1:0);
-    SetFlagsAfterArithmeticOperation(processor, res);
+    uint8_t val = processor->memory->read(addr);
+    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)val) - ((processor->flags&(1 << 3))?1:0);
+    SetFlagsSub(processor, processor->a, val, ((processor->flags&(1 << 3))?1:0));
     processor->a = (res&0xFF);
 
     processor->pc += inst_length;
@@ -2951,8 +2849,8 @@ int sbb_m(INSTDEF) {
 
 // ORA_A
 int ora_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->a;
 
@@ -2964,8 +2862,8 @@ int ora_a(INSTDEF) {
 
 // ORA_B
 int ora_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->b;
 
@@ -2977,8 +2875,8 @@ int ora_b(INSTDEF) {
 
 // ORA_C
 int ora_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->c;
 
@@ -2990,8 +2888,8 @@ int ora_c(INSTDEF) {
 
 // ORA_D
 int ora_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->d;
 
@@ -3003,8 +2901,8 @@ int ora_d(INSTDEF) {
 
 // ORA_E
 int ora_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->e;
 
@@ -3016,8 +2914,8 @@ int ora_e(INSTDEF) {
 
 // ORA_H
 int ora_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->h;
 
@@ -3029,8 +2927,8 @@ int ora_h(INSTDEF) {
 
 // ORA_L
 int ora_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = processor->a | processor->l;
 
@@ -3042,11 +2940,11 @@ int ora_l(INSTDEF) {
 
 // ORA M
 int ora_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->a = processor->a | processor->memory->data[addr];
+    processor->a = processor->a | processor->memory->read(addr);
     SetFlagsAfterLogicalOperation(processor);
 
     processor->pc += inst_length;
@@ -3055,11 +2953,11 @@ int ora_m(INSTDEF) {
 
 // MOV B,M
 int mvb_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->b = processor->memory->data[addr];
+    processor->b = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3067,11 +2965,11 @@ int mvb_m(INSTDEF) {
 
 // CMP A
 int cmp_a(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->a));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->a, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3079,11 +2977,11 @@ int cmp_a(INSTDEF) {
 
 // CMP B
 int cmp_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->b));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->b, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3091,11 +2989,11 @@ int cmp_b(INSTDEF) {
 
 // CMP C
 int cmp_c(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->c));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->c, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3103,11 +3001,11 @@ int cmp_c(INSTDEF) {
 
 // CMP D
 int cmp_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->d));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->d, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3115,11 +3013,11 @@ int cmp_d(INSTDEF) {
 
 // CMP E
 int cmp_e(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->e));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->e, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3127,11 +3025,11 @@ int cmp_e(INSTDEF) {
 
 // CMP H
 int cmp_h(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->h));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->h, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3139,11 +3037,11 @@ int cmp_h(INSTDEF) {
 
 // CMP L
 int cmp_l(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->l));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    SetFlagsSub(processor, processor->a, processor->l, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3151,12 +3049,13 @@ int cmp_l(INSTDEF) {
 
 // CMP M
 int cmp_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)(processor->memory->data[addr]));
-    SetFlagsAfterArithmeticOperation(processor, res);
+    uint8_t val = processor->memory->read(addr);
+    uint16_t res = ((uint16_t)(processor->a)) - ((uint16_t)val);
+    SetFlagsSub(processor, processor->a, val, 0);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3164,11 +3063,11 @@ int cmp_m(INSTDEF) {
 
 // MOV L,M
 int mvl_m(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = (processor->h << 8) | processor->l;
-    processor->l = processor->memory->data[addr];
+    processor->l = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3176,15 +3075,15 @@ int mvl_m(INSTDEF) {
 
 // LHLD addr
 int lhld(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
     uint16_t addr = (uint16_t)((lowaddr << 8) | highaddr);
 
-    processor->h = processor->memory->data[addr+1];
-    processor->l = processor->memory->data[addr];
+    processor->h = processor->memory->read(addr+1);
+    processor->l = processor->memory->read(addr);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3192,15 +3091,15 @@ int lhld(INSTDEF) {
 
 // SHLD addr
 int shld(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
-    uint8_t highaddr = processor->memory->data.at(processor->pc+1);
-    uint8_t lowaddr = processor->memory->data.at(processor->pc+2);
+    uint8_t highaddr = processor->memory->read(processor->pc+1);
+    uint8_t lowaddr = processor->memory->read(processor->pc+2);
     uint16_t addr = (uint16_t)((lowaddr << 8) | highaddr);
 
-    processor->memory->data[addr+1] = processor->h;
-    processor->memory->data[addr] = processor->l;
+    processor->memory->write(addr+1, processor->h);
+    processor->memory->write(addr, processor->l);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3208,11 +3107,11 @@ int shld(INSTDEF) {
 
 // STAX B
 int stax_b(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = ((processor->b << 8) | processor->c);
-    processor->memory->data[addr] = processor->a;
+    processor->memory->write(addr, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3220,11 +3119,11 @@ int stax_b(INSTDEF) {
 
 // STAX D
 int stax_d(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint16_t addr = ((processor->d << 8) | processor->e);
-    processor->memory->data[addr] = processor->a;
+    processor->memory->write(addr, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
@@ -3232,8 +3131,8 @@ int stax_d(INSTDEF) {
 
 // STC
 int stc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->flags |= (1 << 3);
 
@@ -3243,8 +3142,8 @@ int stc(INSTDEF) {
 
 // CMC
 int cmc(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     if (processor->flags&(1 << 3)) {
         processor->flags &= ~(1 << 3);
@@ -3258,8 +3157,8 @@ int cmc(INSTDEF) {
 
 // CMA
 int cma(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->a = ~(processor->a);
 
@@ -3267,10 +3166,36 @@ int cma(INSTDEF) {
     return inst_cycles;
 }
 
+// DAA
+// Decimal adjust A after a BCD addition
+int daa(INSTDEF) {
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
+
+    uint8_t correction = 0;
+    int carry = (processor->flags&(1 << 3))?1:0;
+
+    if ((processor->a & 0x0f) > 9 || (processor->flags&(1 << 4))) {
+        correction |= 0x06;
+    }
+    if ((processor->a >> 4) > 9 || carry || ((processor->a >> 4) == 9 && (processor->a & 0x0f) > 9)) {
+        correction |= 0x60;
+        carry = 1;
+    }
+
+    // Carry is only ever set by DAA, never cleared
+    SetFlagsAdd(processor, processor->a, correction, 0);
+    processor->flags |= (carry << 3);
+    processor->a += correction;
+
+    processor->pc += inst_length;
+    return inst_cycles;
+}
+
 // SPHL
 int sphl(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     processor->sp  = ((processor->h << 8) |  processor->l);
 
@@ -3280,7 +3205,7 @@ int sphl(INSTDEF) {
 
 // PCHL
 int pchl(INSTDEF) {
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_cycles = opcode.cycles;
 
     processor->pc  = ((processor->h << 8) |  processor->l);
 
@@ -3289,15 +3214,15 @@ int pchl(INSTDEF) {
 
 // XTHL
 int xthl(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
 
     uint8_t h = processor->h;
     uint8_t l = processor->l;
-    processor->h = processor->memory->data[processor->sp+1];
-    processor->l = processor->memory->data[processor->sp];
-    processor->memory->data[processor->sp+1] = h;
-    processor->memory->data[processor->sp] = l;
+    processor->h = processor->memory->read(processor->sp+1);
+    processor->l = processor->memory->read(processor->sp);
+    processor->memory->write(processor->sp+1, h);
+    processor->memory->write(processor->sp, l);
 
     processor->pc += inst_length;
     return inst_cycles;
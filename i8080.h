@@ -2,14 +2,15 @@
 #define I8080_H
 
 #include "cpu.h"
+#include "i8080flags.h"
 
-int parity(uint8_t n);
-void SetFlagsZ(CPU *processor, int8_t val);
-void SetFlagsS(CPU *processor, int8_t val);
-void SetFlagsP(CPU *processor, uint8_t val);
-void SetFlagsAfterArithmeticOperation(CPU *processor, uint16_t val);
+void SetFlagsAdd(CPU *processor, uint8_t a, uint8_t val, int carry);
+void SetFlagsSub(CPU *processor, uint8_t a, uint8_t val, int borrow);
+void SetFlagsInr(CPU *processor, uint8_t res);
+void SetFlagsDcr(CPU *processor, uint8_t res);
 void SetFlagsAfterLogicalOperation(CPU *processor);
 void SetFlagsZSP(CPU *processor, uint8_t val);
+void DiagnosticPrint(CPU *processor);
 
 extern "C" {
   int noop(INSTDEF);
@@ -231,6 +232,7 @@ extern "C" {
   int stc(INSTDEF);
   int cmc(INSTDEF);
   int cma(INSTDEF);
+  int daa(INSTDEF);
   int ral(INSTDEF);
   int rar(INSTDEF);
   int dad_sp(INSTDEF);
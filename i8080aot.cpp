@@ -0,0 +1,88 @@
+#include "i8080aot.h"
+
+#include <string.h>
+
+#include <QDebug>
+
+Aot::Aot(CPU *processor, const AotProgram &aot_program)
+    : program(aot_program)
+{
+    cpu = processor;
+    blocks = new AotBlockFunction[0x10000];
+    memset(blocks, 0, 0x10000 * sizeof(AotBlockFunction));
+
+    const uint8_t *mem = cpu->memory->data;
+    active = memcmp(mem + program.base, program.image, program.size) == 0;
+    if (!active) {
+        qWarning() << "Recompiled code does not match the loaded ROM, interpreting";
+        return;
+    }
+
+    for (int i = 0; i < program.block_count; i++) {
+        blocks[program.blocks[i].pc] = program.blocks[i].function;
+    }
+
+    // Writes to the image are reported through MemoryMap::invalidateCode().
+    for (int page = program.base >> 8; page < (program.base + program.size + 0xff) >> 8; page++) {
+        cpu->memory->code_pages[page] |= 4;
+    }
+    cpu->memory->aot = this;
+}
+
+Aot::~Aot()
+{
+    if (cpu->memory->aot == this) {
+        cpu->memory->aot = 0;
+    }
+    delete[] blocks;
+}
+
+int Aot::run(int cycles)
+{
+    CPU *processor = cpu;
+    int executed = 0;
+    uint8_t *mem = processor->memory->data;
+
+    while (executed < cycles && (processor->flags&(1 << 6))) {
+        if (processor->hasRoutine(processor->pc)) {
+            int routine_cycles = processor->runRoutine(cycles - executed);
+            if (routine_cycles > 0) {
+                executed += routine_cycles;
+                continue;
+            }
+        }
+
+        AotBlockFunction block = blocks[processor->pc];
+
+        if (block) {
+            int ran = (*block)(processor, mem, 0, cycles - executed);
+            if (ran > 0) {
+                executed += ran;
+                continue;
+            }
+            // Left before its first instruction, interpret it.
+        }
+
+        int inst_cycles = processor->step();
+        if (inst_cycles == 0) {
+            break;
+        }
+        executed += inst_cycles;
+    }
+
+    return executed;
+}
+
+void Aot::invalidate(uint16_t addr)
+{
+    if (!active || (uint16_t)(addr - program.base) >= program.size) {
+        return;
+    }
+
+    qWarning() << "ROM written at" << addr << ", recompiled code disabled";
+    active = false;
+    memset(blocks, 0, 0x10000 * sizeof(AotBlockFunction));
+    for (int page = program.base >> 8; page < (program.base + program.size + 0xff) >> 8; page++) {
+        cpu->memory->code_pages[page] &= ~4;
+    }
+}
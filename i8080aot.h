@@ -0,0 +1,71 @@
+#ifndef I8080AOT_H
+#define I8080AOT_H
+
+#include <stdint.h>
+
+#include "cpu.h"
+
+/*
+ Statically recompiled ROM
+
+ tools/recompilerom.py translates a ROM image ahead of time into C++, one
+ function per basic block it can discover by following the control flow
+ from the reset and RST vectors. CPU::StaticEngine runs those functions,
+ and interprets everything else with CPU::step() through the handler
+ table:
+ - code reached only through PCHL, or RAM-resident code
+ - IN/OUT and any other machine callback (setCallback())
+ - HLT, DAA, instructions without a core handler and CALL 5
+ - PUSH outside of safe memory
+ - writes into the ROM image. The interpreter performs them through
+   MemoryMap::write(), after which the recompiled code is no longer used.
+
+ A block function is entered with the `cyc` cycles executed so far and
+ runs from its address until `budget` is used up, or until the next
+ instruction is not recompiled. Blocks continue directly in the block
+ they jump or fall through to, returns and PCHL go back to run(). It
+ stores the registers back and returns the cycles executed, with
+ processor->pc at the next instruction, so it returns `cyc` unchanged if
+ it left before its first instruction.
+
+ The recompiled code is only used if the memory holds the exact image it
+ was generated from when the engine starts.
+*/
+
+typedef int (*AotBlockFunction)(CPU *processor, uint8_t *mem, int cyc, int budget);
+
+struct AotBlock {
+    uint16_t pc;
+    AotBlockFunction function;
+};
+
+struct AotProgram {
+    uint16_t base;          // address of the recompiled image
+    uint16_t size;
+    const uint8_t *image;   // the bytes the blocks were generated from
+    const AotBlock *blocks;
+    int block_count;
+};
+
+// Space Invaders, invaders.h/g/f/e at $0000-$1FFF, see invadersaot.cpp
+extern const AotProgram invaders_aot;
+
+class Aot
+{
+public:
+    Aot(CPU *processor, const AotProgram &program);
+    ~Aot();
+    // Executes instructions until at least `cycles` cycles have been
+    // emulated, or the processor is disabled or reaches an unknown
+    // instruction. Returns the cycles emulated.
+    int run(int cycles);
+    // Stops using the recompiled code once the image is written to.
+    void invalidate(uint16_t addr);
+private:
+    CPU *cpu;
+    const AotProgram &program;
+    AotBlockFunction *blocks;   // block functions by pc, or 0
+    bool active;
+};
+
+#endif // I8080AOT_H
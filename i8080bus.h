@@ -0,0 +1,82 @@
+#ifndef I8080BUS_H
+#define I8080BUS_H
+
+#include <stdint.h>
+
+#include "cpu.h"
+
+/*
+ Bus policies
+
+ The switch engine is a template over the bus it reaches memory and the
+ I/O ports through, see i8080switchengine.h. The engine creates the bus
+ once per run and calls it inline, so a bus costs no more than its
+ accessors do. A bus provides
+
+   uint8_t fetch8(uint16_t addr)          opcodes and their operands
+   uint8_t read8(uint16_t addr)           data reads, including the stack
+   void write8(uint16_t addr, uint8_t val)
+   static const bool ports                IN and OUT go through in() and
+   uint8_t in(uint8_t port)               out(), otherwise through the
+   void out(uint8_t port, uint8_t val)    machine's instruction callbacks
+
+ FlatBus compiles to plain loads and stores on the 64KB memory array.
+ It fetches from the storage at the fetch address, as the other engines
+ do. Data reads go through the page table, and so do writes to pages
+ that hold code or watchpoints or are not plain RAM, see MemoryMap.
+ CheckedBus is for debugging, it takes every access through MemoryMap
+ like the handler table does, so fetches too follow mirrors and devices
+ and stop on read watchpoints. A machine derives its own bus to inline
+ its ports, e.g. InvadersBus in invadersbus.h.
+*/
+
+class FlatBus {
+public:
+    static const bool ports = false;
+
+    explicit FlatBus(CPU *processor) : memory(processor->memory), mem(processor->memory->data) {}
+
+    inline uint8_t fetch8(uint16_t addr) const {
+        return mem[addr];
+    }
+    inline uint8_t read8(uint16_t addr) const {
+        return memory->read(addr);
+    }
+    inline void write8(uint16_t addr, uint8_t val) {
+        if (memory->code_pages[addr >> 8]) {
+            memory->write(addr, val);
+        } else {
+            mem[addr] = val;
+        }
+    }
+    inline uint8_t in(uint8_t port) {
+        Q_UNUSED(port);
+        return 0;
+    }
+    inline void out(uint8_t port, uint8_t val) {
+        Q_UNUSED(port);
+        Q_UNUSED(val);
+    }
+protected:
+    MemoryMap *memory;
+    uint8_t *mem;
+};
+
+// Every fetch, read and write goes through MemoryMap, none of them reach
+// the storage directly.
+class CheckedBus : public FlatBus {
+public:
+    explicit CheckedBus(CPU *processor) : FlatBus(processor) {}
+
+    inline uint8_t fetch8(uint16_t addr) const {
+        return memory->read(addr);
+    }
+    inline uint8_t read8(uint16_t addr) const {
+        return memory->read(addr);
+    }
+    inline void write8(uint16_t addr, uint8_t val) {
+        memory->write(addr, val);
+    }
+};
+
+#endif // I8080BUS_H
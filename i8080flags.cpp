@@ -0,0 +1,67 @@
+#include "i8080flags.h"
+
+uint8_t zsp_flags[0x100];
+uint8_t inr_flags[0x100];
+uint8_t dcr_flags[0x100];
+uint8_t add_flags[2][0x100][0x100];
+uint8_t sub_flags[2][0x100][0x100];
+
+static uint8_t ZSP(uint8_t res) {
+    uint8_t flags = 0;
+    uint8_t y;
+
+    if (res == 0) {
+        flags |= FlagZero;
+    }
+    if (res & 0x80) {
+        flags |= FlagSign;
+    }
+
+    // Set on even parity
+    y = res^(res>>1);
+    y = y^(y>>2);
+    y = y^(y>>4);
+    if ((y & 1) == 0) {
+        flags |= FlagParity;
+    }
+
+    return flags;
+}
+
+static bool BuildFlagTables(void) {
+    for (int res = 0; res < 0x100; res++) {
+        zsp_flags[res] = ZSP(res);
+        inr_flags[res] = ZSP(res) | (((res & 0x0f) == 0x00) ? FlagAuxCarry : 0);
+        dcr_flags[res] = ZSP(res) | (((res & 0x0f) != 0x0f) ? FlagAuxCarry : 0);
+    }
+
+    for (int carry = 0; carry < 2; carry++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int val = 0; val < 0x100; val++) {
+                int sum = a + val + carry;
+                uint8_t flags = zsp_flags[sum & 0xff];
+                if (sum > 0xff) {
+                    flags |= FlagCarry;
+                }
+                if ((a & 0x0f) + (val & 0x0f) + carry > 0x0f) {
+                    flags |= FlagAuxCarry;
+                }
+                add_flags[carry][a][val] = flags;
+
+                int diff = a - val - carry;
+                flags = zsp_flags[diff & 0xff];
+                if (diff < 0) {
+                    flags |= FlagCarry;
+                }
+                if ((a & 0x0f) + (~val & 0x0f) + !carry > 0x0f) {
+                    flags |= FlagAuxCarry;
+                }
+                sub_flags[carry][a][val] = flags;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool flag_tables_built = BuildFlagTables();
@@ -0,0 +1,37 @@
+#ifndef I8080FLAGS_H
+#define I8080FLAGS_H
+
+#include <stdint.h>
+
+#include "i8080instructiontable.h"
+
+/*
+ ALU flag tables
+
+ Every entry holds the Z, S, P, CY and AC bits of CPU::flags that an
+ operation leaves behind, so updating the flags is a mask and an OR:
+
+   flags = (flags & ~ALU_FLAGS) | add_flags[carry][a][val];
+
+ add_flags  A + val + carry (ADD, ADC, ADI, ACI, DAA)
+ sub_flags  A - val - borrow (SUB, SBB, SUI, SBI, CMP, CPI). The 8080
+            subtracts by adding the two's complement, CY is set on
+            borrow and AC is the carry out of bit 3 of A + ~val + !borrow.
+ inr_flags  indexed by the result of INR, CY is not part of the entry
+ dcr_flags  indexed by the result of DCR, CY is not part of the entry
+ zsp_flags  Z, S and P of a result byte
+
+ The tables are built before main() runs. tests/flags checks every
+ entry, and every engine's ALU instructions, against a bit-serial model
+ of the 8080 adder.
+*/
+
+const int ALU_FLAGS = FlagZero|FlagSign|FlagParity|FlagCarry|FlagAuxCarry;
+
+extern uint8_t zsp_flags[0x100];
+extern uint8_t inr_flags[0x100];
+extern uint8_t dcr_flags[0x100];
+extern uint8_t add_flags[2][0x100][0x100];
+extern uint8_t sub_flags[2][0x100][0x100];
+
+#endif // I8080FLAGS_H
@@ -0,0 +1,332 @@
+// Generated by tools/genfusedhandlers.py from assets/opcodeprofile.txt.
+// Do not edit by hand, re-run the generator. See i8080fused.h.
+
+#include "i8080fused.h"
+#include "i8080.h"
+
+// MOV A,M / ANA A / JNZ a16
+static int fused_7e_a7_c2(INSTDEF)
+{
+    int cycles = mva_m(processor, opcode);
+    cycles += ana_a(processor, i8080_instructions[0xa7]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// INX H / DCR B / JNZ a16
+static int fused_23_05_c2(INSTDEF)
+{
+    int cycles = inx_h(processor, opcode);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// LDA a16 / ANA A / JZ a16
+static int fused_3a_a7_ca(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += ana_a(processor, i8080_instructions[0xa7]);
+    cycles += jz(processor, i8080_instructions[0xca]);
+    return cycles;
+}
+
+// LDA a16 / ANA A / JNZ a16
+static int fused_3a_a7_c2(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += ana_a(processor, i8080_instructions[0xa7]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// LDA a16 / DCR A / JNZ a16
+static int fused_3a_3d_c2(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += dcr_a(processor, i8080_instructions[0x3d]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// MOV M,A / INX H / INX D
+static int fused_77_23_13(INSTDEF)
+{
+    uint32_t code_writes = processor->memory->code_writes;
+    int cycles = mvm_a(processor, opcode);
+    if (processor->memory->code_writes != code_writes) {
+        return cycles;
+    }
+    cycles += inx_h(processor, i8080_instructions[0x23]);
+    cycles += inx_d(processor, i8080_instructions[0x13]);
+    return cycles;
+}
+
+// LDA a16 / CPI d8 / RET
+static int fused_3a_fe_c9(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += cpi(processor, i8080_instructions[0xfe]);
+    cycles += ret(processor, i8080_instructions[0xc9]);
+    return cycles;
+}
+
+// INX H / INX D / DCR B
+static int fused_23_13_05(INSTDEF)
+{
+    int cycles = inx_h(processor, opcode);
+    cycles += inx_d(processor, i8080_instructions[0x13]);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    return cycles;
+}
+
+// INX D / DCR B / JNZ a16
+static int fused_13_05_c2(INSTDEF)
+{
+    int cycles = inx_d(processor, opcode);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// LDAX D / MOV M,A / INX H
+static int fused_1a_77_23(INSTDEF)
+{
+    uint32_t code_writes = processor->memory->code_writes;
+    int cycles = ldax_d(processor, opcode);
+    cycles += mvm_a(processor, i8080_instructions[0x77]);
+    if (processor->memory->code_writes != code_writes) {
+        return cycles;
+    }
+    cycles += inx_h(processor, i8080_instructions[0x23]);
+    return cycles;
+}
+
+// POP B / DCR B / JNZ a16
+static int fused_c1_05_c2(INSTDEF)
+{
+    int cycles = pop_b(processor, opcode);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// DAD B / POP B / DCR B
+static int fused_09_c1_05(INSTDEF)
+{
+    int cycles = dad_b(processor, opcode);
+    cycles += pop_b(processor, i8080_instructions[0xc1]);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    return cycles;
+}
+
+// LXI B,d16 / DAD B / POP B
+static int fused_01_09_c1(INSTDEF)
+{
+    int cycles = lxi_b(processor, opcode);
+    cycles += dad_b(processor, i8080_instructions[0x09]);
+    cycles += pop_b(processor, i8080_instructions[0xc1]);
+    return cycles;
+}
+
+// MOV A,H / CPI d8 / JC a16
+static int fused_7c_fe_da(INSTDEF)
+{
+    int cycles = mva_h(processor, opcode);
+    cycles += cpi(processor, i8080_instructions[0xfe]);
+    cycles += jc(processor, i8080_instructions[0xda]);
+    return cycles;
+}
+
+// INX H / MOV A,L / ANI d8
+static int fused_23_7d_e6(INSTDEF)
+{
+    int cycles = inx_h(processor, opcode);
+    cycles += mva_l(processor, i8080_instructions[0x7d]);
+    cycles += ani(processor, i8080_instructions[0xe6]);
+    return cycles;
+}
+
+// MOV A,L / ANI d8 / CPI d8
+static int fused_7d_e6_fe(INSTDEF)
+{
+    int cycles = mva_l(processor, opcode);
+    cycles += ani(processor, i8080_instructions[0xe6]);
+    cycles += cpi(processor, i8080_instructions[0xfe]);
+    return cycles;
+}
+
+// ANI d8 / CPI d8 / JC a16
+static int fused_e6_fe_da(INSTDEF)
+{
+    int cycles = ani(processor, opcode);
+    cycles += cpi(processor, i8080_instructions[0xfe]);
+    cycles += jc(processor, i8080_instructions[0xda]);
+    return cycles;
+}
+
+// MVI M,d8 / INX H / MOV A,L
+static int fused_36_23_7d(INSTDEF)
+{
+    uint32_t code_writes = processor->memory->code_writes;
+    int cycles = mvi_m(processor, opcode);
+    if (processor->memory->code_writes != code_writes) {
+        return cycles;
+    }
+    cycles += inx_h(processor, i8080_instructions[0x23]);
+    cycles += mva_l(processor, i8080_instructions[0x7d]);
+    return cycles;
+}
+
+// ANA A / JNZ a16
+static int fused_a7_c2(INSTDEF)
+{
+    int cycles = ana_a(processor, opcode);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// DCR B / JNZ a16
+static int fused_05_c2(INSTDEF)
+{
+    int cycles = dcr_b(processor, opcode);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// LDA a16 / ANA A
+static int fused_3a_a7(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += ana_a(processor, i8080_instructions[0xa7]);
+    return cycles;
+}
+
+// MOV A,M / ANA A
+static int fused_7e_a7(INSTDEF)
+{
+    int cycles = mva_m(processor, opcode);
+    cycles += ana_a(processor, i8080_instructions[0xa7]);
+    return cycles;
+}
+
+// INX H / DCR B
+static int fused_23_05(INSTDEF)
+{
+    int cycles = inx_h(processor, opcode);
+    cycles += dcr_b(processor, i8080_instructions[0x05]);
+    return cycles;
+}
+
+// ANA A / JZ a16
+static int fused_a7_ca(INSTDEF)
+{
+    int cycles = ana_a(processor, opcode);
+    cycles += jz(processor, i8080_instructions[0xca]);
+    return cycles;
+}
+
+// DCR A / JNZ a16
+static int fused_3d_c2(INSTDEF)
+{
+    int cycles = dcr_a(processor, opcode);
+    cycles += jnz(processor, i8080_instructions[0xc2]);
+    return cycles;
+}
+
+// LDA a16 / DCR A
+static int fused_3a_3d(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += dcr_a(processor, i8080_instructions[0x3d]);
+    return cycles;
+}
+
+// LDA a16 / CPI d8
+static int fused_3a_fe(INSTDEF)
+{
+    int cycles = lda(processor, opcode);
+    cycles += cpi(processor, i8080_instructions[0xfe]);
+    return cycles;
+}
+
+// MOV M,A / INX H
+static int fused_77_23(INSTDEF)
+{
+    uint32_t code_writes = processor->memory->code_writes;
+    int cycles = mvm_a(processor, opcode);
+    if (processor->memory->code_writes != code_writes) {
+        return cycles;
+    }
+    cycles += inx_h(processor, i8080_instructions[0x23]);
+    return cycles;
+}
+
+// INX H / INX D
+static int fused_23_13(INSTDEF)
+{
+    int cycles = inx_h(processor, opcode);
+    cycles += inx_d(processor, i8080_instructions[0x13]);
+    return cycles;
+}
+
+// LDAX D / MOV M,A
+static int fused_1a_77(INSTDEF)
+{
+    int cycles = ldax_d(processor, opcode);
+    cycles += mvm_a(processor, i8080_instructions[0x77]);
+    return cycles;
+}
+
+// CPI d8 / RET
+static int fused_fe_c9(INSTDEF)
+{
+    int cycles = cpi(processor, opcode);
+    cycles += ret(processor, i8080_instructions[0xc9]);
+    return cycles;
+}
+
+// CPI d8 / JC a16
+static int fused_fe_da(INSTDEF)
+{
+    int cycles = cpi(processor, opcode);
+    cycles += jc(processor, i8080_instructions[0xda]);
+    return cycles;
+}
+
+const FusedHandler fused_handlers[] = {
+    { { 0x7e, 0xa7, 0xc2 }, 3, fused_7e_a7_c2 },
+    { { 0x23, 0x05, 0xc2 }, 3, fused_23_05_c2 },
+    { { 0x3a, 0xa7, 0xca }, 3, fused_3a_a7_ca },
+    { { 0x3a, 0xa7, 0xc2 }, 3, fused_3a_a7_c2 },
+    { { 0x3a, 0x3d, 0xc2 }, 3, fused_3a_3d_c2 },
+    { { 0x77, 0x23, 0x13 }, 3, fused_77_23_13 },
+    { { 0x3a, 0xfe, 0xc9 }, 3, fused_3a_fe_c9 },
+    { { 0x23, 0x13, 0x05 }, 3, fused_23_13_05 },
+    { { 0x13, 0x05, 0xc2 }, 3, fused_13_05_c2 },
+    { { 0x1a, 0x77, 0x23 }, 3, fused_1a_77_23 },
+    { { 0xc1, 0x05, 0xc2 }, 3, fused_c1_05_c2 },
+    { { 0x09, 0xc1, 0x05 }, 3, fused_09_c1_05 },
+    { { 0x01, 0x09, 0xc1 }, 3, fused_01_09_c1 },
+    { { 0x7c, 0xfe, 0xda }, 3, fused_7c_fe_da },
+    { { 0x23, 0x7d, 0xe6 }, 3, fused_23_7d_e6 },
+    { { 0x7d, 0xe6, 0xfe }, 3, fused_7d_e6_fe },
+    { { 0xe6, 0xfe, 0xda }, 3, fused_e6_fe_da },
+    { { 0x36, 0x23, 0x7d }, 3, fused_36_23_7d },
+    { { 0xa7, 0xc2, 0x00 }, 2, fused_a7_c2 },
+    { { 0x05, 0xc2, 0x00 }, 2, fused_05_c2 },
+    { { 0x3a, 0xa7, 0x00 }, 2, fused_3a_a7 },
+    { { 0x7e, 0xa7, 0x00 }, 2, fused_7e_a7 },
+    { { 0x23, 0x05, 0x00 }, 2, fused_23_05 },
+    { { 0xa7, 0xca, 0x00 }, 2, fused_a7_ca },
+    { { 0x3d, 0xc2, 0x00 }, 2, fused_3d_c2 },
+    { { 0x3a, 0x3d, 0x00 }, 2, fused_3a_3d },
+    { { 0x3a, 0xfe, 0x00 }, 2, fused_3a_fe },
+    { { 0x77, 0x23, 0x00 }, 2, fused_77_23 },
+    { { 0x23, 0x13, 0x00 }, 2, fused_23_13 },
+    { { 0x1a, 0x77, 0x00 }, 2, fused_1a_77 },
+    { { 0xfe, 0xc9, 0x00 }, 2, fused_fe_c9 },
+    { { 0xfe, 0xda, 0x00 }, 2, fused_fe_da },
+};
+
+const int fused_handler_count = sizeof(fused_handlers) / sizeof(fused_handlers[0]);
@@ -0,0 +1,36 @@
+#ifndef I8080FUSED_H
+#define I8080FUSED_H
+
+#include "cpu.h"
+
+/*
+ Fused handlers
+
+ A fused handler executes a sequence of two or three instructions that
+ often run back to back, by calling their instruction_handlers functions
+ directly. The block cache puts one in place of the sequence's micro-ops,
+ which saves a dispatch and the per-op checks of BlockCache::run() for
+ all but the first instruction.
+
+ Only the last instruction of a sequence may leave it or disable the
+ processor, i.e. jump, call, return, PUSH or HLT. If an earlier one writes
+ to a page holding code (MemoryMap::code_writes), the handler returns
+ after it with pc at the next instruction, so that nothing executes from
+ code that may have been overwritten.
+
+ The sequences are the most frequent ones of a Space Invaders profile,
+ see opcodeprofile.h. i8080fused.cpp is generated from it by
+ tools/genfusedhandlers.py.
+*/
+
+struct FusedHandler {
+    uint8_t ops[3];
+    int length;              // instructions, 2 or 3
+    int (*handler)(INSTDEF); // gets the InstructionDef of the first instruction
+};
+
+// Longer sequences first, so that the first match is the longest one.
+extern const FusedHandler fused_handlers[];
+extern const int fused_handler_count;
+
+#endif // I8080FUSED_H
@@ -0,0 +1,291 @@
+#ifndef I8080INSTRUCTIONTABLE_H
+#define I8080INSTRUCTIONTABLE_H
+
+// Generated by tools/geninstructiontable.py from assets/8080_instructions.json.
+// Do not edit by hand, edit the JSON file and re-run the generator.
+
+#include <stdint.h>
+
+enum InstructionAddressingMode : uint8_t {
+    AddressingImplied,
+    AddressingImmediate
+};
+
+// Bits match the condition flag bits of CPU::flags.
+enum InstructionFlagEffect : uint8_t {
+    FlagZero     = (1 << 0),
+    FlagSign     = (1 << 1),
+    FlagParity   = (1 << 2),
+    FlagCarry    = (1 << 3),
+    FlagAuxCarry = (1 << 4)
+};
+
+struct InstructionDef {
+    const char *mnemonic;
+    uint8_t length;
+    uint8_t cycles;
+    uint8_t mode;
+    uint8_t affected_flags;
+    bool defined;
+};
+
+constexpr InstructionDef i8080_instructions[0x100] = {
+    /* 0x00 */ { "NOP", 1, 4, AddressingImplied, 0, true },
+    /* 0x01 */ { "LXI B,d16", 3, 10, AddressingImmediate, 0, true },
+    /* 0x02 */ { "STAX B", 1, 7, AddressingImplied, 0, true },
+    /* 0x03 */ { "INX B", 1, 5, AddressingImplied, 0, true },
+    /* 0x04 */ { "INR B", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x05 */ { "DCR B", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x06 */ { "MVI B,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x07 */ { "RLC", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x08 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x09 */ { "DAD B", 1, 10, AddressingImplied, FlagCarry, true },
+    /* 0x0a */ { "LDAX B", 1, 7, AddressingImplied, 0, true },
+    /* 0x0b */ { "DCX B", 1, 5, AddressingImplied, 0, true },
+    /* 0x0c */ { "INR C", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x0d */ { "DCR C", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x0e */ { "MVI C,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x0f */ { "RRC", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x10 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x11 */ { "LXI D,d16", 3, 10, AddressingImmediate, 0, true },
+    /* 0x12 */ { "STAX D", 1, 7, AddressingImplied, 0, true },
+    /* 0x13 */ { "INX D", 1, 5, AddressingImplied, 0, true },
+    /* 0x14 */ { "INR D", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x15 */ { "DCR D", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x16 */ { "MVI D,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x17 */ { "RAL", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x18 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x19 */ { "DAD D", 1, 10, AddressingImplied, FlagCarry, true },
+    /* 0x1a */ { "LDAX D", 1, 7, AddressingImplied, 0, true },
+    /* 0x1b */ { "DCX D", 1, 5, AddressingImplied, 0, true },
+    /* 0x1c */ { "INR E", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x1d */ { "DCR E", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x1e */ { "MVI E,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x1f */ { "RAR", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x20 */ { "NOP", 1, 4, AddressingImplied, 0, true },
+    /* 0x21 */ { "LXI H,d16", 3, 10, AddressingImmediate, 0, true },
+    /* 0x22 */ { "SHLD a16", 3, 16, AddressingImmediate, 0, true },
+    /* 0x23 */ { "INX H", 1, 5, AddressingImplied, 0, true },
+    /* 0x24 */ { "INR H", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x25 */ { "DCR H", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x26 */ { "MVI H,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x27 */ { "DAA", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x28 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x29 */ { "DAD H", 1, 10, AddressingImplied, FlagCarry, true },
+    /* 0x2a */ { "LHLD a16", 3, 16, AddressingImmediate, 0, true },
+    /* 0x2b */ { "DCX H", 1, 5, AddressingImplied, 0, true },
+    /* 0x2c */ { "INR L", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x2d */ { "DCR L", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x2e */ { "MVI L,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x2f */ { "CMA", 1, 4, AddressingImplied, 0, true },
+    /* 0x30 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x31 */ { "LXI SP,d16", 3, 10, AddressingImmediate, 0, true },
+    /* 0x32 */ { "STA a16", 3, 13, AddressingImmediate, 0, true },
+    /* 0x33 */ { "INX SP", 1, 5, AddressingImplied, 0, true },
+    /* 0x34 */ { "INR M", 1, 10, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x35 */ { "DCR M", 1, 10, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x36 */ { "MVI M,d8", 2, 10, AddressingImmediate, 0, true },
+    /* 0x37 */ { "STC", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x38 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x39 */ { "DAD SP", 1, 10, AddressingImplied, FlagCarry, true },
+    /* 0x3a */ { "LDA a16", 3, 13, AddressingImmediate, 0, true },
+    /* 0x3b */ { "DCX SP", 1, 5, AddressingImplied, 0, true },
+    /* 0x3c */ { "INR A", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x3d */ { "DCR A", 1, 5, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity, true },
+    /* 0x3e */ { "MVI A,d8", 2, 7, AddressingImmediate, 0, true },
+    /* 0x3f */ { "CMC", 1, 4, AddressingImplied, FlagCarry, true },
+    /* 0x40 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x41 */ { "MOV B,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x42 */ { "MOV B,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x43 */ { "MOV B,E", 1, 5, AddressingImplied, 0, true },
+    /* 0x44 */ { "MOV B,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x45 */ { "MOV B,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x46 */ { "MOV B,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x47 */ { "MOV B,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x48 */ { "MOV C,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x49 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x4a */ { "MOV C,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x4b */ { "MOV C,E", 1, 5, AddressingImplied, 0, true },
+    /* 0x4c */ { "MOV C,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x4d */ { "MOV C,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x4e */ { "MOV C,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x4f */ { "MOV C,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x50 */ { "MOV D,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x51 */ { "MOV D,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x52 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x53 */ { "MOV D,E", 1, 3, AddressingImplied, 0, true },
+    /* 0x54 */ { "MOV D,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x55 */ { "MOV D,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x56 */ { "MOV D,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x57 */ { "MOV D,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x58 */ { "MOV E,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x59 */ { "MOV E,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x5a */ { "MOV E,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x5b */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x5c */ { "MOV E,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x5d */ { "MOV E,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x5e */ { "MOV E,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x5f */ { "MOV E,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x60 */ { "MOV H,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x61 */ { "MOV H,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x62 */ { "MOV H,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x63 */ { "MOV H,E", 1, 5, AddressingImplied, 0, true },
+    /* 0x64 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x65 */ { "MOV H,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x66 */ { "MOV H,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x67 */ { "MOV H,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x68 */ { "MOV L,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x69 */ { "MOV L,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x6a */ { "MOV L,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x6b */ { "MOV L,E", 1, 5, AddressingImplied, 0, true },
+    /* 0x6c */ { "MOV L,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x6d */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x6e */ { "MOV L,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x6f */ { "MOV L,A", 1, 5, AddressingImplied, 0, true },
+    /* 0x70 */ { "MOV M,B", 1, 7, AddressingImplied, 0, true },
+    /* 0x71 */ { "MOV M,C", 1, 7, AddressingImplied, 0, true },
+    /* 0x72 */ { "MOV M,D", 1, 7, AddressingImplied, 0, true },
+    /* 0x73 */ { "MOV M,E", 1, 7, AddressingImplied, 0, true },
+    /* 0x74 */ { "MOV M,H", 1, 7, AddressingImplied, 0, true },
+    /* 0x75 */ { "MOV M,L", 1, 7, AddressingImplied, 0, true },
+    /* 0x76 */ { "HLT", 1, 7, AddressingImplied, 0, true },
+    /* 0x77 */ { "MOV M,A", 1, 7, AddressingImplied, 0, true },
+    /* 0x78 */ { "MOV A,B", 1, 5, AddressingImplied, 0, true },
+    /* 0x79 */ { "MOV A,C", 1, 5, AddressingImplied, 0, true },
+    /* 0x7a */ { "MOV A,D", 1, 5, AddressingImplied, 0, true },
+    /* 0x7b */ { "MOV A,E", 1, 5, AddressingImplied, 0, true },
+    /* 0x7c */ { "MOV A,H", 1, 5, AddressingImplied, 0, true },
+    /* 0x7d */ { "MOV A,L", 1, 5, AddressingImplied, 0, true },
+    /* 0x7e */ { "MOV A,M", 1, 7, AddressingImplied, 0, true },
+    /* 0x7f */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0x80 */ { "ADD B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x81 */ { "ADD C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x82 */ { "ADD D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x83 */ { "ADD E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x84 */ { "ADD H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x85 */ { "ADD L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x86 */ { "ADD M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x87 */ { "ADD A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x88 */ { "ADC B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x89 */ { "ADC C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8a */ { "ADC D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8b */ { "ADC E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8c */ { "ADC H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8d */ { "ADC L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8e */ { "ADC M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x8f */ { "ADC A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x90 */ { "SUB B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x91 */ { "SUB C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x92 */ { "SUB D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x93 */ { "SUB E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x94 */ { "SUB H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x95 */ { "SUB L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x96 */ { "SUB M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x97 */ { "SUB A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x98 */ { "SBB B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x99 */ { "SBB C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9a */ { "SBB D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9b */ { "SBB E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9c */ { "SBB H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9d */ { "SBB L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9e */ { "SBB M", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0x9f */ { "SBB A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa0 */ { "ANA B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa1 */ { "ANA C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa2 */ { "ANA D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa3 */ { "ANA E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa4 */ { "ANA H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa5 */ { "ANA L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa6 */ { "ANA M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa7 */ { "ANA A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa8 */ { "XRA B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xa9 */ { "XRA C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xaa */ { "XRA D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xab */ { "XRA E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xac */ { "XRA H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xad */ { "XRA L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xae */ { "XRA M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xaf */ { "XRA A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb0 */ { "ORA B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb1 */ { "ORA C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb2 */ { "ORA D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb3 */ { "ORA E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb4 */ { "ORA H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb5 */ { "ORA L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb6 */ { "ORA M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb7 */ { "ORA A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb8 */ { "CMP B", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xb9 */ { "CMP C", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xba */ { "CMP D", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xbb */ { "CMP E", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xbc */ { "CMP H", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xbd */ { "CMP L", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xbe */ { "CMP M", 1, 7, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xbf */ { "CMP A", 1, 4, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xc0 */ { "RNZ", 1, 11, AddressingImplied, 0, true },
+    /* 0xc1 */ { "POP B", 1, 10, AddressingImplied, 0, true },
+    /* 0xc2 */ { "JNZ a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xc3 */ { "JMP a16", 3, 7, AddressingImmediate, 0, true },
+    /* 0xc4 */ { "CNZ a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xc5 */ { "PUSH B", 1, 11, AddressingImplied, 0, true },
+    /* 0xc6 */ { "ADI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xc7 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xc8 */ { "RZ", 1, 11, AddressingImplied, 0, true },
+    /* 0xc9 */ { "RET", 1, 10, AddressingImplied, 0, true },
+    /* 0xca */ { "JZ a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xcb */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xcc */ { "CZ a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xcd */ { "CALL a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xce */ { "ACI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xcf */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xd0 */ { "RNC", 1, 11, AddressingImplied, 0, true },
+    /* 0xd1 */ { "POP D", 1, 10, AddressingImplied, 0, true },
+    /* 0xd2 */ { "JNC a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xd3 */ { "OUT d8", 2, 10, AddressingImmediate, 0, true },
+    /* 0xd4 */ { "CNC a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xd5 */ { "PUSH D", 1, 11, AddressingImplied, 0, true },
+    /* 0xd6 */ { "SUI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xd7 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xd8 */ { "RC", 1, 11, AddressingImplied, 0, true },
+    /* 0xd9 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xda */ { "JC a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xdb */ { "IN d8", 2, 10, AddressingImmediate, 0, true },
+    /* 0xdc */ { "CC a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xdd */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xde */ { "SBI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xdf */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xe0 */ { "RPO", 1, 11, AddressingImplied, 0, true },
+    /* 0xe1 */ { "POP H", 1, 10, AddressingImplied, 0, true },
+    /* 0xe2 */ { "JPO a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xe3 */ { "XTHL", 1, 18, AddressingImplied, 0, true },
+    /* 0xe4 */ { "CPO a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xe5 */ { "PUSH H", 1, 11, AddressingImplied, 0, true },
+    /* 0xe6 */ { "ANI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xe7 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xe8 */ { "RPE", 1, 11, AddressingImplied, 0, true },
+    /* 0xe9 */ { "PCHL", 1, 5, AddressingImplied, 0, true },
+    /* 0xea */ { "JPE a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xeb */ { "XCHG", 1, 5, AddressingImplied, 0, true },
+    /* 0xec */ { "CPE a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xed */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xee */ { "XRI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xef */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xf0 */ { "RP", 1, 11, AddressingImplied, 0, true },
+    /* 0xf1 */ { "POP PSW", 1, 10, AddressingImplied, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xf2 */ { "JP", 3, 10, AddressingImplied, 0, true },
+    /* 0xf3 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xf4 */ { "CP a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xf5 */ { "PUSH PSW", 1, 11, AddressingImplied, 0, true },
+    /* 0xf6 */ { "ORI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xf7 */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xf8 */ { "RM", 1, 11, AddressingImplied, 0, true },
+    /* 0xf9 */ { "SPHL", 1, 5, AddressingImplied, 0, true },
+    /* 0xfa */ { "JM a16", 3, 10, AddressingImmediate, 0, true },
+    /* 0xfb */ { "EI", 1, 4, AddressingImplied, 0, true },
+    /* 0xfc */ { "CM a16", 3, 17, AddressingImmediate, 0, true },
+    /* 0xfd */ { "", 0, 0, AddressingImplied, 0, false },
+    /* 0xfe */ { "CPI d8", 2, 7, AddressingImmediate, FlagSign|FlagZero|FlagAuxCarry|FlagParity|FlagCarry, true },
+    /* 0xff */ { "", 0, 0, AddressingImplied, 0, false },
+};
+
+#endif // I8080INSTRUCTIONTABLE_H
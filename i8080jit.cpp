@@ -0,0 +1,1031 @@
+#include "i8080jit.h"
+#include "i8080flags.h"
+
+#include <string.h>
+
+#include <QDebug>
+#include <QPair>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define I8080_JIT
+#endif
+
+#ifdef I8080_JIT
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+namespace {
+
+enum HostReg {
+    RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+    R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+enum Operand { RegB, RegC, RegD, RegE, RegH, RegL, RegM, RegA };
+
+// Host registers of the 8080 registers, see i8080jit.h.
+const int host_regs[8] = { R9, R10, R11, R12, R13, R14, -1, R8 };
+const int REG_A = R8;
+const int REG_H = R13;
+const int REG_L = R14;
+const int REG_SP = R15;
+const int REG_FLAGS = RSI;
+const int REG_CYCLES = RDI;
+const int REG_CPU = RBP;
+const int REG_MEM = RBX;
+
+#ifdef _WIN32
+const int ARG0 = RCX, ARG1 = RDX, ARG2 = R8, ARG3 = R9;
+#else
+const int ARG0 = RDI, ARG1 = RSI, ARG2 = RDX, ARG3 = RCX;
+#endif
+
+// Jcc condition codes
+enum Cond { CondE = 0x4, CondNE = 0x5, CondL = 0xc, CondGE = 0xd };
+
+// "op reg, r/m" opcodes
+enum RegOp { OpAdd = 0x03, OpOr = 0x0b, OpAnd = 0x23, OpSub = 0x2b, OpXor = 0x33, OpMov = 0x8b };
+
+// /digit of the immediate and shift groups
+enum Ext { ExtAdd = 0, ExtOr = 1, ExtAnd = 4, ExtSub = 5, ExtXor = 6, ExtCmp = 7 };
+enum ShiftExt { ExtShl = 4, ExtShr = 5 };
+
+// The budget passed to enter(), above the shadow space of calls.
+const int8_t budget_slot = 32;
+
+/*
+ Just the x86-64 encodings the translator needs. 32-bit operations zero
+ the upper half of a host register, so 8080 registers are kept zero
+ extended and masked after arithmetic.
+*/
+class Emitter
+{
+public:
+    uint8_t *p;
+
+    Emitter(uint8_t *at) : p(at) {}
+
+    void byte(uint8_t b) { *p++ = b; }
+    void dword(uint32_t d) { memcpy(p, &d, 4); p += 4; }
+    void qword(uint64_t q) { memcpy(p, &q, 8); p += 8; }
+
+    // REX is forced for byte registers, so that 4-7 are spl to dil.
+    void rex(bool w, int reg, int index, int base, bool force = false) {
+        uint8_t r = 0x40 | (w << 3) | ((reg >> 3) << 2) | ((index >> 3) << 1) | (base >> 3);
+        if (r != 0x40 || force) {
+            byte(r);
+        }
+    }
+    void modrm(int mod, int reg, int rm) { byte((mod << 6) | ((reg & 7) << 3) | (rm & 7)); }
+
+    // op reg, rm
+    void rr(uint8_t op, int reg, int rm) { rex(false, reg, 0, rm); byte(op); modrm(3, reg, rm); }
+    void rr64(uint8_t op, int reg, int rm) { rex(true, reg, 0, rm); byte(op); modrm(3, reg, rm); }
+    void mov(int dst, int src) { rr(OpMov, dst, src); }
+
+    // op rm, imm
+    void ri(int ext, int rm, int32_t imm) {
+        rex(false, 0, 0, rm);
+        if (imm >= -128 && imm <= 127) {
+            byte(0x83); modrm(3, ext, rm); byte((uint8_t)imm);
+        } else {
+            byte(0x81); modrm(3, ext, rm); dword(imm);
+        }
+    }
+    void ri64(int ext, int rm, int8_t imm) { rex(true, 0, 0, rm); byte(0x83); modrm(3, ext, rm); byte((uint8_t)imm); }
+    void shift(int ext, int rm, uint8_t n) { rex(false, 0, 0, rm); byte(0xc1); modrm(3, ext, rm); byte(n); }
+    void movImm(int dst, uint32_t imm) { rex(false, 0, 0, dst); byte(0xb8 + (dst & 7)); dword(imm); }
+    void movImm64(int dst, const void *ptr) { rex(true, 0, 0, dst); byte(0xb8 + (dst & 7)); qword((uint64_t)(uintptr_t)ptr); }
+    void test(int rm, uint32_t imm) { rex(false, 0, 0, rm); byte(0xf7); modrm(3, 0, rm); dword(imm); }
+    void test64(int reg, int rm) { rex(true, reg, 0, rm); byte(0x85); modrm(3, reg, rm); }
+
+    // [base + index << scale], base must not be rbp or r13
+    void sib(int reg, int base, int index, int scale = 0) {
+        modrm(0, reg, RSP);
+        byte((scale << 6) | ((index & 7) << 3) | (base & 7));
+    }
+    void load8(int dst, int base, int index) { rex(false, dst, index, base); byte(0x0f); byte(0xb6); sib(dst, base, index); }
+    void store8(int base, int index, int src) { rex(false, src, index, base, true); byte(0x88); sib(src, base, index); }
+    void store8Imm(int base, int index, uint8_t imm) { rex(false, 0, index, base); byte(0xc6); sib(0, base, index); byte(imm); }
+    void test8Imm(int base, int index, uint8_t imm) { rex(false, 0, index, base); byte(0xf6); sib(0, base, index); byte(imm); }
+    void load64Scaled(int dst, int base, int index) { rex(true, dst, index, base); byte(0x8b); sib(dst, base, index, 3); }
+    // Sets bit `bit` of the bit string at [base], base must not be rbp or r13
+    void btsMem(int base, int bit) { rex(true, bit, 0, base); byte(0x0f); byte(0xab); modrm(0, bit, base); }
+
+    // CPU members, [rbp + disp32]
+    void field(int reg, int32_t disp) { modrm(2, reg, RBP); dword(disp); }
+    void loadCpu8(int dst, int32_t disp) { rex(false, dst, 0, RBP); byte(0x0f); byte(0xb6); field(dst, disp); }
+    void loadCpu16(int dst, int32_t disp) { rex(false, dst, 0, RBP); byte(0x0f); byte(0xb7); field(dst, disp); }
+    void loadCpu32(int dst, int32_t disp) { rex(false, dst, 0, RBP); byte(0x8b); field(dst, disp); }
+    void storeCpu8(int32_t disp, int src) { rex(false, src, 0, RBP, true); byte(0x88); field(src, disp); }
+    void storeCpu16(int32_t disp, int src) { byte(0x66); rex(false, src, 0, RBP); byte(0x89); field(src, disp); }
+    void storeCpu32(int32_t disp, int src) { rex(false, src, 0, RBP); byte(0x89); field(src, disp); }
+    void orCpu32(int32_t disp, uint32_t imm) { byte(0x81); field(ExtOr, disp); dword(imm); }
+
+    // Stack slots, [rsp + disp8]
+    void slot(int reg, int8_t disp) { modrm(1, reg, RSP); byte(0x24); byte((uint8_t)disp); }
+    void storeSlot32(int8_t disp, int src) { rex(false, src, 0, 0); byte(0x89); slot(src, disp); }
+    void cmpSlot32(int reg, int8_t disp) { rex(false, reg, 0, 0); byte(0x3b); slot(reg, disp); }
+
+    void push(int r) { rex(false, 0, 0, r); byte(0x50 + (r & 7)); }
+    void pop(int r) { rex(false, 0, 0, r); byte(0x58 + (r & 7)); }
+    void ret() { byte(0xc3); }
+    void jmpReg(int r) { rex(false, 0, 0, r); byte(0xff); modrm(3, 4, r); }
+
+    // Jumps return their rel32 field, to be patched.
+    uint8_t *jcc(int cond) { byte(0x0f); byte(0x80 + cond); uint8_t *rel = p; dword(0); return rel; }
+    uint8_t *jmp() { byte(0xe9); uint8_t *rel = p; dword(0); return rel; }
+};
+
+void Patch(uint8_t *rel, const uint8_t *target)
+{
+    int32_t offset = (int32_t)(target - (rel + 4));
+    memcpy(rel, &offset, 4);
+}
+
+// Offsets of the CPU members native code loads and stores.
+struct CpuLayout {
+    int32_t a, b, c, d, e, h, l, sp, pc, flags;
+
+    CpuLayout(CPU *processor) {
+        const uint8_t *base = (const uint8_t *)processor;
+        a = (const uint8_t *)&processor->a - base;
+        b = (const uint8_t *)&processor->b - base;
+        c = (const uint8_t *)&processor->c - base;
+        d = (const uint8_t *)&processor->d - base;
+        e = (const uint8_t *)&processor->e - base;
+        h = (const uint8_t *)&processor->h - base;
+        l = (const uint8_t *)&processor->l - base;
+        sp = (const uint8_t *)&processor->sp - base;
+        pc = (const uint8_t *)&processor->pc - base;
+        flags = (const uint8_t *)&processor->flags - base;
+    }
+};
+
+// Flag bit tested by the condition in bits 3-5 of Jcc, Ccc and Rcc,
+// and whether it is taken when the flag is set.
+void Condition(uint8_t op, int *flag, bool *set)
+{
+    static const int flags[4] = { FlagZero, FlagCarry, FlagParity, FlagSign };
+    *flag = flags[(op >> 4) & 3];
+    *set = (op >> 3) & 1;
+}
+
+/*
+ Translates one block. Exits are collected while emitting the block and
+ get a stub after it that loads the pc to continue at and leaves through
+ the common exit.
+*/
+class Translator
+{
+public:
+    Emitter e;
+    uint16_t start;  // pc of the block
+    uint8_t *entry;  // native code of the block
+
+    Translator(CPU *processor, int (* const *core_handlers)(INSTDEF), uint16_t pc, uint8_t *at, uint8_t *exit, void **native_entries)
+        : e(at), start(pc), entry(at), cpu(processor), handlers(core_handlers), layout(processor), common_exit(exit), entries(native_entries) {}
+
+    bool translate(uint16_t pc, const uint8_t *mem, bool *ended);
+    void chain(uint16_t target);
+    void emitExits(void);
+
+    // rel32 fields of jumps chaining to a pc that is not compiled yet
+    QVector<QPair<uint8_t *, uint16_t> > unresolved;
+
+private:
+    CPU *cpu;
+    int (* const *handlers)(INSTDEF);
+    CpuLayout layout;
+    uint8_t *common_exit;
+    void **entries;
+    QVector<QPair<uint8_t *, uint16_t> > exits;
+
+    int reg(int operand) { return host_regs[operand]; }
+
+    void exitTo(uint8_t *rel, uint16_t pc) { exits.append(qMakePair(rel, pc)); }
+
+    // dst = H << 8 | L
+    void pair(int dst, int high, int low) {
+        e.mov(dst, high);
+        e.shift(ExtShl, dst, 8);
+        e.rr(OpOr, dst, low);
+    }
+
+    // Leaves before the instruction at `pc` if the page of the address
+    // in `addr` has one of the bits of `mask` in `pages`.
+    void checkPage(const uint8_t *pages, int addr, uint16_t pc, uint8_t mask) {
+        e.mov(RCX, addr);
+        e.shift(ExtShr, RCX, 8);
+        e.movImm64(RDX, pages);
+        e.test8Imm(RDX, RCX, mask);
+        exitTo(e.jcc(CondNE), pc);
+    }
+
+    // The write would hit a page holding pre-decoded code, a page that is
+    // not plain RAM, or a watched or shared one. Writes to tracked pages
+    // stay native, see markWritten().
+    void checkWrite(int addr, uint16_t pc) {
+        checkPage(cpu->memory->code_pages, addr, pc, 7 | 8 | 32 | 64);
+    }
+
+    // Sets the dirty bit of the byte at `addr`, just written, if its page
+    // is tracked, as MemoryMap::write() does. Clobbers ecx and edx.
+    void markWritten(int addr) {
+        e.mov(RCX, addr);
+        e.shift(ExtShr, RCX, 8);
+        e.movImm64(RDX, cpu->memory->code_pages);
+        e.test8Imm(RDX, RCX, 16);
+        uint8_t *untracked = e.jcc(CondE);
+        e.movImm64(RDX, cpu->memory->dirty);
+        e.btsMem(RDX, addr);
+        Patch(untracked, e.p);
+    }
+
+    // The read would not reach the page's own storage, a mirror or a device.
+    void checkRead(int addr, uint16_t pc) {
+        checkPage(cpu->memory->indirect_pages, addr, pc, 0xff);
+    }
+
+    // eax = (SP + delta) & 0xffff
+    void stackAddress(int delta) {
+        e.mov(RAX, REG_SP);
+        e.ri(ExtAdd, RAX, delta);
+        e.ri(ExtAnd, RAX, 0xffff);
+    }
+
+    // Adds the cycles of an instruction and leaves at `next` once the budget is used.
+    void account(int cycles, uint16_t next) {
+        e.ri(ExtAdd, REG_CYCLES, cycles);
+        e.cmpSlot32(REG_CYCLES, budget_slot);
+        exitTo(e.jcc(CondGE), next);
+    }
+
+    // Same, for a pc computed into eax.
+    void accountDynamic(int cycles) {
+        e.ri(ExtAdd, REG_CYCLES, cycles);
+        e.cmpSlot32(REG_CYCLES, budget_slot);
+        Patch(e.jcc(CondGE), common_exit);
+    }
+
+    // Continues at the pc in eax through the entries table.
+    void chainDynamic() {
+        e.movImm64(RDX, entries);
+        e.load64Scaled(RDX, RDX, RAX);
+        e.test64(RDX, RDX);
+        Patch(e.jcc(CondE), common_exit);
+        e.jmpReg(RDX);
+    }
+
+    // Pushes two bytes, `high` and `low` are host registers or,
+    // if negative, the bitwise not of an immediate byte.
+    void push(int high, int low, uint16_t pc) {
+        stackAddress(-1);
+        checkWrite(RAX, pc);
+        stackAddress(-2);
+        checkWrite(RAX, pc);
+        stackAddress(-1);
+        if (high < 0) e.store8Imm(REG_MEM, RAX, ~high); else e.store8(REG_MEM, RAX, high);
+        markWritten(RAX);
+        stackAddress(-2);
+        if (low < 0) e.store8Imm(REG_MEM, RAX, ~low); else e.store8(REG_MEM, RAX, low);
+        markWritten(RAX);
+        e.mov(REG_SP, RAX);
+    }
+
+    // ecx = low byte, edx = high byte, SP += 2
+    void pop(uint16_t pc) {
+        e.mov(RAX, REG_SP);
+        checkRead(RAX, pc);
+        stackAddress(1);
+        checkRead(RAX, pc);
+        e.mov(RAX, REG_SP);
+        e.load8(RCX, REG_MEM, RAX);
+        stackAddress(1);
+        e.load8(RDX, REG_MEM, RAX);
+        e.ri(ExtAdd, REG_SP, 2);
+        e.ri(ExtAnd, REG_SP, 0xffff);
+    }
+
+    // Host register holding a source operand, M is loaded into ecx.
+    int source(int operand, uint16_t pc) {
+        if (operand == RegM) {
+            pair(RAX, REG_H, REG_L);
+            checkRead(RAX, pc);
+            e.load8(RCX, REG_MEM, RAX);
+            return RCX;
+        }
+        return reg(operand);
+    }
+
+    // esi = (esi & ~mask) | table[index]
+    void flagsFrom(const uint8_t *table, int index, uint32_t mask) {
+        e.movImm64(RDX, table);
+        e.load8(RDX, RDX, index);
+        e.ri(ExtAnd, REG_FLAGS, ~mask);
+        e.rr(OpOr, REG_FLAGS, RDX);
+    }
+
+    // ADD, ADC, SUB, SBB and CMP of the value in `val`
+    void arithmetic(int val, bool subtract, bool with_carry, bool store) {
+        e.mov(RAX, REG_A);
+        e.shift(ExtShl, RAX, 8);
+        e.rr(OpOr, RAX, val);
+        if (with_carry) {
+            // index bit 16 is the carry in, see i8080flags.h
+            e.mov(RDX, REG_FLAGS);
+            e.ri(ExtAnd, RDX, FlagCarry);
+            e.shift(ExtShl, RDX, 13);
+            e.rr(OpOr, RAX, RDX);
+            e.shift(ExtShr, RDX, 16);
+        }
+        if (store) {
+            e.rr(subtract ? OpSub : OpAdd, REG_A, val);
+            if (with_carry) {
+                e.rr(subtract ? OpSub : OpAdd, REG_A, RDX);
+            }
+            e.ri(ExtAnd, REG_A, 0xff);
+        }
+        e.movImm64(RDX, subtract ? &sub_flags[0][0][0] : &add_flags[0][0][0]);
+        e.load8(RAX, RDX, RAX);
+        e.ri(ExtAnd, REG_FLAGS, ~ALU_FLAGS);
+        e.rr(OpOr, REG_FLAGS, RAX);
+    }
+
+    // ANA, XRA and ORA, which clear CY and AC
+    void logical(uint8_t op, int val) {
+        e.rr(op, REG_A, val);
+        flagsFrom(zsp_flags, REG_A, ALU_FLAGS);
+    }
+
+    // INR and DCR of a host register, which leave CY alone
+    void incdec(int r, bool decrement) {
+        e.ri(decrement ? ExtSub : ExtAdd, r, 1);
+        e.ri(ExtAnd, r, 0xff);
+        flagsFrom(decrement ? dcr_flags : inr_flags, r, ALU_FLAGS & ~FlagCarry);
+    }
+
+    // INX and DCX of a register pair
+    void pairStep(int high, int low, bool decrement) {
+        pair(RAX, high, low);
+        e.ri(decrement ? ExtSub : ExtAdd, RAX, 1);
+        e.ri(ExtAnd, RAX, 0xffff);
+        e.mov(low, RAX);
+        e.ri(ExtAnd, low, 0xff);
+        e.shift(ExtShr, RAX, 8);
+        e.mov(high, RAX);
+    }
+
+    // CY = bit 7 (left) or bit 0 (right) of A, from eax
+    void carryFromRotate() {
+        e.shift(ExtShl, RAX, 3);
+        e.ri(ExtAnd, REG_FLAGS, ~FlagCarry);
+        e.rr(OpOr, REG_FLAGS, RAX);
+    }
+};
+
+void Translator::chain(uint16_t target)
+{
+    uint8_t *rel = e.jmp();
+    if (target == start) {
+        Patch(rel, entry);
+    } else if (entries[target]) {
+        Patch(rel, (uint8_t *)entries[target]);
+    } else {
+        exitTo(rel, target);
+        unresolved.append(qMakePair(rel, target));
+    }
+}
+
+void Translator::emitExits()
+{
+    QHash<uint16_t, uint8_t *> stubs;
+
+    for (const QPair<uint8_t *, uint16_t> &exit : exits) {
+        uint8_t *stub = stubs.value(exit.second, 0);
+        if (!stub) {
+            stub = e.p;
+            e.movImm(RAX, exit.second);
+            Patch(e.jmp(), common_exit);
+            stubs.insert(exit.second, stub);
+        }
+        Patch(exit.first, stub);
+    }
+}
+
+// Emits the instruction at `pc`, or returns false if it is not translated.
+// Sets `ended` after an instruction that does not continue at the next one.
+bool Translator::translate(uint16_t pc, const uint8_t *mem, bool *ended)
+{
+    uint8_t op = mem[pc];
+    const InstructionDef &opcode = i8080_instructions[op];
+    uint16_t next = pc + opcode.length;
+    uint8_t imm = mem[(uint16_t)(pc+1)];
+    uint16_t addr = (uint16_t)((mem[(uint16_t)(pc+2)] << 8) | imm);
+    int d = (op >> 3) & 7;
+    int s = op & 7;
+    int flag;
+    bool set;
+
+    // Opcodes without a core handler stay unknown, as in CPU::step().
+    if (!opcode.defined || !handlers[op]) {
+        return false;
+    }
+
+    *ended = false;
+
+    switch (op) {
+    case 0x00: break; // NOP
+
+    // Register pairs
+    case 0x01: case 0x11: case 0x21: // LXI B,d16
+        e.movImm(reg(d + 1), imm);
+        e.movImm(reg(d), mem[(uint16_t)(pc+2)]);
+        break;
+    case 0x31: e.movImm(REG_SP, addr); break; // LXI SP,d16
+    case 0x03: case 0x13: case 0x23: // INX B
+    case 0x0b: case 0x1b: case 0x2b: // DCX B
+        pairStep(reg(d & 6), reg((d & 6) + 1), op & 0x08);
+        break;
+    case 0x33: case 0x3b: // INX SP, DCX SP
+        e.ri((op & 0x08) ? ExtSub : ExtAdd, REG_SP, 1);
+        e.ri(ExtAnd, REG_SP, 0xffff);
+        break;
+    case 0x09: case 0x19: case 0x29: case 0x39: // DAD B
+        pair(RAX, REG_H, REG_L);
+        if (op == 0x39) {
+            e.mov(RCX, REG_SP);
+        } else {
+            pair(RCX, reg(d - 1), reg(d));
+        }
+        e.rr(OpAdd, RAX, RCX);
+        e.mov(RDX, RAX);
+        e.shift(ExtShr, RDX, 16);
+        e.shift(ExtShl, RDX, 3);
+        e.ri(ExtAnd, REG_FLAGS, ~FlagCarry);
+        e.rr(OpOr, REG_FLAGS, RDX);
+        e.mov(REG_L, RAX);
+        e.ri(ExtAnd, REG_L, 0xff);
+        e.shift(ExtShr, RAX, 8);
+        e.ri(ExtAnd, RAX, 0xff);
+        e.mov(REG_H, RAX);
+        break;
+    case 0xc5: case 0xd5: case 0xe5: { // PUSH B
+        // Outside of safe memory the interpreter disables the processor.
+        // Its bounds are on SP - 2 and SP - 1 without wrapping, so SP 0
+        // and 1 are outside as well.
+        e.loadCpu32(RAX, layout.flags);
+        e.test(RAX, 1 << 7);
+        uint8_t *diagnostic = e.jcc(CondNE);
+        e.mov(RAX, REG_SP);
+        e.ri(ExtSub, RAX, 2);
+        e.ri(ExtCmp, RAX, 0x2000);
+        exitTo(e.jcc(CondL), pc);
+        e.ri(ExtCmp, RAX, 0x4000 - 1);
+        exitTo(e.jcc(CondGE), pc);
+        Patch(diagnostic, e.p);
+        push(reg((op >> 3) & 6), reg(((op >> 3) & 6) + 1), pc);
+        break;
+    }
+    case 0xc1: case 0xd1: case 0xe1: // POP B
+        pop(pc);
+        e.mov(reg((op >> 3) & 6), RDX);
+        e.mov(reg(((op >> 3) & 6) + 1), RCX);
+        break;
+    case 0xf5: // PUSH PSW
+        stackAddress(-1);
+        checkWrite(RAX, pc);
+        stackAddress(-2);
+        checkWrite(RAX, pc);
+        stackAddress(-1);
+        e.store8(REG_MEM, RAX, REG_A);
+        markWritten(RAX);
+        stackAddress(-2);
+        e.loadCpu32(RDX, layout.flags);
+        e.ri(ExtAnd, RDX, 0xe0);
+        e.rr(OpOr, RDX, REG_FLAGS);
+        e.store8(REG_MEM, RAX, RDX);
+        markWritten(RAX);
+        e.mov(REG_SP, RAX);
+        break;
+    case 0xf1: // POP PSW
+        pop(pc);
+        e.mov(REG_A, RDX);
+        e.loadCpu32(RAX, layout.flags);
+        e.ri(ExtAnd, RAX, 0xff00);
+        e.rr(OpOr, RAX, RCX);
+        e.storeCpu32(layout.flags, RAX);
+        e.mov(REG_FLAGS, RCX);
+        e.ri(ExtAnd, REG_FLAGS, ALU_FLAGS);
+        account(opcode.cycles, next);
+        // The popped byte may have disabled the processor.
+        e.test(RAX, 1 << 6);
+        exitTo(e.jcc(CondE), next);
+        return true;
+    case 0xeb: // XCHG
+        e.mov(RAX, reg(RegD));
+        e.mov(reg(RegD), REG_H);
+        e.mov(REG_H, RAX);
+        e.mov(RAX, reg(RegE));
+        e.mov(reg(RegE), REG_L);
+        e.mov(REG_L, RAX);
+        break;
+    case 0xe3: // XTHL
+        e.mov(RAX, REG_SP);
+        checkRead(RAX, pc);
+        checkWrite(RAX, pc);
+        stackAddress(1);
+        checkRead(RAX, pc);
+        checkWrite(RAX, pc);
+        e.mov(RAX, REG_SP);
+        e.load8(RCX, REG_MEM, RAX);
+        e.store8(REG_MEM, RAX, REG_L);
+        stackAddress(1);
+        e.load8(RDX, REG_MEM, RAX);
+        e.store8(REG_MEM, RAX, REG_H);
+        e.mov(REG_L, RCX);
+        e.mov(REG_H, RDX);
+        markWritten(RAX);
+        e.mov(RAX, REG_SP);
+        markWritten(RAX);
+        break;
+    case 0xf9: pair(REG_SP, REG_H, REG_L); break; // SPHL
+
+    // Loads and stores
+    case 0x02: case 0x12: // STAX B
+        pair(RAX, reg(d), reg(d + 1));
+        checkWrite(RAX, pc);
+        e.store8(REG_MEM, RAX, REG_A);
+        markWritten(RAX);
+        break;
+    case 0x0a: case 0x1a: // LDAX B
+        pair(RAX, reg(d - 1), reg(d));
+        checkRead(RAX, pc);
+        e.load8(REG_A, REG_MEM, RAX);
+        break;
+    case 0x32: // STA addr
+        e.movImm(RAX, addr);
+        checkWrite(RAX, pc);
+        e.store8(REG_MEM, RAX, REG_A);
+        markWritten(RAX);
+        break;
+    case 0x3a: // LDA addr
+        e.movImm(RAX, addr);
+        checkRead(RAX, pc);
+        e.load8(REG_A, REG_MEM, RAX);
+        break;
+    case 0x22: // SHLD addr
+        e.movImm(RAX, (uint16_t)(addr+1));
+        checkWrite(RAX, pc);
+        e.movImm(RAX, addr);
+        checkWrite(RAX, pc);
+        e.store8(REG_MEM, RAX, REG_L);
+        markWritten(RAX);
+        e.movImm(RAX, (uint16_t)(addr+1));
+        e.store8(REG_MEM, RAX, REG_H);
+        markWritten(RAX);
+        break;
+    case 0x2a: // LHLD addr
+        e.movImm(RAX, (uint16_t)(addr+1));
+        checkRead(RAX, pc);
+        e.movImm(RAX, addr);
+        checkRead(RAX, pc);
+        e.load8(REG_L, REG_MEM, RAX);
+        e.movImm(RAX, (uint16_t)(addr+1));
+        e.load8(REG_H, REG_MEM, RAX);
+        break;
+    case 0x06: case 0x0e: case 0x16: case 0x1e: // MVI D,d8
+    case 0x26: case 0x2e: case 0x36: case 0x3e:
+        if (d == RegM) {
+            pair(RAX, REG_H, REG_L);
+            checkWrite(RAX, pc);
+            e.store8Imm(REG_MEM, RAX, imm);
+            markWritten(RAX);
+        } else {
+            e.movImm(reg(d), imm);
+        }
+        break;
+
+    // Arithmetic and logic
+    case 0x04: case 0x0c: case 0x14: case 0x1c: // INR D
+    case 0x24: case 0x2c: case 0x34: case 0x3c:
+    case 0x05: case 0x0d: case 0x15: case 0x1d: // DCR D
+    case 0x25: case 0x2d: case 0x35: case 0x3d:
+        if (d == RegM) {
+            pair(RAX, REG_H, REG_L);
+            checkRead(RAX, pc);
+            checkWrite(RAX, pc);
+            e.load8(RCX, REG_MEM, RAX);
+            incdec(RCX, op & 1);
+            e.store8(REG_MEM, RAX, RCX);
+            markWritten(RAX);
+        } else {
+            incdec(reg(d), op & 1);
+        }
+        break;
+    case 0xc6: case 0xce: case 0xd6: case 0xde: case 0xfe: // ADI, ACI, SUI, SBI, CPI d8
+        e.movImm(RCX, imm);
+        arithmetic(RCX, op & 0x10, op == 0xce || op == 0xde, op != 0xfe);
+        break;
+    case 0xe6: // ANI d8
+        e.movImm(RCX, imm);
+        logical(OpAnd, RCX);
+        break;
+    case 0xee: case 0xf6: // XRI d8, ORI d8, which leave AC alone
+        e.ri(op == 0xee ? ExtXor : ExtOr, REG_A, imm);
+        flagsFrom(zsp_flags, REG_A, FlagZero|FlagSign|FlagParity|FlagCarry);
+        break;
+    case 0x2f: e.ri(ExtXor, REG_A, 0xff); break;     // CMA
+    case 0x37: e.ri(ExtOr, REG_FLAGS, FlagCarry); break;  // STC
+    case 0x3f: e.ri(ExtXor, REG_FLAGS, FlagCarry); break; // CMC
+    case 0x07: // RLC
+        e.mov(RAX, REG_A);
+        e.shift(ExtShr, RAX, 7);
+        e.shift(ExtShl, REG_A, 1);
+        e.rr(OpOr, REG_A, RAX);
+        e.ri(ExtAnd, REG_A, 0xff);
+        carryFromRotate();
+        break;
+    case 0x0f: // RRC
+        e.mov(RAX, REG_A);
+        e.ri(ExtAnd, RAX, 1);
+        e.shift(ExtShr, REG_A, 1);
+        e.mov(RCX, RAX);
+        e.shift(ExtShl, RCX, 7);
+        e.rr(OpOr, REG_A, RCX);
+        carryFromRotate();
+        break;
+    case 0x17: // RAL
+        e.mov(RAX, REG_A);
+        e.shift(ExtShr, RAX, 7);
+        e.mov(RCX, REG_FLAGS);
+        e.shift(ExtShr, RCX, 3);
+        e.ri(ExtAnd, RCX, 1);
+        e.shift(ExtShl, REG_A, 1);
+        e.rr(OpOr, REG_A, RCX);
+        e.ri(ExtAnd, REG_A, 0xff);
+        carryFromRotate();
+        break;
+    case 0x1f: // RAR
+        e.mov(RAX, REG_A);
+        e.ri(ExtAnd, RAX, 1);
+        e.mov(RCX, REG_FLAGS);
+        e.ri(ExtAnd, RCX, FlagCarry);
+        e.shift(ExtShl, RCX, 4);
+        e.shift(ExtShr, REG_A, 1);
+        e.rr(OpOr, REG_A, RCX);
+        carryFromRotate();
+        break;
+    case 0xfb: e.orCpu32(layout.flags, 1 << 5); break; // EI
+
+    // Jumps, calls and returns
+    case 0xc3: // JMP addr
+        account(opcode.cycles, addr);
+        *ended = true;
+        return true;
+    case 0xe9: // PCHL
+        pair(RAX, REG_H, REG_L);
+        accountDynamic(opcode.cycles);
+        chainDynamic();
+        *ended = true;
+        return true;
+    case 0xc2: case 0xca: case 0xd2: case 0xda: // Jcc addr
+    case 0xe2: case 0xea: case 0xf2: case 0xfa: {
+        Condition(op, &flag, &set);
+        e.test(REG_FLAGS, flag);
+        uint8_t *not_taken = e.jcc(set ? CondE : CondNE);
+        account(opcode.cycles, addr);
+        chain(addr);
+        Patch(not_taken, e.p);
+        account(opcode.cycles, next);
+        *ended = true;
+        return true;
+    }
+    case 0xcd: // CALL addr
+        // Diagnostic Mode prints through CALL 5, see CPU::step().
+        if (addr == 5) {
+            return false;
+        }
+        push(~(next >> 8), ~(next & 0xff), pc);
+        account(opcode.cycles, addr);
+        *ended = true;
+        return true;
+    case 0xc4: case 0xcc: case 0xd4: case 0xdc: // Ccc addr
+    case 0xe4: case 0xec: case 0xf4: case 0xfc: {
+        Condition(op, &flag, &set);
+        e.test(REG_FLAGS, flag);
+        uint8_t *not_taken = e.jcc(set ? CondE : CondNE);
+        push(~(next >> 8), ~(next & 0xff), pc);
+        account(opcode.cycles, addr);
+        chain(addr);
+        Patch(not_taken, e.p);
+        account(11, next);
+        *ended = true;
+        return true;
+    }
+    case 0xc9: // RET
+        pop(pc);
+        e.shift(ExtShl, RDX, 8);
+        e.rr(OpOr, RCX, RDX);
+        e.mov(RAX, RCX);
+        accountDynamic(opcode.cycles);
+        chainDynamic();
+        *ended = true;
+        return true;
+    case 0xc0: case 0xc8: case 0xd0: case 0xd8: // Rcc
+    case 0xe0: case 0xe8: case 0xf0: case 0xf8: {
+        Condition(op, &flag, &set);
+        e.test(REG_FLAGS, flag);
+        uint8_t *not_taken = e.jcc(set ? CondE : CondNE);
+        pop(pc);
+        e.shift(ExtShl, RDX, 8);
+        e.rr(OpOr, RCX, RDX);
+        e.mov(RAX, RCX);
+        accountDynamic(opcode.cycles);
+        chainDynamic();
+        Patch(not_taken, e.p);
+        account(5, next);
+        *ended = true;
+        return true;
+    }
+
+    default:
+        if (op >= 0x40 && op < 0x80 && op != 0x76) { // MOV D,S, 0x76 is HLT
+            if (d == RegM) {
+                pair(RAX, REG_H, REG_L);
+                checkWrite(RAX, pc);
+                e.store8(REG_MEM, RAX, reg(s));
+                markWritten(RAX);
+            } else if (s == RegM) {
+                pair(RAX, REG_H, REG_L);
+                checkRead(RAX, pc);
+                e.load8(reg(d), REG_MEM, RAX);
+            } else {
+                e.mov(reg(d), reg(s));
+            }
+            break;
+        }
+        if (op >= 0x80 && op < 0xc0) { // ADD S to CMP S
+            int val = source(s, pc);
+            switch (d) {
+            case 0: arithmetic(val, false, false, true); break; // ADD
+            case 1: arithmetic(val, false, true, true); break;  // ADC
+            case 2: arithmetic(val, true, false, true); break;  // SUB
+            case 3: arithmetic(val, true, true, true); break;   // SBB
+            case 4: logical(OpAnd, val); break;                 // ANA
+            case 5: logical(OpXor, val); break;                 // XRA
+            case 6: logical(OpOr, val); break;                  // ORA
+            default: arithmetic(val, true, false, false); break; // CMP
+            }
+            break;
+        }
+        // HLT, DAA, IN/OUT and anything else is interpreted.
+        return false;
+    }
+
+    account(opcode.cycles, next);
+    return true;
+}
+
+}
+
+Jit::Jit(CPU *processor)
+{
+    cpu = processor;
+    code = 0;
+    entries = new void *[0x10000];
+    heat = new uint8_t[0x10000];
+    memset(entries, 0, 0x10000 * sizeof(void *));
+    memset(heat, 0, 0x10000);
+
+#ifdef I8080_JIT
+#ifdef _WIN32
+    code = (uint8_t *)VirtualAlloc(0, code_size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+    code = (uint8_t *)mmap(0, code_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED) {
+        code = 0;
+    }
+#endif
+#endif
+
+    if (code) {
+        emitStubs();
+    } else {
+        qDebug() << "JIT not available, interpreting";
+    }
+
+    cpu->memory->jit = this;
+}
+
+Jit::~Jit()
+{
+    cpu->memory->jit = 0;
+#ifdef I8080_JIT
+    if (code) {
+#ifdef _WIN32
+        VirtualFree(code, 0, MEM_RELEASE);
+#else
+        munmap(code, code_size);
+#endif
+    }
+#endif
+    delete[] entries;
+    delete[] heat;
+}
+
+bool Jit::available()
+{
+#ifdef I8080_JIT
+    return true;
+#else
+    return false;
+#endif
+}
+
+// enter(cpu, mem, budget, entry) saves the host registers, loads the
+// 8080 registers and jumps to the entry, common_exit stores them back
+// with the pc in eax and returns the cycles executed.
+void Jit::emitStubs()
+{
+    static const int saved[8] = { RBX, RBP, RSI, RDI, R12, R13, R14, R15 };
+    CpuLayout layout(cpu);
+    Emitter e(code);
+
+    enter = (int (*)(CPU *, uint8_t *, int, void *))e.p;
+    for (int i = 0; i < 8; i++) {
+        e.push(saved[i]);
+    }
+    e.ri64(ExtSub, RSP, 40); // shadow space and budget slot, keeps rsp 16 byte aligned
+    e.rr64(OpMov, REG_CPU, ARG0);
+    e.rr64(OpMov, REG_MEM, ARG1);
+    e.storeSlot32(budget_slot, ARG2);
+    e.rr64(OpMov, RAX, ARG3);
+    e.loadCpu8(REG_A, layout.a);
+    e.loadCpu8(host_regs[RegB], layout.b);
+    e.loadCpu8(host_regs[RegC], layout.c);
+    e.loadCpu8(host_regs[RegD], layout.d);
+    e.loadCpu8(host_regs[RegE], layout.e);
+    e.loadCpu8(REG_H, layout.h);
+    e.loadCpu8(REG_L, layout.l);
+    e.loadCpu16(REG_SP, layout.sp);
+    e.loadCpu32(REG_FLAGS, layout.flags);
+    e.ri(ExtAnd, REG_FLAGS, ALU_FLAGS);
+    e.rr(OpXor, REG_CYCLES, REG_CYCLES);
+    e.jmpReg(RAX);
+
+    common_exit = e.p;
+    e.storeCpu16(layout.pc, RAX);
+    e.storeCpu8(layout.a, REG_A);
+    e.storeCpu8(layout.b, host_regs[RegB]);
+    e.storeCpu8(layout.c, host_regs[RegC]);
+    e.storeCpu8(layout.d, host_regs[RegD]);
+    e.storeCpu8(layout.e, host_regs[RegE]);
+    e.storeCpu8(layout.h, REG_H);
+    e.storeCpu8(layout.l, REG_L);
+    e.storeCpu16(layout.sp, REG_SP);
+    e.loadCpu32(RCX, layout.flags);
+    e.ri(ExtAnd, RCX, ~ALU_FLAGS);
+    e.rr(OpOr, RCX, REG_FLAGS);
+    e.storeCpu32(layout.flags, RCX);
+    e.mov(RAX, REG_CYCLES);
+    e.ri64(ExtAdd, RSP, 40);
+    for (int i = 7; i >= 0; i--) {
+        e.pop(saved[i]);
+    }
+    e.ret();
+
+    code_blocks = e.p;
+    code_end = e.p;
+}
+
+void *Jit::compile(uint16_t start)
+{
+    if (code_end + max_block_code > code + code_size) {
+        flush();
+    }
+
+    const uint8_t *mem = cpu->memory->data;
+    Translator t(cpu, cpu->instruction_handlers, start, code_end, common_exit, entries);
+    uint16_t pc = start;
+    bool ended = false;
+    int count = 0;
+
+    while (count < max_block_length && !ended) {
+        uint8_t op = mem[pc];
+        // Blocks leave to run() at native routines, see CPU::addRoutine().
+        if (cpu->hasRoutine(pc) || !t.translate(pc, mem, &ended)) {
+            break;
+        }
+        if (ended && (op == 0xc3 || op == 0xcd)) {
+            // JMP and CALL chain to their target.
+            t.chain((uint16_t)((mem[(uint16_t)(pc+2)] << 8) | mem[(uint16_t)(pc+1)]));
+        } else if (ended && ((op & 0xc7) == 0xc2 || (op & 0xc7) == 0xc4 || (op & 0xc7) == 0xc0)) {
+            // Jcc, Ccc and Rcc chain to the next instruction when not taken.
+            t.chain(pc + i8080_instructions[op].length);
+        }
+        pc += i8080_instructions[op].length;
+        count++;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+    if (!ended) {
+        t.chain(pc);
+    }
+    t.emitExits();
+    code_end = t.e.p;
+
+    // Chained jumps to this block get resolved.
+    for (uint8_t *rel : links.take(start)) {
+        Patch(rel, t.entry);
+    }
+    for (const QPair<uint8_t *, uint16_t> &link : t.unresolved) {
+        links[link.second].append(link.first);
+    }
+
+    entries[start] = t.entry;
+
+    // Translated code is dropped once written to, see invalidate().
+    uint16_t length = pc - start;
+    int first_page = start >> 8;
+    int last_page = (uint16_t)(start + length - 1) >> 8;
+    for (int page = first_page; ; page = (page + 1) & 0xff) {
+        page_ranges[page].append(((uint32_t)start << 16) | length);
+        cpu->memory->code_pages[page] |= 2;
+        if (page == last_page) {
+            break;
+        }
+    }
+
+    return t.entry;
+}
+
+int Jit::run(int cycles)
+{
+    CPU *processor = cpu;
+    int executed = 0;
+    uint8_t *mem = processor->memory->data;
+
+    while (executed < cycles && (processor->flags&(1 << 6))) {
+        uint16_t pc = processor->pc;
+
+        if (processor->hasRoutine(pc)) {
+            int routine_cycles = processor->runRoutine(cycles - executed);
+            if (routine_cycles > 0) {
+                executed += routine_cycles;
+                continue;
+            }
+        }
+
+        void *entry = entries[pc];
+
+        if (!entry && code && heat[pc] < hot_threshold && ++heat[pc] == hot_threshold) {
+            entry = compile(pc);
+        }
+
+        if (entry) {
+            int ran = (*enter)(processor, mem, cycles - executed, entry);
+            if (ran > 0) {
+                executed += ran;
+                continue;
+            }
+            // Left before its first instruction, interpret it.
+        }
+
+        int inst_cycles = processor->step();
+        if (inst_cycles == 0) {
+            break;
+        }
+        executed += inst_cycles;
+    }
+
+    return executed;
+}
+
+void Jit::invalidate(uint16_t addr)
+{
+    for (uint32_t range : page_ranges[addr >> 8]) {
+        if ((uint16_t)(addr - (range >> 16)) < (range & 0xffff)) {
+            flush();
+            return;
+        }
+    }
+}
+
+void Jit::flush()
+{
+    code_end = code_blocks;
+    memset(entries, 0, 0x10000 * sizeof(void *));
+    memset(heat, 0, 0x10000);
+    links.clear();
+    for (int page = 0; page < 0x100; page++) {
+        page_ranges[page].clear();
+        cpu->memory->code_pages[page] &= ~2;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef I8080JIT_H
+#define I8080JIT_H
+
+#include <stdint.h>
+
+#include <QHash>
+#include <QVector>
+
+#include "cpu.h"
+
+/*
+ x86-64 dynamic recompiler
+
+ CPU::JitEngine translates hot basic blocks into native code. A pc becomes
+ hot after hot_threshold entries from the dispatcher in run(). Until then,
+ and for everything the recompiler does not translate, instructions are
+ interpreted one at a time with CPU::step() through the handler table.
+
+ Within native code the 8080 registers live in host registers:
+
+   A r8   B r9   C r10  D r11  E r12  H r13  L r14  SP r15
+   Z, S, P, CY and AC (flags bits 0-4) esi, cycles executed edi
+   CPU* rbp, memory rbx, scratch rax, rcx and rdx
+
+ They are loaded from and stored back to the CPU by the entry and exit
+ stubs at the start of the code buffer. Blocks jump directly to the
+ blocks they branch to once those are compiled, returns and PCHL chain
+ through the entries table.
+
+ Every translated instruction adds its cycles and leaves native code once
+ the budget is used up, so run() stops at exactly the same instruction
+ as the interpreter. This also makes the recompiler checkable against the
+ handler table instruction by instruction, by running budgets of 1 cycle.
+
+ Not translated, so interpreted:
+ - IN/OUT and any other machine callback (setCallback())
+ - HLT, DAA, instructions without a core handler
+ - CALL 5, which is the CP/M print routine in Diagnostic Mode
+ - PUSH B/D/H outside of safe memory, which disables the processor
+ - any write to a page holding pre-decoded or translated code. The
+   interpreter performs it through MemoryMap::write(), which flushes the
+   translations if the write hits translated code.
+ - writes to pages that are not plain RAM, watched or shared with a
+   snapshot, and reads of mirrored or device pages, which go through
+   MemoryMap's page table.
+
+ Writes to pages given to MemoryMap::trackWrites(), the video RAM, stay
+ native and set their dirty bit inline.
+
+ Only available on x86-64 hosts, elsewhere run() interprets everything.
+*/
+
+class Jit
+{
+public:
+    Jit(CPU *processor);
+    ~Jit();
+    // Executes instructions until at least `cycles` cycles have been
+    // emulated, or the processor is disabled or reaches an unknown
+    // instruction. Returns the cycles emulated.
+    int run(int cycles);
+    // Flushes all translations if `addr` holds translated code.
+    void invalidate(uint16_t addr);
+    void flush(void);
+    static bool available(void);
+private:
+    static const int code_size = 4 * 1024 * 1024;
+    static const int max_block_length = 64;
+    static const int max_block_code = 64 * 1024;
+    static const uint8_t hot_threshold = 8;
+    void *compile(uint16_t pc);
+    void emitStubs(void);
+    CPU *cpu;
+    uint8_t *code;         // executable buffer, the stubs followed by blocks
+    uint8_t *code_blocks;  // first byte after the stubs
+    uint8_t *code_end;     // next free byte
+    uint8_t *common_exit;  // stores the registers, pc in eax, and returns
+    int (*enter)(CPU *processor, uint8_t *mem, int budget, void *entry);
+    void **entries;        // native code by pc, or 0
+    uint8_t *heat;         // dispatcher entries by pc, up to hot_threshold
+    QHash<uint16_t, QVector<uint8_t *> > links; // rel32 fields jumping to an exit stub of a pc
+    QVector<uint32_t> page_ranges[0x100];       // start << 16 | length of blocks per page
+};
+
+#endif // I8080JIT_H
@@ -0,0 +1,5 @@
+#include "i8080switchengine.h"
+
+// The bus instances every machine can use, see i8080switchengine.h.
+template int RunSwitchEngine<FlatBus>(CPU *processor, int cycles);
+template int RunSwitchEngine<CheckedBus>(CPU *processor, int cycles);
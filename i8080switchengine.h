@@ -0,0 +1,718 @@
+#ifndef I8080SWITCHENGINE_H
+#define I8080SWITCHENGINE_H
+
+#include "i8080.h"
+#include "i8080bus.h"
+#include "disassembler.h"
+
+#include <QDebug>
+
+/*
+ Switch dispatched execution engine.
+
+ Executes the same instruction set as the instruction_handlers table,
+ but in one loop without an indirect call per instruction. Instructions
+ that only differ by their register operand are generated from a single
+ template, the operand is encoded in the opcode bits as
+
+ 000 B, 001 C, 010 D, 011 E, 100 H, 101 L, 110 M (memory at HL), 111 A
+
+ e.g. MOV D,S is 01DDDSSS, ADD S is 10000SSS and INR D is 00DDD100.
+
+ Immediate operands are read relative to the address of the instruction,
+ processor->pc already points to the next instruction when an instruction
+ is executed, so jumps, calls and returns simply overwrite it.
+
+ Lazy flags
+
+ Most Z, S and P results are overwritten before anything reads them, so
+ the ALU only records the 8-bit result they derive from in zsp_result.
+ They are materialized into processor->flags by the conditional jumps,
+ calls and returns testing them, PUSH PSW, machine callbacks and whenever
+ the engine returns, so flags are always complete outside of the engine.
+ CY and AC are read from the i8080flags.h tables eagerly.
+
+ Bus
+
+ The engine is a template over the bus it reaches memory and the I/O
+ ports through, see i8080bus.h. CPU::switch_engine holds the instance a
+ machine runs, RunSwitchEngine<FlatBus> unless the machine sets its own,
+ e.g. RunSwitchEngine<InvadersBus> with the ports inline. The FlatBus and
+ CheckedBus instances are compiled once, in i8080switchengine.cpp.
+*/
+
+namespace SwitchEngineOps {
+
+enum Operand { RegB, RegC, RegD, RegE, RegH, RegL, RegM, RegA };
+
+template<int R, class Bus>
+inline uint8_t ReadOperand(CPU *processor, Bus &bus)
+{
+    switch (R) {
+    case RegB: return processor->b;
+    case RegC: return processor->c;
+    case RegD: return processor->d;
+    case RegE: return processor->e;
+    case RegH: return processor->h;
+    case RegL: return processor->l;
+    case RegM: return bus.read8((processor->h << 8) | processor->l);
+    default:   return processor->a;
+    }
+}
+
+template<int R, class Bus>
+inline void WriteOperand(CPU *processor, Bus &bus, uint8_t val)
+{
+    switch (R) {
+    case RegB: processor->b = val; break;
+    case RegC: processor->c = val; break;
+    case RegD: processor->d = val; break;
+    case RegE: processor->e = val; break;
+    case RegH: processor->h = val; break;
+    case RegL: processor->l = val; break;
+    case RegM: bus.write8((processor->h << 8) | processor->l, val); break;
+    default:   processor->a = val; break;
+    }
+}
+
+template<class Bus>
+inline uint8_t Immediate(Bus &bus, uint16_t pc)
+{
+    return bus.fetch8(pc+1);
+}
+
+template<class Bus>
+inline uint16_t Address(Bus &bus, uint16_t pc)
+{
+    return (uint16_t)((bus.fetch8(pc+2) << 8) | bus.fetch8(pc+1));
+}
+
+template<class Bus>
+inline void Push(CPU *processor, Bus &bus, uint8_t high, uint8_t low)
+{
+    bus.write8(processor->sp-1, high);
+    bus.write8(processor->sp-2, low);
+    processor->sp -= 2;
+}
+
+template<class Bus>
+inline uint16_t Pop(CPU *processor, Bus &bus)
+{
+    uint16_t val = (uint16_t)((bus.read8(processor->sp+1) << 8) | bus.read8(processor->sp));
+    processor->sp += 2;
+    return val;
+}
+
+inline void MaterializeFlags(CPU *processor)
+{
+    if (processor->zsp_pending) {
+        processor->flags = (processor->flags & ~(FlagZero|FlagSign|FlagParity)) | zsp_flags[processor->zsp_result];
+        processor->zsp_pending = false;
+    }
+}
+
+inline void SetFlagsZSPLazy(CPU *processor, uint8_t res)
+{
+    processor->zsp_result = res;
+    processor->zsp_pending = true;
+}
+
+// Takes CY and AC from a flag table entry
+inline void SetCarryAux(CPU *processor, uint8_t table_flags)
+{
+    processor->flags = (processor->flags & ~(FlagCarry|FlagAuxCarry)) | (table_flags & (FlagCarry|FlagAuxCarry));
+}
+
+// Lazy SetFlagsAdd()
+inline void SetFlagsAddLazy(CPU *processor, uint8_t a, uint8_t val, int carry)
+{
+    SetCarryAux(processor, add_flags[carry][a][val]);
+    SetFlagsZSPLazy(processor, a + val + carry);
+}
+
+// Lazy SetFlagsSub()
+inline void SetFlagsSubLazy(CPU *processor, uint8_t a, uint8_t val, int borrow)
+{
+    SetCarryAux(processor, sub_flags[borrow][a][val]);
+    SetFlagsZSPLazy(processor, a - val - borrow);
+}
+
+inline int Carry(CPU *processor)
+{
+    return (processor->flags&(1 << 3))?1:0;
+}
+
+// Lazy SetFlagsAfterLogicalOperation()
+inline void SetFlagsLogical(CPU *processor)
+{
+    processor->flags &= ~((1 << 3) | (1 << 4));
+    SetFlagsZSPLazy(processor, processor->a);
+}
+
+template<int Flag, bool Set>
+inline bool Condition(CPU *processor)
+{
+    if (Flag != FlagCarry) {
+        MaterializeFlags(processor);
+    }
+    return ((processor->flags & Flag) != 0) == Set;
+}
+
+// MOV D,S
+template<int D, int S, class Bus>
+inline void Mov(CPU *processor, Bus &bus)
+{
+    WriteOperand<D>(processor, bus, ReadOperand<S>(processor, bus));
+}
+
+// MVI D,d8
+template<int D, class Bus>
+inline void Mvi(CPU *processor, Bus &bus, uint16_t pc)
+{
+    WriteOperand<D>(processor, bus, Immediate(bus, pc));
+}
+
+// INR D
+template<int D, class Bus>
+inline void Inr(CPU *processor, Bus &bus)
+{
+    uint8_t res = ReadOperand<D>(processor, bus) + 1;
+    processor->flags = (processor->flags & ~FlagAuxCarry) | (inr_flags[res] & FlagAuxCarry);
+    SetFlagsZSPLazy(processor, res);
+    WriteOperand<D>(processor, bus, res);
+}
+
+// DCR D
+template<int D, class Bus>
+inline void Dcr(CPU *processor, Bus &bus)
+{
+    uint8_t res = ReadOperand<D>(processor, bus) - 1;
+    processor->flags = (processor->flags & ~FlagAuxCarry) | (dcr_flags[res] & FlagAuxCarry);
+    SetFlagsZSPLazy(processor, res);
+    WriteOperand<D>(processor, bus, res);
+}
+
+// ADD S
+template<int S, class Bus>
+inline void Add(CPU *processor, Bus &bus)
+{
+    uint8_t val = ReadOperand<S>(processor, bus);
+    SetFlagsAddLazy(processor, processor->a, val, 0);
+    processor->a += val;
+}
+
+// ADC S
+template<int S, class Bus>
+inline void Adc(CPU *processor, Bus &bus)
+{
+    uint8_t val = ReadOperand<S>(processor, bus);
+    int carry = Carry(processor);
+    SetFlagsAddLazy(processor, processor->a, val, carry);
+    processor->a += val + carry;
+}
+
+// SUB S
+template<int S, class Bus>
+inline void Sub(CPU *processor, Bus &bus)
+{
+    uint8_t val = ReadOperand<S>(processor, bus);
+    SetFlagsSubLazy(processor, processor->a, val, 0);
+    processor->a -= val;
+}
+
+// SBB S
+template<int S, class Bus>
+inline void Sbb(CPU *processor, Bus &bus)
+{
+    uint8_t val = ReadOperand<S>(processor, bus);
+    int borrow = Carry(processor);
+    SetFlagsSubLazy(processor, processor->a, val, borrow);
+    processor->a -= val + borrow;
+}
+
+// ANA S
+template<int S, class Bus>
+inline void Ana(CPU *processor, Bus &bus)
+{
+    processor->a = processor->a & ReadOperand<S>(processor, bus);
+    SetFlagsLogical(processor);
+}
+
+// XRA S
+template<int S, class Bus>
+inline void Xra(CPU *processor, Bus &bus)
+{
+    processor->a = processor->a ^ ReadOperand<S>(processor, bus);
+    SetFlagsLogical(processor);
+}
+
+// ORA S
+template<int S, class Bus>
+inline void Ora(CPU *processor, Bus &bus)
+{
+    processor->a = processor->a | ReadOperand<S>(processor, bus);
+    SetFlagsLogical(processor);
+}
+
+// CMP S
+template<int S, class Bus>
+inline void Cmp(CPU *processor, Bus &bus)
+{
+    SetFlagsSubLazy(processor, processor->a, ReadOperand<S>(processor, bus), 0);
+}
+
+// LXI H,d16 where the pair is H (high) and L (low)
+template<int H, int L, class Bus>
+inline void Lxi(CPU *processor, Bus &bus, uint16_t pc)
+{
+    WriteOperand<L>(processor, bus, bus.fetch8(pc+1));
+    WriteOperand<H>(processor, bus, bus.fetch8(pc+2));
+}
+
+// INX H
+template<int H, int L, class Bus>
+inline void Inx(CPU *processor, Bus &bus)
+{
+    uint8_t low = ReadOperand<L>(processor, bus) + 1;
+    WriteOperand<L>(processor, bus, low);
+    if (low == 0) WriteOperand<H>(processor, bus, ReadOperand<H>(processor, bus) + 1);
+}
+
+// DCX H
+template<int H, int L, class Bus>
+inline void Dcx(CPU *processor, Bus &bus)
+{
+    uint8_t low = ReadOperand<L>(processor, bus) - 1;
+    WriteOperand<L>(processor, bus, low);
+    if (low == 0xFF) WriteOperand<H>(processor, bus, ReadOperand<H>(processor, bus) - 1);
+}
+
+inline void Dad(CPU *processor, uint16_t val)
+{
+    uint32_t add = ((processor->h << 8) | processor->l) + val;
+
+    processor->h = (add & 0xff00) >> 8;
+    processor->l = add & 0xff;
+
+    if ((add & 0xffff0000) != 0) {
+        processor->flags |= (1 << 3);
+    } else {
+        processor->flags &= ~(1 << 3);
+    }
+}
+
+// PUSH H
+template<int H, int L, class Bus>
+inline void PushPair(CPU *processor, Bus &bus)
+{
+    if (((processor->flags&(1 << 7)) == 0) && (((processor->sp-2) < 0x2000) || ((processor->sp-1) >= 0x4000))) {
+        qDebug() << "Writing outside of safe memory";
+        processor->flags &= ~(1 << 6); // Disable the processor.
+    }
+    Push(processor, bus, ReadOperand<H>(processor, bus), ReadOperand<L>(processor, bus));
+}
+
+// POP H
+template<int H, int L, class Bus>
+inline void PopPair(CPU *processor, Bus &bus)
+{
+    uint16_t val = Pop(processor, bus);
+    WriteOperand<H>(processor, bus, val >> 8);
+    WriteOperand<L>(processor, bus, val & 0xff);
+}
+
+// Jcc addr
+template<int Flag, bool Set, class Bus>
+inline void JumpIf(CPU *processor, Bus &bus, uint16_t pc)
+{
+    if (Condition<Flag, Set>(processor)) {
+        processor->pc = Address(bus, pc);
+    }
+}
+
+// Ccc addr, returns the cycles taken.
+template<int Flag, bool Set, class Bus>
+inline int CallIf(CPU *processor, Bus &bus, uint16_t pc, int inst_cycles)
+{
+    if (Condition<Flag, Set>(processor)) {
+        Push(processor, bus, processor->pc >> 8, processor->pc & 0xff);
+        processor->pc = Address(bus, pc);
+        return inst_cycles;
+    }
+    return 11;
+}
+
+// Rcc, returns the cycles taken.
+template<int Flag, bool Set, class Bus>
+inline int ReturnIf(CPU *processor, Bus &bus, int inst_cycles)
+{
+    if (Condition<Flag, Set>(processor)) {
+        processor->pc = Pop(processor, bus);
+        return inst_cycles;
+    }
+    return 5;
+}
+
+}
+
+// Expand one case per register operand, in bits 0-2 (source)
+// or bits 3-5 (destination) of the opcode.
+#define CASE_SOURCES(base, op, ...) \
+        case (base)+RegB: op<RegB>(__VA_ARGS__); break; \
+        case (base)+RegC: op<RegC>(__VA_ARGS__); break; \
+        case (base)+RegD: op<RegD>(__VA_ARGS__); break; \
+        case (base)+RegE: op<RegE>(__VA_ARGS__); break; \
+        case (base)+RegH: op<RegH>(__VA_ARGS__); break; \
+        case (base)+RegL: op<RegL>(__VA_ARGS__); break; \
+        case (base)+RegM: op<RegM>(__VA_ARGS__); break; \
+        case (base)+RegA: op<RegA>(__VA_ARGS__); break;
+
+#define CASE_DESTINATIONS(base, op, ...) \
+        case (base)+(RegB<<3): op<RegB>(__VA_ARGS__); break; \
+        case (base)+(RegC<<3): op<RegC>(__VA_ARGS__); break; \
+        case (base)+(RegD<<3): op<RegD>(__VA_ARGS__); break; \
+        case (base)+(RegE<<3): op<RegE>(__VA_ARGS__); break; \
+        case (base)+(RegH<<3): op<RegH>(__VA_ARGS__); break; \
+        case (base)+(RegL<<3): op<RegL>(__VA_ARGS__); break; \
+        case (base)+(RegM<<3): op<RegM>(__VA_ARGS__); break; \
+        case (base)+(RegA<<3): op<RegA>(__VA_ARGS__); break;
+
+template<class Bus, bool LazyFlags>
+int RunSwitchEngineLoop(CPU *processor, int cycles)
+{
+    using namespace SwitchEngineOps;
+
+    Bus bus(processor);
+    int executed = 0;
+
+    while (executed < cycles) {
+        const uint16_t pc = processor->pc;
+
+        if (processor->hasRoutine(pc)) {
+            MaterializeFlags(processor);
+            int routine_cycles = processor->runRoutine(cycles - executed);
+            if (routine_cycles > 0) {
+                executed += routine_cycles;
+                continue;
+            }
+        }
+
+        const uint8_t op = bus.fetch8(pc);
+        const InstructionDef &opcode = i8080_instructions[op];
+        int inst_cycles = opcode.cycles;
+
+        processor->pc += opcode.length;
+
+        switch (op) {
+        case 0x00: break; // NOP
+        case 0x76: processor->flags &= ~(1 << 6); break; // HLT, disable the processor
+
+        // Register pairs
+        case 0x01: Lxi<RegB, RegC>(processor, bus, pc); break; // LXI B,d16
+        case 0x11: Lxi<RegD, RegE>(processor, bus, pc); break; // LXI D,d16
+        case 0x21: Lxi<RegH, RegL>(processor, bus, pc); break; // LXI H,d16
+        case 0x31: processor->sp = Address(bus, pc); break;   // LXI SP,d16
+        case 0x03: Inx<RegB, RegC>(processor, bus); break;     // INX B
+        case 0x13: Inx<RegD, RegE>(processor, bus); break;     // INX D
+        case 0x23: Inx<RegH, RegL>(processor, bus); break;     // INX H
+        case 0x33: processor->sp++; break;                     // INX SP
+        case 0x0b: Dcx<RegB, RegC>(processor, bus); break;     // DCX B
+        case 0x1b: Dcx<RegD, RegE>(processor, bus); break;     // DCX D
+        case 0x2b: Dcx<RegH, RegL>(processor, bus); break;     // DCX H
+        case 0x3b: processor->sp--; break;                     // DCX SP
+        case 0x09: Dad(processor, (processor->b << 8) | processor->c); break; // DAD B
+        case 0x19: Dad(processor, (processor->d << 8) | processor->e); break; // DAD D
+        case 0x29: Dad(processor, (processor->h << 8) | processor->l); break; // DAD H
+        case 0x39: Dad(processor, processor->sp); break;                      // DAD SP
+        case 0xc5: PushPair<RegB, RegC>(processor, bus); break; // PUSH B
+        case 0xd5: PushPair<RegD, RegE>(processor, bus); break; // PUSH D
+        case 0xe5: PushPair<RegH, RegL>(processor, bus); break; // PUSH H
+        case 0xc1: PopPair<RegB, RegC>(processor, bus); break;  // POP B
+        case 0xd1: PopPair<RegD, RegE>(processor, bus); break;  // POP D
+        case 0xe1: PopPair<RegH, RegL>(processor, bus); break;  // POP H
+        case 0xf5: // PUSH PSW
+            MaterializeFlags(processor);
+            Push(processor, bus, processor->a, (uint8_t)processor->flags);
+            break;
+        case 0xf1: { // POP PSW
+            uint16_t val = Pop(processor, bus);
+            processor->zsp_pending = false;
+            processor->flags = ((processor->flags & 0xff00) | (val & 0xff));
+            processor->a = val >> 8;
+            break;
+        }
+        case 0xeb: { // XCHG
+            uint8_t tmpd = processor->d, tmpe = processor->e;
+            processor->d = processor->h;
+            processor->e = processor->l;
+            processor->h = tmpd;
+            processor->l = tmpe;
+            break;
+        }
+        case 0xe3: { // XTHL
+            uint8_t h = processor->h, l = processor->l;
+            processor->h = bus.read8((uint16_t)(processor->sp+1));
+            processor->l = bus.read8(processor->sp);
+            bus.write8((uint16_t)(processor->sp+1), h);
+            bus.write8(processor->sp, l);
+            break;
+        }
+        case 0xf9: processor->sp = (processor->h << 8) | processor->l; break; // SPHL
+
+        // Loads and stores
+        case 0x02: bus.write8((processor->b << 8) | processor->c, processor->a); break; // STAX B
+        case 0x12: bus.write8((processor->d << 8) | processor->e, processor->a); break; // STAX D
+        case 0x0a: processor->a = bus.read8((processor->b << 8) | processor->c); break; // LDAX B
+        case 0x1a: processor->a = bus.read8((processor->d << 8) | processor->e); break; // LDAX D
+        case 0x32: bus.write8(Address(bus, pc), processor->a); break; // STA addr
+        case 0x3a: processor->a = bus.read8(Address(bus, pc)); break; // LDA addr
+        case 0x22: { // SHLD addr
+            uint16_t addr = Address(bus, pc);
+            bus.write8((uint16_t)(addr+1), processor->h);
+            bus.write8(addr, processor->l);
+            break;
+        }
+        case 0x2a: { // LHLD addr
+            uint16_t addr = Address(bus, pc);
+            processor->h = bus.read8((uint16_t)(addr+1));
+            processor->l = bus.read8(addr);
+            break;
+        }
+        CASE_DESTINATIONS(0x06, Mvi, processor, bus, pc) // MVI D,d8
+
+        // MOV D,S
+        case 0x41: Mov<RegB, RegC>(processor, bus); break; // MOV B,C
+        case 0x42: Mov<RegB, RegD>(processor, bus); break; // MOV B,D
+        case 0x43: Mov<RegB, RegE>(processor, bus); break; // MOV B,E
+        case 0x44: Mov<RegB, RegH>(processor, bus); break; // MOV B,H
+        case 0x45: Mov<RegB, RegL>(processor, bus); break; // MOV B,L
+        case 0x46: Mov<RegB, RegM>(processor, bus); break; // MOV B,M
+        case 0x47: Mov<RegB, RegA>(processor, bus); break; // MOV B,A
+        case 0x48: Mov<RegC, RegB>(processor, bus); break; // MOV C,B
+        case 0x4a: Mov<RegC, RegD>(processor, bus); break; // MOV C,D
+        case 0x4b: Mov<RegC, RegE>(processor, bus); break; // MOV C,E
+        case 0x4c: Mov<RegC, RegH>(processor, bus); break; // MOV C,H
+        case 0x4d: Mov<RegC, RegL>(processor, bus); break; // MOV C,L
+        case 0x4e: Mov<RegC, RegM>(processor, bus); break; // MOV C,M
+        case 0x4f: Mov<RegC, RegA>(processor, bus); break; // MOV C,A
+        case 0x50: Mov<RegD, RegB>(processor, bus); break; // MOV D,B
+        case 0x51: Mov<RegD, RegC>(processor, bus); break; // MOV D,C
+        case 0x53: Mov<RegD, RegE>(processor, bus); break; // MOV D,E
+        case 0x54: Mov<RegD, RegH>(processor, bus); break; // MOV D,H
+        case 0x55: Mov<RegD, RegL>(processor, bus); break; // MOV D,L
+        case 0x56: Mov<RegD, RegM>(processor, bus); break; // MOV D,M
+        case 0x57: Mov<RegD, RegA>(processor, bus); break; // MOV D,A
+        case 0x58: Mov<RegE, RegB>(processor, bus); break; // MOV E,B
+        case 0x59: Mov<RegE, RegC>(processor, bus); break; // MOV E,C
+        case 0x5a: Mov<RegE, RegD>(processor, bus); break; // MOV E,D
+        case 0x5c: Mov<RegE, RegH>(processor, bus); break; // MOV E,H
+        case 0x5d: Mov<RegE, RegL>(processor, bus); break; // MOV E,L
+        case 0x5e: Mov<RegE, RegM>(processor, bus); break; // MOV E,M
+        case 0x5f: Mov<RegE, RegA>(processor, bus); break; // MOV E,A
+        case 0x60: Mov<RegH, RegB>(processor, bus); break; // MOV H,B
+        case 0x61: Mov<RegH, RegC>(processor, bus); break; // MOV H,C
+        case 0x62: Mov<RegH, RegD>(processor, bus); break; // MOV H,D
+        case 0x63: Mov<RegH, RegE>(processor, bus); break; // MOV H,E
+        case 0x65: Mov<RegH, RegL>(processor, bus); break; // MOV H,L
+        case 0x66: Mov<RegH, RegM>(processor, bus); break; // MOV H,M
+        case 0x67: Mov<RegH, RegA>(processor, bus); break; // MOV H,A
+        case 0x68: Mov<RegL, RegB>(processor, bus); break; // MOV L,B
+        case 0x69: Mov<RegL, RegC>(processor, bus); break; // MOV L,C
+        case 0x6a: Mov<RegL, RegD>(processor, bus); break; // MOV L,D
+        case 0x6b: Mov<RegL, RegE>(processor, bus); break; // MOV L,E
+        case 0x6c: Mov<RegL, RegH>(processor, bus); break; // MOV L,H
+        case 0x6e: Mov<RegL, RegM>(processor, bus); break; // MOV L,M
+        case 0x6f: Mov<RegL, RegA>(processor, bus); break; // MOV L,A
+        case 0x70: Mov<RegM, RegB>(processor, bus); break; // MOV M,B
+        case 0x71: Mov<RegM, RegC>(processor, bus); break; // MOV M,C
+        case 0x72: Mov<RegM, RegD>(processor, bus); break; // MOV M,D
+        case 0x73: Mov<RegM, RegE>(processor, bus); break; // MOV M,E
+        case 0x74: Mov<RegM, RegH>(processor, bus); break; // MOV M,H
+        case 0x75: Mov<RegM, RegL>(processor, bus); break; // MOV M,L
+        case 0x77: Mov<RegM, RegA>(processor, bus); break; // MOV M,A
+        case 0x78: Mov<RegA, RegB>(processor, bus); break; // MOV A,B
+        case 0x79: Mov<RegA, RegC>(processor, bus); break; // MOV A,C
+        case 0x7a: Mov<RegA, RegD>(processor, bus); break; // MOV A,D
+        case 0x7b: Mov<RegA, RegE>(processor, bus); break; // MOV A,E
+        case 0x7c: Mov<RegA, RegH>(processor, bus); break; // MOV A,H
+        case 0x7d: Mov<RegA, RegL>(processor, bus); break; // MOV A,L
+        case 0x7e: Mov<RegA, RegM>(processor, bus); break; // MOV A,M
+
+        // Arithmetic and logic
+        CASE_DESTINATIONS(0x04, Inr, processor, bus) // INR D
+        CASE_DESTINATIONS(0x05, Dcr, processor, bus) // DCR D
+        CASE_SOURCES(0x80, Add, processor, bus) // ADD S
+        CASE_SOURCES(0x88, Adc, processor, bus) // ADC S
+        CASE_SOURCES(0x90, Sub, processor, bus) // SUB S
+        CASE_SOURCES(0x98, Sbb, processor, bus) // SBB S
+        CASE_SOURCES(0xa0, Ana, processor, bus) // ANA S
+        CASE_SOURCES(0xa8, Xra, processor, bus) // XRA S
+        CASE_SOURCES(0xb0, Ora, processor, bus) // ORA S
+        CASE_SOURCES(0xb8, Cmp, processor, bus) // CMP S
+        case 0xc6: // ADI d8
+        case 0xce: { // ACI d8
+            uint8_t val = Immediate(bus, pc);
+            int carry = (op == 0xce) ? Carry(processor) : 0;
+            SetFlagsAddLazy(processor, processor->a, val, carry);
+            processor->a += val + carry;
+            break;
+        }
+        case 0xd6: // SUI d8
+        case 0xde: // SBI d8
+        case 0xfe: { // CPI d8
+            uint8_t val = Immediate(bus, pc);
+            int borrow = (op == 0xde) ? Carry(processor) : 0;
+            SetFlagsSubLazy(processor, processor->a, val, borrow);
+            if (op != 0xfe) processor->a -= val + borrow;
+            break;
+        }
+        case 0xe6: // ANI d8
+            processor->a = processor->a & Immediate(bus, pc);
+            SetFlagsLogical(processor);
+            break;
+        case 0xee: // XRI d8
+        case 0xf6: { // ORI d8
+            uint8_t val = Immediate(bus, pc);
+            uint8_t res = (op == 0xee) ? (processor->a ^ val) : (processor->a | val);
+            SetFlagsZSPLazy(processor, res);
+            processor->flags &= ~(1 << 3);
+            processor->a = res;
+            break;
+        }
+        case 0x27: { // DAA
+            uint8_t correction = 0;
+            int carry = Carry(processor);
+            if ((processor->a & 0x0f) > 9 || (processor->flags&(1 << 4))) {
+                correction |= 0x06;
+            }
+            if ((processor->a >> 4) > 9 || carry || ((processor->a >> 4) == 9 && (processor->a & 0x0f) > 9)) {
+                correction |= 0x60;
+                carry = 1;
+            }
+            SetFlagsAddLazy(processor, processor->a, correction, 0);
+            processor->flags |= (carry << 3);
+            processor->a += correction;
+            break;
+        }
+        case 0x2f: processor->a = ~(processor->a); break; // CMA
+        case 0x37: processor->flags |= (1 << 3); break;    // STC
+        case 0x3f: processor->flags ^= (1 << 3); break;    // CMC
+        case 0x07: { // RLC
+            uint8_t val = processor->a;
+            processor->a = ((val & 0x80) >> 7) | (val << 1);
+            processor->flags = (processor->flags & ~(1 << 3)) | ((val & 0x80) >> 4);
+            break;
+        }
+        case 0x0f: { // RRC
+            uint8_t val = processor->a;
+            processor->a = ((val & 1) << 7) | (val >> 1);
+            processor->flags = (processor->flags & ~(1 << 3)) | ((val & 1) << 3);
+            break;
+        }
+        case 0x17: { // RAL
+            uint8_t val = processor->a;
+            processor->a = ((processor->flags&(1 << 3))?1:0) | (val << 1);
+            processor->flags = (processor->flags & ~(1 << 3)) | ((val & 0x80) >> 4);
+            break;
+        }
+        case 0x1f: { // RAR
+            uint8_t val = processor->a;
+            processor->a = (((processor->flags&(1 << 3))?1:0) << 7) | (val >> 1);
+            processor->flags = (processor->flags & ~(1 << 3)) | ((val & 1) << 3);
+            break;
+        }
+
+        // Jumps, calls and returns
+        case 0xc3: processor->pc = Address(bus, pc); break; // JMP addr
+        case 0xe9: processor->pc = (processor->h << 8) | processor->l; break; // PCHL
+        case 0xc2: JumpIf<FlagZero, false>(processor, bus, pc); break;   // JNZ addr
+        case 0xca: JumpIf<FlagZero, true>(processor, bus, pc); break;    // JZ addr
+        case 0xd2: JumpIf<FlagCarry, false>(processor, bus, pc); break;  // JNC addr
+        case 0xda: JumpIf<FlagCarry, true>(processor, bus, pc); break;   // JC addr
+        case 0xe2: JumpIf<FlagParity, false>(processor, bus, pc); break; // JPO addr
+        case 0xea: JumpIf<FlagParity, true>(processor, bus, pc); break;  // JPE addr
+        case 0xf2: JumpIf<FlagSign, false>(processor, bus, pc); break;   // JP addr
+        case 0xfa: JumpIf<FlagSign, true>(processor, bus, pc); break;    // JM addr
+        case 0xcd: // CALL addr, Diagnostic Mode's CALL 5 is handled by CPU::step()
+            Push(processor, bus, processor->pc >> 8, processor->pc & 0xff);
+            processor->pc = Address(bus, pc);
+            break;
+        case 0xc4: inst_cycles = CallIf<FlagZero, false>(processor, bus, pc, inst_cycles); break;   // CNZ addr
+        case 0xcc: inst_cycles = CallIf<FlagZero, true>(processor, bus, pc, inst_cycles); break;    // CZ addr
+        case 0xd4: inst_cycles = CallIf<FlagCarry, false>(processor, bus, pc, inst_cycles); break;  // CNC addr
+        case 0xdc: inst_cycles = CallIf<FlagCarry, true>(processor, bus, pc, inst_cycles); break;   // CC addr
+        case 0xe4: inst_cycles = CallIf<FlagParity, false>(processor, bus, pc, inst_cycles); break; // CPO addr
+        case 0xec: inst_cycles = CallIf<FlagParity, true>(processor, bus, pc, inst_cycles); break;  // CPE addr
+        case 0xf4: inst_cycles = CallIf<FlagSign, false>(processor, bus, pc, inst_cycles); break;   // CP addr
+        case 0xfc: inst_cycles = CallIf<FlagSign, true>(processor, bus, pc, inst_cycles); break;    // CM addr
+        case 0xc9: processor->pc = Pop(processor, bus); break; // RET
+        case 0xc0: inst_cycles = ReturnIf<FlagZero, false>(processor, bus, inst_cycles); break;   // RNZ
+        case 0xc8: inst_cycles = ReturnIf<FlagZero, true>(processor, bus, inst_cycles); break;    // RZ
+        case 0xd0: inst_cycles = ReturnIf<FlagCarry, false>(processor, bus, inst_cycles); break;  // RNC
+        case 0xd8: inst_cycles = ReturnIf<FlagCarry, true>(processor, bus, inst_cycles); break;   // RC
+        case 0xe0: inst_cycles = ReturnIf<FlagParity, false>(processor, bus, inst_cycles); break; // RPO
+        case 0xe8: inst_cycles = ReturnIf<FlagParity, true>(processor, bus, inst_cycles); break;  // RPE
+        case 0xf0: inst_cycles = ReturnIf<FlagSign, false>(processor, bus, inst_cycles); break;   // RP
+        case 0xf8: inst_cycles = ReturnIf<FlagSign, true>(processor, bus, inst_cycles); break;    // RM
+
+        case 0xfb: processor->flags |= (1 << 5); break; // EI
+
+        default:
+            // IN and OUT, when the bus has the machine's ports inline.
+            if (Bus::ports && op == 0xdb) {
+                processor->a = bus.in(Immediate(bus, pc));
+                break;
+            }
+            if (Bus::ports && op == 0xd3) {
+                bus.out(Immediate(bus, pc), processor->a);
+                break;
+            }
+            // Not implemented by the core, the machine may provide
+            // a handler with CPU::setCallback(), e.g. for IN/OUT.
+            processor->pc = pc;
+            MaterializeFlags(processor);
+            if (!processor->instruction_callbacks[op]) {
+                qDebug() << "Unknown instruction" << processor->disassembler->Disassemble(pc);
+                return executed;
+            }
+            inst_cycles = (*processor->instruction_callbacks[op])(processor, opcode);
+            break;
+        }
+
+        executed += inst_cycles;
+
+        if (!LazyFlags) {
+            MaterializeFlags(processor);
+        }
+
+        // HLT, a PUSH outside of safe memory or a machine callback
+        // may have disabled the processor.
+        if (!(processor->flags&(1 << 6))) {
+            break;
+        }
+    }
+
+    MaterializeFlags(processor);
+
+    return executed;
+}
+
+
+#undef CASE_SOURCES
+#undef CASE_DESTINATIONS
+
+// Executes instructions until at least `cycles` cycles have been
+// emulated, or the processor is disabled. Returns the cycles emulated.
+template<class Bus>
+int RunSwitchEngine(CPU *processor, int cycles)
+{
+    if (processor->lazy_flags) {
+        return RunSwitchEngineLoop<Bus, true>(processor, cycles);
+    }
+    return RunSwitchEngineLoop<Bus, false>(processor, cycles);
+}
+
+extern template int RunSwitchEngine<FlatBus>(CPU *processor, int cycles);
+extern template int RunSwitchEngine<CheckedBus>(CPU *processor, int cycles);
+
+#endif // I8080SWITCHENGINE_H
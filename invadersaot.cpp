@@ -0,0 +1,13884 @@
+// Generated by tools/recompilerom.py from assets/roms/invaders.h/g/f/e.
+// Do not edit by hand, re-run the generator. See i8080aot.h.
+
+#include "i8080aot.h"
+#include "i8080flags.h"
+
+#define HL ((uint16_t)((h << 8) | l))
+#define EXIT(next) do { pc = (next); goto exit; } while (0)
+// Continues in the block at `next` while there is budget left, native
+// routines are dispatched by Aot::run(), see CPU::addRoutine().
+#define CHAIN(next, block) do { if (cyc >= budget || processor->hasRoutine(next)) EXIT(next); pc = (next); STORE return block(processor, mem, cyc, budget); } while (0)
+#define ACCOUNT(cycles, next) do { cyc += (cycles); if (cyc >= budget) EXIT(next); } while (0)
+// Leaves before the instruction at `at` if it would write to the image,
+// another page that is not plain RAM, or a watched or shared page, the
+// interpreter writes through MemoryMap::write(). Aot marks the image in
+// MemoryMap::code_pages.
+#define CHECK_WRITE(addr, at) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & (7 | 8 | 32 | 64)) EXIT(at); } while (0)
+// Sets the dirty bit of a byte just written to a page that CHECK_WRITE
+// leaves native, if MemoryMap::trackWrites() tracks it.
+#define WRITTEN(addr) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & 16) processor->memory->markDirty(addr); } while (0)
+// Leaves before the instruction at `at` if it would read a mirrored or
+// device page, see MemoryMap::indirect_pages.
+#define CHECK_READ(addr, at) do { if (processor->memory->indirect_pages[(uint16_t)(addr) >> 8]) EXIT(at); } while (0)
+
+#define ENTER \
+    uint8_t a = processor->a, b = processor->b, c = processor->c, d = processor->d, \
+            e = processor->e, h = processor->h, l = processor->l; \
+    uint16_t sp = processor->sp, pc; \
+    int f = processor->flags;
+
+#define STORE \
+    processor->a = a; processor->b = b; processor->c = c; processor->d = d; \
+    processor->e = e; processor->h = h; processor->l = l; \
+    processor->sp = sp; processor->pc = pc; \
+    processor->flags = f;
+
+#define LEAVE \
+    STORE \
+    return cyc;
+
+static int Block0000(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0008(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0010(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0019(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0022(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0026(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0029(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block002d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0030(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0035(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0038(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block003e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block003f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0042(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0049(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0050(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0057(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block005a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block005d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0064(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0067(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block006f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0072(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block007b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block007e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0081(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0082(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block008c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0097(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block009e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00a5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00ab(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00ae(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00b1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00b4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00c7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0100(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0108(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0117(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block012e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0136(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block013b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0141(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0146(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block014b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0154(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block015a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0160(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0166(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0170(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block017a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0183(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0188(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0194(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0195(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0197(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01a1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01a5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01b1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01cd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01cf(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01d9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01e6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01ef(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01f5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01fd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0203(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0208(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0209(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block020e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0213(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0214(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block021a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block021b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block021e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0229(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0232(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0235(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0239(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0242(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0245(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0248(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block024b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block024f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0254(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block025c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0262(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0277(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block027c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block027d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0281(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0288(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02ed(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02f5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02fb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0305(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block030e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0312(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0318(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block031f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0326(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0329(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0332(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0335(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0707(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0765(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0771(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0774(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block077f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block078b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0793(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0798(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block079b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07a3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07a9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07b5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07bb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07cb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07ce(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07d1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07dd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07e7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07ea(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07f6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07f9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block07ff(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0804(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0807(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block080e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0811(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0814(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0817(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block081a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block081f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0822(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0825(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0828(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block082b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0832(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0835(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0838(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block083b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block083e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0841(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0844(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0849(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block084e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0851(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0857(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block085d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0861(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0866(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block086a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block086d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0872(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0875(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0878(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0886(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block088d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0898(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08a9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08ae(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08b3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08b6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08b9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08bc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08cb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08ce(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08d3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08de(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08e9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08f3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08fe(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block08ff(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0910(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0913(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0919(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0921(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0929(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block092e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0931(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0935(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0938(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block093d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0941(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0946(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0948(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block094b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block094f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0952(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0958(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block095e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0966(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block096b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block096e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block097c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0982(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0986(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0988(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block098b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0990(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block099d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09a3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09ad(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09b1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09b2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09bd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09c3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09c5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09ca(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09d2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09d6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09d9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09e8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09ee(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09ef(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09f2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block09f9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a00(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a13(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a18(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a25(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a2d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a30(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a33(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a36(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a39(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a3c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a3f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a42(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a47(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a4c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a4f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a52(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a55(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a58(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a59(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a5f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a66(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a6c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a71(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a7c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a80(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a87(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a8e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a93(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a98(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0a9e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aa5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aaa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aab(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ab1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ab6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0abb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0abf(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ac6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aca(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ace(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0acf(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ad7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ada(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ae1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ae2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aea(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0aef(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0af2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0af6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b02(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b08(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b0b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b0e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b11(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b14(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b17(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b1e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b24(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b27(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b2d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b30(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b33(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b39(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b3c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b3f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b47(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b4a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b4d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b54(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b57(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b5d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b60(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b63(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b66(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b69(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b71(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b74(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b79(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b7c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b7f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b83(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b86(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b89(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b90(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b93(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0b9e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0ba6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bae(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bb4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bb9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bbd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bc3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bc6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bce(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bd4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bd7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bda(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0be5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0be8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bee(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bf1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0bf4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1424(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1427(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1438(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1439(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1446(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1474(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1479(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block147c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block147e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1486(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1490(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14cb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14de(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14e1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14ea(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14ef(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block14f5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1500(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1504(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1508(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block150f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block151a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block151f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1524(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1527(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block152a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1530(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1538(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block153d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1545(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block154a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1554(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block155a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block155c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1562(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1569(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block156f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1575(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1579(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1581(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1590(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1596(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1597(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block159e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15a5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15a9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15b7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15bd(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15be(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15c1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15c5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15c7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15d1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15d3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15d6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15de(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15e6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15f1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15f3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15f6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15f9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15fe(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block15ff(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1604(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block160b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1611(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1618(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block161e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1626(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block162b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1632(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1639(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block163c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block163f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1648(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block164b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block164e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1652(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1661(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1663(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block166b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1671(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1674(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1679(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1685(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1688(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block168b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block168f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1698(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block169f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16aa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16b5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16b7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16bb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16be(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16c1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16c6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16c9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16da(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16e0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16e3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16e6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16ee(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16f1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16f6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16f9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block16ff(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1705(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1709(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block170e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1711(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block171c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1721(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1727(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block172c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1734(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1739(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1740(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1747(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block174e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1753(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1759(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1760(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block176d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1774(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1775(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block177c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1785(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1789(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block178e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17a2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17aa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17af(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17c9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17cf(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17d2(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17df(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17e3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17eb(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17f7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block17fa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1804(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block180c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1810(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1815(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1820(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1828(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block182b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block182e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1831(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1837(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block183a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block183d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block183e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1841(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1844(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block184a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block184c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1854(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1856(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block185b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1868(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1871(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1879(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1884(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1888(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1891(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1898(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block189e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18a9(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18d1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18df(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18e7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18ef(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18f1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block18fa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1903(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1904(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block190a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block190d(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1910(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1918(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block191a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1925(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block192b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1931(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block193c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1947(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1950(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1956(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1959(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block195c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block195f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1962(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1965(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1968(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block196b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block196e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1971(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1979(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block197c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block197f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1982(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1988(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block199a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19a3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19a8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19ae(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19b3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19d1(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19d3(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19d7(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19e5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19e6(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19ec(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19f5(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19fa(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block19ff(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a05(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a32(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a3a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a3b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a47(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a4a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a54(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a5c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a5f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a68(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a69(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a6b(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a74(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a7e(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a7f(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a82(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a84(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a8a(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block1a8b(CPU *processor, uint8_t *mem, int cyc, int budget);
+
+static int Block0000(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0000 00
+    ACCOUNT(4, 0x0001);
+    // 0001 00
+    ACCOUNT(4, 0x0002);
+    // 0002 00
+    ACCOUNT(4, 0x0003);
+    // 0003 c3 d4 18
+    cyc += 7;
+    CHAIN(0x18d4, Block18d4);
+exit:
+    LEAVE
+}
+
+static int Block0008(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0008 f5
+    CHECK_WRITE(sp - 1, 0x0008);
+    CHECK_WRITE(sp - 2, 0x0008);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0009);
+    // 0009 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0009);
+    CHECK_WRITE(sp - 1, 0x0009);
+    CHECK_WRITE(sp - 2, 0x0009);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x000a);
+    // 000a d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x000a);
+    CHECK_WRITE(sp - 1, 0x000a);
+    CHECK_WRITE(sp - 2, 0x000a);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x000b);
+    // 000b e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x000b);
+    CHECK_WRITE(sp - 1, 0x000b);
+    CHECK_WRITE(sp - 2, 0x000b);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x000c);
+    // 000c c3 8c 00
+    cyc += 7;
+    CHAIN(0x008c, Block008c);
+exit:
+    LEAVE
+}
+
+static int Block0010(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0010 f5
+    CHECK_WRITE(sp - 1, 0x0010);
+    CHECK_WRITE(sp - 2, 0x0010);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0011);
+    // 0011 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0011);
+    CHECK_WRITE(sp - 1, 0x0011);
+    CHECK_WRITE(sp - 2, 0x0011);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0012);
+    // 0012 d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0012);
+    CHECK_WRITE(sp - 1, 0x0012);
+    CHECK_WRITE(sp - 2, 0x0012);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0013);
+    // 0013 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0013);
+    CHECK_WRITE(sp - 1, 0x0013);
+    CHECK_WRITE(sp - 2, 0x0013);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0014);
+    // 0014 3e 80
+    a = 0x80;
+    ACCOUNT(7, 0x0016);
+    // 0016 32 72 20
+    CHECK_WRITE(0x2072, 0x0016);
+    mem[0x2072] = a;
+    WRITTEN(0x2072);
+    ACCOUNT(13, 0x0019);
+    CHAIN(0x0019, Block0019);
+exit:
+    LEAVE
+}
+
+static int Block0019(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0019 21 c0 20
+    h = 0x20; l = 0xc0;
+    ACCOUNT(10, 0x001c);
+    // 001c 35
+    CHECK_READ(HL, 0x001c);
+    CHECK_WRITE(HL, 0x001c);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x001d);
+    // 001d cd cd 17
+    CHECK_WRITE(sp - 1, 0x001d);
+    CHECK_WRITE(sp - 2, 0x001d);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x20;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    EXIT(0x17cd);
+exit:
+    LEAVE
+}
+
+static int Block0022(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0022 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0023);
+    // 0023 da 67 00
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0067, Block0067);
+    CHAIN(0x0026, Block0026);
+exit:
+    LEAVE
+}
+
+static int Block0026(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0026 3a ea 20
+    CHECK_READ(0x20ea, 0x0026);
+    a = mem[0x20ea];
+    ACCOUNT(13, 0x0029);
+    CHAIN(0x0029, Block0029);
+exit:
+    LEAVE
+}
+
+static int Block0029(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0029 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x002a);
+    // 002a ca 42 00
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0042, Block0042);
+    CHAIN(0x002d, Block002d);
+exit:
+    LEAVE
+}
+
+static int Block002d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 002d 3a eb 20
+    CHECK_READ(0x20eb, 0x002d);
+    a = mem[0x20eb];
+    ACCOUNT(13, 0x0030);
+    CHAIN(0x0030, Block0030);
+exit:
+    LEAVE
+}
+
+static int Block0030(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0030 fe 99
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x99];
+    ACCOUNT(7, 0x0032);
+    // 0032 ca 3e 00
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x003e, Block003e);
+    CHAIN(0x0035, Block0035);
+exit:
+    LEAVE
+}
+
+static int Block0035(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0035 c6 01
+    { uint8_t v = 0x01; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0037);
+    EXIT(0x0037);
+exit:
+    LEAVE
+}
+
+static int Block0038(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0038 32 eb 20
+    CHECK_WRITE(0x20eb, 0x0038);
+    mem[0x20eb] = a;
+    WRITTEN(0x20eb);
+    ACCOUNT(13, 0x003b);
+    // 003b cd 47 19
+    CHECK_WRITE(sp - 1, 0x003b);
+    CHECK_WRITE(sp - 2, 0x003b);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1947, Block1947);
+exit:
+    LEAVE
+}
+
+static int Block003e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 003e af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x003f);
+    CHAIN(0x003f, Block003f);
+exit:
+    LEAVE
+}
+
+static int Block003f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 003f 32 ea 20
+    CHECK_WRITE(0x20ea, 0x003f);
+    mem[0x20ea] = a;
+    WRITTEN(0x20ea);
+    ACCOUNT(13, 0x0042);
+    CHAIN(0x0042, Block0042);
+exit:
+    LEAVE
+}
+
+static int Block0042(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0042 3a e9 20
+    CHECK_READ(0x20e9, 0x0042);
+    a = mem[0x20e9];
+    ACCOUNT(13, 0x0045);
+    // 0045 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0046);
+    // 0046 ca 82 00
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0082, Block0082);
+    CHAIN(0x0049, Block0049);
+exit:
+    LEAVE
+}
+
+static int Block0049(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0049 3a ef 20
+    CHECK_READ(0x20ef, 0x0049);
+    a = mem[0x20ef];
+    ACCOUNT(13, 0x004c);
+    // 004c a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x004d);
+    // 004d c2 6f 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x006f, Block006f);
+    CHAIN(0x0050, Block0050);
+exit:
+    LEAVE
+}
+
+static int Block0050(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0050 3a eb 20
+    CHECK_READ(0x20eb, 0x0050);
+    a = mem[0x20eb];
+    ACCOUNT(13, 0x0053);
+    // 0053 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0054);
+    // 0054 c2 5d 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x005d, Block005d);
+    CHAIN(0x0057, Block0057);
+exit:
+    LEAVE
+}
+
+static int Block0057(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0057 cd bf 0a
+    CHECK_WRITE(sp - 1, 0x0057);
+    CHECK_WRITE(sp - 2, 0x0057);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x5a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0abf, Block0abf);
+exit:
+    LEAVE
+}
+
+static int Block005a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 005a c3 82 00
+    cyc += 7;
+    CHAIN(0x0082, Block0082);
+exit:
+    LEAVE
+}
+
+static int Block005d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 005d 3a 93 20
+    CHECK_READ(0x2093, 0x005d);
+    a = mem[0x2093];
+    ACCOUNT(13, 0x0060);
+    // 0060 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0061);
+    // 0061 c2 82 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0082, Block0082);
+    CHAIN(0x0064, Block0064);
+exit:
+    LEAVE
+}
+
+static int Block0064(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0064 c3 65 07
+    cyc += 7;
+    CHAIN(0x0765, Block0765);
+exit:
+    LEAVE
+}
+
+static int Block0067(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0067 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0069);
+    // 0069 32 ea 20
+    CHECK_WRITE(0x20ea, 0x0069);
+    mem[0x20ea] = a;
+    WRITTEN(0x20ea);
+    ACCOUNT(13, 0x006c);
+    // 006c c3 3f 00
+    cyc += 7;
+    CHAIN(0x003f, Block003f);
+exit:
+    LEAVE
+}
+
+static int Block006f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 006f cd 40 17
+    CHECK_WRITE(sp - 1, 0x006f);
+    CHECK_WRITE(sp - 2, 0x006f);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x72;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1740, Block1740);
+exit:
+    LEAVE
+}
+
+static int Block0072(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0072 3a 32 20
+    CHECK_READ(0x2032, 0x0072);
+    a = mem[0x2032];
+    ACCOUNT(13, 0x0075);
+    // 0075 32 80 20
+    CHECK_WRITE(0x2080, 0x0075);
+    mem[0x2080] = a;
+    WRITTEN(0x2080);
+    ACCOUNT(13, 0x0078);
+    // 0078 cd 00 01
+    CHECK_WRITE(sp - 1, 0x0078);
+    CHECK_WRITE(sp - 2, 0x0078);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0100, Block0100);
+exit:
+    LEAVE
+}
+
+static int Block007b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 007b cd 48 02
+    CHECK_WRITE(sp - 1, 0x007b);
+    CHECK_WRITE(sp - 2, 0x007b);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0248, Block0248);
+exit:
+    LEAVE
+}
+
+static int Block007e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 007e cd 13 09
+    CHECK_WRITE(sp - 1, 0x007e);
+    CHECK_WRITE(sp - 2, 0x007e);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x81;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0913, Block0913);
+exit:
+    LEAVE
+}
+
+static int Block0081(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0081 00
+    ACCOUNT(4, 0x0082);
+    CHAIN(0x0082, Block0082);
+exit:
+    LEAVE
+}
+
+static int Block0082(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0082 e1
+    CHECK_READ(sp, 0x0082);
+    CHECK_READ(sp + 1, 0x0082);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x0083);
+    // 0083 d1
+    CHECK_READ(sp, 0x0083);
+    CHECK_READ(sp + 1, 0x0083);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x0084);
+    // 0084 c1
+    CHECK_READ(sp, 0x0084);
+    CHECK_READ(sp + 1, 0x0084);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x0085);
+    // 0085 f1
+    CHECK_READ(sp, 0x0085);
+    CHECK_READ(sp + 1, 0x0085);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x0086);
+    if (!(f & (1 << 6))) EXIT(0x0086);
+    // 0086 fb
+    f |= (1 << 5);
+    ACCOUNT(4, 0x0087);
+    // 0087 c9
+    CHECK_READ(sp, 0x0087);
+    CHECK_READ(sp + 1, 0x0087);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block008c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 008c af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x008d);
+    // 008d 32 72 20
+    CHECK_WRITE(0x2072, 0x008d);
+    mem[0x2072] = a;
+    WRITTEN(0x2072);
+    ACCOUNT(13, 0x0090);
+    // 0090 3a e9 20
+    CHECK_READ(0x20e9, 0x0090);
+    a = mem[0x20e9];
+    ACCOUNT(13, 0x0093);
+    // 0093 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0094);
+    // 0094 ca 82 00
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0082, Block0082);
+    CHAIN(0x0097, Block0097);
+exit:
+    LEAVE
+}
+
+static int Block0097(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0097 3a ef 20
+    CHECK_READ(0x20ef, 0x0097);
+    a = mem[0x20ef];
+    ACCOUNT(13, 0x009a);
+    // 009a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x009b);
+    // 009b c2 a5 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x00a5, Block00a5);
+    CHAIN(0x009e, Block009e);
+exit:
+    LEAVE
+}
+
+static int Block009e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 009e 3a c1 20
+    CHECK_READ(0x20c1, 0x009e);
+    a = mem[0x20c1];
+    ACCOUNT(13, 0x00a1);
+    // 00a1 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x00a2);
+    // 00a2 d2 82 00
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x0082, Block0082);
+    CHAIN(0x00a5, Block00a5);
+exit:
+    LEAVE
+}
+
+static int Block00a5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00a5 21 20 20
+    h = 0x20; l = 0x20;
+    ACCOUNT(10, 0x00a8);
+    // 00a8 cd 4b 02
+    CHECK_WRITE(sp - 1, 0x00a8);
+    CHECK_WRITE(sp - 2, 0x00a8);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xab;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x024b, Block024b);
+exit:
+    LEAVE
+}
+
+static int Block00ab(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00ab cd 41 01
+    CHECK_WRITE(sp - 1, 0x00ab);
+    CHECK_WRITE(sp - 2, 0x00ab);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xae;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0141, Block0141);
+exit:
+    LEAVE
+}
+
+static int Block00ae(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00ae c3 82 00
+    cyc += 7;
+    CHAIN(0x0082, Block0082);
+exit:
+    LEAVE
+}
+
+static int Block00b1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00b1 cd 86 08
+    CHECK_WRITE(sp - 1, 0x00b1);
+    CHECK_WRITE(sp - 2, 0x00b1);
+    mem[(uint16_t)(sp - 1)] = 0x00;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0886, Block0886);
+exit:
+    LEAVE
+}
+
+static int Block00b4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00b4 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x00b4);
+    CHECK_WRITE(sp - 1, 0x00b4);
+    CHECK_WRITE(sp - 2, 0x00b4);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x00b5);
+    // 00b5 7e
+    CHECK_READ(HL, 0x00b5);
+    a = mem[HL];
+    ACCOUNT(7, 0x00b6);
+    // 00b6 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x00b7);
+    // 00b7 66
+    CHECK_READ(HL, 0x00b7);
+    h = mem[HL];
+    ACCOUNT(7, 0x00b8);
+    // 00b8 6f
+    l = a;
+    ACCOUNT(5, 0x00b9);
+    // 00b9 22 09 20
+    CHECK_WRITE(0x2009, 0x00b9);
+    CHECK_WRITE(0x200a, 0x00b9);
+    mem[0x2009] = l; mem[0x200a] = h;
+    WRITTEN(0x2009);
+    WRITTEN(0x200a);
+    ACCOUNT(16, 0x00bc);
+    // 00bc 22 0b 20
+    CHECK_WRITE(0x200b, 0x00bc);
+    CHECK_WRITE(0x200c, 0x00bc);
+    mem[0x200b] = l; mem[0x200c] = h;
+    WRITTEN(0x200b);
+    WRITTEN(0x200c);
+    ACCOUNT(16, 0x00bf);
+    // 00bf e1
+    CHECK_READ(sp, 0x00bf);
+    CHECK_READ(sp + 1, 0x00bf);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x00c0);
+    // 00c0 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x00c1);
+    // 00c1 7e
+    CHECK_READ(HL, 0x00c1);
+    a = mem[HL];
+    ACCOUNT(7, 0x00c2);
+    // 00c2 fe 03
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x03];
+    ACCOUNT(7, 0x00c4);
+    // 00c4 c2 c8 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x00c8, Block00c8);
+    CHAIN(0x00c7, Block00c7);
+exit:
+    LEAVE
+}
+
+static int Block00c7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00c7 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x00c8);
+    CHAIN(0x00c8, Block00c8);
+exit:
+    LEAVE
+}
+
+static int Block00c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00c8 32 08 20
+    CHECK_WRITE(0x2008, 0x00c8);
+    mem[0x2008] = a;
+    WRITTEN(0x2008);
+    ACCOUNT(13, 0x00cb);
+    // 00cb fe fe
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xfe];
+    ACCOUNT(7, 0x00cd);
+    // 00cd 3e 00
+    a = 0x00;
+    ACCOUNT(7, 0x00cf);
+    // 00cf c2 d3 00
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x00d3, Block00d3);
+    CHAIN(0x00d2, Block00d2);
+exit:
+    LEAVE
+}
+
+static int Block00d2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d2 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x00d3);
+    CHAIN(0x00d3, Block00d3);
+exit:
+    LEAVE
+}
+
+static int Block00d3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d3 32 0d 20
+    CHECK_WRITE(0x200d, 0x00d3);
+    mem[0x200d] = a;
+    WRITTEN(0x200d);
+    ACCOUNT(13, 0x00d6);
+    // 00d6 c9
+    CHECK_READ(sp, 0x00d6);
+    CHECK_READ(sp + 1, 0x00d6);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block00d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d7 3e 02
+    a = 0x02;
+    ACCOUNT(7, 0x00d9);
+    // 00d9 32 fb 21
+    CHECK_WRITE(0x21fb, 0x00d9);
+    mem[0x21fb] = a;
+    WRITTEN(0x21fb);
+    ACCOUNT(13, 0x00dc);
+    // 00dc 32 fb 22
+    CHECK_WRITE(0x22fb, 0x00dc);
+    mem[0x22fb] = a;
+    WRITTEN(0x22fb);
+    ACCOUNT(13, 0x00df);
+    // 00df c3 e4 08
+    cyc += 7;
+    CHAIN(0x08e4, Block08e4);
+exit:
+    LEAVE
+}
+
+static int Block0100(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0100 21 02 20
+    h = 0x20; l = 0x02;
+    ACCOUNT(10, 0x0103);
+    // 0103 7e
+    CHECK_READ(HL, 0x0103);
+    a = mem[HL];
+    ACCOUNT(7, 0x0104);
+    // 0104 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0105);
+    // 0105 c2 38 15
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1538, Block1538);
+    CHAIN(0x0108, Block0108);
+exit:
+    LEAVE
+}
+
+static int Block0108(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0108 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0108);
+    CHECK_WRITE(sp - 1, 0x0108);
+    CHECK_WRITE(sp - 2, 0x0108);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0109);
+    // 0109 3a 06 20
+    CHECK_READ(0x2006, 0x0109);
+    a = mem[0x2006];
+    ACCOUNT(13, 0x010c);
+    // 010c 6f
+    l = a;
+    ACCOUNT(5, 0x010d);
+    // 010d 3a 67 20
+    CHECK_READ(0x2067, 0x010d);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x0110);
+    // 0110 67
+    h = a;
+    ACCOUNT(5, 0x0111);
+    // 0111 7e
+    CHECK_READ(HL, 0x0111);
+    a = mem[HL];
+    ACCOUNT(7, 0x0112);
+    // 0112 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0113);
+    // 0113 e1
+    CHECK_READ(sp, 0x0113);
+    CHECK_READ(sp + 1, 0x0113);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x0114);
+    // 0114 ca 36 01
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0136, Block0136);
+    CHAIN(0x0117, Block0117);
+exit:
+    LEAVE
+}
+
+static int Block0117(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0117 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0118);
+    // 0118 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0119);
+    // 0119 7e
+    CHECK_READ(HL, 0x0119);
+    a = mem[HL];
+    ACCOUNT(7, 0x011a);
+    // 011a 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x011b);
+    // 011b 46
+    CHECK_READ(HL, 0x011b);
+    b = mem[HL];
+    ACCOUNT(7, 0x011c);
+    // 011c e6 fe
+    a &= 0xfe; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x011e);
+    // 011e 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x011f);
+    // 011f 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0120);
+    // 0120 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0121);
+    // 0121 5f
+    e = a;
+    ACCOUNT(5, 0x0122);
+    // 0122 16 00
+    d = 0x00;
+    ACCOUNT(7, 0x0124);
+    // 0124 21 00 1c
+    h = 0x1c; l = 0x00;
+    ACCOUNT(10, 0x0127);
+    // 0127 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x0128);
+    // 0128 eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x0129);
+    // 0129 78
+    a = b;
+    ACCOUNT(5, 0x012a);
+    // 012a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x012b);
+    // 012b c4 3b 01
+    if (!(f & FlagZero)) {
+        CHECK_WRITE(sp - 1, 0x012b);
+        CHECK_WRITE(sp - 2, 0x012b);
+        mem[(uint16_t)(sp - 1)] = 0x01;
+        WRITTEN(sp - 1);
+        mem[(uint16_t)(sp - 2)] = 0x2e;
+        WRITTEN(sp - 2);
+        sp -= 2;
+        cyc += 17;
+        CHAIN(0x013b, Block013b);
+    }
+    cyc += 11;
+    CHAIN(0x012e, Block012e);
+exit:
+    LEAVE
+}
+
+static int Block012e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 012e 2a 0b 20
+    CHECK_READ(0x200b, 0x012e);
+    CHECK_READ(0x200c, 0x012e);
+    l = mem[0x200b]; h = mem[0x200c];
+    ACCOUNT(16, 0x0131);
+    // 0131 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x0133);
+    // 0133 cd d3 15
+    CHECK_WRITE(sp - 1, 0x0133);
+    CHECK_WRITE(sp - 2, 0x0133);
+    mem[(uint16_t)(sp - 1)] = 0x01;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x36;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x15d3, Block15d3);
+exit:
+    LEAVE
+}
+
+static int Block0136(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0136 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0137);
+    // 0137 32 00 20
+    CHECK_WRITE(0x2000, 0x0137);
+    mem[0x2000] = a;
+    WRITTEN(0x2000);
+    ACCOUNT(13, 0x013a);
+    // 013a c9
+    CHECK_READ(sp, 0x013a);
+    CHECK_READ(sp + 1, 0x013a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block013b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 013b 21 30 00
+    h = 0x00; l = 0x30;
+    ACCOUNT(10, 0x013e);
+    // 013e 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x013f);
+    // 013f eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x0140);
+    // 0140 c9
+    CHECK_READ(sp, 0x0140);
+    CHECK_READ(sp + 1, 0x0140);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0141(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0141 3a 68 20
+    CHECK_READ(0x2068, 0x0141);
+    a = mem[0x2068];
+    ACCOUNT(13, 0x0144);
+    // 0144 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0145);
+    // 0145 c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x0145);
+        CHECK_READ(sp + 1, 0x0145);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0146, Block0146);
+exit:
+    LEAVE
+}
+
+static int Block0146(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0146 3a 00 20
+    CHECK_READ(0x2000, 0x0146);
+    a = mem[0x2000];
+    ACCOUNT(13, 0x0149);
+    // 0149 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x014a);
+    // 014a c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x014a);
+        CHECK_READ(sp + 1, 0x014a);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x014b, Block014b);
+exit:
+    LEAVE
+}
+
+static int Block014b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 014b 3a 67 20
+    CHECK_READ(0x2067, 0x014b);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x014e);
+    // 014e 67
+    h = a;
+    ACCOUNT(5, 0x014f);
+    // 014f 3a 06 20
+    CHECK_READ(0x2006, 0x014f);
+    a = mem[0x2006];
+    ACCOUNT(13, 0x0152);
+    // 0152 16 02
+    d = 0x02;
+    ACCOUNT(7, 0x0154);
+    CHAIN(0x0154, Block0154);
+exit:
+    LEAVE
+}
+
+static int Block0154(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0154 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0155);
+    // 0155 fe 37
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x37];
+    ACCOUNT(7, 0x0157);
+    // 0157 cc a1 01
+    if ((f & FlagZero)) {
+        CHECK_WRITE(sp - 1, 0x0157);
+        CHECK_WRITE(sp - 2, 0x0157);
+        mem[(uint16_t)(sp - 1)] = 0x01;
+        WRITTEN(sp - 1);
+        mem[(uint16_t)(sp - 2)] = 0x5a;
+        WRITTEN(sp - 2);
+        sp -= 2;
+        cyc += 17;
+        CHAIN(0x01a1, Block01a1);
+    }
+    cyc += 11;
+    CHAIN(0x015a, Block015a);
+exit:
+    LEAVE
+}
+
+static int Block015a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 015a 6f
+    l = a;
+    ACCOUNT(5, 0x015b);
+    // 015b 46
+    CHECK_READ(HL, 0x015b);
+    b = mem[HL];
+    ACCOUNT(7, 0x015c);
+    // 015c 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x015d);
+    // 015d c2 54 01
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0154, Block0154);
+    CHAIN(0x0160, Block0160);
+exit:
+    LEAVE
+}
+
+static int Block0160(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0160 32 06 20
+    CHECK_WRITE(0x2006, 0x0160);
+    mem[0x2006] = a;
+    WRITTEN(0x2006);
+    ACCOUNT(13, 0x0163);
+    // 0163 cd 7a 01
+    CHECK_WRITE(sp - 1, 0x0163);
+    CHECK_WRITE(sp - 2, 0x0163);
+    mem[(uint16_t)(sp - 1)] = 0x01;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x66;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x017a, Block017a);
+exit:
+    LEAVE
+}
+
+static int Block0166(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0166 61
+    h = c;
+    ACCOUNT(5, 0x0167);
+    // 0167 22 0b 20
+    CHECK_WRITE(0x200b, 0x0167);
+    CHECK_WRITE(0x200c, 0x0167);
+    mem[0x200b] = l; mem[0x200c] = h;
+    WRITTEN(0x200b);
+    WRITTEN(0x200c);
+    ACCOUNT(16, 0x016a);
+    // 016a 7d
+    a = l;
+    ACCOUNT(5, 0x016b);
+    // 016b fe 28
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x28];
+    ACCOUNT(7, 0x016d);
+    // 016d da 71 19
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x1971, Block1971);
+    CHAIN(0x0170, Block0170);
+exit:
+    LEAVE
+}
+
+static int Block0170(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0170 7a
+    a = d;
+    ACCOUNT(5, 0x0171);
+    // 0171 32 04 20
+    CHECK_WRITE(0x2004, 0x0171);
+    mem[0x2004] = a;
+    WRITTEN(0x2004);
+    ACCOUNT(13, 0x0174);
+    // 0174 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0176);
+    // 0176 32 00 20
+    CHECK_WRITE(0x2000, 0x0176);
+    mem[0x2000] = a;
+    WRITTEN(0x2000);
+    ACCOUNT(13, 0x0179);
+    // 0179 c9
+    CHECK_READ(sp, 0x0179);
+    CHECK_READ(sp + 1, 0x0179);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block017a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 017a 16 00
+    d = 0x00;
+    ACCOUNT(7, 0x017c);
+    // 017c 7d
+    a = l;
+    ACCOUNT(5, 0x017d);
+    // 017d 21 09 20
+    h = 0x20; l = 0x09;
+    ACCOUNT(10, 0x0180);
+    // 0180 46
+    CHECK_READ(HL, 0x0180);
+    b = mem[HL];
+    ACCOUNT(7, 0x0181);
+    // 0181 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0182);
+    // 0182 4e
+    CHECK_READ(HL, 0x0182);
+    c = mem[HL];
+    ACCOUNT(7, 0x0183);
+    CHAIN(0x0183, Block0183);
+exit:
+    LEAVE
+}
+
+static int Block0183(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0183 fe 0b
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x0b];
+    ACCOUNT(7, 0x0185);
+    // 0185 fa 94 01
+    cyc += 10;
+    if ((f & FlagSign)) CHAIN(0x0194, Block0194);
+    CHAIN(0x0188, Block0188);
+exit:
+    LEAVE
+}
+
+static int Block0188(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0188 de 0b
+    { uint8_t v = 0x0b; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x018a);
+    // 018a 5f
+    e = a;
+    ACCOUNT(5, 0x018b);
+    // 018b 78
+    a = b;
+    ACCOUNT(5, 0x018c);
+    // 018c c6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x018e);
+    // 018e 47
+    b = a;
+    ACCOUNT(5, 0x018f);
+    // 018f 7b
+    a = e;
+    ACCOUNT(5, 0x0190);
+    // 0190 14
+    d = (uint8_t)(d + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[d];
+    ACCOUNT(5, 0x0191);
+    // 0191 c3 83 01
+    cyc += 7;
+    CHAIN(0x0183, Block0183);
+exit:
+    LEAVE
+}
+
+static int Block0194(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0194 68
+    l = b;
+    ACCOUNT(5, 0x0195);
+    CHAIN(0x0195, Block0195);
+exit:
+    LEAVE
+}
+
+static int Block0195(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0195 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0196);
+    // 0196 c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x0196);
+        CHECK_READ(sp + 1, 0x0196);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0197, Block0197);
+exit:
+    LEAVE
+}
+
+static int Block0197(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0197 5f
+    e = a;
+    ACCOUNT(5, 0x0198);
+    // 0198 79
+    a = c;
+    ACCOUNT(5, 0x0199);
+    // 0199 c6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x019b);
+    // 019b 4f
+    c = a;
+    ACCOUNT(5, 0x019c);
+    // 019c 7b
+    a = e;
+    ACCOUNT(5, 0x019d);
+    // 019d 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x019e);
+    // 019e c3 95 01
+    cyc += 7;
+    CHAIN(0x0195, Block0195);
+exit:
+    LEAVE
+}
+
+static int Block01a1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01a1 15
+    d = (uint8_t)(d - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[d];
+    ACCOUNT(5, 0x01a2);
+    // 01a2 ca cd 01
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x01cd, Block01cd);
+    CHAIN(0x01a5, Block01a5);
+exit:
+    LEAVE
+}
+
+static int Block01a5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01a5 21 06 20
+    h = 0x20; l = 0x06;
+    ACCOUNT(10, 0x01a8);
+    // 01a8 36 00
+    CHECK_WRITE(HL, 0x01a8);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x01aa);
+    // 01aa 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x01ab);
+    // 01ab 4e
+    CHECK_READ(HL, 0x01ab);
+    c = mem[HL];
+    ACCOUNT(7, 0x01ac);
+    // 01ac 36 00
+    CHECK_WRITE(HL, 0x01ac);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x01ae);
+    // 01ae cd d9 01
+    CHECK_WRITE(sp - 1, 0x01ae);
+    CHECK_WRITE(sp - 2, 0x01ae);
+    mem[(uint16_t)(sp - 1)] = 0x01;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01d9, Block01d9);
+exit:
+    LEAVE
+}
+
+static int Block01b1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01b1 21 05 20
+    h = 0x20; l = 0x05;
+    ACCOUNT(10, 0x01b4);
+    // 01b4 7e
+    CHECK_READ(HL, 0x01b4);
+    a = mem[HL];
+    ACCOUNT(7, 0x01b5);
+    // 01b5 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x01b6);
+    // 01b6 e6 01
+    a &= 0x01; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x01b8);
+    // 01b8 77
+    CHECK_WRITE(HL, 0x01b8);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x01b9);
+    // 01b9 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x01ba);
+    // 01ba 21 67 20
+    h = 0x20; l = 0x67;
+    ACCOUNT(10, 0x01bd);
+    // 01bd 66
+    CHECK_READ(HL, 0x01bd);
+    h = mem[HL];
+    ACCOUNT(7, 0x01be);
+    // 01be c9
+    CHECK_READ(sp, 0x01be);
+    CHECK_READ(sp + 1, 0x01be);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block01c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c0 21 00 21
+    h = 0x21; l = 0x00;
+    ACCOUNT(10, 0x01c3);
+    CHAIN(0x01c3, Block01c3);
+exit:
+    LEAVE
+}
+
+static int Block01c3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c3 06 37
+    b = 0x37;
+    ACCOUNT(7, 0x01c5);
+    CHAIN(0x01c5, Block01c5);
+exit:
+    LEAVE
+}
+
+static int Block01c5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c5 36 01
+    CHECK_WRITE(HL, 0x01c5);
+    mem[HL] = 0x01;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x01c7);
+    // 01c7 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x01c8);
+    // 01c8 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x01c9);
+    // 01c9 c2 c5 01
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x01c5, Block01c5);
+    CHAIN(0x01cc, Block01cc);
+exit:
+    LEAVE
+}
+
+static int Block01cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01cc c9
+    CHECK_READ(sp, 0x01cc);
+    CHECK_READ(sp + 1, 0x01cc);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block01cd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01cd e1
+    CHECK_READ(sp, 0x01cd);
+    CHECK_READ(sp + 1, 0x01cd);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x01ce);
+    // 01ce c9
+    CHECK_READ(sp, 0x01ce);
+    CHECK_READ(sp + 1, 0x01ce);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block01cf(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01cf 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x01d1);
+    // 01d1 06 e0
+    b = 0xe0;
+    ACCOUNT(7, 0x01d3);
+    // 01d3 21 02 24
+    h = 0x24; l = 0x02;
+    ACCOUNT(10, 0x01d6);
+    // 01d6 c3 cc 14
+    cyc += 7;
+    CHAIN(0x14cc, Block14cc);
+exit:
+    LEAVE
+}
+
+static int Block01d9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01d9 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x01da);
+    // 01da 46
+    CHECK_READ(HL, 0x01da);
+    b = mem[HL];
+    ACCOUNT(7, 0x01db);
+    // 01db 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x01dc);
+    // 01dc 79
+    a = c;
+    ACCOUNT(5, 0x01dd);
+    // 01dd 86
+    CHECK_READ(HL, 0x01dd);
+    { uint8_t v = mem[HL]; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01de);
+    // 01de 77
+    CHECK_WRITE(HL, 0x01de);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x01df);
+    // 01df 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x01e0);
+    // 01e0 78
+    a = b;
+    ACCOUNT(5, 0x01e1);
+    // 01e1 86
+    CHECK_READ(HL, 0x01e1);
+    { uint8_t v = mem[HL]; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01e2);
+    // 01e2 77
+    CHECK_WRITE(HL, 0x01e2);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x01e3);
+    // 01e3 c9
+    CHECK_READ(sp, 0x01e3);
+    CHECK_READ(sp + 1, 0x01e3);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block01e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01e4 06 c0
+    b = 0xc0;
+    ACCOUNT(7, 0x01e6);
+    CHAIN(0x01e6, Block01e6);
+exit:
+    LEAVE
+}
+
+static int Block01e6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01e6 11 00 1b
+    d = 0x1b; e = 0x00;
+    ACCOUNT(10, 0x01e9);
+    // 01e9 21 00 20
+    h = 0x20; l = 0x00;
+    ACCOUNT(10, 0x01ec);
+    // 01ec c3 32 1a
+    cyc += 7;
+    CHAIN(0x1a32, Block1a32);
+exit:
+    LEAVE
+}
+
+static int Block01ef(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01ef 21 42 21
+    h = 0x21; l = 0x42;
+    ACCOUNT(10, 0x01f2);
+    // 01f2 c3 f8 01
+    cyc += 7;
+    CHAIN(0x01f8, Block01f8);
+exit:
+    LEAVE
+}
+
+static int Block01f5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01f5 21 42 22
+    h = 0x22; l = 0x42;
+    ACCOUNT(10, 0x01f8);
+    CHAIN(0x01f8, Block01f8);
+exit:
+    LEAVE
+}
+
+static int Block01f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01f8 0e 04
+    c = 0x04;
+    ACCOUNT(7, 0x01fa);
+    // 01fa 11 20 1d
+    d = 0x1d; e = 0x20;
+    ACCOUNT(10, 0x01fd);
+    CHAIN(0x01fd, Block01fd);
+exit:
+    LEAVE
+}
+
+static int Block01fd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01fd d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x01fd);
+    CHECK_WRITE(sp - 1, 0x01fd);
+    CHECK_WRITE(sp - 2, 0x01fd);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x01fe);
+    // 01fe 06 2c
+    b = 0x2c;
+    ACCOUNT(7, 0x0200);
+    // 0200 cd 32 1a
+    CHECK_WRITE(sp - 1, 0x0200);
+    CHECK_WRITE(sp - 2, 0x0200);
+    mem[(uint16_t)(sp - 1)] = 0x02;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x03;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a32, Block1a32);
+exit:
+    LEAVE
+}
+
+static int Block0203(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0203 d1
+    CHECK_READ(sp, 0x0203);
+    CHECK_READ(sp + 1, 0x0203);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x0204);
+    // 0204 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x0205);
+    // 0205 c2 fd 01
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x01fd, Block01fd);
+    CHAIN(0x0208, Block0208);
+exit:
+    LEAVE
+}
+
+static int Block0208(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0208 c9
+    CHECK_READ(sp, 0x0208);
+    CHECK_READ(sp + 1, 0x0208);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0209(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0209 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x020b);
+    // 020b c3 1b 02
+    cyc += 7;
+    CHAIN(0x021b, Block021b);
+exit:
+    LEAVE
+}
+
+static int Block020e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 020e 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0210);
+    // 0210 c3 14 02
+    cyc += 7;
+    CHAIN(0x0214, Block0214);
+exit:
+    LEAVE
+}
+
+static int Block0213(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0213 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0214);
+    CHAIN(0x0214, Block0214);
+exit:
+    LEAVE
+}
+
+static int Block0214(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0214 11 42 22
+    d = 0x22; e = 0x42;
+    ACCOUNT(10, 0x0217);
+    // 0217 c3 1e 02
+    cyc += 7;
+    CHAIN(0x021e, Block021e);
+exit:
+    LEAVE
+}
+
+static int Block021a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 021a af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x021b);
+    CHAIN(0x021b, Block021b);
+exit:
+    LEAVE
+}
+
+static int Block021b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 021b 11 42 21
+    d = 0x21; e = 0x42;
+    ACCOUNT(10, 0x021e);
+    CHAIN(0x021e, Block021e);
+exit:
+    LEAVE
+}
+
+static int Block021e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 021e 32 81 20
+    CHECK_WRITE(0x2081, 0x021e);
+    mem[0x2081] = a;
+    WRITTEN(0x2081);
+    ACCOUNT(13, 0x0221);
+    // 0221 01 02 16
+    b = 0x16; c = 0x02;
+    ACCOUNT(10, 0x0224);
+    // 0224 21 06 28
+    h = 0x28; l = 0x06;
+    ACCOUNT(10, 0x0227);
+    // 0227 3e 04
+    a = 0x04;
+    ACCOUNT(7, 0x0229);
+    CHAIN(0x0229, Block0229);
+exit:
+    LEAVE
+}
+
+static int Block0229(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0229 f5
+    CHECK_WRITE(sp - 1, 0x0229);
+    CHECK_WRITE(sp - 2, 0x0229);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x022a);
+    // 022a c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x022a);
+    CHECK_WRITE(sp - 1, 0x022a);
+    CHECK_WRITE(sp - 2, 0x022a);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x022b);
+    // 022b 3a 81 20
+    CHECK_READ(0x2081, 0x022b);
+    a = mem[0x2081];
+    ACCOUNT(13, 0x022e);
+    // 022e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x022f);
+    // 022f c2 42 02
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0242, Block0242);
+    CHAIN(0x0232, Block0232);
+exit:
+    LEAVE
+}
+
+static int Block0232(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0232 cd 69 1a
+    CHECK_WRITE(sp - 1, 0x0232);
+    CHECK_WRITE(sp - 2, 0x0232);
+    mem[(uint16_t)(sp - 1)] = 0x02;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x35;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a69, Block1a69);
+exit:
+    LEAVE
+}
+
+static int Block0235(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0235 c1
+    CHECK_READ(sp, 0x0235);
+    CHECK_READ(sp + 1, 0x0235);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x0236);
+    // 0236 f1
+    CHECK_READ(sp, 0x0236);
+    CHECK_READ(sp + 1, 0x0236);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x0237);
+    if (!(f & (1 << 6))) EXIT(0x0237);
+    // 0237 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x0238);
+    // 0238 c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x0238);
+        CHECK_READ(sp + 1, 0x0238);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0239, Block0239);
+exit:
+    LEAVE
+}
+
+static int Block0239(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0239 d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0239);
+    CHECK_WRITE(sp - 1, 0x0239);
+    CHECK_WRITE(sp - 2, 0x0239);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x023a);
+    // 023a 11 e0 02
+    d = 0x02; e = 0xe0;
+    ACCOUNT(10, 0x023d);
+    // 023d 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x023e);
+    // 023e d1
+    CHECK_READ(sp, 0x023e);
+    CHECK_READ(sp + 1, 0x023e);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x023f);
+    // 023f c3 29 02
+    cyc += 7;
+    CHAIN(0x0229, Block0229);
+exit:
+    LEAVE
+}
+
+static int Block0242(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0242 cd 7c 14
+    CHECK_WRITE(sp - 1, 0x0242);
+    CHECK_WRITE(sp - 2, 0x0242);
+    mem[(uint16_t)(sp - 1)] = 0x02;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x45;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x147c, Block147c);
+exit:
+    LEAVE
+}
+
+static int Block0245(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0245 c3 35 02
+    cyc += 7;
+    CHAIN(0x0235, Block0235);
+exit:
+    LEAVE
+}
+
+static int Block0248(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0248 21 10 20
+    h = 0x20; l = 0x10;
+    ACCOUNT(10, 0x024b);
+    CHAIN(0x024b, Block024b);
+exit:
+    LEAVE
+}
+
+static int Block024b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 024b 7e
+    CHECK_READ(HL, 0x024b);
+    a = mem[HL];
+    ACCOUNT(7, 0x024c);
+    // 024c fe ff
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xff];
+    ACCOUNT(7, 0x024e);
+    // 024e c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x024e);
+        CHECK_READ(sp + 1, 0x024e);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x024f, Block024f);
+exit:
+    LEAVE
+}
+
+static int Block024f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 024f fe fe
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xfe];
+    ACCOUNT(7, 0x0251);
+    // 0251 ca 81 02
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0281, Block0281);
+    CHAIN(0x0254, Block0254);
+exit:
+    LEAVE
+}
+
+static int Block0254(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0254 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0255);
+    // 0255 46
+    CHECK_READ(HL, 0x0255);
+    b = mem[HL];
+    ACCOUNT(7, 0x0256);
+    // 0256 4f
+    c = a;
+    ACCOUNT(5, 0x0257);
+    // 0257 b0
+    a |= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0258);
+    // 0258 79
+    a = c;
+    ACCOUNT(5, 0x0259);
+    // 0259 c2 77 02
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0277, Block0277);
+    CHAIN(0x025c, Block025c);
+exit:
+    LEAVE
+}
+
+static int Block025c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 025c 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x025d);
+    // 025d 7e
+    CHECK_READ(HL, 0x025d);
+    a = mem[HL];
+    ACCOUNT(7, 0x025e);
+    // 025e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x025f);
+    // 025f c2 88 02
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0288, Block0288);
+    CHAIN(0x0262, Block0262);
+exit:
+    LEAVE
+}
+
+static int Block0262(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0262 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0263);
+    // 0263 5e
+    CHECK_READ(HL, 0x0263);
+    e = mem[HL];
+    ACCOUNT(7, 0x0264);
+    // 0264 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0265);
+    // 0265 56
+    CHECK_READ(HL, 0x0265);
+    d = mem[HL];
+    ACCOUNT(7, 0x0266);
+    // 0266 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0266);
+    CHECK_WRITE(sp - 1, 0x0266);
+    CHECK_WRITE(sp - 2, 0x0266);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0267);
+    // 0267 eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x0268);
+    // 0268 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0268);
+    CHECK_WRITE(sp - 1, 0x0268);
+    CHECK_WRITE(sp - 2, 0x0268);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0269);
+    // 0269 21 6f 02
+    h = 0x02; l = 0x6f;
+    ACCOUNT(10, 0x026c);
+    // 026c e3
+    CHECK_READ(sp, 0x026c);
+    CHECK_READ(sp + 1, 0x026c);
+    CHECK_WRITE(sp, 0x026c);
+    CHECK_WRITE(sp + 1, 0x026c);
+    { uint8_t t = mem[sp]; mem[sp] = l; l = t; t = mem[(uint16_t)(sp + 1)]; mem[(uint16_t)(sp + 1)] = h; h = t; }
+    WRITTEN(sp);
+    WRITTEN(sp + 1);
+    ACCOUNT(18, 0x026d);
+    // 026d d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x026d);
+    CHECK_WRITE(sp - 1, 0x026d);
+    CHECK_WRITE(sp - 2, 0x026d);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x026e);
+    // 026e e9
+    cyc += 5;
+    EXIT(HL);
+exit:
+    LEAVE
+}
+
+static int Block0277(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0277 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x0278);
+    // 0278 04
+    b = (uint8_t)(b + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[b];
+    ACCOUNT(5, 0x0279);
+    // 0279 c2 7d 02
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x027d, Block027d);
+    CHAIN(0x027c, Block027c);
+exit:
+    LEAVE
+}
+
+static int Block027c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 027c 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x027d);
+    CHAIN(0x027d, Block027d);
+exit:
+    LEAVE
+}
+
+static int Block027d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 027d 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x027e);
+    // 027e 70
+    CHECK_WRITE(HL, 0x027e);
+    mem[HL] = b;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x027f);
+    // 027f 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0280);
+    // 0280 77
+    CHECK_WRITE(HL, 0x0280);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0281);
+    CHAIN(0x0281, Block0281);
+exit:
+    LEAVE
+}
+
+static int Block0281(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0281 11 10 00
+    d = 0x00; e = 0x10;
+    ACCOUNT(10, 0x0284);
+    // 0284 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x0285);
+    // 0285 c3 4b 02
+    cyc += 7;
+    CHAIN(0x024b, Block024b);
+exit:
+    LEAVE
+}
+
+static int Block0288(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0288 35
+    CHECK_READ(HL, 0x0288);
+    CHECK_WRITE(HL, 0x0288);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0289);
+    // 0289 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x028a);
+    // 028a 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x028b);
+    // 028b c3 81 02
+    cyc += 7;
+    CHAIN(0x0281, Block0281);
+exit:
+    LEAVE
+}
+
+static int Block02ed(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02ed 3a 67 20
+    CHECK_READ(0x2067, 0x02ed);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x02f0);
+    // 02f0 f5
+    CHECK_WRITE(sp - 1, 0x02f0);
+    CHECK_WRITE(sp - 2, 0x02f0);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x02f1);
+    // 02f1 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x02f2);
+    // 02f2 da 32 03
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0332, Block0332);
+    CHAIN(0x02f5, Block02f5);
+exit:
+    LEAVE
+}
+
+static int Block02f5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02f5 cd 0e 02
+    CHECK_WRITE(sp - 1, 0x02f5);
+    CHECK_WRITE(sp - 2, 0x02f5);
+    mem[(uint16_t)(sp - 1)] = 0x02;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf8;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x020e, Block020e);
+exit:
+    LEAVE
+}
+
+static int Block02f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02f8 cd 78 08
+    CHECK_WRITE(sp - 1, 0x02f8);
+    CHECK_WRITE(sp - 2, 0x02f8);
+    mem[(uint16_t)(sp - 1)] = 0x02;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xfb;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0878, Block0878);
+exit:
+    LEAVE
+}
+
+static int Block02fb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02fb 73
+    CHECK_WRITE(HL, 0x02fb);
+    mem[HL] = e;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x02fc);
+    // 02fc 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x02fd);
+    // 02fd 72
+    CHECK_WRITE(HL, 0x02fd);
+    mem[HL] = d;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x02fe);
+    // 02fe 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x02ff);
+    // 02ff 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0300);
+    // 0300 70
+    CHECK_WRITE(HL, 0x0300);
+    mem[HL] = b;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0301);
+    // 0301 00
+    ACCOUNT(4, 0x0302);
+    // 0302 cd e4 01
+    CHECK_WRITE(sp - 1, 0x0302);
+    CHECK_WRITE(sp - 2, 0x0302);
+    mem[(uint16_t)(sp - 1)] = 0x03;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x05;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01e4, Block01e4);
+exit:
+    LEAVE
+}
+
+static int Block0305(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0305 f1
+    CHECK_READ(sp, 0x0305);
+    CHECK_READ(sp + 1, 0x0305);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x0306);
+    if (!(f & (1 << 6))) EXIT(0x0306);
+    // 0306 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0307);
+    // 0307 3e 21
+    a = 0x21;
+    ACCOUNT(7, 0x0309);
+    // 0309 06 00
+    b = 0x00;
+    ACCOUNT(7, 0x030b);
+    // 030b d2 12 03
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x0312, Block0312);
+    CHAIN(0x030e, Block030e);
+exit:
+    LEAVE
+}
+
+static int Block030e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 030e 06 20
+    b = 0x20;
+    ACCOUNT(7, 0x0310);
+    // 0310 3e 22
+    a = 0x22;
+    ACCOUNT(7, 0x0312);
+    CHAIN(0x0312, Block0312);
+exit:
+    LEAVE
+}
+
+static int Block0312(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0312 32 67 20
+    CHECK_WRITE(0x2067, 0x0312);
+    mem[0x2067] = a;
+    WRITTEN(0x2067);
+    ACCOUNT(13, 0x0315);
+    // 0315 cd b6 0a
+    CHECK_WRITE(sp - 1, 0x0315);
+    CHECK_WRITE(sp - 2, 0x0315);
+    mem[(uint16_t)(sp - 1)] = 0x03;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x18;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block0318(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0318 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0319);
+    // 0319 32 11 20
+    CHECK_WRITE(0x2011, 0x0319);
+    mem[0x2011] = a;
+    WRITTEN(0x2011);
+    ACCOUNT(13, 0x031c);
+    // 031c 78
+    a = b;
+    ACCOUNT(5, 0x031d);
+    EXIT(0x031d);
+exit:
+    LEAVE
+}
+
+static int Block031f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 031f 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0320);
+    // 0320 32 98 20
+    CHECK_WRITE(0x2098, 0x0320);
+    mem[0x2098] = a;
+    WRITTEN(0x2098);
+    ACCOUNT(13, 0x0323);
+    // 0323 cd d6 09
+    CHECK_WRITE(sp - 1, 0x0323);
+    CHECK_WRITE(sp - 2, 0x0323);
+    mem[(uint16_t)(sp - 1)] = 0x03;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x26;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block0326(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0326 cd 7f 1a
+    CHECK_WRITE(sp - 1, 0x0326);
+    CHECK_WRITE(sp - 2, 0x0326);
+    mem[(uint16_t)(sp - 1)] = 0x03;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x29;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a7f, Block1a7f);
+exit:
+    LEAVE
+}
+
+static int Block0329(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0329 c3 f9 07
+    cyc += 7;
+    CHAIN(0x07f9, Block07f9);
+exit:
+    LEAVE
+}
+
+static int Block0332(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0332 cd 09 02
+    CHECK_WRITE(sp - 1, 0x0332);
+    CHECK_WRITE(sp - 2, 0x0332);
+    mem[(uint16_t)(sp - 1)] = 0x03;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x35;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0209, Block0209);
+exit:
+    LEAVE
+}
+
+static int Block0335(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0335 c3 f8 02
+    cyc += 7;
+    CHAIN(0x02f8, Block02f8);
+exit:
+    LEAVE
+}
+
+static int Block0707(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0707 06 fe
+    b = 0xfe;
+    ACCOUNT(7, 0x0709);
+    // 0709 c3 dc 19
+    cyc += 7;
+    CHAIN(0x19dc, Block19dc);
+exit:
+    LEAVE
+}
+
+static int Block0765(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0765 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0767);
+    // 0767 32 93 20
+    CHECK_WRITE(0x2093, 0x0767);
+    mem[0x2093] = a;
+    WRITTEN(0x2093);
+    ACCOUNT(13, 0x076a);
+    // 076a 31 00 24
+    sp = 0x2400;
+    ACCOUNT(10, 0x076d);
+    // 076d fb
+    f |= (1 << 5);
+    ACCOUNT(4, 0x076e);
+    // 076e cd 79 19
+    CHECK_WRITE(sp - 1, 0x076e);
+    CHECK_WRITE(sp - 2, 0x076e);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x71;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1979, Block1979);
+exit:
+    LEAVE
+}
+
+static int Block0771(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0771 cd d6 09
+    CHECK_WRITE(sp - 1, 0x0771);
+    CHECK_WRITE(sp - 2, 0x0771);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x74;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block0774(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0774 21 13 30
+    h = 0x30; l = 0x13;
+    ACCOUNT(10, 0x0777);
+    // 0777 11 f3 1f
+    d = 0x1f; e = 0xf3;
+    ACCOUNT(10, 0x077a);
+    // 077a 0e 04
+    c = 0x04;
+    ACCOUNT(7, 0x077c);
+    // 077c cd f3 08
+    CHECK_WRITE(sp - 1, 0x077c);
+    CHECK_WRITE(sp - 2, 0x077c);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block077f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 077f 3a eb 20
+    CHECK_READ(0x20eb, 0x077f);
+    a = mem[0x20eb];
+    ACCOUNT(13, 0x0782);
+    // 0782 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x0783);
+    // 0783 21 10 28
+    h = 0x28; l = 0x10;
+    ACCOUNT(10, 0x0786);
+    // 0786 0e 14
+    c = 0x14;
+    ACCOUNT(7, 0x0788);
+    // 0788 c2 57 08
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0857, Block0857);
+    CHAIN(0x078b, Block078b);
+exit:
+    LEAVE
+}
+
+static int Block078b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 078b 11 cf 1a
+    d = 0x1a; e = 0xcf;
+    ACCOUNT(10, 0x078e);
+    // 078e cd f3 08
+    CHECK_WRITE(sp - 1, 0x078e);
+    CHECK_WRITE(sp - 2, 0x078e);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x91;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block0793(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0793 e6 04
+    a &= 0x04; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0795);
+    // 0795 ca 7f 07
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x077f, Block077f);
+    CHAIN(0x0798, Block0798);
+exit:
+    LEAVE
+}
+
+static int Block0798(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0798 06 99
+    b = 0x99;
+    ACCOUNT(7, 0x079a);
+    // 079a af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x079b);
+    CHAIN(0x079b, Block079b);
+exit:
+    LEAVE
+}
+
+static int Block079b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 079b 32 ce 20
+    CHECK_WRITE(0x20ce, 0x079b);
+    mem[0x20ce] = a;
+    WRITTEN(0x20ce);
+    ACCOUNT(13, 0x079e);
+    // 079e 3a eb 20
+    CHECK_READ(0x20eb, 0x079e);
+    a = mem[0x20eb];
+    ACCOUNT(13, 0x07a1);
+    // 07a1 80
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x07a2);
+    EXIT(0x07a2);
+exit:
+    LEAVE
+}
+
+static int Block07a3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07a3 32 eb 20
+    CHECK_WRITE(0x20eb, 0x07a3);
+    mem[0x20eb] = a;
+    WRITTEN(0x20eb);
+    ACCOUNT(13, 0x07a6);
+    // 07a6 cd 47 19
+    CHECK_WRITE(sp - 1, 0x07a6);
+    CHECK_WRITE(sp - 2, 0x07a6);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xa9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1947, Block1947);
+exit:
+    LEAVE
+}
+
+static int Block07a9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07a9 21 00 00
+    h = 0x00; l = 0x00;
+    ACCOUNT(10, 0x07ac);
+    // 07ac 22 f8 20
+    CHECK_WRITE(0x20f8, 0x07ac);
+    CHECK_WRITE(0x20f9, 0x07ac);
+    mem[0x20f8] = l; mem[0x20f9] = h;
+    WRITTEN(0x20f8);
+    WRITTEN(0x20f9);
+    ACCOUNT(16, 0x07af);
+    // 07af 22 fc 20
+    CHECK_WRITE(0x20fc, 0x07af);
+    CHECK_WRITE(0x20fd, 0x07af);
+    mem[0x20fc] = l; mem[0x20fd] = h;
+    WRITTEN(0x20fc);
+    WRITTEN(0x20fd);
+    ACCOUNT(16, 0x07b2);
+    // 07b2 cd 25 19
+    CHECK_WRITE(sp - 1, 0x07b2);
+    CHECK_WRITE(sp - 2, 0x07b2);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb5;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1925, Block1925);
+exit:
+    LEAVE
+}
+
+static int Block07b5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07b5 cd 2b 19
+    CHECK_WRITE(sp - 1, 0x07b5);
+    CHECK_WRITE(sp - 2, 0x07b5);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb8;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x192b, Block192b);
+exit:
+    LEAVE
+}
+
+static int Block07b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07b8 cd d7 19
+    CHECK_WRITE(sp - 1, 0x07b8);
+    CHECK_WRITE(sp - 2, 0x07b8);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xbb;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d7, Block19d7);
+exit:
+    LEAVE
+}
+
+static int Block07bb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07bb 21 01 01
+    h = 0x01; l = 0x01;
+    ACCOUNT(10, 0x07be);
+    // 07be 7c
+    a = h;
+    ACCOUNT(5, 0x07bf);
+    // 07bf 32 ef 20
+    CHECK_WRITE(0x20ef, 0x07bf);
+    mem[0x20ef] = a;
+    WRITTEN(0x20ef);
+    ACCOUNT(13, 0x07c2);
+    // 07c2 22 e7 20
+    CHECK_WRITE(0x20e7, 0x07c2);
+    CHECK_WRITE(0x20e8, 0x07c2);
+    mem[0x20e7] = l; mem[0x20e8] = h;
+    WRITTEN(0x20e7);
+    WRITTEN(0x20e8);
+    ACCOUNT(16, 0x07c5);
+    // 07c5 22 e5 20
+    CHECK_WRITE(0x20e5, 0x07c5);
+    CHECK_WRITE(0x20e6, 0x07c5);
+    mem[0x20e5] = l; mem[0x20e6] = h;
+    WRITTEN(0x20e5);
+    WRITTEN(0x20e6);
+    ACCOUNT(16, 0x07c8);
+    // 07c8 cd 56 19
+    CHECK_WRITE(sp - 1, 0x07c8);
+    CHECK_WRITE(sp - 2, 0x07c8);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xcb;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1956, Block1956);
+exit:
+    LEAVE
+}
+
+static int Block07cb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07cb cd ef 01
+    CHECK_WRITE(sp - 1, 0x07cb);
+    CHECK_WRITE(sp - 2, 0x07cb);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xce;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01ef, Block01ef);
+exit:
+    LEAVE
+}
+
+static int Block07ce(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07ce cd f5 01
+    CHECK_WRITE(sp - 1, 0x07ce);
+    CHECK_WRITE(sp - 2, 0x07ce);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01f5, Block01f5);
+exit:
+    LEAVE
+}
+
+static int Block07d1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07d1 cd d1 08
+    CHECK_WRITE(sp - 1, 0x07d1);
+    CHECK_WRITE(sp - 2, 0x07d1);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    EXIT(0x08d1);
+exit:
+    LEAVE
+}
+
+static int Block07d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07d4 32 ff 21
+    CHECK_WRITE(0x21ff, 0x07d4);
+    mem[0x21ff] = a;
+    WRITTEN(0x21ff);
+    ACCOUNT(13, 0x07d7);
+    // 07d7 32 ff 22
+    CHECK_WRITE(0x22ff, 0x07d7);
+    mem[0x22ff] = a;
+    WRITTEN(0x22ff);
+    ACCOUNT(13, 0x07da);
+    // 07da cd d7 00
+    CHECK_WRITE(sp - 1, 0x07da);
+    CHECK_WRITE(sp - 2, 0x07da);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xdd;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x00d7, Block00d7);
+exit:
+    LEAVE
+}
+
+static int Block07dd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07dd af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x07de);
+    // 07de 32 fe 21
+    CHECK_WRITE(0x21fe, 0x07de);
+    mem[0x21fe] = a;
+    WRITTEN(0x21fe);
+    ACCOUNT(13, 0x07e1);
+    // 07e1 32 fe 22
+    CHECK_WRITE(0x22fe, 0x07e1);
+    mem[0x22fe] = a;
+    WRITTEN(0x22fe);
+    ACCOUNT(13, 0x07e4);
+    // 07e4 cd c0 01
+    CHECK_WRITE(sp - 1, 0x07e4);
+    CHECK_WRITE(sp - 2, 0x07e4);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xe7;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01c0, Block01c0);
+exit:
+    LEAVE
+}
+
+static int Block07e7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07e7 cd 04 19
+    CHECK_WRITE(sp - 1, 0x07e7);
+    CHECK_WRITE(sp - 2, 0x07e7);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xea;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1904, Block1904);
+exit:
+    LEAVE
+}
+
+static int Block07ea(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07ea 21 78 38
+    h = 0x38; l = 0x78;
+    ACCOUNT(10, 0x07ed);
+    // 07ed 22 fc 21
+    CHECK_WRITE(0x21fc, 0x07ed);
+    CHECK_WRITE(0x21fd, 0x07ed);
+    mem[0x21fc] = l; mem[0x21fd] = h;
+    WRITTEN(0x21fc);
+    WRITTEN(0x21fd);
+    ACCOUNT(16, 0x07f0);
+    // 07f0 22 fc 22
+    CHECK_WRITE(0x22fc, 0x07f0);
+    CHECK_WRITE(0x22fd, 0x07f0);
+    mem[0x22fc] = l; mem[0x22fd] = h;
+    WRITTEN(0x22fc);
+    WRITTEN(0x22fd);
+    ACCOUNT(16, 0x07f3);
+    // 07f3 cd e4 01
+    CHECK_WRITE(sp - 1, 0x07f3);
+    CHECK_WRITE(sp - 2, 0x07f3);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01e4, Block01e4);
+exit:
+    LEAVE
+}
+
+static int Block07f6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07f6 cd 7f 1a
+    CHECK_WRITE(sp - 1, 0x07f6);
+    CHECK_WRITE(sp - 2, 0x07f6);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a7f, Block1a7f);
+exit:
+    LEAVE
+}
+
+static int Block07f9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07f9 cd 8d 08
+    CHECK_WRITE(sp - 1, 0x07f9);
+    CHECK_WRITE(sp - 2, 0x07f9);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xfc;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x088d, Block088d);
+exit:
+    LEAVE
+}
+
+static int Block07fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07fc cd d6 09
+    CHECK_WRITE(sp - 1, 0x07fc);
+    CHECK_WRITE(sp - 2, 0x07fc);
+    mem[(uint16_t)(sp - 1)] = 0x07;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xff;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block07ff(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 07ff 00
+    ACCOUNT(4, 0x0800);
+    // 0800 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0801);
+    // 0801 32 c1 20
+    CHECK_WRITE(0x20c1, 0x0801);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x0804);
+    CHAIN(0x0804, Block0804);
+exit:
+    LEAVE
+}
+
+static int Block0804(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0804 cd cf 01
+    CHECK_WRITE(sp - 1, 0x0804);
+    CHECK_WRITE(sp - 2, 0x0804);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x07;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01cf, Block01cf);
+exit:
+    LEAVE
+}
+
+static int Block0807(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0807 3a 67 20
+    CHECK_READ(0x2067, 0x0807);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x080a);
+    // 080a 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x080b);
+    // 080b da 72 08
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0872, Block0872);
+    CHAIN(0x080e, Block080e);
+exit:
+    LEAVE
+}
+
+static int Block080e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 080e cd 13 02
+    CHECK_WRITE(sp - 1, 0x080e);
+    CHECK_WRITE(sp - 2, 0x080e);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x11;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0213, Block0213);
+exit:
+    LEAVE
+}
+
+static int Block0811(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0811 cd cf 01
+    CHECK_WRITE(sp - 1, 0x0811);
+    CHECK_WRITE(sp - 2, 0x0811);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x14;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01cf, Block01cf);
+exit:
+    LEAVE
+}
+
+static int Block0814(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0814 cd b1 00
+    CHECK_WRITE(sp - 1, 0x0814);
+    CHECK_WRITE(sp - 2, 0x0814);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x17;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x00b1, Block00b1);
+exit:
+    LEAVE
+}
+
+static int Block0817(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0817 cd d1 19
+    CHECK_WRITE(sp - 1, 0x0817);
+    CHECK_WRITE(sp - 2, 0x0817);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x1a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d1, Block19d1);
+exit:
+    LEAVE
+}
+
+static int Block081a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 081a 06 20
+    b = 0x20;
+    ACCOUNT(7, 0x081c);
+    // 081c cd fa 18
+    CHECK_WRITE(sp - 1, 0x081c);
+    CHECK_WRITE(sp - 2, 0x081c);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x1f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block081f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 081f cd 18 16
+    CHECK_WRITE(sp - 1, 0x081f);
+    CHECK_WRITE(sp - 2, 0x081f);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x22;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1618, Block1618);
+exit:
+    LEAVE
+}
+
+static int Block0822(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0822 cd 0a 19
+    CHECK_WRITE(sp - 1, 0x0822);
+    CHECK_WRITE(sp - 2, 0x0822);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x25;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x190a, Block190a);
+exit:
+    LEAVE
+}
+
+static int Block0825(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0825 cd f3 15
+    CHECK_WRITE(sp - 1, 0x0825);
+    CHECK_WRITE(sp - 2, 0x0825);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x28;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x15f3, Block15f3);
+exit:
+    LEAVE
+}
+
+static int Block0828(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0828 cd 88 09
+    CHECK_WRITE(sp - 1, 0x0828);
+    CHECK_WRITE(sp - 2, 0x0828);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x2b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0988, Block0988);
+exit:
+    LEAVE
+}
+
+static int Block082b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 082b 3a 82 20
+    CHECK_READ(0x2082, 0x082b);
+    a = mem[0x2082];
+    ACCOUNT(13, 0x082e);
+    // 082e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x082f);
+    // 082f ca ef 09
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x09ef, Block09ef);
+    CHAIN(0x0832, Block0832);
+exit:
+    LEAVE
+}
+
+static int Block0832(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0832 cd 0e 17
+    CHECK_WRITE(sp - 1, 0x0832);
+    CHECK_WRITE(sp - 2, 0x0832);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x35;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x170e, Block170e);
+exit:
+    LEAVE
+}
+
+static int Block0835(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0835 cd 35 09
+    CHECK_WRITE(sp - 1, 0x0835);
+    CHECK_WRITE(sp - 2, 0x0835);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x38;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0935, Block0935);
+exit:
+    LEAVE
+}
+
+static int Block0838(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0838 cd d8 08
+    CHECK_WRITE(sp - 1, 0x0838);
+    CHECK_WRITE(sp - 2, 0x0838);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08d8, Block08d8);
+exit:
+    LEAVE
+}
+
+static int Block083b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 083b cd 2c 17
+    CHECK_WRITE(sp - 1, 0x083b);
+    CHECK_WRITE(sp - 2, 0x083b);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x172c, Block172c);
+exit:
+    LEAVE
+}
+
+static int Block083e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 083e cd 59 0a
+    CHECK_WRITE(sp - 1, 0x083e);
+    CHECK_WRITE(sp - 2, 0x083e);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x41;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0841(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0841 ca 49 08
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0849, Block0849);
+    CHAIN(0x0844, Block0844);
+exit:
+    LEAVE
+}
+
+static int Block0844(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0844 06 04
+    b = 0x04;
+    ACCOUNT(7, 0x0846);
+    // 0846 cd fa 18
+    CHECK_WRITE(sp - 1, 0x0846);
+    CHECK_WRITE(sp - 2, 0x0846);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x49;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block0849(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0849 cd 75 17
+    CHECK_WRITE(sp - 1, 0x0849);
+    CHECK_WRITE(sp - 2, 0x0849);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1775, Block1775);
+exit:
+    LEAVE
+}
+
+static int Block084e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 084e cd 04 18
+    CHECK_WRITE(sp - 1, 0x084e);
+    CHECK_WRITE(sp - 2, 0x084e);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x51;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1804, Block1804);
+exit:
+    LEAVE
+}
+
+static int Block0851(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0851 c3 1f 08
+    cyc += 7;
+    CHAIN(0x081f, Block081f);
+exit:
+    LEAVE
+}
+
+static int Block0857(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0857 11 ba 1a
+    d = 0x1a; e = 0xba;
+    ACCOUNT(10, 0x085a);
+    // 085a cd f3 08
+    CHECK_WRITE(sp - 1, 0x085a);
+    CHECK_WRITE(sp - 2, 0x085a);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x5d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block085d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 085d 06 98
+    b = 0x98;
+    ACCOUNT(7, 0x085f);
+    EXIT(0x085f);
+exit:
+    LEAVE
+}
+
+static int Block0861(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0861 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0862);
+    // 0862 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0863);
+    // 0863 da 6d 08
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x086d, Block086d);
+    CHAIN(0x0866, Block0866);
+exit:
+    LEAVE
+}
+
+static int Block0866(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0866 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0867);
+    // 0867 da 98 07
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0798, Block0798);
+    CHAIN(0x086a, Block086a);
+exit:
+    LEAVE
+}
+
+static int Block086a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 086a c3 7f 07
+    cyc += 7;
+    CHAIN(0x077f, Block077f);
+exit:
+    LEAVE
+}
+
+static int Block086d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 086d 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x086f);
+    // 086f c3 9b 07
+    cyc += 7;
+    CHAIN(0x079b, Block079b);
+exit:
+    LEAVE
+}
+
+static int Block0872(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0872 cd 1a 02
+    CHECK_WRITE(sp - 1, 0x0872);
+    CHECK_WRITE(sp - 2, 0x0872);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x75;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x021a, Block021a);
+exit:
+    LEAVE
+}
+
+static int Block0875(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0875 c3 14 08
+    cyc += 7;
+    CHAIN(0x0814, Block0814);
+exit:
+    LEAVE
+}
+
+static int Block0878(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0878 3a 08 20
+    CHECK_READ(0x2008, 0x0878);
+    a = mem[0x2008];
+    ACCOUNT(13, 0x087b);
+    // 087b 47
+    b = a;
+    ACCOUNT(5, 0x087c);
+    // 087c 2a 09 20
+    CHECK_READ(0x2009, 0x087c);
+    CHECK_READ(0x200a, 0x087c);
+    l = mem[0x2009]; h = mem[0x200a];
+    ACCOUNT(16, 0x087f);
+    // 087f eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x0880);
+    // 0880 c3 86 08
+    cyc += 7;
+    CHAIN(0x0886, Block0886);
+exit:
+    LEAVE
+}
+
+static int Block0886(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0886 3a 67 20
+    CHECK_READ(0x2067, 0x0886);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x0889);
+    // 0889 67
+    h = a;
+    ACCOUNT(5, 0x088a);
+    // 088a 2e fc
+    l = 0xfc;
+    ACCOUNT(7, 0x088c);
+    // 088c c9
+    CHECK_READ(sp, 0x088c);
+    CHECK_READ(sp + 1, 0x088c);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block088d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 088d 21 11 2b
+    h = 0x2b; l = 0x11;
+    ACCOUNT(10, 0x0890);
+    // 0890 11 70 1b
+    d = 0x1b; e = 0x70;
+    ACCOUNT(10, 0x0893);
+    // 0893 0e 0e
+    c = 0x0e;
+    ACCOUNT(7, 0x0895);
+    // 0895 cd f3 08
+    CHECK_WRITE(sp - 1, 0x0895);
+    CHECK_WRITE(sp - 2, 0x0895);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x98;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block0898(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0898 3a 67 20
+    CHECK_READ(0x2067, 0x0898);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x089b);
+    // 089b 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x089c);
+    // 089c 3e 1c
+    a = 0x1c;
+    ACCOUNT(7, 0x089e);
+    // 089e 21 11 37
+    h = 0x37; l = 0x11;
+    ACCOUNT(10, 0x08a1);
+    // 08a1 d4 ff 08
+    if (!(f & FlagCarry)) {
+        CHECK_WRITE(sp - 1, 0x08a1);
+        CHECK_WRITE(sp - 2, 0x08a1);
+        mem[(uint16_t)(sp - 1)] = 0x08;
+        WRITTEN(sp - 1);
+        mem[(uint16_t)(sp - 2)] = 0xa4;
+        WRITTEN(sp - 2);
+        sp -= 2;
+        cyc += 17;
+        CHAIN(0x08ff, Block08ff);
+    }
+    cyc += 11;
+    CHAIN(0x08a4, Block08a4);
+exit:
+    LEAVE
+}
+
+static int Block08a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08a4 3e b0
+    a = 0xb0;
+    ACCOUNT(7, 0x08a6);
+    // 08a6 32 c0 20
+    CHECK_WRITE(0x20c0, 0x08a6);
+    mem[0x20c0] = a;
+    WRITTEN(0x20c0);
+    ACCOUNT(13, 0x08a9);
+    CHAIN(0x08a9, Block08a9);
+exit:
+    LEAVE
+}
+
+static int Block08a9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08a9 3a c0 20
+    CHECK_READ(0x20c0, 0x08a9);
+    a = mem[0x20c0];
+    ACCOUNT(13, 0x08ac);
+    // 08ac a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x08ad);
+    // 08ad c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x08ad);
+        CHECK_READ(sp + 1, 0x08ad);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x08ae, Block08ae);
+exit:
+    LEAVE
+}
+
+static int Block08ae(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08ae e6 04
+    a &= 0x04; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x08b0);
+    // 08b0 c2 bc 08
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x08bc, Block08bc);
+    CHAIN(0x08b3, Block08b3);
+exit:
+    LEAVE
+}
+
+static int Block08b3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08b3 cd ca 09
+    CHECK_WRITE(sp - 1, 0x08b3);
+    CHECK_WRITE(sp - 2, 0x08b3);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09ca, Block09ca);
+exit:
+    LEAVE
+}
+
+static int Block08b6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08b6 cd 31 19
+    CHECK_WRITE(sp - 1, 0x08b6);
+    CHECK_WRITE(sp - 2, 0x08b6);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1931, Block1931);
+exit:
+    LEAVE
+}
+
+static int Block08b9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08b9 c3 a9 08
+    cyc += 7;
+    CHAIN(0x08a9, Block08a9);
+exit:
+    LEAVE
+}
+
+static int Block08bc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08bc 06 20
+    b = 0x20;
+    ACCOUNT(7, 0x08be);
+    // 08be 21 1c 27
+    h = 0x27; l = 0x1c;
+    ACCOUNT(10, 0x08c1);
+    // 08c1 3a 67 20
+    CHECK_READ(0x2067, 0x08c1);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x08c4);
+    // 08c4 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x08c5);
+    // 08c5 da cb 08
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x08cb, Block08cb);
+    CHAIN(0x08c8, Block08c8);
+exit:
+    LEAVE
+}
+
+static int Block08c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08c8 21 1c 39
+    h = 0x39; l = 0x1c;
+    ACCOUNT(10, 0x08cb);
+    CHAIN(0x08cb, Block08cb);
+exit:
+    LEAVE
+}
+
+static int Block08cb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08cb cd cb 14
+    CHECK_WRITE(sp - 1, 0x08cb);
+    CHECK_WRITE(sp - 2, 0x08cb);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xce;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x14cb, Block14cb);
+exit:
+    LEAVE
+}
+
+static int Block08ce(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08ce c3 a9 08
+    cyc += 7;
+    CHAIN(0x08a9, Block08a9);
+exit:
+    LEAVE
+}
+
+static int Block08d3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08d3 e6 03
+    a &= 0x03; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x08d5);
+    // 08d5 c6 03
+    { uint8_t v = 0x03; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x08d7);
+    // 08d7 c9
+    CHECK_READ(sp, 0x08d7);
+    CHECK_READ(sp + 1, 0x08d7);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block08d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08d8 3a 82 20
+    CHECK_READ(0x2082, 0x08d8);
+    a = mem[0x2082];
+    ACCOUNT(13, 0x08db);
+    // 08db fe 09
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x09];
+    ACCOUNT(7, 0x08dd);
+    // 08dd d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x08dd);
+        CHECK_READ(sp + 1, 0x08dd);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x08de, Block08de);
+exit:
+    LEAVE
+}
+
+static int Block08de(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08de 3e fb
+    a = 0xfb;
+    ACCOUNT(7, 0x08e0);
+    // 08e0 32 7e 20
+    CHECK_WRITE(0x207e, 0x08e0);
+    mem[0x207e] = a;
+    WRITTEN(0x207e);
+    ACCOUNT(13, 0x08e3);
+    // 08e3 c9
+    CHECK_READ(sp, 0x08e3);
+    CHECK_READ(sp + 1, 0x08e3);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block08e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08e4 3a ce 20
+    CHECK_READ(0x20ce, 0x08e4);
+    a = mem[0x20ce];
+    ACCOUNT(13, 0x08e7);
+    // 08e7 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x08e8);
+    // 08e8 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x08e8);
+        CHECK_READ(sp + 1, 0x08e8);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x08e9, Block08e9);
+exit:
+    LEAVE
+}
+
+static int Block08e9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08e9 21 1c 39
+    h = 0x39; l = 0x1c;
+    ACCOUNT(10, 0x08ec);
+    // 08ec 06 20
+    b = 0x20;
+    ACCOUNT(7, 0x08ee);
+    // 08ee c3 cb 14
+    cyc += 7;
+    CHAIN(0x14cb, Block14cb);
+exit:
+    LEAVE
+}
+
+static int Block08f3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08f3 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x08f3);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x08f4);
+    // 08f4 d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x08f4);
+    CHECK_WRITE(sp - 1, 0x08f4);
+    CHECK_WRITE(sp - 2, 0x08f4);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x08f5);
+    // 08f5 cd ff 08
+    CHECK_WRITE(sp - 1, 0x08f5);
+    CHECK_WRITE(sp - 2, 0x08f5);
+    mem[(uint16_t)(sp - 1)] = 0x08;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf8;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block08f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08f8 d1
+    CHECK_READ(sp, 0x08f8);
+    CHECK_READ(sp + 1, 0x08f8);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x08f9);
+    // 08f9 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x08fa);
+    // 08fa 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x08fb);
+    // 08fb c2 f3 08
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x08f3, Block08f3);
+    CHAIN(0x08fe, Block08fe);
+exit:
+    LEAVE
+}
+
+static int Block08fe(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08fe c9
+    CHECK_READ(sp, 0x08fe);
+    CHECK_READ(sp + 1, 0x08fe);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block08ff(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 08ff 11 00 1e
+    d = 0x1e; e = 0x00;
+    ACCOUNT(10, 0x0902);
+    // 0902 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0902);
+    CHECK_WRITE(sp - 1, 0x0902);
+    CHECK_WRITE(sp - 2, 0x0902);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0903);
+    // 0903 26 00
+    h = 0x00;
+    ACCOUNT(7, 0x0905);
+    // 0905 6f
+    l = a;
+    ACCOUNT(5, 0x0906);
+    // 0906 29
+    { uint32_t v = HL + ((h << 8) | l); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x0907);
+    // 0907 29
+    { uint32_t v = HL + ((h << 8) | l); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x0908);
+    // 0908 29
+    { uint32_t v = HL + ((h << 8) | l); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x0909);
+    // 0909 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x090a);
+    // 090a eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x090b);
+    // 090b e1
+    CHECK_READ(sp, 0x090b);
+    CHECK_READ(sp + 1, 0x090b);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x090c);
+    // 090c 06 08
+    b = 0x08;
+    ACCOUNT(7, 0x090e);
+    EXIT(0x090e);
+exit:
+    LEAVE
+}
+
+static int Block0910(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0910 c3 39 14
+    cyc += 7;
+    CHAIN(0x1439, Block1439);
+exit:
+    LEAVE
+}
+
+static int Block0913(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0913 3a 09 20
+    CHECK_READ(0x2009, 0x0913);
+    a = mem[0x2009];
+    ACCOUNT(13, 0x0916);
+    // 0916 fe 78
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x78];
+    ACCOUNT(7, 0x0918);
+    // 0918 d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x0918);
+        CHECK_READ(sp + 1, 0x0918);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0919, Block0919);
+exit:
+    LEAVE
+}
+
+static int Block0919(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0919 2a 91 20
+    CHECK_READ(0x2091, 0x0919);
+    CHECK_READ(0x2092, 0x0919);
+    l = mem[0x2091]; h = mem[0x2092];
+    ACCOUNT(16, 0x091c);
+    // 091c 7d
+    a = l;
+    ACCOUNT(5, 0x091d);
+    // 091d b4
+    a |= h; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x091e);
+    // 091e c2 29 09
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0929, Block0929);
+    CHAIN(0x0921, Block0921);
+exit:
+    LEAVE
+}
+
+static int Block0921(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0921 21 00 06
+    h = 0x06; l = 0x00;
+    ACCOUNT(10, 0x0924);
+    // 0924 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0926);
+    // 0926 32 83 20
+    CHECK_WRITE(0x2083, 0x0926);
+    mem[0x2083] = a;
+    WRITTEN(0x2083);
+    ACCOUNT(13, 0x0929);
+    CHAIN(0x0929, Block0929);
+exit:
+    LEAVE
+}
+
+static int Block0929(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0929 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x092a);
+    // 092a 22 91 20
+    CHECK_WRITE(0x2091, 0x092a);
+    CHECK_WRITE(0x2092, 0x092a);
+    mem[0x2091] = l; mem[0x2092] = h;
+    WRITTEN(0x2091);
+    WRITTEN(0x2092);
+    ACCOUNT(16, 0x092d);
+    // 092d c9
+    CHECK_READ(sp, 0x092d);
+    CHECK_READ(sp + 1, 0x092d);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block092e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 092e cd 11 16
+    CHECK_WRITE(sp - 1, 0x092e);
+    CHECK_WRITE(sp - 2, 0x092e);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x31;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1611, Block1611);
+exit:
+    LEAVE
+}
+
+static int Block0931(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0931 2e ff
+    l = 0xff;
+    ACCOUNT(7, 0x0933);
+    // 0933 7e
+    CHECK_READ(HL, 0x0933);
+    a = mem[HL];
+    ACCOUNT(7, 0x0934);
+    // 0934 c9
+    CHECK_READ(sp, 0x0934);
+    CHECK_READ(sp + 1, 0x0934);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0935(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0935 cd 10 19
+    CHECK_WRITE(sp - 1, 0x0935);
+    CHECK_WRITE(sp - 2, 0x0935);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x38;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1910, Block1910);
+exit:
+    LEAVE
+}
+
+static int Block0938(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0938 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0939);
+    // 0939 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x093a);
+    // 093a 7e
+    CHECK_READ(HL, 0x093a);
+    a = mem[HL];
+    ACCOUNT(7, 0x093b);
+    // 093b a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x093c);
+    // 093c c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x093c);
+        CHECK_READ(sp + 1, 0x093c);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x093d, Block093d);
+exit:
+    LEAVE
+}
+
+static int Block093d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 093d 06 15
+    b = 0x15;
+    ACCOUNT(7, 0x093f);
+    EXIT(0x093f);
+exit:
+    LEAVE
+}
+
+static int Block0941(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0941 e6 08
+    a &= 0x08; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0943);
+    // 0943 ca 48 09
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0948, Block0948);
+    CHAIN(0x0946, Block0946);
+exit:
+    LEAVE
+}
+
+static int Block0946(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0946 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x0948);
+    CHAIN(0x0948, Block0948);
+exit:
+    LEAVE
+}
+
+static int Block0948(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0948 cd ca 09
+    CHECK_WRITE(sp - 1, 0x0948);
+    CHECK_WRITE(sp - 2, 0x0948);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09ca, Block09ca);
+exit:
+    LEAVE
+}
+
+static int Block094b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 094b 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x094c);
+    // 094c 7e
+    CHECK_READ(HL, 0x094c);
+    a = mem[HL];
+    ACCOUNT(7, 0x094d);
+    // 094d b8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][b];
+    ACCOUNT(4, 0x094e);
+    // 094e d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x094e);
+        CHECK_READ(sp + 1, 0x094e);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x094f, Block094f);
+exit:
+    LEAVE
+}
+
+static int Block094f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 094f cd 2e 09
+    CHECK_WRITE(sp - 1, 0x094f);
+    CHECK_WRITE(sp - 2, 0x094f);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x52;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x092e, Block092e);
+exit:
+    LEAVE
+}
+
+static int Block0952(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0952 34
+    CHECK_READ(HL, 0x0952);
+    CHECK_WRITE(HL, 0x0952);
+    { uint8_t v = (uint8_t)(mem[HL] + 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0953);
+    // 0953 7e
+    CHECK_READ(HL, 0x0953);
+    a = mem[HL];
+    ACCOUNT(7, 0x0954);
+    // 0954 f5
+    CHECK_WRITE(sp - 1, 0x0954);
+    CHECK_WRITE(sp - 2, 0x0954);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0955);
+    // 0955 21 01 25
+    h = 0x25; l = 0x01;
+    ACCOUNT(10, 0x0958);
+    CHAIN(0x0958, Block0958);
+exit:
+    LEAVE
+}
+
+static int Block0958(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0958 24
+    h = (uint8_t)(h + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[h];
+    ACCOUNT(5, 0x0959);
+    // 0959 24
+    h = (uint8_t)(h + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[h];
+    ACCOUNT(5, 0x095a);
+    // 095a 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x095b);
+    // 095b c2 58 09
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0958, Block0958);
+    CHAIN(0x095e, Block095e);
+exit:
+    LEAVE
+}
+
+static int Block095e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 095e 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x0960);
+    // 0960 11 60 1c
+    d = 0x1c; e = 0x60;
+    ACCOUNT(10, 0x0963);
+    // 0963 cd 39 14
+    CHECK_WRITE(sp - 1, 0x0963);
+    CHECK_WRITE(sp - 2, 0x0963);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x66;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1439, Block1439);
+exit:
+    LEAVE
+}
+
+static int Block0966(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0966 f1
+    CHECK_READ(sp, 0x0966);
+    CHECK_READ(sp + 1, 0x0966);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x0967);
+    if (!(f & (1 << 6))) EXIT(0x0967);
+    // 0967 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0968);
+    // 0968 cd 8b 1a
+    CHECK_WRITE(sp - 1, 0x0968);
+    CHECK_WRITE(sp - 2, 0x0968);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x6b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a8b, Block1a8b);
+exit:
+    LEAVE
+}
+
+static int Block096b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 096b cd 10 19
+    CHECK_WRITE(sp - 1, 0x096b);
+    CHECK_WRITE(sp - 2, 0x096b);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x6e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1910, Block1910);
+exit:
+    LEAVE
+}
+
+static int Block096e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 096e 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x096f);
+    // 096f 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0970);
+    // 0970 36 00
+    CHECK_WRITE(HL, 0x0970);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0972);
+    // 0972 3e ff
+    a = 0xff;
+    ACCOUNT(7, 0x0974);
+    // 0974 32 99 20
+    CHECK_WRITE(0x2099, 0x0974);
+    mem[0x2099] = a;
+    WRITTEN(0x2099);
+    ACCOUNT(13, 0x0977);
+    // 0977 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x0979);
+    // 0979 c3 fa 18
+    cyc += 7;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block097c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 097c 21 a0 1d
+    h = 0x1d; l = 0xa0;
+    ACCOUNT(10, 0x097f);
+    // 097f fe 02
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x02];
+    ACCOUNT(7, 0x0981);
+    // 0981 d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x0981);
+        CHECK_READ(sp + 1, 0x0981);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0982, Block0982);
+exit:
+    LEAVE
+}
+
+static int Block0982(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0982 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0983);
+    // 0983 fe 04
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x04];
+    ACCOUNT(7, 0x0985);
+    // 0985 d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x0985);
+        CHECK_READ(sp + 1, 0x0985);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0986, Block0986);
+exit:
+    LEAVE
+}
+
+static int Block0986(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0986 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0987);
+    // 0987 c9
+    CHECK_READ(sp, 0x0987);
+    CHECK_READ(sp + 1, 0x0987);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0988(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0988 cd ca 09
+    CHECK_WRITE(sp - 1, 0x0988);
+    CHECK_WRITE(sp - 2, 0x0988);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x8b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09ca, Block09ca);
+exit:
+    LEAVE
+}
+
+static int Block098b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 098b 3a f1 20
+    CHECK_READ(0x20f1, 0x098b);
+    a = mem[0x20f1];
+    ACCOUNT(13, 0x098e);
+    // 098e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x098f);
+    // 098f c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x098f);
+        CHECK_READ(sp + 1, 0x098f);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0990, Block0990);
+exit:
+    LEAVE
+}
+
+static int Block0990(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0990 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0991);
+    // 0991 32 f1 20
+    CHECK_WRITE(0x20f1, 0x0991);
+    mem[0x20f1] = a;
+    WRITTEN(0x20f1);
+    ACCOUNT(13, 0x0994);
+    // 0994 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0994);
+    CHECK_WRITE(sp - 1, 0x0994);
+    CHECK_WRITE(sp - 2, 0x0994);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0995);
+    // 0995 2a f2 20
+    CHECK_READ(0x20f2, 0x0995);
+    CHECK_READ(0x20f3, 0x0995);
+    l = mem[0x20f2]; h = mem[0x20f3];
+    ACCOUNT(16, 0x0998);
+    // 0998 eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x0999);
+    // 0999 e1
+    CHECK_READ(sp, 0x0999);
+    CHECK_READ(sp + 1, 0x0999);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x099a);
+    // 099a 7e
+    CHECK_READ(HL, 0x099a);
+    a = mem[HL];
+    ACCOUNT(7, 0x099b);
+    // 099b 83
+    { uint8_t v = e; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x099c);
+    EXIT(0x099c);
+exit:
+    LEAVE
+}
+
+static int Block099d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 099d 77
+    CHECK_WRITE(HL, 0x099d);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x099e);
+    // 099e 5f
+    e = a;
+    ACCOUNT(5, 0x099f);
+    // 099f 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x09a0);
+    // 09a0 7e
+    CHECK_READ(HL, 0x09a0);
+    a = mem[HL];
+    ACCOUNT(7, 0x09a1);
+    // 09a1 8a
+    { uint8_t v = d; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x09a2);
+    EXIT(0x09a2);
+exit:
+    LEAVE
+}
+
+static int Block09a3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09a3 77
+    CHECK_WRITE(HL, 0x09a3);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x09a4);
+    // 09a4 57
+    d = a;
+    ACCOUNT(5, 0x09a5);
+    // 09a5 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x09a6);
+    // 09a6 7e
+    CHECK_READ(HL, 0x09a6);
+    a = mem[HL];
+    ACCOUNT(7, 0x09a7);
+    // 09a7 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x09a8);
+    // 09a8 66
+    CHECK_READ(HL, 0x09a8);
+    h = mem[HL];
+    ACCOUNT(7, 0x09a9);
+    // 09a9 6f
+    l = a;
+    ACCOUNT(5, 0x09aa);
+    // 09aa c3 ad 09
+    cyc += 7;
+    CHAIN(0x09ad, Block09ad);
+exit:
+    LEAVE
+}
+
+static int Block09ad(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09ad 7a
+    a = d;
+    ACCOUNT(5, 0x09ae);
+    // 09ae cd b2 09
+    CHECK_WRITE(sp - 1, 0x09ae);
+    CHECK_WRITE(sp - 2, 0x09ae);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09b2, Block09b2);
+exit:
+    LEAVE
+}
+
+static int Block09b1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09b1 7b
+    a = e;
+    ACCOUNT(5, 0x09b2);
+    CHAIN(0x09b2, Block09b2);
+exit:
+    LEAVE
+}
+
+static int Block09b2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09b2 d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x09b2);
+    CHECK_WRITE(sp - 1, 0x09b2);
+    CHECK_WRITE(sp - 2, 0x09b2);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x09b3);
+    // 09b3 f5
+    CHECK_WRITE(sp - 1, 0x09b3);
+    CHECK_WRITE(sp - 2, 0x09b3);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x09b4);
+    // 09b4 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x09b5);
+    // 09b5 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x09b6);
+    // 09b6 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x09b7);
+    // 09b7 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x09b8);
+    // 09b8 e6 0f
+    a &= 0x0f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x09ba);
+    // 09ba cd c5 09
+    CHECK_WRITE(sp - 1, 0x09ba);
+    CHECK_WRITE(sp - 2, 0x09ba);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xbd;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09c5, Block09c5);
+exit:
+    LEAVE
+}
+
+static int Block09bd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09bd f1
+    CHECK_READ(sp, 0x09bd);
+    CHECK_READ(sp + 1, 0x09bd);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x09be);
+    if (!(f & (1 << 6))) EXIT(0x09be);
+    // 09be e6 0f
+    a &= 0x0f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x09c0);
+    // 09c0 cd c5 09
+    CHECK_WRITE(sp - 1, 0x09c0);
+    CHECK_WRITE(sp - 2, 0x09c0);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xc3;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09c5, Block09c5);
+exit:
+    LEAVE
+}
+
+static int Block09c3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09c3 d1
+    CHECK_READ(sp, 0x09c3);
+    CHECK_READ(sp + 1, 0x09c3);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x09c4);
+    // 09c4 c9
+    CHECK_READ(sp, 0x09c4);
+    CHECK_READ(sp + 1, 0x09c4);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block09c5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09c5 c6 1a
+    { uint8_t v = 0x1a; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x09c7);
+    // 09c7 c3 ff 08
+    cyc += 7;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block09ca(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09ca 3a 67 20
+    CHECK_READ(0x2067, 0x09ca);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x09cd);
+    // 09cd 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x09ce);
+    // 09ce 21 f8 20
+    h = 0x20; l = 0xf8;
+    ACCOUNT(10, 0x09d1);
+    // 09d1 d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x09d1);
+        CHECK_READ(sp + 1, 0x09d1);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x09d2, Block09d2);
+exit:
+    LEAVE
+}
+
+static int Block09d2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09d2 21 fc 20
+    h = 0x20; l = 0xfc;
+    ACCOUNT(10, 0x09d5);
+    // 09d5 c9
+    CHECK_READ(sp, 0x09d5);
+    CHECK_READ(sp + 1, 0x09d5);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block09d6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09d6 21 02 24
+    h = 0x24; l = 0x02;
+    ACCOUNT(10, 0x09d9);
+    CHAIN(0x09d9, Block09d9);
+exit:
+    LEAVE
+}
+
+static int Block09d9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09d9 36 00
+    CHECK_WRITE(HL, 0x09d9);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x09db);
+    // 09db 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x09dc);
+    // 09dc 7d
+    a = l;
+    ACCOUNT(5, 0x09dd);
+    // 09dd e6 1f
+    a &= 0x1f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x09df);
+    // 09df fe 1c
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x1c];
+    ACCOUNT(7, 0x09e1);
+    // 09e1 da e8 09
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x09e8, Block09e8);
+    CHAIN(0x09e4, Block09e4);
+exit:
+    LEAVE
+}
+
+static int Block09e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09e4 11 06 00
+    d = 0x00; e = 0x06;
+    ACCOUNT(10, 0x09e7);
+    // 09e7 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x09e8);
+    CHAIN(0x09e8, Block09e8);
+exit:
+    LEAVE
+}
+
+static int Block09e8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09e8 7c
+    a = h;
+    ACCOUNT(5, 0x09e9);
+    // 09e9 fe 40
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x40];
+    ACCOUNT(7, 0x09eb);
+    // 09eb da d9 09
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x09d9, Block09d9);
+    CHAIN(0x09ee, Block09ee);
+exit:
+    LEAVE
+}
+
+static int Block09ee(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09ee c9
+    CHECK_READ(sp, 0x09ee);
+    CHECK_READ(sp + 1, 0x09ee);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block09ef(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09ef cd 3c 0a
+    CHECK_WRITE(sp - 1, 0x09ef);
+    CHECK_WRITE(sp - 2, 0x09ef);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf2;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a3c, Block0a3c);
+exit:
+    LEAVE
+}
+
+static int Block09f2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09f2 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x09f3);
+    // 09f3 32 e9 20
+    CHECK_WRITE(0x20e9, 0x09f3);
+    mem[0x20e9] = a;
+    WRITTEN(0x20e9);
+    ACCOUNT(13, 0x09f6);
+    // 09f6 cd d6 09
+    CHECK_WRITE(sp - 1, 0x09f6);
+    CHECK_WRITE(sp - 2, 0x09f6);
+    mem[(uint16_t)(sp - 1)] = 0x09;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block09f9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 09f9 3a 67 20
+    CHECK_READ(0x2067, 0x09f9);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x09fc);
+    // 09fc f5
+    CHECK_WRITE(sp - 1, 0x09fc);
+    CHECK_WRITE(sp - 2, 0x09fc);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x09fd);
+    // 09fd cd e4 01
+    CHECK_WRITE(sp - 1, 0x09fd);
+    CHECK_WRITE(sp - 2, 0x09fd);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x00;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01e4, Block01e4);
+exit:
+    LEAVE
+}
+
+static int Block0a00(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a00 f1
+    CHECK_READ(sp, 0x0a00);
+    CHECK_READ(sp + 1, 0x0a00);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x0a01);
+    if (!(f & (1 << 6))) EXIT(0x0a01);
+    // 0a01 32 67 20
+    CHECK_WRITE(0x2067, 0x0a01);
+    mem[0x2067] = a;
+    WRITTEN(0x2067);
+    ACCOUNT(13, 0x0a04);
+    // 0a04 3a 67 20
+    CHECK_READ(0x2067, 0x0a04);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x0a07);
+    // 0a07 67
+    h = a;
+    ACCOUNT(5, 0x0a08);
+    // 0a08 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0a08);
+    CHECK_WRITE(sp - 1, 0x0a08);
+    CHECK_WRITE(sp - 2, 0x0a08);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0a09);
+    // 0a09 2e fe
+    l = 0xfe;
+    ACCOUNT(7, 0x0a0b);
+    // 0a0b 7e
+    CHECK_READ(HL, 0x0a0b);
+    a = mem[HL];
+    ACCOUNT(7, 0x0a0c);
+    // 0a0c e6 07
+    a &= 0x07; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0a0e);
+    // 0a0e 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0a0f);
+    // 0a0f 77
+    CHECK_WRITE(HL, 0x0a0f);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0a10);
+    // 0a10 21 a2 1d
+    h = 0x1d; l = 0xa2;
+    ACCOUNT(10, 0x0a13);
+    CHAIN(0x0a13, Block0a13);
+exit:
+    LEAVE
+}
+
+static int Block0a13(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a13 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0a14);
+    // 0a14 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x0a15);
+    // 0a15 c2 13 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0a13, Block0a13);
+    CHAIN(0x0a18, Block0a18);
+exit:
+    LEAVE
+}
+
+static int Block0a18(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a18 7e
+    CHECK_READ(HL, 0x0a18);
+    a = mem[HL];
+    ACCOUNT(7, 0x0a19);
+    // 0a19 e1
+    CHECK_READ(sp, 0x0a19);
+    CHECK_READ(sp + 1, 0x0a19);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x0a1a);
+    // 0a1a 2e fc
+    l = 0xfc;
+    ACCOUNT(7, 0x0a1c);
+    // 0a1c 77
+    CHECK_WRITE(HL, 0x0a1c);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0a1d);
+    // 0a1d 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0a1e);
+    // 0a1e 36 38
+    CHECK_WRITE(HL, 0x0a1e);
+    mem[HL] = 0x38;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0a20);
+    // 0a20 7c
+    a = h;
+    ACCOUNT(5, 0x0a21);
+    // 0a21 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0a22);
+    // 0a22 da 33 0a
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0a33, Block0a33);
+    CHAIN(0x0a25, Block0a25);
+exit:
+    LEAVE
+}
+
+static int Block0a25(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a25 3e 21
+    a = 0x21;
+    ACCOUNT(7, 0x0a27);
+    // 0a27 32 98 20
+    CHECK_WRITE(0x2098, 0x0a27);
+    mem[0x2098] = a;
+    WRITTEN(0x2098);
+    ACCOUNT(13, 0x0a2a);
+    // 0a2a cd f5 01
+    CHECK_WRITE(sp - 1, 0x0a2a);
+    CHECK_WRITE(sp - 2, 0x0a2a);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x2d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01f5, Block01f5);
+exit:
+    LEAVE
+}
+
+static int Block0a2d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a2d cd 04 19
+    CHECK_WRITE(sp - 1, 0x0a2d);
+    CHECK_WRITE(sp - 2, 0x0a2d);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x30;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1904, Block1904);
+exit:
+    LEAVE
+}
+
+static int Block0a30(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a30 c3 04 08
+    cyc += 7;
+    CHAIN(0x0804, Block0804);
+exit:
+    LEAVE
+}
+
+static int Block0a33(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a33 cd ef 01
+    CHECK_WRITE(sp - 1, 0x0a33);
+    CHECK_WRITE(sp - 2, 0x0a33);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x36;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01ef, Block01ef);
+exit:
+    LEAVE
+}
+
+static int Block0a36(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a36 cd c0 01
+    CHECK_WRITE(sp - 1, 0x0a36);
+    CHECK_WRITE(sp - 2, 0x0a36);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x39;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01c0, Block01c0);
+exit:
+    LEAVE
+}
+
+static int Block0a39(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a39 c3 04 08
+    cyc += 7;
+    CHAIN(0x0804, Block0804);
+exit:
+    LEAVE
+}
+
+static int Block0a3c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a3c cd 59 0a
+    CHECK_WRITE(sp - 1, 0x0a3c);
+    CHECK_WRITE(sp - 2, 0x0a3c);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0a3f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a3f c2 52 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0a52, Block0a52);
+    CHAIN(0x0a42, Block0a42);
+exit:
+    LEAVE
+}
+
+static int Block0a42(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a42 3e 30
+    a = 0x30;
+    ACCOUNT(7, 0x0a44);
+    // 0a44 32 c0 20
+    CHECK_WRITE(0x20c0, 0x0a44);
+    mem[0x20c0] = a;
+    WRITTEN(0x20c0);
+    ACCOUNT(13, 0x0a47);
+    CHAIN(0x0a47, Block0a47);
+exit:
+    LEAVE
+}
+
+static int Block0a47(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a47 3a c0 20
+    CHECK_READ(0x20c0, 0x0a47);
+    a = mem[0x20c0];
+    ACCOUNT(13, 0x0a4a);
+    // 0a4a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0a4b);
+    // 0a4b c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x0a4b);
+        CHECK_READ(sp + 1, 0x0a4b);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x0a4c, Block0a4c);
+exit:
+    LEAVE
+}
+
+static int Block0a4c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a4c cd 59 0a
+    CHECK_WRITE(sp - 1, 0x0a4c);
+    CHECK_WRITE(sp - 2, 0x0a4c);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0a4f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a4f ca 47 0a
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0a47, Block0a47);
+    CHAIN(0x0a52, Block0a52);
+exit:
+    LEAVE
+}
+
+static int Block0a52(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a52 cd 59 0a
+    CHECK_WRITE(sp - 1, 0x0a52);
+    CHECK_WRITE(sp - 2, 0x0a52);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x55;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0a55(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a55 c2 52 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0a52, Block0a52);
+    CHAIN(0x0a58, Block0a58);
+exit:
+    LEAVE
+}
+
+static int Block0a58(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a58 c9
+    CHECK_READ(sp, 0x0a58);
+    CHECK_READ(sp + 1, 0x0a58);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0a59(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a59 3a 15 20
+    CHECK_READ(0x2015, 0x0a59);
+    a = mem[0x2015];
+    ACCOUNT(13, 0x0a5c);
+    // 0a5c fe ff
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xff];
+    ACCOUNT(7, 0x0a5e);
+    // 0a5e c9
+    CHECK_READ(sp, 0x0a5e);
+    CHECK_READ(sp + 1, 0x0a5e);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0a5f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a5f 3a ef 20
+    CHECK_READ(0x20ef, 0x0a5f);
+    a = mem[0x20ef];
+    ACCOUNT(13, 0x0a62);
+    // 0a62 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0a63);
+    // 0a63 ca 7c 0a
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0a7c, Block0a7c);
+    CHAIN(0x0a66, Block0a66);
+exit:
+    LEAVE
+}
+
+static int Block0a66(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a66 48
+    c = b;
+    ACCOUNT(5, 0x0a67);
+    // 0a67 06 08
+    b = 0x08;
+    ACCOUNT(7, 0x0a69);
+    // 0a69 cd fa 18
+    CHECK_WRITE(sp - 1, 0x0a69);
+    CHECK_WRITE(sp - 2, 0x0a69);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x6c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block0a6c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a6c 41
+    b = c;
+    ACCOUNT(5, 0x0a6d);
+    // 0a6d 78
+    a = b;
+    ACCOUNT(5, 0x0a6e);
+    // 0a6e cd 7c 09
+    CHECK_WRITE(sp - 1, 0x0a6e);
+    CHECK_WRITE(sp - 2, 0x0a6e);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x71;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x097c, Block097c);
+exit:
+    LEAVE
+}
+
+static int Block0a71(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a71 7e
+    CHECK_READ(HL, 0x0a71);
+    a = mem[HL];
+    ACCOUNT(7, 0x0a72);
+    // 0a72 21 f3 20
+    h = 0x20; l = 0xf3;
+    ACCOUNT(10, 0x0a75);
+    // 0a75 36 00
+    CHECK_WRITE(HL, 0x0a75);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0a77);
+    // 0a77 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0a78);
+    // 0a78 77
+    CHECK_WRITE(HL, 0x0a78);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0a79);
+    // 0a79 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x0a7a);
+    // 0a7a 36 01
+    CHECK_WRITE(HL, 0x0a7a);
+    mem[HL] = 0x01;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0a7c);
+    CHAIN(0x0a7c, Block0a7c);
+exit:
+    LEAVE
+}
+
+static int Block0a7c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a7c 21 62 20
+    h = 0x20; l = 0x62;
+    ACCOUNT(10, 0x0a7f);
+    // 0a7f c9
+    CHECK_READ(sp, 0x0a7f);
+    CHECK_READ(sp + 1, 0x0a7f);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0a80(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a80 3e 02
+    a = 0x02;
+    ACCOUNT(7, 0x0a82);
+    // 0a82 32 c1 20
+    CHECK_WRITE(0x20c1, 0x0a82);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x0a85);
+    EXIT(0x0a85);
+exit:
+    LEAVE
+}
+
+static int Block0a87(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a87 3a cb 20
+    CHECK_READ(0x20cb, 0x0a87);
+    a = mem[0x20cb];
+    ACCOUNT(13, 0x0a8a);
+    // 0a8a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0a8b);
+    // 0a8b ca 85 0a
+    cyc += 10;
+    if ((f & FlagZero)) EXIT(0x0a85);
+    CHAIN(0x0a8e, Block0a8e);
+exit:
+    LEAVE
+}
+
+static int Block0a8e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a8e af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0a8f);
+    // 0a8f 32 c1 20
+    CHECK_WRITE(0x20c1, 0x0a8f);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x0a92);
+    // 0a92 c9
+    CHECK_READ(sp, 0x0a92);
+    CHECK_READ(sp + 1, 0x0a92);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0a93(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a93 d5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x0a93);
+    CHECK_WRITE(sp - 1, 0x0a93);
+    CHECK_WRITE(sp - 2, 0x0a93);
+    mem[(uint16_t)(sp - 1)] = d;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x0a94);
+    // 0a94 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x0a94);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x0a95);
+    // 0a95 cd ff 08
+    CHECK_WRITE(sp - 1, 0x0a95);
+    CHECK_WRITE(sp - 2, 0x0a95);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x98;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block0a98(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a98 d1
+    CHECK_READ(sp, 0x0a98);
+    CHECK_READ(sp + 1, 0x0a98);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    d = high; e = low; }
+    ACCOUNT(10, 0x0a99);
+    // 0a99 3e 07
+    a = 0x07;
+    ACCOUNT(7, 0x0a9b);
+    // 0a9b 32 c0 20
+    CHECK_WRITE(0x20c0, 0x0a9b);
+    mem[0x20c0] = a;
+    WRITTEN(0x20c0);
+    ACCOUNT(13, 0x0a9e);
+    CHAIN(0x0a9e, Block0a9e);
+exit:
+    LEAVE
+}
+
+static int Block0a9e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0a9e 3a c0 20
+    CHECK_READ(0x20c0, 0x0a9e);
+    a = mem[0x20c0];
+    ACCOUNT(13, 0x0aa1);
+    // 0aa1 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x0aa2);
+    // 0aa2 c2 9e 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0a9e, Block0a9e);
+    CHAIN(0x0aa5, Block0aa5);
+exit:
+    LEAVE
+}
+
+static int Block0aa5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aa5 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x0aa6);
+    // 0aa6 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x0aa7);
+    // 0aa7 c2 93 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0a93, Block0a93);
+    CHAIN(0x0aaa, Block0aaa);
+exit:
+    LEAVE
+}
+
+static int Block0aaa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aaa c9
+    CHECK_READ(sp, 0x0aaa);
+    CHECK_READ(sp + 1, 0x0aaa);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0aab(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aab 21 50 20
+    h = 0x20; l = 0x50;
+    ACCOUNT(10, 0x0aae);
+    // 0aae c3 4b 02
+    cyc += 7;
+    CHAIN(0x024b, Block024b);
+exit:
+    LEAVE
+}
+
+static int Block0ab1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ab1 3e 40
+    a = 0x40;
+    ACCOUNT(7, 0x0ab3);
+    // 0ab3 c3 d7 0a
+    cyc += 7;
+    CHAIN(0x0ad7, Block0ad7);
+exit:
+    LEAVE
+}
+
+static int Block0ab6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ab6 3e 80
+    a = 0x80;
+    ACCOUNT(7, 0x0ab8);
+    // 0ab8 c3 d7 0a
+    cyc += 7;
+    CHAIN(0x0ad7, Block0ad7);
+exit:
+    LEAVE
+}
+
+static int Block0abb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0abb e1
+    CHECK_READ(sp, 0x0abb);
+    CHECK_READ(sp + 1, 0x0abb);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x0abc);
+    // 0abc c3 72 00
+    cyc += 7;
+    CHAIN(0x0072, Block0072);
+exit:
+    LEAVE
+}
+
+static int Block0abf(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0abf 3a c1 20
+    CHECK_READ(0x20c1, 0x0abf);
+    a = mem[0x20c1];
+    ACCOUNT(13, 0x0ac2);
+    // 0ac2 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0ac3);
+    // 0ac3 da bb 0a
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0abb, Block0abb);
+    CHAIN(0x0ac6, Block0ac6);
+exit:
+    LEAVE
+}
+
+static int Block0ac6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ac6 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0ac7);
+    // 0ac7 da 68 18
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x1868, Block1868);
+    CHAIN(0x0aca, Block0aca);
+exit:
+    LEAVE
+}
+
+static int Block0aca(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aca 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0acb);
+    // 0acb da ab 0a
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0aab, Block0aab);
+    CHAIN(0x0ace, Block0ace);
+exit:
+    LEAVE
+}
+
+static int Block0ace(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ace c9
+    CHECK_READ(sp, 0x0ace);
+    CHECK_READ(sp + 1, 0x0ace);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0acf(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0acf 21 14 2b
+    h = 0x2b; l = 0x14;
+    ACCOUNT(10, 0x0ad2);
+    // 0ad2 0e 0f
+    c = 0x0f;
+    ACCOUNT(7, 0x0ad4);
+    // 0ad4 c3 93 0a
+    cyc += 7;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block0ad7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ad7 32 c0 20
+    CHECK_WRITE(0x20c0, 0x0ad7);
+    mem[0x20c0] = a;
+    WRITTEN(0x20c0);
+    ACCOUNT(13, 0x0ada);
+    CHAIN(0x0ada, Block0ada);
+exit:
+    LEAVE
+}
+
+static int Block0ada(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ada 3a c0 20
+    CHECK_READ(0x20c0, 0x0ada);
+    a = mem[0x20c0];
+    ACCOUNT(13, 0x0add);
+    // 0add a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0ade);
+    // 0ade c2 da 0a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0ada, Block0ada);
+    CHAIN(0x0ae1, Block0ae1);
+exit:
+    LEAVE
+}
+
+static int Block0ae1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ae1 c9
+    CHECK_READ(sp, 0x0ae1);
+    CHECK_READ(sp + 1, 0x0ae1);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block0ae2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ae2 21 c2 20
+    h = 0x20; l = 0xc2;
+    ACCOUNT(10, 0x0ae5);
+    // 0ae5 06 0c
+    b = 0x0c;
+    ACCOUNT(7, 0x0ae7);
+    // 0ae7 c3 32 1a
+    cyc += 7;
+    CHAIN(0x1a32, Block1a32);
+exit:
+    LEAVE
+}
+
+static int Block0aea(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aea af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0aeb);
+    EXIT(0x0aeb);
+exit:
+    LEAVE
+}
+
+static int Block0aef(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0aef cd 82 19
+    CHECK_WRITE(sp - 1, 0x0aef);
+    CHECK_WRITE(sp - 2, 0x0aef);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf2;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1982, Block1982);
+exit:
+    LEAVE
+}
+
+static int Block0af2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0af2 fb
+    f |= (1 << 5);
+    ACCOUNT(4, 0x0af3);
+    // 0af3 cd b1 0a
+    CHECK_WRITE(sp - 1, 0x0af3);
+    CHECK_WRITE(sp - 2, 0x0af3);
+    mem[(uint16_t)(sp - 1)] = 0x0a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block0af6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0af6 3a ec 20
+    CHECK_READ(0x20ec, 0x0af6);
+    a = mem[0x20ec];
+    ACCOUNT(13, 0x0af9);
+    // 0af9 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0afa);
+    // 0afa 21 17 30
+    h = 0x30; l = 0x17;
+    ACCOUNT(10, 0x0afd);
+    // 0afd 0e 04
+    c = 0x04;
+    ACCOUNT(7, 0x0aff);
+    // 0aff c2 e8 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0be8, Block0be8);
+    CHAIN(0x0b02, Block0b02);
+exit:
+    LEAVE
+}
+
+static int Block0b02(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b02 11 fa 1c
+    d = 0x1c; e = 0xfa;
+    ACCOUNT(10, 0x0b05);
+    // 0b05 cd 93 0a
+    CHECK_WRITE(sp - 1, 0x0b05);
+    CHECK_WRITE(sp - 2, 0x0b05);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x08;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block0b08(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b08 11 af 1d
+    d = 0x1d; e = 0xaf;
+    ACCOUNT(10, 0x0b0b);
+    CHAIN(0x0b0b, Block0b0b);
+exit:
+    LEAVE
+}
+
+static int Block0b0b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b0b cd cf 0a
+    CHECK_WRITE(sp - 1, 0x0b0b);
+    CHECK_WRITE(sp - 2, 0x0b0b);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x0e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0acf, Block0acf);
+exit:
+    LEAVE
+}
+
+static int Block0b0e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b0e cd b1 0a
+    CHECK_WRITE(sp - 1, 0x0b0e);
+    CHECK_WRITE(sp - 2, 0x0b0e);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x11;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block0b11(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b11 cd 15 18
+    CHECK_WRITE(sp - 1, 0x0b11);
+    CHECK_WRITE(sp - 2, 0x0b11);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x14;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1815, Block1815);
+exit:
+    LEAVE
+}
+
+static int Block0b14(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b14 cd b6 0a
+    CHECK_WRITE(sp - 1, 0x0b14);
+    CHECK_WRITE(sp - 2, 0x0b14);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x17;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block0b17(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b17 3a ec 20
+    CHECK_READ(0x20ec, 0x0b17);
+    a = mem[0x20ec];
+    ACCOUNT(13, 0x0b1a);
+    // 0b1a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0b1b);
+    // 0b1b c2 4a 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0b4a, Block0b4a);
+    CHAIN(0x0b1e, Block0b1e);
+exit:
+    LEAVE
+}
+
+static int Block0b1e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b1e 11 95 1a
+    d = 0x1a; e = 0x95;
+    ACCOUNT(10, 0x0b21);
+    // 0b21 cd e2 0a
+    CHECK_WRITE(sp - 1, 0x0b21);
+    CHECK_WRITE(sp - 2, 0x0b21);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x24;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ae2, Block0ae2);
+exit:
+    LEAVE
+}
+
+static int Block0b24(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b24 cd 80 0a
+    CHECK_WRITE(sp - 1, 0x0b24);
+    CHECK_WRITE(sp - 2, 0x0b24);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x27;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a80, Block0a80);
+exit:
+    LEAVE
+}
+
+static int Block0b27(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b27 11 b0 1b
+    d = 0x1b; e = 0xb0;
+    ACCOUNT(10, 0x0b2a);
+    // 0b2a cd e2 0a
+    CHECK_WRITE(sp - 1, 0x0b2a);
+    CHECK_WRITE(sp - 2, 0x0b2a);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x2d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ae2, Block0ae2);
+exit:
+    LEAVE
+}
+
+static int Block0b2d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b2d cd 80 0a
+    CHECK_WRITE(sp - 1, 0x0b2d);
+    CHECK_WRITE(sp - 2, 0x0b2d);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x30;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a80, Block0a80);
+exit:
+    LEAVE
+}
+
+static int Block0b30(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b30 cd b1 0a
+    CHECK_WRITE(sp - 1, 0x0b30);
+    CHECK_WRITE(sp - 2, 0x0b30);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x33;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block0b33(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b33 11 c9 1f
+    d = 0x1f; e = 0xc9;
+    ACCOUNT(10, 0x0b36);
+    // 0b36 cd e2 0a
+    CHECK_WRITE(sp - 1, 0x0b36);
+    CHECK_WRITE(sp - 2, 0x0b36);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x39;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ae2, Block0ae2);
+exit:
+    LEAVE
+}
+
+static int Block0b39(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b39 cd 80 0a
+    CHECK_WRITE(sp - 1, 0x0b39);
+    CHECK_WRITE(sp - 2, 0x0b39);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a80, Block0a80);
+exit:
+    LEAVE
+}
+
+static int Block0b3c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b3c cd b1 0a
+    CHECK_WRITE(sp - 1, 0x0b3c);
+    CHECK_WRITE(sp - 2, 0x0b3c);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block0b3f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b3f 21 b7 33
+    h = 0x33; l = 0xb7;
+    ACCOUNT(10, 0x0b42);
+    // 0b42 06 0a
+    b = 0x0a;
+    ACCOUNT(7, 0x0b44);
+    // 0b44 cd cb 14
+    CHECK_WRITE(sp - 1, 0x0b44);
+    CHECK_WRITE(sp - 2, 0x0b44);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x47;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x14cb, Block14cb);
+exit:
+    LEAVE
+}
+
+static int Block0b47(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b47 cd b6 0a
+    CHECK_WRITE(sp - 1, 0x0b47);
+    CHECK_WRITE(sp - 2, 0x0b47);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block0b4a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b4a cd d6 09
+    CHECK_WRITE(sp - 1, 0x0b4a);
+    CHECK_WRITE(sp - 2, 0x0b4a);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block0b4d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b4d 3a ff 21
+    CHECK_READ(0x21ff, 0x0b4d);
+    a = mem[0x21ff];
+    ACCOUNT(13, 0x0b50);
+    // 0b50 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0b51);
+    // 0b51 c2 5d 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0b5d, Block0b5d);
+    CHAIN(0x0b54, Block0b54);
+exit:
+    LEAVE
+}
+
+static int Block0b54(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b54 cd d1 08
+    CHECK_WRITE(sp - 1, 0x0b54);
+    CHECK_WRITE(sp - 2, 0x0b54);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x57;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    EXIT(0x08d1);
+exit:
+    LEAVE
+}
+
+static int Block0b57(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b57 32 ff 21
+    CHECK_WRITE(0x21ff, 0x0b57);
+    mem[0x21ff] = a;
+    WRITTEN(0x21ff);
+    ACCOUNT(13, 0x0b5a);
+    // 0b5a cd 7f 1a
+    CHECK_WRITE(sp - 1, 0x0b5a);
+    CHECK_WRITE(sp - 2, 0x0b5a);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x5d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a7f, Block1a7f);
+exit:
+    LEAVE
+}
+
+static int Block0b5d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b5d cd e4 01
+    CHECK_WRITE(sp - 1, 0x0b5d);
+    CHECK_WRITE(sp - 2, 0x0b5d);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x60;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01e4, Block01e4);
+exit:
+    LEAVE
+}
+
+static int Block0b60(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b60 cd c0 01
+    CHECK_WRITE(sp - 1, 0x0b60);
+    CHECK_WRITE(sp - 2, 0x0b60);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x63;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01c0, Block01c0);
+exit:
+    LEAVE
+}
+
+static int Block0b63(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b63 cd ef 01
+    CHECK_WRITE(sp - 1, 0x0b63);
+    CHECK_WRITE(sp - 2, 0x0b63);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x66;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01ef, Block01ef);
+exit:
+    LEAVE
+}
+
+static int Block0b66(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b66 cd 1a 02
+    CHECK_WRITE(sp - 1, 0x0b66);
+    CHECK_WRITE(sp - 2, 0x0b66);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x69;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x021a, Block021a);
+exit:
+    LEAVE
+}
+
+static int Block0b69(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b69 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x0b6b);
+    // 0b6b 32 c1 20
+    CHECK_WRITE(0x20c1, 0x0b6b);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x0b6e);
+    // 0b6e cd cf 01
+    CHECK_WRITE(sp - 1, 0x0b6e);
+    CHECK_WRITE(sp - 2, 0x0b6e);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x71;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01cf, Block01cf);
+exit:
+    LEAVE
+}
+
+static int Block0b71(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b71 cd 18 16
+    CHECK_WRITE(sp - 1, 0x0b71);
+    CHECK_WRITE(sp - 2, 0x0b71);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x74;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1618, Block1618);
+exit:
+    LEAVE
+}
+
+static int Block0b74(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b74 cd f1 0b
+    CHECK_WRITE(sp - 1, 0x0b74);
+    CHECK_WRITE(sp - 2, 0x0b74);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x77;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0bf1, Block0bf1);
+exit:
+    LEAVE
+}
+
+static int Block0b79(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b79 cd 59 0a
+    CHECK_WRITE(sp - 1, 0x0b79);
+    CHECK_WRITE(sp - 2, 0x0b79);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0b7c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b7c ca 71 0b
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0b71, Block0b71);
+    CHAIN(0x0b7f, Block0b7f);
+exit:
+    LEAVE
+}
+
+static int Block0b7f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b7f af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0b80);
+    // 0b80 32 25 20
+    CHECK_WRITE(0x2025, 0x0b80);
+    mem[0x2025] = a;
+    WRITTEN(0x2025);
+    ACCOUNT(13, 0x0b83);
+    CHAIN(0x0b83, Block0b83);
+exit:
+    LEAVE
+}
+
+static int Block0b83(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b83 cd 59 0a
+    CHECK_WRITE(sp - 1, 0x0b83);
+    CHECK_WRITE(sp - 2, 0x0b83);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x86;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block0b86(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b86 c2 83 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0b83, Block0b83);
+    CHAIN(0x0b89, Block0b89);
+exit:
+    LEAVE
+}
+
+static int Block0b89(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b89 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0b8a);
+    // 0b8a 32 c1 20
+    CHECK_WRITE(0x20c1, 0x0b8a);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x0b8d);
+    // 0b8d cd b1 0a
+    CHECK_WRITE(sp - 1, 0x0b8d);
+    CHECK_WRITE(sp - 2, 0x0b8d);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x90;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block0b90(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b90 cd 88 19
+    CHECK_WRITE(sp - 1, 0x0b90);
+    CHECK_WRITE(sp - 2, 0x0b90);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x93;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1988, Block1988);
+exit:
+    LEAVE
+}
+
+static int Block0b93(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b93 0e 0c
+    c = 0x0c;
+    ACCOUNT(7, 0x0b95);
+    // 0b95 21 11 2c
+    h = 0x2c; l = 0x11;
+    ACCOUNT(10, 0x0b98);
+    // 0b98 11 90 1f
+    d = 0x1f; e = 0x90;
+    ACCOUNT(10, 0x0b9b);
+    // 0b9b cd f3 08
+    CHECK_WRITE(sp - 1, 0x0b9b);
+    CHECK_WRITE(sp - 2, 0x0b9b);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x9e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block0b9e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0b9e 3a ec 20
+    CHECK_READ(0x20ec, 0x0b9e);
+    a = mem[0x20ec];
+    ACCOUNT(13, 0x0ba1);
+    // 0ba1 fe 00
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x00];
+    ACCOUNT(7, 0x0ba3);
+    // 0ba3 c2 ae 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0bae, Block0bae);
+    CHAIN(0x0ba6, Block0ba6);
+exit:
+    LEAVE
+}
+
+static int Block0ba6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0ba6 21 11 33
+    h = 0x33; l = 0x11;
+    ACCOUNT(10, 0x0ba9);
+    // 0ba9 3e 02
+    a = 0x02;
+    ACCOUNT(7, 0x0bab);
+    // 0bab cd ff 08
+    CHECK_WRITE(sp - 1, 0x0bab);
+    CHECK_WRITE(sp - 2, 0x0bab);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xae;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block0bae(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bae 01 9c 1f
+    b = 0x1f; c = 0x9c;
+    ACCOUNT(10, 0x0bb1);
+    // 0bb1 cd 56 18
+    CHECK_WRITE(sp - 1, 0x0bb1);
+    CHECK_WRITE(sp - 2, 0x0bb1);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1856, Block1856);
+exit:
+    LEAVE
+}
+
+static int Block0bb4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bb4 cd 4c 18
+    CHECK_WRITE(sp - 1, 0x0bb4);
+    CHECK_WRITE(sp - 2, 0x0bb4);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xb7;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x184c, Block184c);
+exit:
+    LEAVE
+}
+
+static int Block0bb9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bb9 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0bba);
+    // 0bba da c3 0b
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x0bc3, Block0bc3);
+    CHAIN(0x0bbd, Block0bbd);
+exit:
+    LEAVE
+}
+
+static int Block0bbd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bbd 01 a0 1f
+    b = 0x1f; c = 0xa0;
+    ACCOUNT(10, 0x0bc0);
+    // 0bc0 cd 3a 18
+    CHECK_WRITE(sp - 1, 0x0bc0);
+    CHECK_WRITE(sp - 2, 0x0bc0);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xc3;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x183a, Block183a);
+exit:
+    LEAVE
+}
+
+static int Block0bc3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bc3 cd b6 0a
+    CHECK_WRITE(sp - 1, 0x0bc3);
+    CHECK_WRITE(sp - 2, 0x0bc3);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xc6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block0bc6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bc6 3a ec 20
+    CHECK_READ(0x20ec, 0x0bc6);
+    a = mem[0x20ec];
+    ACCOUNT(13, 0x0bc9);
+    // 0bc9 fe 00
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x00];
+    ACCOUNT(7, 0x0bcb);
+    // 0bcb c2 da 0b
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x0bda, Block0bda);
+    CHAIN(0x0bce, Block0bce);
+exit:
+    LEAVE
+}
+
+static int Block0bce(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bce 11 d5 1f
+    d = 0x1f; e = 0xd5;
+    ACCOUNT(10, 0x0bd1);
+    // 0bd1 cd e2 0a
+    CHECK_WRITE(sp - 1, 0x0bd1);
+    CHECK_WRITE(sp - 2, 0x0bd1);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ae2, Block0ae2);
+exit:
+    LEAVE
+}
+
+static int Block0bd4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bd4 cd 80 0a
+    CHECK_WRITE(sp - 1, 0x0bd4);
+    CHECK_WRITE(sp - 2, 0x0bd4);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd7;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a80, Block0a80);
+exit:
+    LEAVE
+}
+
+static int Block0bd7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bd7 cd 9e 18
+    CHECK_WRITE(sp - 1, 0x0bd7);
+    CHECK_WRITE(sp - 2, 0x0bd7);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xda;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x189e, Block189e);
+exit:
+    LEAVE
+}
+
+static int Block0bda(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bda 21 ec 20
+    h = 0x20; l = 0xec;
+    ACCOUNT(10, 0x0bdd);
+    // 0bdd 7e
+    CHECK_READ(HL, 0x0bdd);
+    a = mem[HL];
+    ACCOUNT(7, 0x0bde);
+    // 0bde 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0bdf);
+    // 0bdf e6 01
+    a &= 0x01; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0be1);
+    // 0be1 77
+    CHECK_WRITE(HL, 0x0be1);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x0be2);
+    // 0be2 cd d6 09
+    CHECK_WRITE(sp - 1, 0x0be2);
+    CHECK_WRITE(sp - 2, 0x0be2);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xe5;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block0be5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0be5 c3 df 18
+    cyc += 7;
+    CHAIN(0x18df, Block18df);
+exit:
+    LEAVE
+}
+
+static int Block0be8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0be8 11 ab 1d
+    d = 0x1d; e = 0xab;
+    ACCOUNT(10, 0x0beb);
+    // 0beb cd 93 0a
+    CHECK_WRITE(sp - 1, 0x0beb);
+    CHECK_WRITE(sp - 2, 0x0beb);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xee;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block0bee(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bee c3 0b 0b
+    cyc += 7;
+    CHAIN(0x0b0b, Block0b0b);
+exit:
+    LEAVE
+}
+
+static int Block0bf1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bf1 cd 0a 19
+    CHECK_WRITE(sp - 1, 0x0bf1);
+    CHECK_WRITE(sp - 2, 0x0bf1);
+    mem[(uint16_t)(sp - 1)] = 0x0b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x190a, Block190a);
+exit:
+    LEAVE
+}
+
+static int Block0bf4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0bf4 c3 9a 19
+    cyc += 7;
+    CHAIN(0x199a, Block199a);
+exit:
+    LEAVE
+}
+
+static int Block1424(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1424 cd 74 14
+    CHECK_WRITE(sp - 1, 0x1424);
+    CHECK_WRITE(sp - 2, 0x1424);
+    mem[(uint16_t)(sp - 1)] = 0x14;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x27;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1474, Block1474);
+exit:
+    LEAVE
+}
+
+static int Block1427(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1427 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1427);
+    CHECK_WRITE(sp - 1, 0x1427);
+    CHECK_WRITE(sp - 2, 0x1427);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1428);
+    // 1428 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1428);
+    CHECK_WRITE(sp - 1, 0x1428);
+    CHECK_WRITE(sp - 2, 0x1428);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1429);
+    // 1429 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x142a);
+    // 142a 77
+    CHECK_WRITE(HL, 0x142a);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x142b);
+    // 142b 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x142c);
+    // 142c 77
+    CHECK_WRITE(HL, 0x142c);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x142d);
+    // 142d 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x142e);
+    // 142e e1
+    CHECK_READ(sp, 0x142e);
+    CHECK_READ(sp + 1, 0x142e);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x142f);
+    // 142f 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x1432);
+    // 1432 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x1433);
+    // 1433 c1
+    CHECK_READ(sp, 0x1433);
+    CHECK_READ(sp + 1, 0x1433);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x1434);
+    // 1434 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1435);
+    // 1435 c2 27 14
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1427, Block1427);
+    CHAIN(0x1438, Block1438);
+exit:
+    LEAVE
+}
+
+static int Block1438(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1438 c9
+    CHECK_READ(sp, 0x1438);
+    CHECK_READ(sp + 1, 0x1438);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1439(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1439 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1439);
+    CHECK_WRITE(sp - 1, 0x1439);
+    CHECK_WRITE(sp - 2, 0x1439);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x143a);
+    // 143a 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x143a);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x143b);
+    // 143b 77
+    CHECK_WRITE(HL, 0x143b);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x143c);
+    // 143c 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x143d);
+    // 143d 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x1440);
+    // 1440 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x1441);
+    // 1441 c1
+    CHECK_READ(sp, 0x1441);
+    CHECK_READ(sp + 1, 0x1441);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x1442);
+    // 1442 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1443);
+    // 1443 c2 39 14
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1439, Block1439);
+    CHAIN(0x1446, Block1446);
+exit:
+    LEAVE
+}
+
+static int Block1446(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1446 c9
+    CHECK_READ(sp, 0x1446);
+    CHECK_READ(sp + 1, 0x1446);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1474(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1474 7d
+    a = l;
+    ACCOUNT(5, 0x1475);
+    // 1475 e6 07
+    a &= 0x07; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1477);
+    EXIT(0x1477);
+exit:
+    LEAVE
+}
+
+static int Block1479(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1479 c3 47 1a
+    cyc += 7;
+    CHAIN(0x1a47, Block1a47);
+exit:
+    LEAVE
+}
+
+static int Block147c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 147c c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x147c);
+    CHECK_WRITE(sp - 1, 0x147c);
+    CHECK_WRITE(sp - 2, 0x147c);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x147d);
+    // 147d e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x147d);
+    CHECK_WRITE(sp - 1, 0x147d);
+    CHECK_WRITE(sp - 2, 0x147d);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x147e);
+    CHAIN(0x147e, Block147e);
+exit:
+    LEAVE
+}
+
+static int Block147e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 147e 7e
+    CHECK_READ(HL, 0x147e);
+    a = mem[HL];
+    ACCOUNT(7, 0x147f);
+    // 147f 12
+    CHECK_WRITE((uint16_t)((d << 8) | e), 0x147f);
+    mem[(uint16_t)((d << 8) | e)] = a;
+    WRITTEN((uint16_t)((d << 8) | e));
+    ACCOUNT(7, 0x1480);
+    // 1480 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1481);
+    // 1481 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1482);
+    // 1482 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x1483);
+    // 1483 c2 7e 14
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x147e, Block147e);
+    CHAIN(0x1486, Block1486);
+exit:
+    LEAVE
+}
+
+static int Block1486(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1486 e1
+    CHECK_READ(sp, 0x1486);
+    CHECK_READ(sp + 1, 0x1486);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x1487);
+    // 1487 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x148a);
+    // 148a 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x148b);
+    // 148b c1
+    CHECK_READ(sp, 0x148b);
+    CHECK_READ(sp + 1, 0x148b);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x148c);
+    // 148c 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x148d);
+    // 148d c2 7c 14
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x147c, Block147c);
+    CHAIN(0x1490, Block1490);
+exit:
+    LEAVE
+}
+
+static int Block1490(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1490 c9
+    CHECK_READ(sp, 0x1490);
+    CHECK_READ(sp + 1, 0x1490);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block14cb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14cb af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x14cc);
+    CHAIN(0x14cc, Block14cc);
+exit:
+    LEAVE
+}
+
+static int Block14cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14cc c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x14cc);
+    CHECK_WRITE(sp - 1, 0x14cc);
+    CHECK_WRITE(sp - 2, 0x14cc);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x14cd);
+    // 14cd 77
+    CHECK_WRITE(HL, 0x14cd);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x14ce);
+    // 14ce 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x14d1);
+    // 14d1 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x14d2);
+    // 14d2 c1
+    CHECK_READ(sp, 0x14d2);
+    CHECK_READ(sp + 1, 0x14d2);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x14d3);
+    // 14d3 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x14d4);
+    // 14d4 c2 cc 14
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x14cc, Block14cc);
+    CHAIN(0x14d7, Block14d7);
+exit:
+    LEAVE
+}
+
+static int Block14d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14d7 c9
+    CHECK_READ(sp, 0x14d7);
+    CHECK_READ(sp + 1, 0x14d7);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block14d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14d8 3a 25 20
+    CHECK_READ(0x2025, 0x14d8);
+    a = mem[0x2025];
+    ACCOUNT(13, 0x14db);
+    // 14db fe 05
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x05];
+    ACCOUNT(7, 0x14dd);
+    // 14dd c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x14dd);
+        CHECK_READ(sp + 1, 0x14dd);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x14de, Block14de);
+exit:
+    LEAVE
+}
+
+static int Block14de(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14de fe 02
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x02];
+    ACCOUNT(7, 0x14e0);
+    // 14e0 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x14e0);
+        CHECK_READ(sp + 1, 0x14e0);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x14e1, Block14e1);
+exit:
+    LEAVE
+}
+
+static int Block14e1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14e1 3a 29 20
+    CHECK_READ(0x2029, 0x14e1);
+    a = mem[0x2029];
+    ACCOUNT(13, 0x14e4);
+    // 14e4 fe d8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xd8];
+    ACCOUNT(7, 0x14e6);
+    // 14e6 47
+    b = a;
+    ACCOUNT(5, 0x14e7);
+    // 14e7 d2 30 15
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1530, Block1530);
+    CHAIN(0x14ea, Block14ea);
+exit:
+    LEAVE
+}
+
+static int Block14ea(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14ea 3a 02 20
+    CHECK_READ(0x2002, 0x14ea);
+    a = mem[0x2002];
+    ACCOUNT(13, 0x14ed);
+    // 14ed a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x14ee);
+    // 14ee c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x14ee);
+        CHECK_READ(sp + 1, 0x14ee);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x14ef, Block14ef);
+exit:
+    LEAVE
+}
+
+static int Block14ef(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14ef 78
+    a = b;
+    ACCOUNT(5, 0x14f0);
+    // 14f0 fe ce
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xce];
+    ACCOUNT(7, 0x14f2);
+    // 14f2 d2 79 15
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1579, Block1579);
+    CHAIN(0x14f5, Block14f5);
+exit:
+    LEAVE
+}
+
+static int Block14f5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 14f5 c6 06
+    { uint8_t v = 0x06; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x14f7);
+    // 14f7 47
+    b = a;
+    ACCOUNT(5, 0x14f8);
+    // 14f8 3a 09 20
+    CHECK_READ(0x2009, 0x14f8);
+    a = mem[0x2009];
+    ACCOUNT(13, 0x14fb);
+    // 14fb fe 90
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x90];
+    ACCOUNT(7, 0x14fd);
+    // 14fd d2 04 15
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1504, Block1504);
+    CHAIN(0x1500, Block1500);
+exit:
+    LEAVE
+}
+
+static int Block1500(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1500 b8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][b];
+    ACCOUNT(4, 0x1501);
+    // 1501 d2 30 15
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1530, Block1530);
+    CHAIN(0x1504, Block1504);
+exit:
+    LEAVE
+}
+
+static int Block1504(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1504 68
+    l = b;
+    ACCOUNT(5, 0x1505);
+    // 1505 cd 62 15
+    CHECK_WRITE(sp - 1, 0x1505);
+    CHECK_WRITE(sp - 2, 0x1505);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x08;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1562, Block1562);
+exit:
+    LEAVE
+}
+
+static int Block1508(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1508 3a 2a 20
+    CHECK_READ(0x202a, 0x1508);
+    a = mem[0x202a];
+    ACCOUNT(13, 0x150b);
+    // 150b 67
+    h = a;
+    ACCOUNT(5, 0x150c);
+    // 150c cd 6f 15
+    CHECK_WRITE(sp - 1, 0x150c);
+    CHECK_WRITE(sp - 2, 0x150c);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x0f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x156f, Block156f);
+exit:
+    LEAVE
+}
+
+static int Block150f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 150f 22 64 20
+    CHECK_WRITE(0x2064, 0x150f);
+    CHECK_WRITE(0x2065, 0x150f);
+    mem[0x2064] = l; mem[0x2065] = h;
+    WRITTEN(0x2064);
+    WRITTEN(0x2065);
+    ACCOUNT(16, 0x1512);
+    // 1512 3e 05
+    a = 0x05;
+    ACCOUNT(7, 0x1514);
+    // 1514 32 25 20
+    CHECK_WRITE(0x2025, 0x1514);
+    mem[0x2025] = a;
+    WRITTEN(0x2025);
+    ACCOUNT(13, 0x1517);
+    // 1517 cd 81 15
+    CHECK_WRITE(sp - 1, 0x1517);
+    CHECK_WRITE(sp - 2, 0x1517);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x1a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1581, Block1581);
+exit:
+    LEAVE
+}
+
+static int Block151a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 151a 7e
+    CHECK_READ(HL, 0x151a);
+    a = mem[HL];
+    ACCOUNT(7, 0x151b);
+    // 151b a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x151c);
+    // 151c ca 30 15
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x1530, Block1530);
+    CHAIN(0x151f, Block151f);
+exit:
+    LEAVE
+}
+
+static int Block151f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 151f 36 00
+    CHECK_WRITE(HL, 0x151f);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1521);
+    // 1521 cd 5f 0a
+    CHECK_WRITE(sp - 1, 0x1521);
+    CHECK_WRITE(sp - 2, 0x1521);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x24;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a5f, Block0a5f);
+exit:
+    LEAVE
+}
+
+static int Block1524(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1524 cd 3b 1a
+    CHECK_WRITE(sp - 1, 0x1524);
+    CHECK_WRITE(sp - 2, 0x1524);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x27;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a3b, Block1a3b);
+exit:
+    LEAVE
+}
+
+static int Block1527(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1527 cd d3 15
+    CHECK_WRITE(sp - 1, 0x1527);
+    CHECK_WRITE(sp - 2, 0x1527);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x2a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x15d3, Block15d3);
+exit:
+    LEAVE
+}
+
+static int Block152a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 152a 3e 10
+    a = 0x10;
+    ACCOUNT(7, 0x152c);
+    // 152c 32 03 20
+    CHECK_WRITE(0x2003, 0x152c);
+    mem[0x2003] = a;
+    WRITTEN(0x2003);
+    ACCOUNT(13, 0x152f);
+    // 152f c9
+    CHECK_READ(sp, 0x152f);
+    CHECK_READ(sp + 1, 0x152f);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1530(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1530 3e 03
+    a = 0x03;
+    ACCOUNT(7, 0x1532);
+    // 1532 32 25 20
+    CHECK_WRITE(0x2025, 0x1532);
+    mem[0x2025] = a;
+    WRITTEN(0x2025);
+    ACCOUNT(13, 0x1535);
+    // 1535 c3 4a 15
+    cyc += 7;
+    CHAIN(0x154a, Block154a);
+exit:
+    LEAVE
+}
+
+static int Block1538(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1538 21 03 20
+    h = 0x20; l = 0x03;
+    ACCOUNT(10, 0x153b);
+    // 153b 35
+    CHECK_READ(HL, 0x153b);
+    CHECK_WRITE(HL, 0x153b);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x153c);
+    // 153c c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x153c);
+        CHECK_READ(sp + 1, 0x153c);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x153d, Block153d);
+exit:
+    LEAVE
+}
+
+static int Block153d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 153d 2a 64 20
+    CHECK_READ(0x2064, 0x153d);
+    CHECK_READ(0x2065, 0x153d);
+    l = mem[0x2064]; h = mem[0x2065];
+    ACCOUNT(16, 0x1540);
+    // 1540 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x1542);
+    // 1542 cd 24 14
+    CHECK_WRITE(sp - 1, 0x1542);
+    CHECK_WRITE(sp - 2, 0x1542);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x45;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1424, Block1424);
+exit:
+    LEAVE
+}
+
+static int Block1545(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1545 3e 04
+    a = 0x04;
+    ACCOUNT(7, 0x1547);
+    // 1547 32 25 20
+    CHECK_WRITE(0x2025, 0x1547);
+    mem[0x2025] = a;
+    WRITTEN(0x2025);
+    ACCOUNT(13, 0x154a);
+    CHAIN(0x154a, Block154a);
+exit:
+    LEAVE
+}
+
+static int Block154a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 154a af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x154b);
+    // 154b 32 02 20
+    CHECK_WRITE(0x2002, 0x154b);
+    mem[0x2002] = a;
+    WRITTEN(0x2002);
+    ACCOUNT(13, 0x154e);
+    // 154e 06 f7
+    b = 0xf7;
+    ACCOUNT(7, 0x1550);
+    // 1550 c3 dc 19
+    cyc += 7;
+    CHAIN(0x19dc, Block19dc);
+exit:
+    LEAVE
+}
+
+static int Block1554(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1554 0e 00
+    c = 0x00;
+    ACCOUNT(7, 0x1556);
+    // 1556 bc
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][h];
+    ACCOUNT(4, 0x1557);
+    // 1557 d4 90 15
+    if (!(f & FlagCarry)) {
+        CHECK_WRITE(sp - 1, 0x1557);
+        CHECK_WRITE(sp - 2, 0x1557);
+        mem[(uint16_t)(sp - 1)] = 0x15;
+        WRITTEN(sp - 1);
+        mem[(uint16_t)(sp - 2)] = 0x5a;
+        WRITTEN(sp - 2);
+        sp -= 2;
+        cyc += 17;
+        CHAIN(0x1590, Block1590);
+    }
+    cyc += 11;
+    CHAIN(0x155a, Block155a);
+exit:
+    LEAVE
+}
+
+static int Block155a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 155a bc
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][h];
+    ACCOUNT(4, 0x155b);
+    // 155b d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x155b);
+        CHECK_READ(sp + 1, 0x155b);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x155c, Block155c);
+exit:
+    LEAVE
+}
+
+static int Block155c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 155c c6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x155e);
+    // 155e 0c
+    c = (uint8_t)(c + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[c];
+    ACCOUNT(5, 0x155f);
+    // 155f c3 5a 15
+    cyc += 7;
+    CHAIN(0x155a, Block155a);
+exit:
+    LEAVE
+}
+
+static int Block1562(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1562 3a 09 20
+    CHECK_READ(0x2009, 0x1562);
+    a = mem[0x2009];
+    ACCOUNT(13, 0x1565);
+    // 1565 65
+    h = l;
+    ACCOUNT(5, 0x1566);
+    // 1566 cd 54 15
+    CHECK_WRITE(sp - 1, 0x1566);
+    CHECK_WRITE(sp - 2, 0x1566);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x69;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1554, Block1554);
+exit:
+    LEAVE
+}
+
+static int Block1569(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1569 41
+    b = c;
+    ACCOUNT(5, 0x156a);
+    // 156a 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x156b);
+    // 156b de 10
+    { uint8_t v = 0x10; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x156d);
+    // 156d 6f
+    l = a;
+    ACCOUNT(5, 0x156e);
+    // 156e c9
+    CHECK_READ(sp, 0x156e);
+    CHECK_READ(sp + 1, 0x156e);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block156f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 156f 3a 0a 20
+    CHECK_READ(0x200a, 0x156f);
+    a = mem[0x200a];
+    ACCOUNT(13, 0x1572);
+    // 1572 cd 54 15
+    CHECK_WRITE(sp - 1, 0x1572);
+    CHECK_WRITE(sp - 2, 0x1572);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x75;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1554, Block1554);
+exit:
+    LEAVE
+}
+
+static int Block1575(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1575 de 10
+    { uint8_t v = 0x10; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x1577);
+    // 1577 67
+    h = a;
+    ACCOUNT(5, 0x1578);
+    // 1578 c9
+    CHECK_READ(sp, 0x1578);
+    CHECK_READ(sp + 1, 0x1578);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1579(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1579 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x157b);
+    // 157b 32 85 20
+    CHECK_WRITE(0x2085, 0x157b);
+    mem[0x2085] = a;
+    WRITTEN(0x2085);
+    ACCOUNT(13, 0x157e);
+    // 157e c3 45 15
+    cyc += 7;
+    CHAIN(0x1545, Block1545);
+exit:
+    LEAVE
+}
+
+static int Block1581(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1581 78
+    a = b;
+    ACCOUNT(5, 0x1582);
+    // 1582 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1583);
+    // 1583 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1584);
+    // 1584 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1585);
+    // 1585 80
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x1586);
+    // 1586 80
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x1587);
+    // 1587 80
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x1588);
+    // 1588 81
+    { uint8_t v = c; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x1589);
+    // 1589 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x158a);
+    // 158a 6f
+    l = a;
+    ACCOUNT(5, 0x158b);
+    // 158b 3a 67 20
+    CHECK_READ(0x2067, 0x158b);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x158e);
+    // 158e 67
+    h = a;
+    ACCOUNT(5, 0x158f);
+    // 158f c9
+    CHECK_READ(sp, 0x158f);
+    CHECK_READ(sp + 1, 0x158f);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1590(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1590 0c
+    c = (uint8_t)(c + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[c];
+    ACCOUNT(5, 0x1591);
+    // 1591 c6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x1593);
+    // 1593 fa 90 15
+    cyc += 10;
+    if ((f & FlagSign)) CHAIN(0x1590, Block1590);
+    CHAIN(0x1596, Block1596);
+exit:
+    LEAVE
+}
+
+static int Block1596(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1596 c9
+    CHECK_READ(sp, 0x1596);
+    CHECK_READ(sp + 1, 0x1596);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1597(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1597 3a 0d 20
+    CHECK_READ(0x200d, 0x1597);
+    a = mem[0x200d];
+    ACCOUNT(13, 0x159a);
+    // 159a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x159b);
+    // 159b c2 b7 15
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x15b7, Block15b7);
+    CHAIN(0x159e, Block159e);
+exit:
+    LEAVE
+}
+
+static int Block159e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 159e 21 a4 3e
+    h = 0x3e; l = 0xa4;
+    ACCOUNT(10, 0x15a1);
+    // 15a1 cd c5 15
+    CHECK_WRITE(sp - 1, 0x15a1);
+    CHECK_WRITE(sp - 2, 0x15a1);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xa4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x15c5, Block15c5);
+exit:
+    LEAVE
+}
+
+static int Block15a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15a4 d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x15a4);
+        CHECK_READ(sp + 1, 0x15a4);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x15a5, Block15a5);
+exit:
+    LEAVE
+}
+
+static int Block15a5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15a5 06 fe
+    b = 0xfe;
+    ACCOUNT(7, 0x15a7);
+    // 15a7 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x15a9);
+    CHAIN(0x15a9, Block15a9);
+exit:
+    LEAVE
+}
+
+static int Block15a9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15a9 32 0d 20
+    CHECK_WRITE(0x200d, 0x15a9);
+    mem[0x200d] = a;
+    WRITTEN(0x200d);
+    ACCOUNT(13, 0x15ac);
+    // 15ac 78
+    a = b;
+    ACCOUNT(5, 0x15ad);
+    // 15ad 32 08 20
+    CHECK_WRITE(0x2008, 0x15ad);
+    mem[0x2008] = a;
+    WRITTEN(0x2008);
+    ACCOUNT(13, 0x15b0);
+    // 15b0 3a 0e 20
+    CHECK_READ(0x200e, 0x15b0);
+    a = mem[0x200e];
+    ACCOUNT(13, 0x15b3);
+    // 15b3 32 07 20
+    CHECK_WRITE(0x2007, 0x15b3);
+    mem[0x2007] = a;
+    WRITTEN(0x2007);
+    ACCOUNT(13, 0x15b6);
+    // 15b6 c9
+    CHECK_READ(sp, 0x15b6);
+    CHECK_READ(sp + 1, 0x15b6);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block15b7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15b7 21 24 25
+    h = 0x25; l = 0x24;
+    ACCOUNT(10, 0x15ba);
+    // 15ba cd c5 15
+    CHECK_WRITE(sp - 1, 0x15ba);
+    CHECK_WRITE(sp - 2, 0x15ba);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xbd;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x15c5, Block15c5);
+exit:
+    LEAVE
+}
+
+static int Block15bd(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15bd d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x15bd);
+        CHECK_READ(sp + 1, 0x15bd);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x15be, Block15be);
+exit:
+    LEAVE
+}
+
+static int Block15be(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15be cd f1 18
+    CHECK_WRITE(sp - 1, 0x15be);
+    CHECK_WRITE(sp - 2, 0x15be);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xc1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18f1, Block18f1);
+exit:
+    LEAVE
+}
+
+static int Block15c1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15c1 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x15c2);
+    // 15c2 c3 a9 15
+    cyc += 7;
+    CHAIN(0x15a9, Block15a9);
+exit:
+    LEAVE
+}
+
+static int Block15c5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15c5 06 17
+    b = 0x17;
+    ACCOUNT(7, 0x15c7);
+    CHAIN(0x15c7, Block15c7);
+exit:
+    LEAVE
+}
+
+static int Block15c7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15c7 7e
+    CHECK_READ(HL, 0x15c7);
+    a = mem[HL];
+    ACCOUNT(7, 0x15c8);
+    // 15c8 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x15c9);
+    // 15c9 c2 6b 16
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x166b, Block166b);
+    CHAIN(0x15cc, Block15cc);
+exit:
+    LEAVE
+}
+
+static int Block15cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15cc 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x15cd);
+    // 15cd 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x15ce);
+    // 15ce c2 c7 15
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x15c7, Block15c7);
+    CHAIN(0x15d1, Block15d1);
+exit:
+    LEAVE
+}
+
+static int Block15d1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15d1 c9
+    CHECK_READ(sp, 0x15d1);
+    CHECK_READ(sp + 1, 0x15d1);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block15d3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15d3 cd 74 14
+    CHECK_WRITE(sp - 1, 0x15d3);
+    CHECK_WRITE(sp - 2, 0x15d3);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1474, Block1474);
+exit:
+    LEAVE
+}
+
+static int Block15d6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15d6 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x15d6);
+    CHECK_WRITE(sp - 1, 0x15d6);
+    CHECK_WRITE(sp - 2, 0x15d6);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x15d7);
+    CHAIN(0x15d7, Block15d7);
+exit:
+    LEAVE
+}
+
+static int Block15d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15d7 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x15d7);
+    CHECK_WRITE(sp - 1, 0x15d7);
+    CHECK_WRITE(sp - 2, 0x15d7);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x15d8);
+    // 15d8 e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x15d8);
+    CHECK_WRITE(sp - 1, 0x15d8);
+    CHECK_WRITE(sp - 2, 0x15d8);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x15d9);
+    // 15d9 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x15d9);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x15da);
+    EXIT(0x15da);
+exit:
+    LEAVE
+}
+
+static int Block15de(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15de 77
+    CHECK_WRITE(HL, 0x15de);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x15df);
+    // 15df 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x15e0);
+    // 15e0 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x15e1);
+    // 15e1 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x15e2);
+    EXIT(0x15e2);
+exit:
+    LEAVE
+}
+
+static int Block15e6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15e6 77
+    CHECK_WRITE(HL, 0x15e6);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x15e7);
+    // 15e7 e1
+    CHECK_READ(sp, 0x15e7);
+    CHECK_READ(sp + 1, 0x15e7);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x15e8);
+    // 15e8 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x15eb);
+    // 15eb 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x15ec);
+    // 15ec c1
+    CHECK_READ(sp, 0x15ec);
+    CHECK_READ(sp + 1, 0x15ec);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x15ed);
+    // 15ed 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x15ee);
+    // 15ee c2 d7 15
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x15d7, Block15d7);
+    CHAIN(0x15f1, Block15f1);
+exit:
+    LEAVE
+}
+
+static int Block15f1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15f1 e1
+    CHECK_READ(sp, 0x15f1);
+    CHECK_READ(sp + 1, 0x15f1);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x15f2);
+    // 15f2 c9
+    CHECK_READ(sp, 0x15f2);
+    CHECK_READ(sp + 1, 0x15f2);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block15f3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15f3 cd 11 16
+    CHECK_WRITE(sp - 1, 0x15f3);
+    CHECK_WRITE(sp - 2, 0x15f3);
+    mem[(uint16_t)(sp - 1)] = 0x15;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1611, Block1611);
+exit:
+    LEAVE
+}
+
+static int Block15f6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15f6 01 00 37
+    b = 0x37; c = 0x00;
+    ACCOUNT(10, 0x15f9);
+    CHAIN(0x15f9, Block15f9);
+exit:
+    LEAVE
+}
+
+static int Block15f9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15f9 7e
+    CHECK_READ(HL, 0x15f9);
+    a = mem[HL];
+    ACCOUNT(7, 0x15fa);
+    // 15fa a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x15fb);
+    // 15fb ca ff 15
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x15ff, Block15ff);
+    CHAIN(0x15fe, Block15fe);
+exit:
+    LEAVE
+}
+
+static int Block15fe(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15fe 0c
+    c = (uint8_t)(c + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[c];
+    ACCOUNT(5, 0x15ff);
+    CHAIN(0x15ff, Block15ff);
+exit:
+    LEAVE
+}
+
+static int Block15ff(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 15ff 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1600);
+    // 1600 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1601);
+    // 1601 c2 f9 15
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x15f9, Block15f9);
+    CHAIN(0x1604, Block1604);
+exit:
+    LEAVE
+}
+
+static int Block1604(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1604 79
+    a = c;
+    ACCOUNT(5, 0x1605);
+    // 1605 32 82 20
+    CHECK_WRITE(0x2082, 0x1605);
+    mem[0x2082] = a;
+    WRITTEN(0x2082);
+    ACCOUNT(13, 0x1608);
+    // 1608 fe 01
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x01];
+    ACCOUNT(7, 0x160a);
+    // 160a c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x160a);
+        CHECK_READ(sp + 1, 0x160a);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x160b, Block160b);
+exit:
+    LEAVE
+}
+
+static int Block160b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 160b 21 6b 20
+    h = 0x20; l = 0x6b;
+    ACCOUNT(10, 0x160e);
+    // 160e 36 01
+    CHECK_WRITE(HL, 0x160e);
+    mem[HL] = 0x01;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1610);
+    // 1610 c9
+    CHECK_READ(sp, 0x1610);
+    CHECK_READ(sp + 1, 0x1610);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1611(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1611 2e 00
+    l = 0x00;
+    ACCOUNT(7, 0x1613);
+    // 1613 3a 67 20
+    CHECK_READ(0x2067, 0x1613);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x1616);
+    // 1616 67
+    h = a;
+    ACCOUNT(5, 0x1617);
+    // 1617 c9
+    CHECK_READ(sp, 0x1617);
+    CHECK_READ(sp + 1, 0x1617);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1618(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1618 3a 15 20
+    CHECK_READ(0x2015, 0x1618);
+    a = mem[0x2015];
+    ACCOUNT(13, 0x161b);
+    // 161b fe ff
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xff];
+    ACCOUNT(7, 0x161d);
+    // 161d c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x161d);
+        CHECK_READ(sp + 1, 0x161d);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x161e, Block161e);
+exit:
+    LEAVE
+}
+
+static int Block161e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 161e 21 10 20
+    h = 0x20; l = 0x10;
+    ACCOUNT(10, 0x1621);
+    // 1621 7e
+    CHECK_READ(HL, 0x1621);
+    a = mem[HL];
+    ACCOUNT(7, 0x1622);
+    // 1622 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1623);
+    // 1623 46
+    CHECK_READ(HL, 0x1623);
+    b = mem[HL];
+    ACCOUNT(7, 0x1624);
+    // 1624 b0
+    a |= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1625);
+    // 1625 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x1625);
+        CHECK_READ(sp + 1, 0x1625);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x1626, Block1626);
+exit:
+    LEAVE
+}
+
+static int Block1626(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1626 3a 25 20
+    CHECK_READ(0x2025, 0x1626);
+    a = mem[0x2025];
+    ACCOUNT(13, 0x1629);
+    // 1629 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x162a);
+    // 162a c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x162a);
+        CHECK_READ(sp + 1, 0x162a);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x162b, Block162b);
+exit:
+    LEAVE
+}
+
+static int Block162b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 162b 3a ef 20
+    CHECK_READ(0x20ef, 0x162b);
+    a = mem[0x20ef];
+    ACCOUNT(13, 0x162e);
+    // 162e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x162f);
+    // 162f ca 52 16
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x1652, Block1652);
+    CHAIN(0x1632, Block1632);
+exit:
+    LEAVE
+}
+
+static int Block1632(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1632 3a 2d 20
+    CHECK_READ(0x202d, 0x1632);
+    a = mem[0x202d];
+    ACCOUNT(13, 0x1635);
+    // 1635 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1636);
+    // 1636 c2 48 16
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1648, Block1648);
+    CHAIN(0x1639, Block1639);
+exit:
+    LEAVE
+}
+
+static int Block1639(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1639 cd c0 17
+    CHECK_WRITE(sp - 1, 0x1639);
+    CHECK_WRITE(sp - 2, 0x1639);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x17c0, Block17c0);
+exit:
+    LEAVE
+}
+
+static int Block163c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 163c e6 10
+    a &= 0x10; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x163e);
+    // 163e c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x163e);
+        CHECK_READ(sp + 1, 0x163e);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x163f, Block163f);
+exit:
+    LEAVE
+}
+
+static int Block163f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 163f 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x1641);
+    // 1641 32 25 20
+    CHECK_WRITE(0x2025, 0x1641);
+    mem[0x2025] = a;
+    WRITTEN(0x2025);
+    ACCOUNT(13, 0x1644);
+    // 1644 32 2d 20
+    CHECK_WRITE(0x202d, 0x1644);
+    mem[0x202d] = a;
+    WRITTEN(0x202d);
+    ACCOUNT(13, 0x1647);
+    // 1647 c9
+    CHECK_READ(sp, 0x1647);
+    CHECK_READ(sp + 1, 0x1647);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1648(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1648 cd c0 17
+    CHECK_WRITE(sp - 1, 0x1648);
+    CHECK_WRITE(sp - 2, 0x1648);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x17c0, Block17c0);
+exit:
+    LEAVE
+}
+
+static int Block164b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 164b e6 10
+    a &= 0x10; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x164d);
+    // 164d c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x164d);
+        CHECK_READ(sp + 1, 0x164d);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x164e, Block164e);
+exit:
+    LEAVE
+}
+
+static int Block164e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 164e 32 2d 20
+    CHECK_WRITE(0x202d, 0x164e);
+    mem[0x202d] = a;
+    WRITTEN(0x202d);
+    ACCOUNT(13, 0x1651);
+    // 1651 c9
+    CHECK_READ(sp, 0x1651);
+    CHECK_READ(sp + 1, 0x1651);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1652(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1652 21 25 20
+    h = 0x20; l = 0x25;
+    ACCOUNT(10, 0x1655);
+    // 1655 36 01
+    CHECK_WRITE(HL, 0x1655);
+    mem[HL] = 0x01;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1657);
+    // 1657 2a ed 20
+    CHECK_READ(0x20ed, 0x1657);
+    CHECK_READ(0x20ee, 0x1657);
+    l = mem[0x20ed]; h = mem[0x20ee];
+    ACCOUNT(16, 0x165a);
+    // 165a 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x165b);
+    // 165b 7d
+    a = l;
+    ACCOUNT(5, 0x165c);
+    // 165c fe 7e
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x7e];
+    ACCOUNT(7, 0x165e);
+    // 165e da 63 16
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x1663, Block1663);
+    CHAIN(0x1661, Block1661);
+exit:
+    LEAVE
+}
+
+static int Block1661(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1661 2e 74
+    l = 0x74;
+    ACCOUNT(7, 0x1663);
+    CHAIN(0x1663, Block1663);
+exit:
+    LEAVE
+}
+
+static int Block1663(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1663 22 ed 20
+    CHECK_WRITE(0x20ed, 0x1663);
+    CHECK_WRITE(0x20ee, 0x1663);
+    mem[0x20ed] = l; mem[0x20ee] = h;
+    WRITTEN(0x20ed);
+    WRITTEN(0x20ee);
+    ACCOUNT(16, 0x1666);
+    // 1666 7e
+    CHECK_READ(HL, 0x1666);
+    a = mem[HL];
+    ACCOUNT(7, 0x1667);
+    // 1667 32 1d 20
+    CHECK_WRITE(0x201d, 0x1667);
+    mem[0x201d] = a;
+    WRITTEN(0x201d);
+    ACCOUNT(13, 0x166a);
+    // 166a c9
+    CHECK_READ(sp, 0x166a);
+    CHECK_READ(sp + 1, 0x166a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block166b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 166b 37
+    f |= FlagCarry;
+    ACCOUNT(4, 0x166c);
+    // 166c c9
+    CHECK_READ(sp, 0x166c);
+    CHECK_READ(sp + 1, 0x166c);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1671(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1671 cd 10 19
+    CHECK_WRITE(sp - 1, 0x1671);
+    CHECK_WRITE(sp - 2, 0x1671);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x74;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1910, Block1910);
+exit:
+    LEAVE
+}
+
+static int Block1674(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1674 36 00
+    CHECK_WRITE(HL, 0x1674);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1676);
+    // 1676 cd ca 09
+    CHECK_WRITE(sp - 1, 0x1676);
+    CHECK_WRITE(sp - 2, 0x1676);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x79;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09ca, Block09ca);
+exit:
+    LEAVE
+}
+
+static int Block1679(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1679 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x167a);
+    // 167a 11 f5 20
+    d = 0x20; e = 0xf5;
+    ACCOUNT(10, 0x167d);
+    // 167d 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x167d);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x167e);
+    // 167e be
+    CHECK_READ(HL, 0x167e);
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][mem[HL]];
+    ACCOUNT(7, 0x167f);
+    // 167f 1b
+    { uint16_t v = (uint16_t)(((d << 8) | e) - 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1680);
+    // 1680 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1681);
+    // 1681 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x1681);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x1682);
+    // 1682 ca 8b 16
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x168b, Block168b);
+    CHAIN(0x1685, Block1685);
+exit:
+    LEAVE
+}
+
+static int Block1685(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1685 d2 98 16
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1698, Block1698);
+    CHAIN(0x1688, Block1688);
+exit:
+    LEAVE
+}
+
+static int Block1688(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1688 c3 8f 16
+    cyc += 7;
+    CHAIN(0x168f, Block168f);
+exit:
+    LEAVE
+}
+
+static int Block168b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 168b be
+    CHECK_READ(HL, 0x168b);
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][mem[HL]];
+    ACCOUNT(7, 0x168c);
+    // 168c d2 98 16
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1698, Block1698);
+    CHAIN(0x168f, Block168f);
+exit:
+    LEAVE
+}
+
+static int Block168f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 168f 7e
+    CHECK_READ(HL, 0x168f);
+    a = mem[HL];
+    ACCOUNT(7, 0x1690);
+    // 1690 12
+    CHECK_WRITE((uint16_t)((d << 8) | e), 0x1690);
+    mem[(uint16_t)((d << 8) | e)] = a;
+    WRITTEN((uint16_t)((d << 8) | e));
+    ACCOUNT(7, 0x1691);
+    // 1691 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1692);
+    // 1692 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1693);
+    // 1693 7e
+    CHECK_READ(HL, 0x1693);
+    a = mem[HL];
+    ACCOUNT(7, 0x1694);
+    // 1694 12
+    CHECK_WRITE((uint16_t)((d << 8) | e), 0x1694);
+    mem[(uint16_t)((d << 8) | e)] = a;
+    WRITTEN((uint16_t)((d << 8) | e));
+    ACCOUNT(7, 0x1695);
+    // 1695 cd 50 19
+    CHECK_WRITE(sp - 1, 0x1695);
+    CHECK_WRITE(sp - 2, 0x1695);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x98;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1950, Block1950);
+exit:
+    LEAVE
+}
+
+static int Block1698(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1698 3a ce 20
+    CHECK_READ(0x20ce, 0x1698);
+    a = mem[0x20ce];
+    ACCOUNT(13, 0x169b);
+    // 169b a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x169c);
+    // 169c ca c9 16
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x16c9, Block16c9);
+    CHAIN(0x169f, Block169f);
+exit:
+    LEAVE
+}
+
+static int Block169f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 169f 21 03 28
+    h = 0x28; l = 0x03;
+    ACCOUNT(10, 0x16a2);
+    // 16a2 11 a6 1a
+    d = 0x1a; e = 0xa6;
+    ACCOUNT(10, 0x16a5);
+    // 16a5 0e 14
+    c = 0x14;
+    ACCOUNT(7, 0x16a7);
+    // 16a7 cd 93 0a
+    CHECK_WRITE(sp - 1, 0x16a7);
+    CHECK_WRITE(sp - 2, 0x16a7);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xaa;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block16aa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16aa 25
+    h = (uint8_t)(h - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[h];
+    ACCOUNT(5, 0x16ab);
+    // 16ab 25
+    h = (uint8_t)(h - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[h];
+    ACCOUNT(5, 0x16ac);
+    // 16ac 06 1b
+    b = 0x1b;
+    ACCOUNT(7, 0x16ae);
+    // 16ae 3a 67 20
+    CHECK_READ(0x2067, 0x16ae);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x16b1);
+    // 16b1 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x16b2);
+    // 16b2 da b7 16
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x16b7, Block16b7);
+    CHAIN(0x16b5, Block16b5);
+exit:
+    LEAVE
+}
+
+static int Block16b5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16b5 06 1c
+    b = 0x1c;
+    ACCOUNT(7, 0x16b7);
+    CHAIN(0x16b7, Block16b7);
+exit:
+    LEAVE
+}
+
+static int Block16b7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16b7 78
+    a = b;
+    ACCOUNT(5, 0x16b8);
+    // 16b8 cd ff 08
+    CHECK_WRITE(sp - 1, 0x16b8);
+    CHECK_WRITE(sp - 2, 0x16b8);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xbb;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block16bb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16bb cd b1 0a
+    CHECK_WRITE(sp - 1, 0x16bb);
+    CHECK_WRITE(sp - 2, 0x16bb);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xbe;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block16be(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16be cd e7 18
+    CHECK_WRITE(sp - 1, 0x16be);
+    CHECK_WRITE(sp - 2, 0x16be);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xc1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18e7, Block18e7);
+exit:
+    LEAVE
+}
+
+static int Block16c1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16c1 7e
+    CHECK_READ(HL, 0x16c1);
+    a = mem[HL];
+    ACCOUNT(7, 0x16c2);
+    // 16c2 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x16c3);
+    // 16c3 ca c9 16
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x16c9, Block16c9);
+    CHAIN(0x16c6, Block16c6);
+exit:
+    LEAVE
+}
+
+static int Block16c6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16c6 c3 ed 02
+    cyc += 7;
+    CHAIN(0x02ed, Block02ed);
+exit:
+    LEAVE
+}
+
+static int Block16c9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16c9 21 18 2d
+    h = 0x2d; l = 0x18;
+    ACCOUNT(10, 0x16cc);
+    // 16cc 11 a6 1a
+    d = 0x1a; e = 0xa6;
+    ACCOUNT(10, 0x16cf);
+    // 16cf 0e 0a
+    c = 0x0a;
+    ACCOUNT(7, 0x16d1);
+    // 16d1 cd 93 0a
+    CHECK_WRITE(sp - 1, 0x16d1);
+    CHECK_WRITE(sp - 2, 0x16d1);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd4;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block16d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16d4 cd b6 0a
+    CHECK_WRITE(sp - 1, 0x16d4);
+    CHECK_WRITE(sp - 2, 0x16d4);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd7;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block16d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16d7 cd d6 09
+    CHECK_WRITE(sp - 1, 0x16d7);
+    CHECK_WRITE(sp - 2, 0x16d7);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xda;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block16da(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16da af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x16db);
+    // 16db 32 ef 20
+    CHECK_WRITE(0x20ef, 0x16db);
+    mem[0x20ef] = a;
+    WRITTEN(0x20ef);
+    ACCOUNT(13, 0x16de);
+    EXIT(0x16de);
+exit:
+    LEAVE
+}
+
+static int Block16e0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16e0 cd d1 19
+    CHECK_WRITE(sp - 1, 0x16e0);
+    CHECK_WRITE(sp - 2, 0x16e0);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xe3;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d1, Block19d1);
+exit:
+    LEAVE
+}
+
+static int Block16e3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16e3 c3 89 0b
+    cyc += 7;
+    CHAIN(0x0b89, Block0b89);
+exit:
+    LEAVE
+}
+
+static int Block16e6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16e6 31 00 24
+    sp = 0x2400;
+    ACCOUNT(10, 0x16e9);
+    // 16e9 fb
+    f |= (1 << 5);
+    ACCOUNT(4, 0x16ea);
+    // 16ea af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x16eb);
+    // 16eb 32 15 20
+    CHECK_WRITE(0x2015, 0x16eb);
+    mem[0x2015] = a;
+    WRITTEN(0x2015);
+    ACCOUNT(13, 0x16ee);
+    CHAIN(0x16ee, Block16ee);
+exit:
+    LEAVE
+}
+
+static int Block16ee(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16ee cd d8 14
+    CHECK_WRITE(sp - 1, 0x16ee);
+    CHECK_WRITE(sp - 2, 0x16ee);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x14d8, Block14d8);
+exit:
+    LEAVE
+}
+
+static int Block16f1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16f1 06 04
+    b = 0x04;
+    ACCOUNT(7, 0x16f3);
+    // 16f3 cd fa 18
+    CHECK_WRITE(sp - 1, 0x16f3);
+    CHECK_WRITE(sp - 2, 0x16f3);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf6;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block16f6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16f6 cd 59 0a
+    CHECK_WRITE(sp - 1, 0x16f6);
+    CHECK_WRITE(sp - 2, 0x16f6);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a59, Block0a59);
+exit:
+    LEAVE
+}
+
+static int Block16f9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16f9 c2 ee 16
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x16ee, Block16ee);
+    CHAIN(0x16fc, Block16fc);
+exit:
+    LEAVE
+}
+
+static int Block16fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16fc cd d7 19
+    CHECK_WRITE(sp - 1, 0x16fc);
+    CHECK_WRITE(sp - 2, 0x16fc);
+    mem[(uint16_t)(sp - 1)] = 0x16;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xff;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d7, Block19d7);
+exit:
+    LEAVE
+}
+
+static int Block16ff(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 16ff 21 01 27
+    h = 0x27; l = 0x01;
+    ACCOUNT(10, 0x1702);
+    // 1702 cd fa 19
+    CHECK_WRITE(sp - 1, 0x1702);
+    CHECK_WRITE(sp - 2, 0x1702);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x05;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19fa, Block19fa);
+exit:
+    LEAVE
+}
+
+static int Block1705(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1705 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1706);
+    // 1706 cd 8b 1a
+    CHECK_WRITE(sp - 1, 0x1706);
+    CHECK_WRITE(sp - 2, 0x1706);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x09;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a8b, Block1a8b);
+exit:
+    LEAVE
+}
+
+static int Block1709(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1709 06 fb
+    b = 0xfb;
+    ACCOUNT(7, 0x170b);
+    // 170b c3 6b 19
+    cyc += 7;
+    CHAIN(0x196b, Block196b);
+exit:
+    LEAVE
+}
+
+static int Block170e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 170e cd ca 09
+    CHECK_WRITE(sp - 1, 0x170e);
+    CHECK_WRITE(sp - 2, 0x170e);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x11;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09ca, Block09ca);
+exit:
+    LEAVE
+}
+
+static int Block1711(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1711 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1712);
+    // 1712 7e
+    CHECK_READ(HL, 0x1712);
+    a = mem[HL];
+    ACCOUNT(7, 0x1713);
+    // 1713 11 b8 1c
+    d = 0x1c; e = 0xb8;
+    ACCOUNT(10, 0x1716);
+    // 1716 21 a1 1a
+    h = 0x1a; l = 0xa1;
+    ACCOUNT(10, 0x1719);
+    // 1719 0e 04
+    c = 0x04;
+    ACCOUNT(7, 0x171b);
+    // 171b 47
+    b = a;
+    ACCOUNT(5, 0x171c);
+    CHAIN(0x171c, Block171c);
+exit:
+    LEAVE
+}
+
+static int Block171c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 171c 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x171c);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x171d);
+    // 171d b8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][b];
+    ACCOUNT(4, 0x171e);
+    // 171e d2 27 17
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x1727, Block1727);
+    CHAIN(0x1721, Block1721);
+exit:
+    LEAVE
+}
+
+static int Block1721(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1721 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1722);
+    // 1722 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1723);
+    // 1723 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x1724);
+    // 1724 c2 1c 17
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x171c, Block171c);
+    CHAIN(0x1727, Block1727);
+exit:
+    LEAVE
+}
+
+static int Block1727(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1727 7e
+    CHECK_READ(HL, 0x1727);
+    a = mem[HL];
+    ACCOUNT(7, 0x1728);
+    // 1728 32 cf 20
+    CHECK_WRITE(0x20cf, 0x1728);
+    mem[0x20cf] = a;
+    WRITTEN(0x20cf);
+    ACCOUNT(13, 0x172b);
+    // 172b c9
+    CHECK_READ(sp, 0x172b);
+    CHECK_READ(sp + 1, 0x172b);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block172c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 172c 3a 25 20
+    CHECK_READ(0x2025, 0x172c);
+    a = mem[0x2025];
+    ACCOUNT(13, 0x172f);
+    // 172f fe 00
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x00];
+    ACCOUNT(7, 0x1731);
+    // 1731 c2 39 17
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1739, Block1739);
+    CHAIN(0x1734, Block1734);
+exit:
+    LEAVE
+}
+
+static int Block1734(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1734 06 fd
+    b = 0xfd;
+    ACCOUNT(7, 0x1736);
+    // 1736 c3 dc 19
+    cyc += 7;
+    CHAIN(0x19dc, Block19dc);
+exit:
+    LEAVE
+}
+
+static int Block1739(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1739 06 02
+    b = 0x02;
+    ACCOUNT(7, 0x173b);
+    // 173b c3 fa 18
+    cyc += 7;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block1740(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1740 21 9b 20
+    h = 0x20; l = 0x9b;
+    ACCOUNT(10, 0x1743);
+    // 1743 35
+    CHECK_READ(HL, 0x1743);
+    CHECK_WRITE(HL, 0x1743);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1744);
+    // 1744 cc 6d 17
+    if ((f & FlagZero)) {
+        CHECK_WRITE(sp - 1, 0x1744);
+        CHECK_WRITE(sp - 2, 0x1744);
+        mem[(uint16_t)(sp - 1)] = 0x17;
+        WRITTEN(sp - 1);
+        mem[(uint16_t)(sp - 2)] = 0x47;
+        WRITTEN(sp - 2);
+        sp -= 2;
+        cyc += 17;
+        CHAIN(0x176d, Block176d);
+    }
+    cyc += 11;
+    CHAIN(0x1747, Block1747);
+exit:
+    LEAVE
+}
+
+static int Block1747(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1747 3a 68 20
+    CHECK_READ(0x2068, 0x1747);
+    a = mem[0x2068];
+    ACCOUNT(13, 0x174a);
+    // 174a a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x174b);
+    // 174b ca 6d 17
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x176d, Block176d);
+    CHAIN(0x174e, Block174e);
+exit:
+    LEAVE
+}
+
+static int Block174e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 174e 21 96 20
+    h = 0x20; l = 0x96;
+    ACCOUNT(10, 0x1751);
+    // 1751 35
+    CHECK_READ(HL, 0x1751);
+    CHECK_WRITE(HL, 0x1751);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1752);
+    // 1752 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x1752);
+        CHECK_READ(sp + 1, 0x1752);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x1753, Block1753);
+exit:
+    LEAVE
+}
+
+static int Block1753(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1753 21 98 20
+    h = 0x20; l = 0x98;
+    ACCOUNT(10, 0x1756);
+    // 1756 7e
+    CHECK_READ(HL, 0x1756);
+    a = mem[HL];
+    ACCOUNT(7, 0x1757);
+    EXIT(0x1757);
+exit:
+    LEAVE
+}
+
+static int Block1759(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1759 3a 82 20
+    CHECK_READ(0x2082, 0x1759);
+    a = mem[0x2082];
+    ACCOUNT(13, 0x175c);
+    // 175c a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x175d);
+    // 175d ca 6d 17
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x176d, Block176d);
+    CHAIN(0x1760, Block1760);
+exit:
+    LEAVE
+}
+
+static int Block1760(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1760 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1761);
+    // 1761 7e
+    CHECK_READ(HL, 0x1761);
+    a = mem[HL];
+    ACCOUNT(7, 0x1762);
+    // 1762 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1763);
+    // 1763 77
+    CHECK_WRITE(HL, 0x1763);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x1764);
+    // 1764 2b
+    { uint16_t v = (uint16_t)(((h << 8) | l) - 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1765);
+    // 1765 36 01
+    CHECK_WRITE(HL, 0x1765);
+    mem[HL] = 0x01;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1767);
+    // 1767 3e 04
+    a = 0x04;
+    ACCOUNT(7, 0x1769);
+    // 1769 32 9b 20
+    CHECK_WRITE(0x209b, 0x1769);
+    mem[0x209b] = a;
+    WRITTEN(0x209b);
+    ACCOUNT(13, 0x176c);
+    // 176c c9
+    CHECK_READ(sp, 0x176c);
+    CHECK_READ(sp + 1, 0x176c);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block176d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 176d 3a 98 20
+    CHECK_READ(0x2098, 0x176d);
+    a = mem[0x2098];
+    ACCOUNT(13, 0x1770);
+    // 1770 e6 30
+    a &= 0x30; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1772);
+    EXIT(0x1772);
+exit:
+    LEAVE
+}
+
+static int Block1774(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1774 c9
+    CHECK_READ(sp, 0x1774);
+    CHECK_READ(sp + 1, 0x1774);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1775(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1775 3a 95 20
+    CHECK_READ(0x2095, 0x1775);
+    a = mem[0x2095];
+    ACCOUNT(13, 0x1778);
+    // 1778 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1779);
+    // 1779 ca aa 17
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x17aa, Block17aa);
+    CHAIN(0x177c, Block177c);
+exit:
+    LEAVE
+}
+
+static int Block177c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 177c 21 11 1a
+    h = 0x1a; l = 0x11;
+    ACCOUNT(10, 0x177f);
+    // 177f 11 21 1a
+    d = 0x1a; e = 0x21;
+    ACCOUNT(10, 0x1782);
+    // 1782 3a 82 20
+    CHECK_READ(0x2082, 0x1782);
+    a = mem[0x2082];
+    ACCOUNT(13, 0x1785);
+    CHAIN(0x1785, Block1785);
+exit:
+    LEAVE
+}
+
+static int Block1785(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1785 be
+    CHECK_READ(HL, 0x1785);
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][mem[HL]];
+    ACCOUNT(7, 0x1786);
+    // 1786 d2 8e 17
+    cyc += 10;
+    if (!(f & FlagCarry)) CHAIN(0x178e, Block178e);
+    CHAIN(0x1789, Block1789);
+exit:
+    LEAVE
+}
+
+static int Block1789(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1789 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x178a);
+    // 178a 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x178b);
+    // 178b c3 85 17
+    cyc += 7;
+    CHAIN(0x1785, Block1785);
+exit:
+    LEAVE
+}
+
+static int Block178e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 178e 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x178e);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x178f);
+    // 178f 32 97 20
+    CHECK_WRITE(0x2097, 0x178f);
+    mem[0x2097] = a;
+    WRITTEN(0x2097);
+    ACCOUNT(13, 0x1792);
+    // 1792 21 98 20
+    h = 0x20; l = 0x98;
+    ACCOUNT(10, 0x1795);
+    // 1795 7e
+    CHECK_READ(HL, 0x1795);
+    a = mem[HL];
+    ACCOUNT(7, 0x1796);
+    // 1796 e6 30
+    a &= 0x30; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1798);
+    // 1798 47
+    b = a;
+    ACCOUNT(5, 0x1799);
+    // 1799 7e
+    CHECK_READ(HL, 0x1799);
+    a = mem[HL];
+    ACCOUNT(7, 0x179a);
+    // 179a e6 0f
+    a &= 0x0f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x179c);
+    // 179c 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x179d);
+    // 179d fe 10
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x10];
+    ACCOUNT(7, 0x179f);
+    // 179f c2 a4 17
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x17a4, Block17a4);
+    CHAIN(0x17a2, Block17a2);
+exit:
+    LEAVE
+}
+
+static int Block17a2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17a2 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x17a4);
+    CHAIN(0x17a4, Block17a4);
+exit:
+    LEAVE
+}
+
+static int Block17a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17a4 b0
+    a |= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x17a5);
+    // 17a5 77
+    CHECK_WRITE(HL, 0x17a5);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x17a6);
+    // 17a6 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x17a7);
+    // 17a7 32 95 20
+    CHECK_WRITE(0x2095, 0x17a7);
+    mem[0x2095] = a;
+    WRITTEN(0x2095);
+    ACCOUNT(13, 0x17aa);
+    CHAIN(0x17aa, Block17aa);
+exit:
+    LEAVE
+}
+
+static int Block17aa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17aa 21 99 20
+    h = 0x20; l = 0x99;
+    ACCOUNT(10, 0x17ad);
+    // 17ad 35
+    CHECK_READ(HL, 0x17ad);
+    CHECK_WRITE(HL, 0x17ad);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x17ae);
+    // 17ae c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x17ae);
+        CHECK_READ(sp + 1, 0x17ae);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x17af, Block17af);
+exit:
+    LEAVE
+}
+
+static int Block17af(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17af 06 ef
+    b = 0xef;
+    ACCOUNT(7, 0x17b1);
+    // 17b1 c3 dc 19
+    cyc += 7;
+    CHAIN(0x19dc, Block19dc);
+exit:
+    LEAVE
+}
+
+static int Block17c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17c0 3a 67 20
+    CHECK_READ(0x2067, 0x17c0);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x17c3);
+    // 17c3 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x17c4);
+    // 17c4 d2 ca 17
+    cyc += 10;
+    if (!(f & FlagCarry)) EXIT(0x17ca);
+    EXIT(0x17c7);
+exit:
+    LEAVE
+}
+
+static int Block17c9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17c9 c9
+    CHECK_READ(sp, 0x17c9);
+    CHECK_READ(sp + 1, 0x17c9);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block17cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17cc c9
+    CHECK_READ(sp, 0x17cc);
+    CHECK_READ(sp + 1, 0x17cc);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block17cf(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17cf e6 04
+    a &= 0x04; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x17d1);
+    // 17d1 c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x17d1);
+        CHECK_READ(sp + 1, 0x17d1);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x17d2, Block17d2);
+exit:
+    LEAVE
+}
+
+static int Block17d2(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17d2 3a 9a 20
+    CHECK_READ(0x209a, 0x17d2);
+    a = mem[0x209a];
+    ACCOUNT(13, 0x17d5);
+    // 17d5 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x17d6);
+    // 17d6 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x17d6);
+        CHECK_READ(sp + 1, 0x17d6);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x17d7, Block17d7);
+exit:
+    LEAVE
+}
+
+static int Block17d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17d7 31 00 24
+    sp = 0x2400;
+    ACCOUNT(10, 0x17da);
+    // 17da 06 04
+    b = 0x04;
+    ACCOUNT(7, 0x17dc);
+    CHAIN(0x17dc, Block17dc);
+exit:
+    LEAVE
+}
+
+static int Block17dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17dc cd d6 09
+    CHECK_WRITE(sp - 1, 0x17dc);
+    CHECK_WRITE(sp - 2, 0x17dc);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xdf;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block17df(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17df 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x17e0);
+    // 17e0 c2 dc 17
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x17dc, Block17dc);
+    CHAIN(0x17e3, Block17e3);
+exit:
+    LEAVE
+}
+
+static int Block17e3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17e3 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x17e5);
+    // 17e5 32 9a 20
+    CHECK_WRITE(0x209a, 0x17e5);
+    mem[0x209a] = a;
+    WRITTEN(0x209a);
+    ACCOUNT(13, 0x17e8);
+    // 17e8 cd d7 19
+    CHECK_WRITE(sp - 1, 0x17e8);
+    CHECK_WRITE(sp - 2, 0x17e8);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xeb;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d7, Block19d7);
+exit:
+    LEAVE
+}
+
+static int Block17eb(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17eb fb
+    f |= (1 << 5);
+    ACCOUNT(4, 0x17ec);
+    // 17ec 11 bc 1c
+    d = 0x1c; e = 0xbc;
+    ACCOUNT(10, 0x17ef);
+    // 17ef 21 16 30
+    h = 0x30; l = 0x16;
+    ACCOUNT(10, 0x17f2);
+    // 17f2 0e 04
+    c = 0x04;
+    ACCOUNT(7, 0x17f4);
+    // 17f4 cd 93 0a
+    CHECK_WRITE(sp - 1, 0x17f4);
+    CHECK_WRITE(sp - 2, 0x17f4);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf7;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block17f7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17f7 cd b1 0a
+    CHECK_WRITE(sp - 1, 0x17f7);
+    CHECK_WRITE(sp - 2, 0x17f7);
+    mem[(uint16_t)(sp - 1)] = 0x17;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xfa;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0ab1, Block0ab1);
+exit:
+    LEAVE
+}
+
+static int Block17fa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 17fa af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x17fb);
+    // 17fb 32 9a 20
+    CHECK_WRITE(0x209a, 0x17fb);
+    mem[0x209a] = a;
+    WRITTEN(0x209a);
+    ACCOUNT(13, 0x17fe);
+    // 17fe 32 93 20
+    CHECK_WRITE(0x2093, 0x17fe);
+    mem[0x2093] = a;
+    WRITTEN(0x2093);
+    ACCOUNT(13, 0x1801);
+    // 1801 c3 c9 16
+    cyc += 7;
+    CHAIN(0x16c9, Block16c9);
+exit:
+    LEAVE
+}
+
+static int Block1804(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1804 21 84 20
+    h = 0x20; l = 0x84;
+    ACCOUNT(10, 0x1807);
+    // 1807 7e
+    CHECK_READ(HL, 0x1807);
+    a = mem[HL];
+    ACCOUNT(7, 0x1808);
+    // 1808 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1809);
+    // 1809 ca 07 07
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x0707, Block0707);
+    CHAIN(0x180c, Block180c);
+exit:
+    LEAVE
+}
+
+static int Block180c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 180c 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x180d);
+    // 180d 7e
+    CHECK_READ(HL, 0x180d);
+    a = mem[HL];
+    ACCOUNT(7, 0x180e);
+    // 180e a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x180f);
+    // 180f c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x180f);
+        CHECK_READ(sp + 1, 0x180f);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x1810, Block1810);
+exit:
+    LEAVE
+}
+
+static int Block1810(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1810 06 01
+    b = 0x01;
+    ACCOUNT(7, 0x1812);
+    // 1812 c3 fa 18
+    cyc += 7;
+    CHAIN(0x18fa, Block18fa);
+exit:
+    LEAVE
+}
+
+static int Block1815(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1815 21 10 28
+    h = 0x28; l = 0x10;
+    ACCOUNT(10, 0x1818);
+    // 1818 11 a3 1c
+    d = 0x1c; e = 0xa3;
+    ACCOUNT(10, 0x181b);
+    // 181b 0e 15
+    c = 0x15;
+    ACCOUNT(7, 0x181d);
+    // 181d cd f3 08
+    CHECK_WRITE(sp - 1, 0x181d);
+    CHECK_WRITE(sp - 2, 0x181d);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x20;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block1820(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1820 3e 0a
+    a = 0x0a;
+    ACCOUNT(7, 0x1822);
+    // 1822 32 6c 20
+    CHECK_WRITE(0x206c, 0x1822);
+    mem[0x206c] = a;
+    WRITTEN(0x206c);
+    ACCOUNT(13, 0x1825);
+    // 1825 01 be 1d
+    b = 0x1d; c = 0xbe;
+    ACCOUNT(10, 0x1828);
+    CHAIN(0x1828, Block1828);
+exit:
+    LEAVE
+}
+
+static int Block1828(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1828 cd 56 18
+    CHECK_WRITE(sp - 1, 0x1828);
+    CHECK_WRITE(sp - 2, 0x1828);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x2b;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1856, Block1856);
+exit:
+    LEAVE
+}
+
+static int Block182b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 182b da 37 18
+    cyc += 10;
+    if ((f & FlagCarry)) CHAIN(0x1837, Block1837);
+    CHAIN(0x182e, Block182e);
+exit:
+    LEAVE
+}
+
+static int Block182e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 182e cd 44 18
+    CHECK_WRITE(sp - 1, 0x182e);
+    CHECK_WRITE(sp - 2, 0x182e);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x31;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1844, Block1844);
+exit:
+    LEAVE
+}
+
+static int Block1831(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1831 c3 28 18
+    cyc += 7;
+    CHAIN(0x1828, Block1828);
+exit:
+    LEAVE
+}
+
+static int Block1837(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1837 01 cf 1d
+    b = 0x1d; c = 0xcf;
+    ACCOUNT(10, 0x183a);
+    CHAIN(0x183a, Block183a);
+exit:
+    LEAVE
+}
+
+static int Block183a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 183a cd 56 18
+    CHECK_WRITE(sp - 1, 0x183a);
+    CHECK_WRITE(sp - 2, 0x183a);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x3d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1856, Block1856);
+exit:
+    LEAVE
+}
+
+static int Block183d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 183d d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x183d);
+        CHECK_READ(sp + 1, 0x183d);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x183e, Block183e);
+exit:
+    LEAVE
+}
+
+static int Block183e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 183e cd 4c 18
+    CHECK_WRITE(sp - 1, 0x183e);
+    CHECK_WRITE(sp - 2, 0x183e);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x41;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x184c, Block184c);
+exit:
+    LEAVE
+}
+
+static int Block1841(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1841 c3 3a 18
+    cyc += 7;
+    CHAIN(0x183a, Block183a);
+exit:
+    LEAVE
+}
+
+static int Block1844(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1844 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1844);
+    CHECK_WRITE(sp - 1, 0x1844);
+    CHECK_WRITE(sp - 2, 0x1844);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1845);
+    // 1845 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x1847);
+    // 1847 cd 39 14
+    CHECK_WRITE(sp - 1, 0x1847);
+    CHECK_WRITE(sp - 2, 0x1847);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x4a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1439, Block1439);
+exit:
+    LEAVE
+}
+
+static int Block184a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 184a c1
+    CHECK_READ(sp, 0x184a);
+    CHECK_READ(sp + 1, 0x184a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x184b);
+    // 184b c9
+    CHECK_READ(sp, 0x184b);
+    CHECK_READ(sp + 1, 0x184b);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block184c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 184c c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x184c);
+    CHECK_WRITE(sp - 1, 0x184c);
+    CHECK_WRITE(sp - 2, 0x184c);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x184d);
+    // 184d 3a 6c 20
+    CHECK_READ(0x206c, 0x184d);
+    a = mem[0x206c];
+    ACCOUNT(13, 0x1850);
+    // 1850 4f
+    c = a;
+    ACCOUNT(5, 0x1851);
+    // 1851 cd 93 0a
+    CHECK_WRITE(sp - 1, 0x1851);
+    CHECK_WRITE(sp - 2, 0x1851);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x54;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x0a93, Block0a93);
+exit:
+    LEAVE
+}
+
+static int Block1854(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1854 c1
+    CHECK_READ(sp, 0x1854);
+    CHECK_READ(sp + 1, 0x1854);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x1855);
+    // 1855 c9
+    CHECK_READ(sp, 0x1855);
+    CHECK_READ(sp + 1, 0x1855);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1856(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1856 0a
+    CHECK_READ((uint16_t)((b << 8) | c), 0x1856);
+    a = mem[(uint16_t)((b << 8) | c)];
+    ACCOUNT(7, 0x1857);
+    // 1857 fe ff
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xff];
+    ACCOUNT(7, 0x1859);
+    // 1859 37
+    f |= FlagCarry;
+    ACCOUNT(4, 0x185a);
+    // 185a c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x185a);
+        CHECK_READ(sp + 1, 0x185a);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x185b, Block185b);
+exit:
+    LEAVE
+}
+
+static int Block185b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 185b 6f
+    l = a;
+    ACCOUNT(5, 0x185c);
+    // 185c 03
+    { uint16_t v = (uint16_t)(((b << 8) | c) + 1); b = v >> 8; c = v & 0xff; }
+    ACCOUNT(5, 0x185d);
+    // 185d 0a
+    CHECK_READ((uint16_t)((b << 8) | c), 0x185d);
+    a = mem[(uint16_t)((b << 8) | c)];
+    ACCOUNT(7, 0x185e);
+    // 185e 67
+    h = a;
+    ACCOUNT(5, 0x185f);
+    // 185f 03
+    { uint16_t v = (uint16_t)(((b << 8) | c) + 1); b = v >> 8; c = v & 0xff; }
+    ACCOUNT(5, 0x1860);
+    // 1860 0a
+    CHECK_READ((uint16_t)((b << 8) | c), 0x1860);
+    a = mem[(uint16_t)((b << 8) | c)];
+    ACCOUNT(7, 0x1861);
+    // 1861 5f
+    e = a;
+    ACCOUNT(5, 0x1862);
+    // 1862 03
+    { uint16_t v = (uint16_t)(((b << 8) | c) + 1); b = v >> 8; c = v & 0xff; }
+    ACCOUNT(5, 0x1863);
+    // 1863 0a
+    CHECK_READ((uint16_t)((b << 8) | c), 0x1863);
+    a = mem[(uint16_t)((b << 8) | c)];
+    ACCOUNT(7, 0x1864);
+    // 1864 57
+    d = a;
+    ACCOUNT(5, 0x1865);
+    // 1865 03
+    { uint16_t v = (uint16_t)(((b << 8) | c) + 1); b = v >> 8; c = v & 0xff; }
+    ACCOUNT(5, 0x1866);
+    // 1866 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1867);
+    // 1867 c9
+    CHECK_READ(sp, 0x1867);
+    CHECK_READ(sp + 1, 0x1867);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1868(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1868 21 c2 20
+    h = 0x20; l = 0xc2;
+    ACCOUNT(10, 0x186b);
+    // 186b 34
+    CHECK_READ(HL, 0x186b);
+    CHECK_WRITE(HL, 0x186b);
+    { uint8_t v = (uint8_t)(mem[HL] + 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x186c);
+    // 186c 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x186d);
+    // 186d 4e
+    CHECK_READ(HL, 0x186d);
+    c = mem[HL];
+    ACCOUNT(7, 0x186e);
+    // 186e cd d9 01
+    CHECK_WRITE(sp - 1, 0x186e);
+    CHECK_WRITE(sp - 2, 0x186e);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x71;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01d9, Block01d9);
+exit:
+    LEAVE
+}
+
+static int Block1871(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1871 47
+    b = a;
+    ACCOUNT(5, 0x1872);
+    // 1872 3a ca 20
+    CHECK_READ(0x20ca, 0x1872);
+    a = mem[0x20ca];
+    ACCOUNT(13, 0x1875);
+    // 1875 b8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][b];
+    ACCOUNT(4, 0x1876);
+    // 1876 ca 98 18
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x1898, Block1898);
+    CHAIN(0x1879, Block1879);
+exit:
+    LEAVE
+}
+
+static int Block1879(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1879 3a c2 20
+    CHECK_READ(0x20c2, 0x1879);
+    a = mem[0x20c2];
+    ACCOUNT(13, 0x187c);
+    // 187c e6 04
+    a &= 0x04; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x187e);
+    // 187e 2a cc 20
+    CHECK_READ(0x20cc, 0x187e);
+    CHECK_READ(0x20cd, 0x187e);
+    l = mem[0x20cc]; h = mem[0x20cd];
+    ACCOUNT(16, 0x1881);
+    // 1881 c2 88 18
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1888, Block1888);
+    CHAIN(0x1884, Block1884);
+exit:
+    LEAVE
+}
+
+static int Block1884(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1884 11 30 00
+    d = 0x00; e = 0x30;
+    ACCOUNT(10, 0x1887);
+    // 1887 19
+    { uint32_t v = HL + ((d << 8) | e); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x1888);
+    CHAIN(0x1888, Block1888);
+exit:
+    LEAVE
+}
+
+static int Block1888(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1888 22 c7 20
+    CHECK_WRITE(0x20c7, 0x1888);
+    CHECK_WRITE(0x20c8, 0x1888);
+    mem[0x20c7] = l; mem[0x20c8] = h;
+    WRITTEN(0x20c7);
+    WRITTEN(0x20c8);
+    ACCOUNT(16, 0x188b);
+    // 188b 21 c5 20
+    h = 0x20; l = 0xc5;
+    ACCOUNT(10, 0x188e);
+    // 188e cd 3b 1a
+    CHECK_WRITE(sp - 1, 0x188e);
+    CHECK_WRITE(sp - 2, 0x188e);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x91;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a3b, Block1a3b);
+exit:
+    LEAVE
+}
+
+static int Block1891(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1891 eb
+    { uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }
+    ACCOUNT(5, 0x1892);
+    // 1892 c3 d3 15
+    cyc += 7;
+    CHAIN(0x15d3, Block15d3);
+exit:
+    LEAVE
+}
+
+static int Block1898(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1898 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x189a);
+    // 189a 32 cb 20
+    CHECK_WRITE(0x20cb, 0x189a);
+    mem[0x20cb] = a;
+    WRITTEN(0x20cb);
+    ACCOUNT(13, 0x189d);
+    // 189d c9
+    CHECK_READ(sp, 0x189d);
+    CHECK_READ(sp + 1, 0x189d);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block189e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 189e 21 50 20
+    h = 0x20; l = 0x50;
+    ACCOUNT(10, 0x18a1);
+    // 18a1 11 c0 1b
+    d = 0x1b; e = 0xc0;
+    ACCOUNT(10, 0x18a4);
+    // 18a4 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x18a6);
+    // 18a6 cd 32 1a
+    CHECK_WRITE(sp - 1, 0x18a6);
+    CHECK_WRITE(sp - 2, 0x18a6);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xa9;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a32, Block1a32);
+exit:
+    LEAVE
+}
+
+static int Block18a9(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18a9 3e 02
+    a = 0x02;
+    ACCOUNT(7, 0x18ab);
+    // 18ab 32 80 20
+    CHECK_WRITE(0x2080, 0x18ab);
+    mem[0x2080] = a;
+    WRITTEN(0x2080);
+    ACCOUNT(13, 0x18ae);
+    // 18ae 3e ff
+    a = 0xff;
+    ACCOUNT(7, 0x18b0);
+    // 18b0 32 7e 20
+    CHECK_WRITE(0x207e, 0x18b0);
+    mem[0x207e] = a;
+    WRITTEN(0x207e);
+    ACCOUNT(13, 0x18b3);
+    // 18b3 3e 04
+    a = 0x04;
+    ACCOUNT(7, 0x18b5);
+    // 18b5 32 c1 20
+    CHECK_WRITE(0x20c1, 0x18b5);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x18b8);
+    CHAIN(0x18b8, Block18b8);
+exit:
+    LEAVE
+}
+
+static int Block18b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18b8 3a 55 20
+    CHECK_READ(0x2055, 0x18b8);
+    a = mem[0x2055];
+    ACCOUNT(13, 0x18bb);
+    // 18bb e6 01
+    a &= 0x01; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x18bd);
+    // 18bd ca b8 18
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x18b8, Block18b8);
+    CHAIN(0x18c0, Block18c0);
+exit:
+    LEAVE
+}
+
+static int Block18c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18c0 3a 55 20
+    CHECK_READ(0x2055, 0x18c0);
+    a = mem[0x2055];
+    ACCOUNT(13, 0x18c3);
+    // 18c3 e6 01
+    a &= 0x01; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x18c5);
+    // 18c5 c2 c0 18
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x18c0, Block18c0);
+    CHAIN(0x18c8, Block18c8);
+exit:
+    LEAVE
+}
+
+static int Block18c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18c8 21 11 33
+    h = 0x33; l = 0x11;
+    ACCOUNT(10, 0x18cb);
+    // 18cb 3e 26
+    a = 0x26;
+    ACCOUNT(7, 0x18cd);
+    // 18cd 00
+    ACCOUNT(4, 0x18ce);
+    // 18ce cd ff 08
+    CHECK_WRITE(sp - 1, 0x18ce);
+    CHECK_WRITE(sp - 2, 0x18ce);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xd1;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x08ff, Block08ff);
+exit:
+    LEAVE
+}
+
+static int Block18d1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18d1 c3 b6 0a
+    cyc += 7;
+    CHAIN(0x0ab6, Block0ab6);
+exit:
+    LEAVE
+}
+
+static int Block18d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18d4 31 00 24
+    sp = 0x2400;
+    ACCOUNT(10, 0x18d7);
+    // 18d7 06 00
+    b = 0x00;
+    ACCOUNT(7, 0x18d9);
+    // 18d9 cd e6 01
+    CHECK_WRITE(sp - 1, 0x18d9);
+    CHECK_WRITE(sp - 2, 0x18d9);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xdc;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x01e6, Block01e6);
+exit:
+    LEAVE
+}
+
+static int Block18dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18dc cd 56 19
+    CHECK_WRITE(sp - 1, 0x18dc);
+    CHECK_WRITE(sp - 2, 0x18dc);
+    mem[(uint16_t)(sp - 1)] = 0x18;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xdf;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1956, Block1956);
+exit:
+    LEAVE
+}
+
+static int Block18df(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18df 3e 08
+    a = 0x08;
+    ACCOUNT(7, 0x18e1);
+    // 18e1 32 cf 20
+    CHECK_WRITE(0x20cf, 0x18e1);
+    mem[0x20cf] = a;
+    WRITTEN(0x20cf);
+    ACCOUNT(13, 0x18e4);
+    // 18e4 c3 ea 0a
+    cyc += 7;
+    CHAIN(0x0aea, Block0aea);
+exit:
+    LEAVE
+}
+
+static int Block18e7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18e7 3a 67 20
+    CHECK_READ(0x2067, 0x18e7);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x18ea);
+    // 18ea 21 e7 20
+    h = 0x20; l = 0xe7;
+    ACCOUNT(10, 0x18ed);
+    // 18ed 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x18ee);
+    // 18ee d0
+    if (!(f & FlagCarry)) {
+        CHECK_READ(sp, 0x18ee);
+        CHECK_READ(sp + 1, 0x18ee);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x18ef, Block18ef);
+exit:
+    LEAVE
+}
+
+static int Block18ef(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18ef 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x18f0);
+    // 18f0 c9
+    CHECK_READ(sp, 0x18f0);
+    CHECK_READ(sp + 1, 0x18f0);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block18f1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18f1 06 02
+    b = 0x02;
+    ACCOUNT(7, 0x18f3);
+    // 18f3 3a 82 20
+    CHECK_READ(0x2082, 0x18f3);
+    a = mem[0x2082];
+    ACCOUNT(13, 0x18f6);
+    // 18f6 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x18f7);
+    // 18f7 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x18f7);
+        CHECK_READ(sp + 1, 0x18f7);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x18f8, Block18f8);
+exit:
+    LEAVE
+}
+
+static int Block18f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18f8 04
+    b = (uint8_t)(b + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[b];
+    ACCOUNT(5, 0x18f9);
+    // 18f9 c9
+    CHECK_READ(sp, 0x18f9);
+    CHECK_READ(sp + 1, 0x18f9);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block18fa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 18fa 3a 94 20
+    CHECK_READ(0x2094, 0x18fa);
+    a = mem[0x2094];
+    ACCOUNT(13, 0x18fd);
+    // 18fd b0
+    a |= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x18fe);
+    // 18fe 32 94 20
+    CHECK_WRITE(0x2094, 0x18fe);
+    mem[0x2094] = a;
+    WRITTEN(0x2094);
+    ACCOUNT(13, 0x1901);
+    EXIT(0x1901);
+exit:
+    LEAVE
+}
+
+static int Block1903(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1903 c9
+    CHECK_READ(sp, 0x1903);
+    CHECK_READ(sp + 1, 0x1903);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1904(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1904 21 00 22
+    h = 0x22; l = 0x00;
+    ACCOUNT(10, 0x1907);
+    // 1907 c3 c3 01
+    cyc += 7;
+    CHAIN(0x01c3, Block01c3);
+exit:
+    LEAVE
+}
+
+static int Block190a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 190a cd d8 14
+    CHECK_WRITE(sp - 1, 0x190a);
+    CHECK_WRITE(sp - 2, 0x190a);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x0d;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x14d8, Block14d8);
+exit:
+    LEAVE
+}
+
+static int Block190d(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 190d c3 97 15
+    cyc += 7;
+    CHAIN(0x1597, Block1597);
+exit:
+    LEAVE
+}
+
+static int Block1910(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1910 21 e7 20
+    h = 0x20; l = 0xe7;
+    ACCOUNT(10, 0x1913);
+    // 1913 3a 67 20
+    CHECK_READ(0x2067, 0x1913);
+    a = mem[0x2067];
+    ACCOUNT(13, 0x1916);
+    // 1916 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1917);
+    // 1917 d8
+    if ((f & FlagCarry)) {
+        CHECK_READ(sp, 0x1917);
+        CHECK_READ(sp + 1, 0x1917);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x1918, Block1918);
+exit:
+    LEAVE
+}
+
+static int Block1918(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1918 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1919);
+    // 1919 c9
+    CHECK_READ(sp, 0x1919);
+    CHECK_READ(sp + 1, 0x1919);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block191a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 191a 0e 1c
+    c = 0x1c;
+    ACCOUNT(7, 0x191c);
+    // 191c 21 1e 24
+    h = 0x24; l = 0x1e;
+    ACCOUNT(10, 0x191f);
+    // 191f 11 e4 1a
+    d = 0x1a; e = 0xe4;
+    ACCOUNT(10, 0x1922);
+    // 1922 c3 f3 08
+    cyc += 7;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block1925(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1925 21 f8 20
+    h = 0x20; l = 0xf8;
+    ACCOUNT(10, 0x1928);
+    // 1928 c3 31 19
+    cyc += 7;
+    CHAIN(0x1931, Block1931);
+exit:
+    LEAVE
+}
+
+static int Block192b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 192b 21 fc 20
+    h = 0x20; l = 0xfc;
+    ACCOUNT(10, 0x192e);
+    // 192e c3 31 19
+    cyc += 7;
+    CHAIN(0x1931, Block1931);
+exit:
+    LEAVE
+}
+
+static int Block1931(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1931 5e
+    CHECK_READ(HL, 0x1931);
+    e = mem[HL];
+    ACCOUNT(7, 0x1932);
+    // 1932 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1933);
+    // 1933 56
+    CHECK_READ(HL, 0x1933);
+    d = mem[HL];
+    ACCOUNT(7, 0x1934);
+    // 1934 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1935);
+    // 1935 7e
+    CHECK_READ(HL, 0x1935);
+    a = mem[HL];
+    ACCOUNT(7, 0x1936);
+    // 1936 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1937);
+    // 1937 66
+    CHECK_READ(HL, 0x1937);
+    h = mem[HL];
+    ACCOUNT(7, 0x1938);
+    // 1938 6f
+    l = a;
+    ACCOUNT(5, 0x1939);
+    // 1939 c3 ad 09
+    cyc += 7;
+    CHAIN(0x09ad, Block09ad);
+exit:
+    LEAVE
+}
+
+static int Block193c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 193c 0e 07
+    c = 0x07;
+    ACCOUNT(7, 0x193e);
+    // 193e 21 01 35
+    h = 0x35; l = 0x01;
+    ACCOUNT(10, 0x1941);
+    // 1941 11 a9 1f
+    d = 0x1f; e = 0xa9;
+    ACCOUNT(10, 0x1944);
+    // 1944 c3 f3 08
+    cyc += 7;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block1947(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1947 3a eb 20
+    CHECK_READ(0x20eb, 0x1947);
+    a = mem[0x20eb];
+    ACCOUNT(13, 0x194a);
+    // 194a 21 01 3c
+    h = 0x3c; l = 0x01;
+    ACCOUNT(10, 0x194d);
+    // 194d c3 b2 09
+    cyc += 7;
+    CHAIN(0x09b2, Block09b2);
+exit:
+    LEAVE
+}
+
+static int Block1950(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1950 21 f4 20
+    h = 0x20; l = 0xf4;
+    ACCOUNT(10, 0x1953);
+    // 1953 c3 31 19
+    cyc += 7;
+    CHAIN(0x1931, Block1931);
+exit:
+    LEAVE
+}
+
+static int Block1956(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1956 cd 5c 1a
+    CHECK_WRITE(sp - 1, 0x1956);
+    CHECK_WRITE(sp - 2, 0x1956);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x59;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1a5c, Block1a5c);
+exit:
+    LEAVE
+}
+
+static int Block1959(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1959 cd 1a 19
+    CHECK_WRITE(sp - 1, 0x1959);
+    CHECK_WRITE(sp - 2, 0x1959);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x5c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x191a, Block191a);
+exit:
+    LEAVE
+}
+
+static int Block195c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 195c cd 25 19
+    CHECK_WRITE(sp - 1, 0x195c);
+    CHECK_WRITE(sp - 2, 0x195c);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x5f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1925, Block1925);
+exit:
+    LEAVE
+}
+
+static int Block195f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 195f cd 2b 19
+    CHECK_WRITE(sp - 1, 0x195f);
+    CHECK_WRITE(sp - 2, 0x195f);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x62;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x192b, Block192b);
+exit:
+    LEAVE
+}
+
+static int Block1962(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1962 cd 50 19
+    CHECK_WRITE(sp - 1, 0x1962);
+    CHECK_WRITE(sp - 2, 0x1962);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x65;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1950, Block1950);
+exit:
+    LEAVE
+}
+
+static int Block1965(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1965 cd 3c 19
+    CHECK_WRITE(sp - 1, 0x1965);
+    CHECK_WRITE(sp - 2, 0x1965);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x68;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x193c, Block193c);
+exit:
+    LEAVE
+}
+
+static int Block1968(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1968 c3 47 19
+    cyc += 7;
+    CHAIN(0x1947, Block1947);
+exit:
+    LEAVE
+}
+
+static int Block196b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 196b cd dc 19
+    CHECK_WRITE(sp - 1, 0x196b);
+    CHECK_WRITE(sp - 2, 0x196b);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x6e;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19dc, Block19dc);
+exit:
+    LEAVE
+}
+
+static int Block196e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 196e c3 71 16
+    cyc += 7;
+    CHAIN(0x1671, Block1671);
+exit:
+    LEAVE
+}
+
+static int Block1971(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1971 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x1973);
+    // 1973 32 6d 20
+    CHECK_WRITE(0x206d, 0x1973);
+    mem[0x206d] = a;
+    WRITTEN(0x206d);
+    ACCOUNT(13, 0x1976);
+    // 1976 c3 e6 16
+    cyc += 7;
+    CHAIN(0x16e6, Block16e6);
+exit:
+    LEAVE
+}
+
+static int Block1979(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1979 cd d7 19
+    CHECK_WRITE(sp - 1, 0x1979);
+    CHECK_WRITE(sp - 2, 0x1979);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19d7, Block19d7);
+exit:
+    LEAVE
+}
+
+static int Block197c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 197c cd 47 19
+    CHECK_WRITE(sp - 1, 0x197c);
+    CHECK_WRITE(sp - 2, 0x197c);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x7f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1947, Block1947);
+exit:
+    LEAVE
+}
+
+static int Block197f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 197f c3 3c 19
+    cyc += 7;
+    CHAIN(0x193c, Block193c);
+exit:
+    LEAVE
+}
+
+static int Block1982(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1982 32 c1 20
+    CHECK_WRITE(0x20c1, 0x1982);
+    mem[0x20c1] = a;
+    WRITTEN(0x20c1);
+    ACCOUNT(13, 0x1985);
+    // 1985 c9
+    CHECK_READ(sp, 0x1985);
+    CHECK_READ(sp + 1, 0x1985);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1988(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1988 c3 d6 09
+    cyc += 7;
+    CHAIN(0x09d6, Block09d6);
+exit:
+    LEAVE
+}
+
+static int Block199a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 199a 3a 1e 20
+    CHECK_READ(0x201e, 0x199a);
+    a = mem[0x201e];
+    ACCOUNT(13, 0x199d);
+    // 199d a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x199e);
+    // 199e c2 ac 19
+    cyc += 10;
+    if (!(f & FlagZero)) EXIT(0x19ac);
+    EXIT(0x19a1);
+exit:
+    LEAVE
+}
+
+static int Block19a3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19a3 e6 76
+    a &= 0x76; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x19a5);
+    // 19a5 d6 72
+    { uint8_t v = 0x72; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x19a7);
+    // 19a7 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x19a7);
+        CHECK_READ(sp + 1, 0x19a7);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x19a8, Block19a8);
+exit:
+    LEAVE
+}
+
+static int Block19a8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19a8 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x19a9);
+    // 19a9 32 1e 20
+    CHECK_WRITE(0x201e, 0x19a9);
+    mem[0x201e] = a;
+    WRITTEN(0x201e);
+    ACCOUNT(13, 0x19ac);
+    EXIT(0x19ac);
+exit:
+    LEAVE
+}
+
+static int Block19ae(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19ae e6 76
+    a &= 0x76; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x19b0);
+    // 19b0 fe 34
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x34];
+    ACCOUNT(7, 0x19b2);
+    // 19b2 c0
+    if (!(f & FlagZero)) {
+        CHECK_READ(sp, 0x19b2);
+        CHECK_READ(sp + 1, 0x19b2);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x19b3, Block19b3);
+exit:
+    LEAVE
+}
+
+static int Block19b3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19b3 21 1b 2e
+    h = 0x2e; l = 0x1b;
+    ACCOUNT(10, 0x19b6);
+    // 19b6 11 f7 0b
+    d = 0x0b; e = 0xf7;
+    ACCOUNT(10, 0x19b9);
+    // 19b9 0e 09
+    c = 0x09;
+    ACCOUNT(7, 0x19bb);
+    // 19bb c3 f3 08
+    cyc += 7;
+    CHAIN(0x08f3, Block08f3);
+exit:
+    LEAVE
+}
+
+static int Block19d1(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19d1 3e 01
+    a = 0x01;
+    ACCOUNT(7, 0x19d3);
+    CHAIN(0x19d3, Block19d3);
+exit:
+    LEAVE
+}
+
+static int Block19d3(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19d3 32 e9 20
+    CHECK_WRITE(0x20e9, 0x19d3);
+    mem[0x20e9] = a;
+    WRITTEN(0x20e9);
+    ACCOUNT(13, 0x19d6);
+    // 19d6 c9
+    CHECK_READ(sp, 0x19d6);
+    CHECK_READ(sp + 1, 0x19d6);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block19d7(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19d7 af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x19d8);
+    // 19d8 c3 d3 19
+    cyc += 7;
+    CHAIN(0x19d3, Block19d3);
+exit:
+    LEAVE
+}
+
+static int Block19dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19dc 3a 94 20
+    CHECK_READ(0x2094, 0x19dc);
+    a = mem[0x2094];
+    ACCOUNT(13, 0x19df);
+    // 19df a0
+    a &= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x19e0);
+    // 19e0 32 94 20
+    CHECK_WRITE(0x2094, 0x19e0);
+    mem[0x2094] = a;
+    WRITTEN(0x2094);
+    ACCOUNT(13, 0x19e3);
+    EXIT(0x19e3);
+exit:
+    LEAVE
+}
+
+static int Block19e5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19e5 c9
+    CHECK_READ(sp, 0x19e5);
+    CHECK_READ(sp + 1, 0x19e5);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block19e6(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19e6 21 01 27
+    h = 0x27; l = 0x01;
+    ACCOUNT(10, 0x19e9);
+    // 19e9 ca fa 19
+    cyc += 10;
+    if ((f & FlagZero)) CHAIN(0x19fa, Block19fa);
+    CHAIN(0x19ec, Block19ec);
+exit:
+    LEAVE
+}
+
+static int Block19ec(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19ec 11 60 1c
+    d = 0x1c; e = 0x60;
+    ACCOUNT(10, 0x19ef);
+    // 19ef 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x19f1);
+    // 19f1 4f
+    c = a;
+    ACCOUNT(5, 0x19f2);
+    // 19f2 cd 39 14
+    CHECK_WRITE(sp - 1, 0x19f2);
+    CHECK_WRITE(sp - 2, 0x19f2);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xf5;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x1439, Block1439);
+exit:
+    LEAVE
+}
+
+static int Block19f5(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19f5 79
+    a = c;
+    ACCOUNT(5, 0x19f6);
+    // 19f6 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x19f7);
+    // 19f7 c2 ec 19
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x19ec, Block19ec);
+    CHAIN(0x19fa, Block19fa);
+exit:
+    LEAVE
+}
+
+static int Block19fa(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19fa 06 10
+    b = 0x10;
+    ACCOUNT(7, 0x19fc);
+    // 19fc cd cb 14
+    CHECK_WRITE(sp - 1, 0x19fc);
+    CHECK_WRITE(sp - 2, 0x19fc);
+    mem[(uint16_t)(sp - 1)] = 0x19;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0xff;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x14cb, Block14cb);
+exit:
+    LEAVE
+}
+
+static int Block19ff(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 19ff 7c
+    a = h;
+    ACCOUNT(5, 0x1a00);
+    // 1a00 fe 35
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x35];
+    ACCOUNT(7, 0x1a02);
+    // 1a02 c2 fa 19
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x19fa, Block19fa);
+    CHAIN(0x1a05, Block1a05);
+exit:
+    LEAVE
+}
+
+static int Block1a05(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a05 c9
+    CHECK_READ(sp, 0x1a05);
+    CHECK_READ(sp + 1, 0x1a05);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a32(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a32 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x1a32);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x1a33);
+    // 1a33 77
+    CHECK_WRITE(HL, 0x1a33);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x1a34);
+    // 1a34 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a35);
+    // 1a35 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1a36);
+    // 1a36 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1a37);
+    // 1a37 c2 32 1a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1a32, Block1a32);
+    CHAIN(0x1a3a, Block1a3a);
+exit:
+    LEAVE
+}
+
+static int Block1a3a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a3a c9
+    CHECK_READ(sp, 0x1a3a);
+    CHECK_READ(sp + 1, 0x1a3a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a3b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a3b 5e
+    CHECK_READ(HL, 0x1a3b);
+    e = mem[HL];
+    ACCOUNT(7, 0x1a3c);
+    // 1a3c 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a3d);
+    // 1a3d 56
+    CHECK_READ(HL, 0x1a3d);
+    d = mem[HL];
+    ACCOUNT(7, 0x1a3e);
+    // 1a3e 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a3f);
+    // 1a3f 7e
+    CHECK_READ(HL, 0x1a3f);
+    a = mem[HL];
+    ACCOUNT(7, 0x1a40);
+    // 1a40 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a41);
+    // 1a41 4e
+    CHECK_READ(HL, 0x1a41);
+    c = mem[HL];
+    ACCOUNT(7, 0x1a42);
+    // 1a42 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a43);
+    // 1a43 46
+    CHECK_READ(HL, 0x1a43);
+    b = mem[HL];
+    ACCOUNT(7, 0x1a44);
+    // 1a44 61
+    h = c;
+    ACCOUNT(5, 0x1a45);
+    // 1a45 6f
+    l = a;
+    ACCOUNT(5, 0x1a46);
+    // 1a46 c9
+    CHECK_READ(sp, 0x1a46);
+    CHECK_READ(sp + 1, 0x1a46);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a47(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a47 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1a47);
+    CHECK_WRITE(sp - 1, 0x1a47);
+    CHECK_WRITE(sp - 2, 0x1a47);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1a48);
+    // 1a48 06 03
+    b = 0x03;
+    ACCOUNT(7, 0x1a4a);
+    CHAIN(0x1a4a, Block1a4a);
+exit:
+    LEAVE
+}
+
+static int Block1a4a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a4a 7c
+    a = h;
+    ACCOUNT(5, 0x1a4b);
+    // 1a4b 1f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (((f >> 3) & 1) << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1a4c);
+    // 1a4c 67
+    h = a;
+    ACCOUNT(5, 0x1a4d);
+    // 1a4d 7d
+    a = l;
+    ACCOUNT(5, 0x1a4e);
+    // 1a4e 1f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (((f >> 3) & 1) << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x1a4f);
+    // 1a4f 6f
+    l = a;
+    ACCOUNT(5, 0x1a50);
+    // 1a50 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1a51);
+    // 1a51 c2 4a 1a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1a4a, Block1a4a);
+    CHAIN(0x1a54, Block1a54);
+exit:
+    LEAVE
+}
+
+static int Block1a54(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a54 7c
+    a = h;
+    ACCOUNT(5, 0x1a55);
+    // 1a55 e6 3f
+    a &= 0x3f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1a57);
+    // 1a57 f6 20
+    a |= 0x20; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x1a59);
+    // 1a59 67
+    h = a;
+    ACCOUNT(5, 0x1a5a);
+    // 1a5a c1
+    CHECK_READ(sp, 0x1a5a);
+    CHECK_READ(sp + 1, 0x1a5a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x1a5b);
+    // 1a5b c9
+    CHECK_READ(sp, 0x1a5b);
+    CHECK_READ(sp + 1, 0x1a5b);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a5c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a5c 21 00 24
+    h = 0x24; l = 0x00;
+    ACCOUNT(10, 0x1a5f);
+    CHAIN(0x1a5f, Block1a5f);
+exit:
+    LEAVE
+}
+
+static int Block1a5f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a5f 36 00
+    CHECK_WRITE(HL, 0x1a5f);
+    mem[HL] = 0x00;
+    WRITTEN(HL);
+    ACCOUNT(10, 0x1a61);
+    // 1a61 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a62);
+    // 1a62 7c
+    a = h;
+    ACCOUNT(5, 0x1a63);
+    // 1a63 fe 40
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x40];
+    ACCOUNT(7, 0x1a65);
+    // 1a65 c2 5f 1a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1a5f, Block1a5f);
+    CHAIN(0x1a68, Block1a68);
+exit:
+    LEAVE
+}
+
+static int Block1a68(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a68 c9
+    CHECK_READ(sp, 0x1a68);
+    CHECK_READ(sp + 1, 0x1a68);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a69(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a69 c5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1a69);
+    CHECK_WRITE(sp - 1, 0x1a69);
+    CHECK_WRITE(sp - 2, 0x1a69);
+    mem[(uint16_t)(sp - 1)] = b;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = c;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1a6a);
+    // 1a6a e5
+    if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x1a6a);
+    CHECK_WRITE(sp - 1, 0x1a6a);
+    CHECK_WRITE(sp - 2, 0x1a6a);
+    mem[(uint16_t)(sp - 1)] = h;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = l;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1a6b);
+    CHAIN(0x1a6b, Block1a6b);
+exit:
+    LEAVE
+}
+
+static int Block1a6b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a6b 1a
+    CHECK_READ((uint16_t)((d << 8) | e), 0x1a6b);
+    a = mem[(uint16_t)((d << 8) | e)];
+    ACCOUNT(7, 0x1a6c);
+    // 1a6c b6
+    CHECK_READ(HL, 0x1a6c);
+    a |= mem[HL]; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1a6d);
+    // 1a6d 77
+    CHECK_WRITE(HL, 0x1a6d);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x1a6e);
+    // 1a6e 13
+    { uint16_t v = (uint16_t)(((d << 8) | e) + 1); d = v >> 8; e = v & 0xff; }
+    ACCOUNT(5, 0x1a6f);
+    // 1a6f 23
+    { uint16_t v = (uint16_t)(((h << 8) | l) + 1); h = v >> 8; l = v & 0xff; }
+    ACCOUNT(5, 0x1a70);
+    // 1a70 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x1a71);
+    // 1a71 c2 6b 1a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1a6b, Block1a6b);
+    CHAIN(0x1a74, Block1a74);
+exit:
+    LEAVE
+}
+
+static int Block1a74(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a74 e1
+    CHECK_READ(sp, 0x1a74);
+    CHECK_READ(sp + 1, 0x1a74);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    h = high; l = low; }
+    ACCOUNT(10, 0x1a75);
+    // 1a75 01 20 00
+    b = 0x00; c = 0x20;
+    ACCOUNT(10, 0x1a78);
+    // 1a78 09
+    { uint32_t v = HL + ((b << 8) | c); f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }
+    ACCOUNT(10, 0x1a79);
+    // 1a79 c1
+    CHECK_READ(sp, 0x1a79);
+    CHECK_READ(sp + 1, 0x1a79);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    b = high; c = low; }
+    ACCOUNT(10, 0x1a7a);
+    // 1a7a 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x1a7b);
+    // 1a7b c2 69 1a
+    cyc += 10;
+    if (!(f & FlagZero)) CHAIN(0x1a69, Block1a69);
+    CHAIN(0x1a7e, Block1a7e);
+exit:
+    LEAVE
+}
+
+static int Block1a7e(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a7e c9
+    CHECK_READ(sp, 0x1a7e);
+    CHECK_READ(sp + 1, 0x1a7e);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    pc = (uint16_t)((high << 8) | low); }
+    cyc += 10;
+    goto exit;
+exit:
+    LEAVE
+}
+
+static int Block1a7f(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a7f cd 2e 09
+    CHECK_WRITE(sp - 1, 0x1a7f);
+    CHECK_WRITE(sp - 2, 0x1a7f);
+    mem[(uint16_t)(sp - 1)] = 0x1a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x82;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x092e, Block092e);
+exit:
+    LEAVE
+}
+
+static int Block1a82(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a82 a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x1a83);
+    // 1a83 c8
+    if ((f & FlagZero)) {
+        CHECK_READ(sp, 0x1a83);
+        CHECK_READ(sp + 1, 0x1a83);
+        { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+        pc = (uint16_t)((high << 8) | low); }
+        cyc += 11;
+        goto exit;
+    }
+    cyc += 5;
+    CHAIN(0x1a84, Block1a84);
+exit:
+    LEAVE
+}
+
+static int Block1a84(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a84 f5
+    CHECK_WRITE(sp - 1, 0x1a84);
+    CHECK_WRITE(sp - 2, 0x1a84);
+    mem[(uint16_t)(sp - 1)] = a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = (uint8_t)f;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    ACCOUNT(11, 0x1a85);
+    // 1a85 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x1a86);
+    // 1a86 77
+    CHECK_WRITE(HL, 0x1a86);
+    mem[HL] = a;
+    WRITTEN(HL);
+    ACCOUNT(7, 0x1a87);
+    // 1a87 cd e6 19
+    CHECK_WRITE(sp - 1, 0x1a87);
+    CHECK_WRITE(sp - 2, 0x1a87);
+    mem[(uint16_t)(sp - 1)] = 0x1a;
+    WRITTEN(sp - 1);
+    mem[(uint16_t)(sp - 2)] = 0x8a;
+    WRITTEN(sp - 2);
+    sp -= 2;
+    cyc += 17;
+    CHAIN(0x19e6, Block19e6);
+exit:
+    LEAVE
+}
+
+static int Block1a8a(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a8a f1
+    CHECK_READ(sp, 0x1a8a);
+    CHECK_READ(sp + 1, 0x1a8a);
+    { uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;
+    a = high; f = (f & 0xff00) | low; }
+    ACCOUNT(10, 0x1a8b);
+    if (!(f & (1 << 6))) EXIT(0x1a8b);
+    CHAIN(0x1a8b, Block1a8b);
+exit:
+    LEAVE
+}
+
+static int Block1a8b(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 1a8b 21 01 25
+    h = 0x25; l = 0x01;
+    ACCOUNT(10, 0x1a8e);
+    // 1a8e e6 0f
+    a &= 0x0f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x1a90);
+    // 1a90 c3 c5 09
+    cyc += 7;
+    CHAIN(0x09c5, Block09c5);
+exit:
+    LEAVE
+}
+
+static const uint8_t image[0x2000] = {
+    0x00, 0x00, 0x00, 0xc3, 0xd4, 0x18, 0x00, 0x00, 0xf5, 0xc5, 0xd5, 0xe5, 0xc3, 0x8c, 0x00, 0x00,
+    0xf5, 0xc5, 0xd5, 0xe5, 0x3e, 0x80, 0x32, 0x72, 0x20, 0x21, 0xc0, 0x20, 0x35, 0xcd, 0xcd, 0x17,
+    0xdb, 0x01, 0x0f, 0xda, 0x67, 0x00, 0x3a, 0xea, 0x20, 0xa7, 0xca, 0x42, 0x00, 0x3a, 0xeb, 0x20,
+    0xfe, 0x99, 0xca, 0x3e, 0x00, 0xc6, 0x01, 0x27, 0x32, 0xeb, 0x20, 0xcd, 0x47, 0x19, 0xaf, 0x32,
+    0xea, 0x20, 0x3a, 0xe9, 0x20, 0xa7, 0xca, 0x82, 0x00, 0x3a, 0xef, 0x20, 0xa7, 0xc2, 0x6f, 0x00,
+    0x3a, 0xeb, 0x20, 0xa7, 0xc2, 0x5d, 0x00, 0xcd, 0xbf, 0x0a, 0xc3, 0x82, 0x00, 0x3a, 0x93, 0x20,
+    0xa7, 0xc2, 0x82, 0x00, 0xc3, 0x65, 0x07, 0x3e, 0x01, 0x32, 0xea, 0x20, 0xc3, 0x3f, 0x00, 0xcd,
+    0x40, 0x17, 0x3a, 0x32, 0x20, 0x32, 0x80, 0x20, 0xcd, 0x00, 0x01, 0xcd, 0x48, 0x02, 0xcd, 0x13,
+    0x09, 0x00, 0xe1, 0xd1, 0xc1, 0xf1, 0xfb, 0xc9, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x32, 0x72, 0x20,
+    0x3a, 0xe9, 0x20, 0xa7, 0xca, 0x82, 0x00, 0x3a, 0xef, 0x20, 0xa7, 0xc2, 0xa5, 0x00, 0x3a, 0xc1,
+    0x20, 0x0f, 0xd2, 0x82, 0x00, 0x21, 0x20, 0x20, 0xcd, 0x4b, 0x02, 0xcd, 0x41, 0x01, 0xc3, 0x82,
+    0x00, 0xcd, 0x86, 0x08, 0xe5, 0x7e, 0x23, 0x66, 0x6f, 0x22, 0x09, 0x20, 0x22, 0x0b, 0x20, 0xe1,
+    0x2b, 0x7e, 0xfe, 0x03, 0xc2, 0xc8, 0x00, 0x3d, 0x32, 0x08, 0x20, 0xfe, 0xfe, 0x3e, 0x00, 0xc2,
+    0xd3, 0x00, 0x3c, 0x32, 0x0d, 0x20, 0xc9, 0x3e, 0x02, 0x32, 0xfb, 0x21, 0x32, 0xfb, 0x22, 0xc3,
+    0xe4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x02, 0x20, 0x7e, 0xa7, 0xc2, 0x38, 0x15, 0xe5, 0x3a, 0x06, 0x20, 0x6f, 0x3a, 0x67, 0x20,
+    0x67, 0x7e, 0xa7, 0xe1, 0xca, 0x36, 0x01, 0x23, 0x23, 0x7e, 0x23, 0x46, 0xe6, 0xfe, 0x07, 0x07,
+    0x07, 0x5f, 0x16, 0x00, 0x21, 0x00, 0x1c, 0x19, 0xeb, 0x78, 0xa7, 0xc4, 0x3b, 0x01, 0x2a, 0x0b,
+    0x20, 0x06, 0x10, 0xcd, 0xd3, 0x15, 0xaf, 0x32, 0x00, 0x20, 0xc9, 0x21, 0x30, 0x00, 0x19, 0xeb,
+    0xc9, 0x3a, 0x68, 0x20, 0xa7, 0xc8, 0x3a, 0x00, 0x20, 0xa7, 0xc0, 0x3a, 0x67, 0x20, 0x67, 0x3a,
+    0x06, 0x20, 0x16, 0x02, 0x3c, 0xfe, 0x37, 0xcc, 0xa1, 0x01, 0x6f, 0x46, 0x05, 0xc2, 0x54, 0x01,
+    0x32, 0x06, 0x20, 0xcd, 0x7a, 0x01, 0x61, 0x22, 0x0b, 0x20, 0x7d, 0xfe, 0x28, 0xda, 0x71, 0x19,
+    0x7a, 0x32, 0x04, 0x20, 0x3e, 0x01, 0x32, 0x00, 0x20, 0xc9, 0x16, 0x00, 0x7d, 0x21, 0x09, 0x20,
+    0x46, 0x23, 0x4e, 0xfe, 0x0b, 0xfa, 0x94, 0x01, 0xde, 0x0b, 0x5f, 0x78, 0xc6, 0x10, 0x47, 0x7b,
+    0x14, 0xc3, 0x83, 0x01, 0x68, 0xa7, 0xc8, 0x5f, 0x79, 0xc6, 0x10, 0x4f, 0x7b, 0x3d, 0xc3, 0x95,
+    0x01, 0x15, 0xca, 0xcd, 0x01, 0x21, 0x06, 0x20, 0x36, 0x00, 0x23, 0x4e, 0x36, 0x00, 0xcd, 0xd9,
+    0x01, 0x21, 0x05, 0x20, 0x7e, 0x3c, 0xe6, 0x01, 0x77, 0xaf, 0x21, 0x67, 0x20, 0x66, 0xc9, 0x00,
+    0x21, 0x00, 0x21, 0x06, 0x37, 0x36, 0x01, 0x23, 0x05, 0xc2, 0xc5, 0x01, 0xc9, 0xe1, 0xc9, 0x3e,
+    0x01, 0x06, 0xe0, 0x21, 0x02, 0x24, 0xc3, 0xcc, 0x14, 0x23, 0x46, 0x23, 0x79, 0x86, 0x77, 0x23,
+    0x78, 0x86, 0x77, 0xc9, 0x06, 0xc0, 0x11, 0x00, 0x1b, 0x21, 0x00, 0x20, 0xc3, 0x32, 0x1a, 0x21,
+    0x42, 0x21, 0xc3, 0xf8, 0x01, 0x21, 0x42, 0x22, 0x0e, 0x04, 0x11, 0x20, 0x1d, 0xd5, 0x06, 0x2c,
+    0xcd, 0x32, 0x1a, 0xd1, 0x0d, 0xc2, 0xfd, 0x01, 0xc9, 0x3e, 0x01, 0xc3, 0x1b, 0x02, 0x3e, 0x01,
+    0xc3, 0x14, 0x02, 0xaf, 0x11, 0x42, 0x22, 0xc3, 0x1e, 0x02, 0xaf, 0x11, 0x42, 0x21, 0x32, 0x81,
+    0x20, 0x01, 0x02, 0x16, 0x21, 0x06, 0x28, 0x3e, 0x04, 0xf5, 0xc5, 0x3a, 0x81, 0x20, 0xa7, 0xc2,
+    0x42, 0x02, 0xcd, 0x69, 0x1a, 0xc1, 0xf1, 0x3d, 0xc8, 0xd5, 0x11, 0xe0, 0x02, 0x19, 0xd1, 0xc3,
+    0x29, 0x02, 0xcd, 0x7c, 0x14, 0xc3, 0x35, 0x02, 0x21, 0x10, 0x20, 0x7e, 0xfe, 0xff, 0xc8, 0xfe,
+    0xfe, 0xca, 0x81, 0x02, 0x23, 0x46, 0x4f, 0xb0, 0x79, 0xc2, 0x77, 0x02, 0x23, 0x7e, 0xa7, 0xc2,
+    0x88, 0x02, 0x23, 0x5e, 0x23, 0x56, 0xe5, 0xeb, 0xe5, 0x21, 0x6f, 0x02, 0xe3, 0xd5, 0xe9, 0xe1,
+    0x11, 0x0c, 0x00, 0x19, 0xc3, 0x4b, 0x02, 0x05, 0x04, 0xc2, 0x7d, 0x02, 0x3d, 0x05, 0x70, 0x2b,
+    0x77, 0x11, 0x10, 0x00, 0x19, 0xc3, 0x4b, 0x02, 0x35, 0x2b, 0x2b, 0xc3, 0x81, 0x02, 0xe1, 0x23,
+    0x7e, 0xfe, 0xff, 0xca, 0x3b, 0x03, 0x23, 0x35, 0xc0, 0x47, 0xaf, 0x32, 0x68, 0x20, 0x32, 0x69,
+    0x20, 0x3e, 0x30, 0x32, 0x6a, 0x20, 0x78, 0x36, 0x05, 0x23, 0x35, 0xc2, 0x9b, 0x03, 0x2a, 0x1a,
+    0x20, 0x06, 0x10, 0xcd, 0x24, 0x14, 0x21, 0x10, 0x20, 0x11, 0x10, 0x1b, 0x06, 0x10, 0xcd, 0x32,
+    0x1a, 0x06, 0x00, 0xcd, 0xdc, 0x19, 0x3a, 0x6d, 0x20, 0xa7, 0xc0, 0x3a, 0xef, 0x20, 0xa7, 0xc8,
+    0x31, 0x00, 0x24, 0xfb, 0xcd, 0xd7, 0x19, 0xcd, 0x2e, 0x09, 0xa7, 0xca, 0x6d, 0x16, 0xcd, 0xe7,
+    0x18, 0x7e, 0xa7, 0xca, 0x2c, 0x03, 0x3a, 0xce, 0x20, 0xa7, 0xca, 0x2c, 0x03, 0x3a, 0x67, 0x20,
+    0xf5, 0x0f, 0xda, 0x32, 0x03, 0xcd, 0x0e, 0x02, 0xcd, 0x78, 0x08, 0x73, 0x23, 0x72, 0x2b, 0x2b,
+    0x70, 0x00, 0xcd, 0xe4, 0x01, 0xf1, 0x0f, 0x3e, 0x21, 0x06, 0x00, 0xd2, 0x12, 0x03, 0x06, 0x20,
+    0x3e, 0x22, 0x32, 0x67, 0x20, 0xcd, 0xb6, 0x0a, 0xaf, 0x32, 0x11, 0x20, 0x78, 0xd3, 0x05, 0x3c,
+    0x32, 0x98, 0x20, 0xcd, 0xd6, 0x09, 0xcd, 0x7f, 0x1a, 0xc3, 0xf9, 0x07, 0xcd, 0x7f, 0x1a, 0xc3,
+    0x17, 0x08, 0xcd, 0x09, 0x02, 0xc3, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x21, 0x68, 0x20, 0x36, 0x01,
+    0x23, 0x7e, 0xa7, 0xc3, 0xb0, 0x03, 0x00, 0x2b, 0x36, 0x01, 0x3a, 0x1b, 0x20, 0x47, 0x3a, 0xef,
+    0x20, 0xa7, 0xc2, 0x63, 0x03, 0x3a, 0x1d, 0x20, 0x0f, 0xda, 0x81, 0x03, 0x0f, 0xda, 0x8e, 0x03,
+    0xc3, 0x6f, 0x03, 0xcd, 0xc0, 0x17, 0x07, 0x07, 0xda, 0x81, 0x03, 0x07, 0xda, 0x8e, 0x03, 0x21,
+    0x18, 0x20, 0xcd, 0x3b, 0x1a, 0xcd, 0x47, 0x1a, 0xcd, 0x39, 0x14, 0x3e, 0x00, 0x32, 0x12, 0x20,
+    0xc9, 0x78, 0xfe, 0xd9, 0xca, 0x6f, 0x03, 0x3c, 0x32, 0x1b, 0x20, 0xc3, 0x6f, 0x03, 0x78, 0xfe,
+    0x30, 0xca, 0x6f, 0x03, 0x3d, 0x32, 0x1b, 0x20, 0xc3, 0x6f, 0x03, 0x3c, 0xe6, 0x01, 0x32, 0x15,
+    0x20, 0x07, 0x07, 0x07, 0x07, 0x21, 0x70, 0x1c, 0x85, 0x6f, 0x22, 0x18, 0x20, 0xc3, 0x6f, 0x03,
+    0xc2, 0x4a, 0x03, 0x23, 0x35, 0xc2, 0x4a, 0x03, 0xc3, 0x46, 0x03, 0x11, 0x2a, 0x20, 0xcd, 0x06,
+    0x1a, 0xe1, 0xd0, 0x23, 0x7e, 0xa7, 0xc8, 0xfe, 0x01, 0xca, 0xfa, 0x03, 0xfe, 0x02, 0xca, 0x0a,
+    0x04, 0x23, 0xfe, 0x03, 0xc2, 0x2a, 0x04, 0x35, 0xca, 0x36, 0x04, 0x7e, 0xfe, 0x0f, 0xc0, 0xe5,
+    0xcd, 0x30, 0x04, 0xcd, 0x52, 0x14, 0xe1, 0x23, 0x34, 0x23, 0x23, 0x35, 0x35, 0x23, 0x35, 0x35,
+    0x35, 0x23, 0x36, 0x08, 0xcd, 0x30, 0x04, 0xc3, 0x00, 0x14, 0x3c, 0x77, 0x3a, 0x1b, 0x20, 0xc6,
+    0x08, 0x32, 0x2a, 0x20, 0xcd, 0x30, 0x04, 0xc3, 0x00, 0x14, 0xcd, 0x30, 0x04, 0xd5, 0xe5, 0xc5,
+    0xcd, 0x52, 0x14, 0xc1, 0xe1, 0xd1, 0x3a, 0x2c, 0x20, 0x85, 0x6f, 0x32, 0x29, 0x20, 0xcd, 0x91,
+    0x14, 0x3a, 0x61, 0x20, 0xa7, 0xc8, 0x32, 0x02, 0x20, 0xc9, 0xfe, 0x05, 0xc8, 0xc3, 0x36, 0x04,
+    0x21, 0x27, 0x20, 0xc3, 0x3b, 0x1a, 0xcd, 0x30, 0x04, 0xcd, 0x52, 0x14, 0x21, 0x25, 0x20, 0x11,
+    0x25, 0x1b, 0x06, 0x07, 0xcd, 0x32, 0x1a, 0x2a, 0x8d, 0x20, 0x2c, 0x7d, 0xfe, 0x63, 0xda, 0x53,
+    0x04, 0x2e, 0x54, 0x22, 0x8d, 0x20, 0x2a, 0x8f, 0x20, 0x2c, 0x22, 0x8f, 0x20, 0x3a, 0x84, 0x20,
+    0xa7, 0xc0, 0x7e, 0xe6, 0x01, 0x01, 0x29, 0x02, 0xc2, 0x6e, 0x04, 0x01, 0xe0, 0xfe, 0x21, 0x8a,
+    0x20, 0x71, 0x23, 0x23, 0x70, 0xc9, 0xe1, 0x3a, 0x32, 0x1b, 0x32, 0x32, 0x20, 0x2a, 0x38, 0x20,
+    0x7d, 0xb4, 0xc2, 0x8a, 0x04, 0x2b, 0x22, 0x38, 0x20, 0xc9, 0x11, 0x35, 0x20, 0x3e, 0xf9, 0xcd,
+    0x50, 0x05, 0x3a, 0x46, 0x20, 0x32, 0x70, 0x20, 0x3a, 0x56, 0x20, 0x32, 0x71, 0x20, 0xcd, 0x63,
+    0x05, 0x3a, 0x78, 0x20, 0xa7, 0x21, 0x35, 0x20, 0xc2, 0x5b, 0x05, 0x11, 0x30, 0x1b, 0x21, 0x30,
+    0x20, 0x06, 0x10, 0xc3, 0x32, 0x1a, 0xe1, 0x3a, 0x6e, 0x20, 0xa7, 0xc0, 0x3a, 0x80, 0x20, 0xfe,
+    0x01, 0xc0, 0x11, 0x45, 0x20, 0x3e, 0xed, 0xcd, 0x50, 0x05, 0x3a, 0x36, 0x20, 0x32, 0x70, 0x20,
+    0x3a, 0x56, 0x20, 0x32, 0x71, 0x20, 0xcd, 0x63, 0x05, 0x3a, 0x76, 0x20, 0xfe, 0x10, 0xda, 0xe7,
+    0x04, 0x3a, 0x48, 0x1b, 0x32, 0x76, 0x20, 0x3a, 0x78, 0x20, 0xa7, 0x21, 0x45, 0x20, 0xc2, 0x5b,
+    0x05, 0x11, 0x40, 0x1b, 0x21, 0x40, 0x20, 0x06, 0x10, 0xcd, 0x32, 0x1a, 0x3a, 0x82, 0x20, 0x3d,
+    0xc2, 0x08, 0x05, 0x3e, 0x01, 0x32, 0x6e, 0x20, 0x2a, 0x76, 0x20, 0xc3, 0x7e, 0x06, 0xe1, 0x11,
+    0x55, 0x20, 0x3e, 0xdb, 0xcd, 0x50, 0x05, 0x3a, 0x46, 0x20, 0x32, 0x70, 0x20, 0x3a, 0x36, 0x20,
+    0x32, 0x71, 0x20, 0xcd, 0x63, 0x05, 0x3a, 0x76, 0x20, 0xfe, 0x15, 0xda, 0x34, 0x05, 0x3a, 0x58,
+    0x1b, 0x32, 0x76, 0x20, 0x3a, 0x78, 0x20, 0xa7, 0x21, 0x55, 0x20, 0xc2, 0x5b, 0x05, 0x11, 0x50,
+    0x1b, 0x21, 0x50, 0x20, 0x06, 0x10, 0xcd, 0x32, 0x1a, 0x2a, 0x76, 0x20, 0x22, 0x58, 0x20, 0xc9,
+    0x32, 0x7f, 0x20, 0x21, 0x73, 0x20, 0x06, 0x0b, 0xc3, 0x32, 0x1a, 0x11, 0x73, 0x20, 0x06, 0x0b,
+    0xc3, 0x32, 0x1a, 0x21, 0x73, 0x20, 0x7e, 0xe6, 0x80, 0xc2, 0xc1, 0x05, 0x3a, 0xc1, 0x20, 0xfe,
+    0x04, 0x3a, 0x69, 0x20, 0xca, 0xb7, 0x05, 0xa7, 0xc8, 0x23, 0x36, 0x00, 0x3a, 0x70, 0x20, 0xa7,
+    0xca, 0x89, 0x05, 0x47, 0x3a, 0xcf, 0x20, 0xb8, 0xd0, 0x3a, 0x71, 0x20, 0xa7, 0xca, 0x96, 0x05,
+    0x47, 0x3a, 0xcf, 0x20, 0xb8, 0xd0, 0x23, 0x7e, 0xa7, 0xca, 0x1b, 0x06, 0x2a, 0x76, 0x20, 0x4e,
+    0x23, 0x00, 0x22, 0x76, 0x20, 0xcd, 0x2f, 0x06, 0xd0, 0xcd, 0x7a, 0x01, 0x79, 0xc6, 0x07, 0x67,
+    0x7d, 0xd6, 0x0a, 0x6f, 0x22, 0x7b, 0x20, 0x21, 0x73, 0x20, 0x7e, 0xf6, 0x80, 0x77, 0x23, 0x34,
+    0xc9, 0x11, 0x7c, 0x20, 0xcd, 0x06, 0x1a, 0xd0, 0x23, 0x7e, 0xe6, 0x01, 0xc2, 0x44, 0x06, 0x23,
+    0x34, 0xcd, 0x75, 0x06, 0x3a, 0x79, 0x20, 0xc6, 0x03, 0x21, 0x7f, 0x20, 0xbe, 0xda, 0xe2, 0x05,
+    0xd6, 0x0c, 0x32, 0x79, 0x20, 0x3a, 0x7b, 0x20, 0x47, 0x3a, 0x7e, 0x20, 0x80, 0x32, 0x7b, 0x20,
+    0xcd, 0x6c, 0x06, 0x3a, 0x7b, 0x20, 0xfe, 0x15, 0xda, 0x12, 0x06, 0x3a, 0x61, 0x20, 0xa7, 0xc8,
+    0x3a, 0x7b, 0x20, 0xfe, 0x1e, 0xda, 0x12, 0x06, 0xfe, 0x27, 0x00, 0xd2, 0x12, 0x06, 0x97, 0x32,
+    0x15, 0x20, 0x3a, 0x73, 0x20, 0xf6, 0x01, 0x32, 0x73, 0x20, 0xc9, 0x3a, 0x1b, 0x20, 0xc6, 0x08,
+    0x67, 0xcd, 0x6f, 0x15, 0x79, 0xfe, 0x0c, 0xda, 0xa5, 0x05, 0x0e, 0x0b, 0xc3, 0xa5, 0x05, 0x0d,
+    0x3a, 0x67, 0x20, 0x67, 0x69, 0x16, 0x05, 0x7e, 0xa7, 0x37, 0xc0, 0x7d, 0xc6, 0x0b, 0x6f, 0x15,
+    0xc2, 0x37, 0x06, 0xc9, 0x21, 0x78, 0x20, 0x35, 0x7e, 0xfe, 0x03, 0xc2, 0x67, 0x06, 0xcd, 0x75,
+    0x06, 0x21, 0xdc, 0x1c, 0x22, 0x79, 0x20, 0x21, 0x7c, 0x20, 0x35, 0x35, 0x2b, 0x35, 0x35, 0x3e,
+    0x06, 0x32, 0x7d, 0x20, 0xc3, 0x6c, 0x06, 0xa7, 0xc0, 0xc3, 0x75, 0x06, 0x21, 0x79, 0x20, 0xcd,
+    0x3b, 0x1a, 0xc3, 0x91, 0x14, 0x21, 0x79, 0x20, 0xcd, 0x3b, 0x1a, 0xc3, 0x52, 0x14, 0x22, 0x48,
+    0x20, 0xc9, 0xe1, 0x3a, 0x80, 0x20, 0xfe, 0x02, 0xc0, 0x21, 0x83, 0x20, 0x7e, 0xa7, 0xca, 0x0f,
+    0x05, 0x3a, 0x56, 0x20, 0xa7, 0xc2, 0x0f, 0x05, 0x23, 0x7e, 0xa7, 0xc2, 0xab, 0x06, 0x3a, 0x82,
+    0x20, 0xfe, 0x08, 0xda, 0x0f, 0x05, 0x36, 0x01, 0xcd, 0x3c, 0x07, 0x11, 0x8a, 0x20, 0xcd, 0x06,
+    0x1a, 0xd0, 0x21, 0x85, 0x20, 0x7e, 0xa7, 0xc2, 0xd6, 0x06, 0x21, 0x8a, 0x20, 0x7e, 0x23, 0x23,
+    0x86, 0x32, 0x8a, 0x20, 0xcd, 0x3c, 0x07, 0x21, 0x8a, 0x20, 0x7e, 0xfe, 0x28, 0xda, 0xf9, 0x06,
+    0xfe, 0xe1, 0xd2, 0xf9, 0x06, 0xc9, 0x06, 0xfe, 0xcd, 0xdc, 0x19, 0x23, 0x35, 0x7e, 0xfe, 0x1f,
+    0xca, 0x4b, 0x07, 0xfe, 0x18, 0xca, 0x0c, 0x07, 0xa7, 0xc0, 0x06, 0xef, 0x21, 0x98, 0x20, 0x7e,
+    0xa0, 0x77, 0xe6, 0x20, 0xd3, 0x05, 0x00, 0x00, 0x00, 0xcd, 0x42, 0x07, 0xcd, 0xcb, 0x14, 0x21,
+    0x83, 0x20, 0x06, 0x0a, 0xcd, 0x5f, 0x07, 0x06, 0xfe, 0xc3, 0xdc, 0x19, 0x3e, 0x01, 0x32, 0xf1,
+    0x20, 0x2a, 0x8d, 0x20, 0x46, 0x0e, 0x04, 0x21, 0x50, 0x1d, 0x11, 0x4c, 0x1d, 0x1a, 0xb8, 0xca,
+    0x28, 0x07, 0x23, 0x13, 0x0d, 0xc2, 0x1d, 0x07, 0x7e, 0x32, 0x87, 0x20, 0x26, 0x00, 0x68, 0x29,
+    0x29, 0x29, 0x29, 0x22, 0xf2, 0x20, 0xcd, 0x42, 0x07, 0xc3, 0xf1, 0x08, 0xcd, 0x42, 0x07, 0xc3,
+    0x39, 0x14, 0x21, 0x87, 0x20, 0xcd, 0x3b, 0x1a, 0xc3, 0x47, 0x1a, 0x06, 0x10, 0x21, 0x98, 0x20,
+    0x7e, 0xb0, 0x77, 0xcd, 0x70, 0x17, 0x21, 0x7c, 0x1d, 0x22, 0x87, 0x20, 0xc3, 0x3c, 0x07, 0x11,
+    0x83, 0x1b, 0xc3, 0x32, 0x1a, 0x3e, 0x01, 0x32, 0x93, 0x20, 0x31, 0x00, 0x24, 0xfb, 0xcd, 0x79,
+    0x19, 0xcd, 0xd6, 0x09, 0x21, 0x13, 0x30, 0x11, 0xf3, 0x1f, 0x0e, 0x04, 0xcd, 0xf3, 0x08, 0x3a,
+    0xeb, 0x20, 0x3d, 0x21, 0x10, 0x28, 0x0e, 0x14, 0xc2, 0x57, 0x08, 0x11, 0xcf, 0x1a, 0xcd, 0xf3,
+    0x08, 0xdb, 0x01, 0xe6, 0x04, 0xca, 0x7f, 0x07, 0x06, 0x99, 0xaf, 0x32, 0xce, 0x20, 0x3a, 0xeb,
+    0x20, 0x80, 0x27, 0x32, 0xeb, 0x20, 0xcd, 0x47, 0x19, 0x21, 0x00, 0x00, 0x22, 0xf8, 0x20, 0x22,
+    0xfc, 0x20, 0xcd, 0x25, 0x19, 0xcd, 0x2b, 0x19, 0xcd, 0xd7, 0x19, 0x21, 0x01, 0x01, 0x7c, 0x32,
+    0xef, 0x20, 0x22, 0xe7, 0x20, 0x22, 0xe5, 0x20, 0xcd, 0x56, 0x19, 0xcd, 0xef, 0x01, 0xcd, 0xf5,
+    0x01, 0xcd, 0xd1, 0x08, 0x32, 0xff, 0x21, 0x32, 0xff, 0x22, 0xcd, 0xd7, 0x00, 0xaf, 0x32, 0xfe,
+    0x21, 0x32, 0xfe, 0x22, 0xcd, 0xc0, 0x01, 0xcd, 0x04, 0x19, 0x21, 0x78, 0x38, 0x22, 0xfc, 0x21,
+    0x22, 0xfc, 0x22, 0xcd, 0xe4, 0x01, 0xcd, 0x7f, 0x1a, 0xcd, 0x8d, 0x08, 0xcd, 0xd6, 0x09, 0x00,
+    0xaf, 0x32, 0xc1, 0x20, 0xcd, 0xcf, 0x01, 0x3a, 0x67, 0x20, 0x0f, 0xda, 0x72, 0x08, 0xcd, 0x13,
+    0x02, 0xcd, 0xcf, 0x01, 0xcd, 0xb1, 0x00, 0xcd, 0xd1, 0x19, 0x06, 0x20, 0xcd, 0xfa, 0x18, 0xcd,
+    0x18, 0x16, 0xcd, 0x0a, 0x19, 0xcd, 0xf3, 0x15, 0xcd, 0x88, 0x09, 0x3a, 0x82, 0x20, 0xa7, 0xca,
+    0xef, 0x09, 0xcd, 0x0e, 0x17, 0xcd, 0x35, 0x09, 0xcd, 0xd8, 0x08, 0xcd, 0x2c, 0x17, 0xcd, 0x59,
+    0x0a, 0xca, 0x49, 0x08, 0x06, 0x04, 0xcd, 0xfa, 0x18, 0xcd, 0x75, 0x17, 0xd3, 0x06, 0xcd, 0x04,
+    0x18, 0xc3, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x11, 0xba, 0x1a, 0xcd, 0xf3, 0x08, 0x06, 0x98, 0xdb,
+    0x01, 0x0f, 0x0f, 0xda, 0x6d, 0x08, 0x0f, 0xda, 0x98, 0x07, 0xc3, 0x7f, 0x07, 0x3e, 0x01, 0xc3,
+    0x9b, 0x07, 0xcd, 0x1a, 0x02, 0xc3, 0x14, 0x08, 0x3a, 0x08, 0x20, 0x47, 0x2a, 0x09, 0x20, 0xeb,
+    0xc3, 0x86, 0x08, 0x00, 0x00, 0x00, 0x3a, 0x67, 0x20, 0x67, 0x2e, 0xfc, 0xc9, 0x21, 0x11, 0x2b,
+    0x11, 0x70, 0x1b, 0x0e, 0x0e, 0xcd, 0xf3, 0x08, 0x3a, 0x67, 0x20, 0x0f, 0x3e, 0x1c, 0x21, 0x11,
+    0x37, 0xd4, 0xff, 0x08, 0x3e, 0xb0, 0x32, 0xc0, 0x20, 0x3a, 0xc0, 0x20, 0xa7, 0xc8, 0xe6, 0x04,
+    0xc2, 0xbc, 0x08, 0xcd, 0xca, 0x09, 0xcd, 0x31, 0x19, 0xc3, 0xa9, 0x08, 0x06, 0x20, 0x21, 0x1c,
+    0x27, 0x3a, 0x67, 0x20, 0x0f, 0xda, 0xcb, 0x08, 0x21, 0x1c, 0x39, 0xcd, 0xcb, 0x14, 0xc3, 0xa9,
+    0x08, 0xdb, 0x02, 0xe6, 0x03, 0xc6, 0x03, 0xc9, 0x3a, 0x82, 0x20, 0xfe, 0x09, 0xd0, 0x3e, 0xfb,
+    0x32, 0x7e, 0x20, 0xc9, 0x3a, 0xce, 0x20, 0xa7, 0xc0, 0x21, 0x1c, 0x39, 0x06, 0x20, 0xc3, 0xcb,
+    0x14, 0x0e, 0x03, 0x1a, 0xd5, 0xcd, 0xff, 0x08, 0xd1, 0x13, 0x0d, 0xc2, 0xf3, 0x08, 0xc9, 0x11,
+    0x00, 0x1e, 0xe5, 0x26, 0x00, 0x6f, 0x29, 0x29, 0x29, 0x19, 0xeb, 0xe1, 0x06, 0x08, 0xd3, 0x06,
+    0xc3, 0x39, 0x14, 0x3a, 0x09, 0x20, 0xfe, 0x78, 0xd0, 0x2a, 0x91, 0x20, 0x7d, 0xb4, 0xc2, 0x29,
+    0x09, 0x21, 0x00, 0x06, 0x3e, 0x01, 0x32, 0x83, 0x20, 0x2b, 0x22, 0x91, 0x20, 0xc9, 0xcd, 0x11,
+    0x16, 0x2e, 0xff, 0x7e, 0xc9, 0xcd, 0x10, 0x19, 0x2b, 0x2b, 0x7e, 0xa7, 0xc8, 0x06, 0x15, 0xdb,
+    0x02, 0xe6, 0x08, 0xca, 0x48, 0x09, 0x06, 0x10, 0xcd, 0xca, 0x09, 0x23, 0x7e, 0xb8, 0xd8, 0xcd,
+    0x2e, 0x09, 0x34, 0x7e, 0xf5, 0x21, 0x01, 0x25, 0x24, 0x24, 0x3d, 0xc2, 0x58, 0x09, 0x06, 0x10,
+    0x11, 0x60, 0x1c, 0xcd, 0x39, 0x14, 0xf1, 0x3c, 0xcd, 0x8b, 0x1a, 0xcd, 0x10, 0x19, 0x2b, 0x2b,
+    0x36, 0x00, 0x3e, 0xff, 0x32, 0x99, 0x20, 0x06, 0x10, 0xc3, 0xfa, 0x18, 0x21, 0xa0, 0x1d, 0xfe,
+    0x02, 0xd8, 0x23, 0xfe, 0x04, 0xd8, 0x23, 0xc9, 0xcd, 0xca, 0x09, 0x3a, 0xf1, 0x20, 0xa7, 0xc8,
+    0xaf, 0x32, 0xf1, 0x20, 0xe5, 0x2a, 0xf2, 0x20, 0xeb, 0xe1, 0x7e, 0x83, 0x27, 0x77, 0x5f, 0x23,
+    0x7e, 0x8a, 0x27, 0x77, 0x57, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xc3, 0xad, 0x09, 0x7a, 0xcd, 0xb2,
+    0x09, 0x7b, 0xd5, 0xf5, 0x0f, 0x0f, 0x0f, 0x0f, 0xe6, 0x0f, 0xcd, 0xc5, 0x09, 0xf1, 0xe6, 0x0f,
+    0xcd, 0xc5, 0x09, 0xd1, 0xc9, 0xc6, 0x1a, 0xc3, 0xff, 0x08, 0x3a, 0x67, 0x20, 0x0f, 0x21, 0xf8,
+    0x20, 0xd8, 0x21, 0xfc, 0x20, 0xc9, 0x21, 0x02, 0x24, 0x36, 0x00, 0x23, 0x7d, 0xe6, 0x1f, 0xfe,
+    0x1c, 0xda, 0xe8, 0x09, 0x11, 0x06, 0x00, 0x19, 0x7c, 0xfe, 0x40, 0xda, 0xd9, 0x09, 0xc9, 0xcd,
+    0x3c, 0x0a, 0xaf, 0x32, 0xe9, 0x20, 0xcd, 0xd6, 0x09, 0x3a, 0x67, 0x20, 0xf5, 0xcd, 0xe4, 0x01,
+    0xf1, 0x32, 0x67, 0x20, 0x3a, 0x67, 0x20, 0x67, 0xe5, 0x2e, 0xfe, 0x7e, 0xe6, 0x07, 0x3c, 0x77,
+    0x21, 0xa2, 0x1d, 0x23, 0x3d, 0xc2, 0x13, 0x0a, 0x7e, 0xe1, 0x2e, 0xfc, 0x77, 0x23, 0x36, 0x38,
+    0x7c, 0x0f, 0xda, 0x33, 0x0a, 0x3e, 0x21, 0x32, 0x98, 0x20, 0xcd, 0xf5, 0x01, 0xcd, 0x04, 0x19,
+    0xc3, 0x04, 0x08, 0xcd, 0xef, 0x01, 0xcd, 0xc0, 0x01, 0xc3, 0x04, 0x08, 0xcd, 0x59, 0x0a, 0xc2,
+    0x52, 0x0a, 0x3e, 0x30, 0x32, 0xc0, 0x20, 0x3a, 0xc0, 0x20, 0xa7, 0xc8, 0xcd, 0x59, 0x0a, 0xca,
+    0x47, 0x0a, 0xcd, 0x59, 0x0a, 0xc2, 0x52, 0x0a, 0xc9, 0x3a, 0x15, 0x20, 0xfe, 0xff, 0xc9, 0x3a,
+    0xef, 0x20, 0xa7, 0xca, 0x7c, 0x0a, 0x48, 0x06, 0x08, 0xcd, 0xfa, 0x18, 0x41, 0x78, 0xcd, 0x7c,
+    0x09, 0x7e, 0x21, 0xf3, 0x20, 0x36, 0x00, 0x2b, 0x77, 0x2b, 0x36, 0x01, 0x21, 0x62, 0x20, 0xc9,
+    0x3e, 0x02, 0x32, 0xc1, 0x20, 0xd3, 0x06, 0x3a, 0xcb, 0x20, 0xa7, 0xca, 0x85, 0x0a, 0xaf, 0x32,
+    0xc1, 0x20, 0xc9, 0xd5, 0x1a, 0xcd, 0xff, 0x08, 0xd1, 0x3e, 0x07, 0x32, 0xc0, 0x20, 0x3a, 0xc0,
+    0x20, 0x3d, 0xc2, 0x9e, 0x0a, 0x13, 0x0d, 0xc2, 0x93, 0x0a, 0xc9, 0x21, 0x50, 0x20, 0xc3, 0x4b,
+    0x02, 0x3e, 0x40, 0xc3, 0xd7, 0x0a, 0x3e, 0x80, 0xc3, 0xd7, 0x0a, 0xe1, 0xc3, 0x72, 0x00, 0x3a,
+    0xc1, 0x20, 0x0f, 0xda, 0xbb, 0x0a, 0x0f, 0xda, 0x68, 0x18, 0x0f, 0xda, 0xab, 0x0a, 0xc9, 0x21,
+    0x14, 0x2b, 0x0e, 0x0f, 0xc3, 0x93, 0x0a, 0x32, 0xc0, 0x20, 0x3a, 0xc0, 0x20, 0xa7, 0xc2, 0xda,
+    0x0a, 0xc9, 0x21, 0xc2, 0x20, 0x06, 0x0c, 0xc3, 0x32, 0x1a, 0xaf, 0xd3, 0x03, 0xd3, 0x05, 0xcd,
+    0x82, 0x19, 0xfb, 0xcd, 0xb1, 0x0a, 0x3a, 0xec, 0x20, 0xa7, 0x21, 0x17, 0x30, 0x0e, 0x04, 0xc2,
+    0xe8, 0x0b, 0x11, 0xfa, 0x1c, 0xcd, 0x93, 0x0a, 0x11, 0xaf, 0x1d, 0xcd, 0xcf, 0x0a, 0xcd, 0xb1,
+    0x0a, 0xcd, 0x15, 0x18, 0xcd, 0xb6, 0x0a, 0x3a, 0xec, 0x20, 0xa7, 0xc2, 0x4a, 0x0b, 0x11, 0x95,
+    0x1a, 0xcd, 0xe2, 0x0a, 0xcd, 0x80, 0x0a, 0x11, 0xb0, 0x1b, 0xcd, 0xe2, 0x0a, 0xcd, 0x80, 0x0a,
+    0xcd, 0xb1, 0x0a, 0x11, 0xc9, 0x1f, 0xcd, 0xe2, 0x0a, 0xcd, 0x80, 0x0a, 0xcd, 0xb1, 0x0a, 0x21,
+    0xb7, 0x33, 0x06, 0x0a, 0xcd, 0xcb, 0x14, 0xcd, 0xb6, 0x0a, 0xcd, 0xd6, 0x09, 0x3a, 0xff, 0x21,
+    0xa7, 0xc2, 0x5d, 0x0b, 0xcd, 0xd1, 0x08, 0x32, 0xff, 0x21, 0xcd, 0x7f, 0x1a, 0xcd, 0xe4, 0x01,
+    0xcd, 0xc0, 0x01, 0xcd, 0xef, 0x01, 0xcd, 0x1a, 0x02, 0x3e, 0x01, 0x32, 0xc1, 0x20, 0xcd, 0xcf,
+    0x01, 0xcd, 0x18, 0x16, 0xcd, 0xf1, 0x0b, 0xd3, 0x06, 0xcd, 0x59, 0x0a, 0xca, 0x71, 0x0b, 0xaf,
+    0x32, 0x25, 0x20, 0xcd, 0x59, 0x0a, 0xc2, 0x83, 0x0b, 0xaf, 0x32, 0xc1, 0x20, 0xcd, 0xb1, 0x0a,
+    0xcd, 0x88, 0x19, 0x0e, 0x0c, 0x21, 0x11, 0x2c, 0x11, 0x90, 0x1f, 0xcd, 0xf3, 0x08, 0x3a, 0xec,
+    0x20, 0xfe, 0x00, 0xc2, 0xae, 0x0b, 0x21, 0x11, 0x33, 0x3e, 0x02, 0xcd, 0xff, 0x08, 0x01, 0x9c,
+    0x1f, 0xcd, 0x56, 0x18, 0xcd, 0x4c, 0x18, 0xdb, 0x02, 0x07, 0xda, 0xc3, 0x0b, 0x01, 0xa0, 0x1f,
+    0xcd, 0x3a, 0x18, 0xcd, 0xb6, 0x0a, 0x3a, 0xec, 0x20, 0xfe, 0x00, 0xc2, 0xda, 0x0b, 0x11, 0xd5,
+    0x1f, 0xcd, 0xe2, 0x0a, 0xcd, 0x80, 0x0a, 0xcd, 0x9e, 0x18, 0x21, 0xec, 0x20, 0x7e, 0x3c, 0xe6,
+    0x01, 0x77, 0xcd, 0xd6, 0x09, 0xc3, 0xdf, 0x18, 0x11, 0xab, 0x1d, 0xcd, 0x93, 0x0a, 0xc3, 0x0b,
+    0x0b, 0xcd, 0x0a, 0x19, 0xc3, 0x9a, 0x19, 0x13, 0x00, 0x08, 0x13, 0x0e, 0x26, 0x02, 0x0e, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xcd, 0x74, 0x14, 0x00, 0xc5, 0xe5, 0x1a, 0xd3, 0x04, 0xdb, 0x03, 0xb6, 0x77, 0x23, 0x13,
+    0xaf, 0xd3, 0x04, 0xdb, 0x03, 0xb6, 0x77, 0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0x05,
+    0x14, 0xc9, 0x00, 0x00, 0xcd, 0x74, 0x14, 0xc5, 0xe5, 0xaf, 0x77, 0x23, 0x77, 0x23, 0xe1, 0x01,
+    0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0x27, 0x14, 0xc9, 0xc5, 0x1a, 0x77, 0x13, 0x01, 0x20, 0x00,
+    0x09, 0xc1, 0x05, 0xc2, 0x39, 0x14, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xcd, 0x74, 0x14, 0xc5, 0xe5, 0x1a, 0xd3, 0x04, 0xdb, 0x03, 0x2f, 0xa6, 0x77, 0x23,
+    0x13, 0xaf, 0xd3, 0x04, 0xdb, 0x03, 0x2f, 0xa6, 0x77, 0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05,
+    0xc2, 0x55, 0x14, 0xc9, 0x7d, 0xe6, 0x07, 0xd3, 0x02, 0xc3, 0x47, 0x1a, 0xc5, 0xe5, 0x7e, 0x12,
+    0x13, 0x23, 0x0d, 0xc2, 0x7e, 0x14, 0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0x7c, 0x14,
+    0xc9, 0xcd, 0x74, 0x14, 0xaf, 0x32, 0x61, 0x20, 0xc5, 0xe5, 0x1a, 0xd3, 0x04, 0xdb, 0x03, 0xf5,
+    0xa6, 0xca, 0xa9, 0x14, 0x3e, 0x01, 0x32, 0x61, 0x20, 0xf1, 0xb6, 0x77, 0x23, 0x13, 0xaf, 0xd3,
+    0x04, 0xdb, 0x03, 0xf5, 0xa6, 0xca, 0xbd, 0x14, 0x3e, 0x01, 0x32, 0x61, 0x20, 0xf1, 0xb6, 0x77,
+    0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0x98, 0x14, 0xc9, 0xaf, 0xc5, 0x77, 0x01, 0x20,
+    0x00, 0x09, 0xc1, 0x05, 0xc2, 0xcc, 0x14, 0xc9, 0x3a, 0x25, 0x20, 0xfe, 0x05, 0xc8, 0xfe, 0x02,
+    0xc0, 0x3a, 0x29, 0x20, 0xfe, 0xd8, 0x47, 0xd2, 0x30, 0x15, 0x3a, 0x02, 0x20, 0xa7, 0xc8, 0x78,
+    0xfe, 0xce, 0xd2, 0x79, 0x15, 0xc6, 0x06, 0x47, 0x3a, 0x09, 0x20, 0xfe, 0x90, 0xd2, 0x04, 0x15,
+    0xb8, 0xd2, 0x30, 0x15, 0x68, 0xcd, 0x62, 0x15, 0x3a, 0x2a, 0x20, 0x67, 0xcd, 0x6f, 0x15, 0x22,
+    0x64, 0x20, 0x3e, 0x05, 0x32, 0x25, 0x20, 0xcd, 0x81, 0x15, 0x7e, 0xa7, 0xca, 0x30, 0x15, 0x36,
+    0x00, 0xcd, 0x5f, 0x0a, 0xcd, 0x3b, 0x1a, 0xcd, 0xd3, 0x15, 0x3e, 0x10, 0x32, 0x03, 0x20, 0xc9,
+    0x3e, 0x03, 0x32, 0x25, 0x20, 0xc3, 0x4a, 0x15, 0x21, 0x03, 0x20, 0x35, 0xc0, 0x2a, 0x64, 0x20,
+    0x06, 0x10, 0xcd, 0x24, 0x14, 0x3e, 0x04, 0x32, 0x25, 0x20, 0xaf, 0x32, 0x02, 0x20, 0x06, 0xf7,
+    0xc3, 0xdc, 0x19, 0x00, 0x0e, 0x00, 0xbc, 0xd4, 0x90, 0x15, 0xbc, 0xd0, 0xc6, 0x10, 0x0c, 0xc3,
+    0x5a, 0x15, 0x3a, 0x09, 0x20, 0x65, 0xcd, 0x54, 0x15, 0x41, 0x05, 0xde, 0x10, 0x6f, 0xc9, 0x3a,
+    0x0a, 0x20, 0xcd, 0x54, 0x15, 0xde, 0x10, 0x67, 0xc9, 0x3e, 0x01, 0x32, 0x85, 0x20, 0xc3, 0x45,
+    0x15, 0x78, 0x07, 0x07, 0x07, 0x80, 0x80, 0x80, 0x81, 0x3d, 0x6f, 0x3a, 0x67, 0x20, 0x67, 0xc9,
+    0x0c, 0xc6, 0x10, 0xfa, 0x90, 0x15, 0xc9, 0x3a, 0x0d, 0x20, 0xa7, 0xc2, 0xb7, 0x15, 0x21, 0xa4,
+    0x3e, 0xcd, 0xc5, 0x15, 0xd0, 0x06, 0xfe, 0x3e, 0x01, 0x32, 0x0d, 0x20, 0x78, 0x32, 0x08, 0x20,
+    0x3a, 0x0e, 0x20, 0x32, 0x07, 0x20, 0xc9, 0x21, 0x24, 0x25, 0xcd, 0xc5, 0x15, 0xd0, 0xcd, 0xf1,
+    0x18, 0xaf, 0xc3, 0xa9, 0x15, 0x06, 0x17, 0x7e, 0xa7, 0xc2, 0x6b, 0x16, 0x23, 0x05, 0xc2, 0xc7,
+    0x15, 0xc9, 0x00, 0xcd, 0x74, 0x14, 0xe5, 0xc5, 0xe5, 0x1a, 0xd3, 0x04, 0xdb, 0x03, 0x77, 0x23,
+    0x13, 0xaf, 0xd3, 0x04, 0xdb, 0x03, 0x77, 0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0xd7,
+    0x15, 0xe1, 0xc9, 0xcd, 0x11, 0x16, 0x01, 0x00, 0x37, 0x7e, 0xa7, 0xca, 0xff, 0x15, 0x0c, 0x23,
+    0x05, 0xc2, 0xf9, 0x15, 0x79, 0x32, 0x82, 0x20, 0xfe, 0x01, 0xc0, 0x21, 0x6b, 0x20, 0x36, 0x01,
+    0xc9, 0x2e, 0x00, 0x3a, 0x67, 0x20, 0x67, 0xc9, 0x3a, 0x15, 0x20, 0xfe, 0xff, 0xc0, 0x21, 0x10,
+    0x20, 0x7e, 0x23, 0x46, 0xb0, 0xc0, 0x3a, 0x25, 0x20, 0xa7, 0xc0, 0x3a, 0xef, 0x20, 0xa7, 0xca,
+    0x52, 0x16, 0x3a, 0x2d, 0x20, 0xa7, 0xc2, 0x48, 0x16, 0xcd, 0xc0, 0x17, 0xe6, 0x10, 0xc8, 0x3e,
+    0x01, 0x32, 0x25, 0x20, 0x32, 0x2d, 0x20, 0xc9, 0xcd, 0xc0, 0x17, 0xe6, 0x10, 0xc0, 0x32, 0x2d,
+    0x20, 0xc9, 0x21, 0x25, 0x20, 0x36, 0x01, 0x2a, 0xed, 0x20, 0x23, 0x7d, 0xfe, 0x7e, 0xda, 0x63,
+    0x16, 0x2e, 0x74, 0x22, 0xed, 0x20, 0x7e, 0x32, 0x1d, 0x20, 0xc9, 0x37, 0xc9, 0xaf, 0xcd, 0x8b,
+    0x1a, 0xcd, 0x10, 0x19, 0x36, 0x00, 0xcd, 0xca, 0x09, 0x23, 0x11, 0xf5, 0x20, 0x1a, 0xbe, 0x1b,
+    0x2b, 0x1a, 0xca, 0x8b, 0x16, 0xd2, 0x98, 0x16, 0xc3, 0x8f, 0x16, 0xbe, 0xd2, 0x98, 0x16, 0x7e,
+    0x12, 0x13, 0x23, 0x7e, 0x12, 0xcd, 0x50, 0x19, 0x3a, 0xce, 0x20, 0xa7, 0xca, 0xc9, 0x16, 0x21,
+    0x03, 0x28, 0x11, 0xa6, 0x1a, 0x0e, 0x14, 0xcd, 0x93, 0x0a, 0x25, 0x25, 0x06, 0x1b, 0x3a, 0x67,
+    0x20, 0x0f, 0xda, 0xb7, 0x16, 0x06, 0x1c, 0x78, 0xcd, 0xff, 0x08, 0xcd, 0xb1, 0x0a, 0xcd, 0xe7,
+    0x18, 0x7e, 0xa7, 0xca, 0xc9, 0x16, 0xc3, 0xed, 0x02, 0x21, 0x18, 0x2d, 0x11, 0xa6, 0x1a, 0x0e,
+    0x0a, 0xcd, 0x93, 0x0a, 0xcd, 0xb6, 0x0a, 0xcd, 0xd6, 0x09, 0xaf, 0x32, 0xef, 0x20, 0xd3, 0x05,
+    0xcd, 0xd1, 0x19, 0xc3, 0x89, 0x0b, 0x31, 0x00, 0x24, 0xfb, 0xaf, 0x32, 0x15, 0x20, 0xcd, 0xd8,
+    0x14, 0x06, 0x04, 0xcd, 0xfa, 0x18, 0xcd, 0x59, 0x0a, 0xc2, 0xee, 0x16, 0xcd, 0xd7, 0x19, 0x21,
+    0x01, 0x27, 0xcd, 0xfa, 0x19, 0xaf, 0xcd, 0x8b, 0x1a, 0x06, 0xfb, 0xc3, 0x6b, 0x19, 0xcd, 0xca,
+    0x09, 0x23, 0x7e, 0x11, 0xb8, 0x1c, 0x21, 0xa1, 0x1a, 0x0e, 0x04, 0x47, 0x1a, 0xb8, 0xd2, 0x27,
+    0x17, 0x23, 0x13, 0x0d, 0xc2, 0x1c, 0x17, 0x7e, 0x32, 0xcf, 0x20, 0xc9, 0x3a, 0x25, 0x20, 0xfe,
+    0x00, 0xc2, 0x39, 0x17, 0x06, 0xfd, 0xc3, 0xdc, 0x19, 0x06, 0x02, 0xc3, 0xfa, 0x18, 0x00, 0x00,
+    0x21, 0x9b, 0x20, 0x35, 0xcc, 0x6d, 0x17, 0x3a, 0x68, 0x20, 0xa7, 0xca, 0x6d, 0x17, 0x21, 0x96,
+    0x20, 0x35, 0xc0, 0x21, 0x98, 0x20, 0x7e, 0xd3, 0x05, 0x3a, 0x82, 0x20, 0xa7, 0xca, 0x6d, 0x17,
+    0x2b, 0x7e, 0x2b, 0x77, 0x2b, 0x36, 0x01, 0x3e, 0x04, 0x32, 0x9b, 0x20, 0xc9, 0x3a, 0x98, 0x20,
+    0xe6, 0x30, 0xd3, 0x05, 0xc9, 0x3a, 0x95, 0x20, 0xa7, 0xca, 0xaa, 0x17, 0x21, 0x11, 0x1a, 0x11,
+    0x21, 0x1a, 0x3a, 0x82, 0x20, 0xbe, 0xd2, 0x8e, 0x17, 0x23, 0x13, 0xc3, 0x85, 0x17, 0x1a, 0x32,
+    0x97, 0x20, 0x21, 0x98, 0x20, 0x7e, 0xe6, 0x30, 0x47, 0x7e, 0xe6, 0x0f, 0x07, 0xfe, 0x10, 0xc2,
+    0xa4, 0x17, 0x3e, 0x01, 0xb0, 0x77, 0xaf, 0x32, 0x95, 0x20, 0x21, 0x99, 0x20, 0x35, 0xc0, 0x06,
+    0xef, 0xc3, 0xdc, 0x19, 0x06, 0xef, 0x21, 0x98, 0x20, 0x7e, 0xa0, 0x77, 0xd3, 0x05, 0xc9, 0x00,
+    0x3a, 0x67, 0x20, 0x0f, 0xd2, 0xca, 0x17, 0xdb, 0x01, 0xc9, 0xdb, 0x02, 0xc9, 0xdb, 0x02, 0xe6,
+    0x04, 0xc8, 0x3a, 0x9a, 0x20, 0xa7, 0xc0, 0x31, 0x00, 0x24, 0x06, 0x04, 0xcd, 0xd6, 0x09, 0x05,
+    0xc2, 0xdc, 0x17, 0x3e, 0x01, 0x32, 0x9a, 0x20, 0xcd, 0xd7, 0x19, 0xfb, 0x11, 0xbc, 0x1c, 0x21,
+    0x16, 0x30, 0x0e, 0x04, 0xcd, 0x93, 0x0a, 0xcd, 0xb1, 0x0a, 0xaf, 0x32, 0x9a, 0x20, 0x32, 0x93,
+    0x20, 0xc3, 0xc9, 0x16, 0x21, 0x84, 0x20, 0x7e, 0xa7, 0xca, 0x07, 0x07, 0x23, 0x7e, 0xa7, 0xc0,
+    0x06, 0x01, 0xc3, 0xfa, 0x18, 0x21, 0x10, 0x28, 0x11, 0xa3, 0x1c, 0x0e, 0x15, 0xcd, 0xf3, 0x08,
+    0x3e, 0x0a, 0x32, 0x6c, 0x20, 0x01, 0xbe, 0x1d, 0xcd, 0x56, 0x18, 0xda, 0x37, 0x18, 0xcd, 0x44,
+    0x18, 0xc3, 0x28, 0x18, 0xcd, 0xb1, 0x0a, 0x01, 0xcf, 0x1d, 0xcd, 0x56, 0x18, 0xd8, 0xcd, 0x4c,
+    0x18, 0xc3, 0x3a, 0x18, 0xc5, 0x06, 0x10, 0xcd, 0x39, 0x14, 0xc1, 0xc9, 0xc5, 0x3a, 0x6c, 0x20,
+    0x4f, 0xcd, 0x93, 0x0a, 0xc1, 0xc9, 0x0a, 0xfe, 0xff, 0x37, 0xc8, 0x6f, 0x03, 0x0a, 0x67, 0x03,
+    0x0a, 0x5f, 0x03, 0x0a, 0x57, 0x03, 0xa7, 0xc9, 0x21, 0xc2, 0x20, 0x34, 0x23, 0x4e, 0xcd, 0xd9,
+    0x01, 0x47, 0x3a, 0xca, 0x20, 0xb8, 0xca, 0x98, 0x18, 0x3a, 0xc2, 0x20, 0xe6, 0x04, 0x2a, 0xcc,
+    0x20, 0xc2, 0x88, 0x18, 0x11, 0x30, 0x00, 0x19, 0x22, 0xc7, 0x20, 0x21, 0xc5, 0x20, 0xcd, 0x3b,
+    0x1a, 0xeb, 0xc3, 0xd3, 0x15, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x32, 0xcb, 0x20, 0xc9, 0x21, 0x50,
+    0x20, 0x11, 0xc0, 0x1b, 0x06, 0x10, 0xcd, 0x32, 0x1a, 0x3e, 0x02, 0x32, 0x80, 0x20, 0x3e, 0xff,
+    0x32, 0x7e, 0x20, 0x3e, 0x04, 0x32, 0xc1, 0x20, 0x3a, 0x55, 0x20, 0xe6, 0x01, 0xca, 0xb8, 0x18,
+    0x3a, 0x55, 0x20, 0xe6, 0x01, 0xc2, 0xc0, 0x18, 0x21, 0x11, 0x33, 0x3e, 0x26, 0x00, 0xcd, 0xff,
+    0x08, 0xc3, 0xb6, 0x0a, 0x31, 0x00, 0x24, 0x06, 0x00, 0xcd, 0xe6, 0x01, 0xcd, 0x56, 0x19, 0x3e,
+    0x08, 0x32, 0xcf, 0x20, 0xc3, 0xea, 0x0a, 0x3a, 0x67, 0x20, 0x21, 0xe7, 0x20, 0x0f, 0xd0, 0x23,
+    0xc9, 0x06, 0x02, 0x3a, 0x82, 0x20, 0x3d, 0xc0, 0x04, 0xc9, 0x3a, 0x94, 0x20, 0xb0, 0x32, 0x94,
+    0x20, 0xd3, 0x03, 0xc9, 0x21, 0x00, 0x22, 0xc3, 0xc3, 0x01, 0xcd, 0xd8, 0x14, 0xc3, 0x97, 0x15,
+    0x21, 0xe7, 0x20, 0x3a, 0x67, 0x20, 0x0f, 0xd8, 0x23, 0xc9, 0x0e, 0x1c, 0x21, 0x1e, 0x24, 0x11,
+    0xe4, 0x1a, 0xc3, 0xf3, 0x08, 0x21, 0xf8, 0x20, 0xc3, 0x31, 0x19, 0x21, 0xfc, 0x20, 0xc3, 0x31,
+    0x19, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xc3, 0xad, 0x09, 0x0e, 0x07, 0x21, 0x01,
+    0x35, 0x11, 0xa9, 0x1f, 0xc3, 0xf3, 0x08, 0x3a, 0xeb, 0x20, 0x21, 0x01, 0x3c, 0xc3, 0xb2, 0x09,
+    0x21, 0xf4, 0x20, 0xc3, 0x31, 0x19, 0xcd, 0x5c, 0x1a, 0xcd, 0x1a, 0x19, 0xcd, 0x25, 0x19, 0xcd,
+    0x2b, 0x19, 0xcd, 0x50, 0x19, 0xcd, 0x3c, 0x19, 0xc3, 0x47, 0x19, 0xcd, 0xdc, 0x19, 0xc3, 0x71,
+    0x16, 0x3e, 0x01, 0x32, 0x6d, 0x20, 0xc3, 0xe6, 0x16, 0xcd, 0xd7, 0x19, 0xcd, 0x47, 0x19, 0xc3,
+    0x3c, 0x19, 0x32, 0xc1, 0x20, 0xc9, 0x8b, 0x19, 0xc3, 0xd6, 0x09, 0x21, 0x03, 0x28, 0x11, 0xbe,
+    0x19, 0x0e, 0x13, 0xc3, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x1e, 0x20, 0xa7, 0xc2, 0xac,
+    0x19, 0xdb, 0x01, 0xe6, 0x76, 0xd6, 0x72, 0xc0, 0x3c, 0x32, 0x1e, 0x20, 0xdb, 0x01, 0xe6, 0x76,
+    0xfe, 0x34, 0xc0, 0x21, 0x1b, 0x2e, 0x11, 0xf7, 0x0b, 0x0e, 0x09, 0xc3, 0xf3, 0x08, 0x28, 0x13,
+    0x00, 0x08, 0x13, 0x0e, 0x26, 0x02, 0x0e, 0x11, 0x0f, 0x0e, 0x11, 0x00, 0x13, 0x08, 0x0e, 0x0d,
+    0x28, 0x3e, 0x01, 0x32, 0xe9, 0x20, 0xc9, 0xaf, 0xc3, 0xd3, 0x19, 0x00, 0x3a, 0x94, 0x20, 0xa0,
+    0x32, 0x94, 0x20, 0xd3, 0x03, 0xc9, 0x21, 0x01, 0x27, 0xca, 0xfa, 0x19, 0x11, 0x60, 0x1c, 0x06,
+    0x10, 0x4f, 0xcd, 0x39, 0x14, 0x79, 0x3d, 0xc2, 0xec, 0x19, 0x06, 0x10, 0xcd, 0xcb, 0x14, 0x7c,
+    0xfe, 0x35, 0xc2, 0xfa, 0x19, 0xc9, 0x21, 0x72, 0x20, 0x46, 0x1a, 0xe6, 0x80, 0xa8, 0xc0, 0x37,
+    0xc9, 0x32, 0x2b, 0x24, 0x1c, 0x16, 0x11, 0x0d, 0x0a, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+    0x01, 0x34, 0x2e, 0x27, 0x22, 0x1c, 0x18, 0x15, 0x13, 0x10, 0x0e, 0x0d, 0x0c, 0x0b, 0x09, 0x07,
+    0x05, 0xff, 0x1a, 0x77, 0x23, 0x13, 0x05, 0xc2, 0x32, 0x1a, 0xc9, 0x5e, 0x23, 0x56, 0x23, 0x7e,
+    0x23, 0x4e, 0x23, 0x46, 0x61, 0x6f, 0xc9, 0xc5, 0x06, 0x03, 0x7c, 0x1f, 0x67, 0x7d, 0x1f, 0x6f,
+    0x05, 0xc2, 0x4a, 0x1a, 0x7c, 0xe6, 0x3f, 0xf6, 0x20, 0x67, 0xc1, 0xc9, 0x21, 0x00, 0x24, 0x36,
+    0x00, 0x23, 0x7c, 0xfe, 0x40, 0xc2, 0x5f, 0x1a, 0xc9, 0xc5, 0xe5, 0x1a, 0xb6, 0x77, 0x13, 0x23,
+    0x0d, 0xc2, 0x6b, 0x1a, 0xe1, 0x01, 0x20, 0x00, 0x09, 0xc1, 0x05, 0xc2, 0x69, 0x1a, 0xc9, 0xcd,
+    0x2e, 0x09, 0xa7, 0xc8, 0xf5, 0x3d, 0x77, 0xcd, 0xe6, 0x19, 0xf1, 0x21, 0x01, 0x25, 0xe6, 0x0f,
+    0xc3, 0xc5, 0x09, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0xfe, 0x20, 0x1c, 0x10, 0x9e, 0x00, 0x20,
+    0x1c, 0x30, 0x10, 0x0b, 0x08, 0x07, 0x06, 0x00, 0x0c, 0x04, 0x26, 0x0e, 0x15, 0x04, 0x11, 0x26,
+    0x26, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x24, 0x26, 0x25, 0x1b, 0x26, 0x0e, 0x11, 0x26, 0x1c,
+    0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x12, 0x26, 0x01, 0x14, 0x13, 0x13, 0x0e, 0x0d, 0x26, 0x0e,
+    0x0d, 0x0b, 0x18, 0x26, 0x1b, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x26, 0x26, 0x01, 0x14, 0x13,
+    0x13, 0x0e, 0x0d, 0x26, 0x26, 0x12, 0x02, 0x0e, 0x11, 0x04, 0x24, 0x1b, 0x25, 0x26, 0x07, 0x08,
+    0x3f, 0x12, 0x02, 0x0e, 0x11, 0x04, 0x26, 0x12, 0x02, 0x0e, 0x11, 0x04, 0x24, 0x1c, 0x25, 0x26,
+    0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x78, 0x38, 0x78, 0x38, 0x00, 0xf8, 0x00,
+    0x00, 0x80, 0x00, 0x8e, 0x02, 0xff, 0x05, 0x0c, 0x60, 0x1c, 0x20, 0x30, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbb, 0x03, 0x00, 0x10, 0x90, 0x1c, 0x28, 0x30, 0x01, 0x04, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x02, 0x76, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xee, 0x1c, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x04, 0xe2, 0x1c, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x82, 0x06, 0x00, 0x00, 0x01, 0x06, 0x1d, 0x04, 0xd0, 0x1c, 0x00, 0x00, 0x03,
+    0xff, 0x00, 0xc0, 0x1c, 0x00, 0x00, 0x10, 0x21, 0x01, 0x00, 0x30, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x0f, 0x0b, 0x00, 0x18, 0x26, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x24, 0x1b, 0x25, 0xfc, 0x00,
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x64, 0x1d, 0xd0, 0x29, 0x18, 0x02, 0x54, 0x1d, 0x00,
+    0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x10, 0x9e, 0x00, 0x20, 0x1c,
+    0x00, 0x03, 0x04, 0x78, 0x14, 0x13, 0x08, 0x1a, 0x3d, 0x68, 0xfc, 0xfc, 0x68, 0x3d, 0x1a, 0x00,
+    0x00, 0x00, 0x01, 0xb8, 0x98, 0xa0, 0x1b, 0x10, 0xff, 0x00, 0xa0, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x1c, 0xc8, 0x9b, 0x03,
+    0x00, 0x00, 0x03, 0x04, 0x78, 0x14, 0x0b, 0x19, 0x3a, 0x6d, 0xfa, 0xfa, 0x6d, 0x3a, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x74, 0x1f, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x2f, 0x00, 0x00, 0x1c, 0x27, 0x00, 0x00, 0x1c, 0x39,
+    0x00, 0x00, 0x39, 0x79, 0x7a, 0x6e, 0xec, 0xfa, 0xfa, 0xec, 0x6e, 0x7a, 0x79, 0x39, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x1d, 0xbe, 0x6c, 0x3c, 0x3c, 0x3c, 0x6c, 0xbe, 0x1d, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x3a, 0x6d, 0xfa, 0xfa, 0x6d, 0x3a, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x7a, 0x7f, 0x6d, 0xec, 0xfa, 0xfa, 0xec, 0x6d, 0x7f, 0x7a, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x18, 0xbe, 0x6d, 0x3d, 0x3c, 0x3d, 0x6d, 0xbe, 0x18, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x3d, 0x68, 0xfc, 0xfc, 0x68, 0x3d, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x7f, 0xff, 0x7f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x00,
+    0x00, 0x04, 0x01, 0x13, 0x03, 0x07, 0xb3, 0x0f, 0x2f, 0x03, 0x2f, 0x49, 0x04, 0x03, 0x00, 0x01,
+    0x40, 0x08, 0x05, 0xa3, 0x0a, 0x03, 0x5b, 0x0f, 0x27, 0x27, 0x0b, 0x4b, 0x40, 0x84, 0x11, 0x48,
+    0x0f, 0x99, 0x3c, 0x7e, 0x3d, 0xbc, 0x3e, 0x7c, 0x99, 0x27, 0x1b, 0x1a, 0x26, 0x0f, 0x0e, 0x08,
+    0x0d, 0x13, 0x12, 0x28, 0x12, 0x02, 0x0e, 0x11, 0x04, 0x26, 0x00, 0x03, 0x15, 0x00, 0x0d, 0x02,
+    0x04, 0x26, 0x13, 0x00, 0x01, 0x0b, 0x04, 0x28, 0x02, 0x10, 0x20, 0x30, 0x13, 0x08, 0x0b, 0x13,
+    0x00, 0x08, 0x49, 0x22, 0x14, 0x81, 0x42, 0x00, 0x42, 0x81, 0x14, 0x22, 0x49, 0x08, 0x00, 0x00,
+    0x44, 0xaa, 0x10, 0x88, 0x54, 0x22, 0x10, 0xaa, 0x44, 0x22, 0x54, 0x88, 0x4a, 0x15, 0xbe, 0x3f,
+    0x5e, 0x25, 0x04, 0xfc, 0x04, 0x10, 0xfc, 0x10, 0x20, 0xfc, 0x20, 0x80, 0xfc, 0x80, 0x00, 0xfe,
+    0x00, 0x24, 0xfe, 0x12, 0x00, 0xfe, 0x00, 0x48, 0xfe, 0x90, 0x0f, 0x0b, 0x00, 0x29, 0x00, 0x00,
+    0x01, 0x07, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x01, 0x06, 0x03, 0x01, 0x01, 0x0b, 0x09, 0x02, 0x08,
+    0x02, 0x0b, 0x04, 0x07, 0x0a, 0x05, 0x02, 0x05, 0x04, 0x06, 0x07, 0x08, 0x0a, 0x06, 0x0a, 0x03,
+    0xff, 0x0f, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf0, 0xff,
+    0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x3f, 0xff, 0x1f, 0xff, 0x0f, 0x05, 0x10, 0x15, 0x30,
+    0x94, 0x97, 0x9a, 0x9d, 0x10, 0x05, 0x05, 0x10, 0x15, 0x10, 0x10, 0x05, 0x30, 0x10, 0x10, 0x10,
+    0x05, 0x15, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1e, 0x37, 0x3e, 0x7c, 0x74, 0x7e,
+    0x7e, 0x74, 0x7c, 0x3e, 0x37, 0x1e, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xa5,
+    0x40, 0x08, 0x98, 0x3d, 0xb6, 0x3c, 0x36, 0x1d, 0x10, 0x48, 0x62, 0xb6, 0x1d, 0x98, 0x08, 0x42,
+    0x90, 0x08, 0x00, 0x00, 0x26, 0x1f, 0x1a, 0x1b, 0x1a, 0x1a, 0x1b, 0x1f, 0x1a, 0x1d, 0x1a, 0x1a,
+    0x10, 0x20, 0x30, 0x60, 0x50, 0x48, 0x48, 0x48, 0x40, 0x40, 0x40, 0x0f, 0x0b, 0x00, 0x18, 0x12,
+    0x0f, 0x00, 0x02, 0x04, 0x26, 0x26, 0x08, 0x0d, 0x15, 0x00, 0x03, 0x04, 0x11, 0x12, 0x0e, 0x2c,
+    0x68, 0x1d, 0x0c, 0x2c, 0x20, 0x1c, 0x0a, 0x2c, 0x40, 0x1c, 0x08, 0x2c, 0x00, 0x1c, 0xff, 0x0e,
+    0x2e, 0xe0, 0x1d, 0x0c, 0x2e, 0xea, 0x1d, 0x0a, 0x2e, 0xf4, 0x1d, 0x08, 0x2e, 0x99, 0x1c, 0xff,
+    0x27, 0x38, 0x26, 0x0c, 0x18, 0x12, 0x13, 0x04, 0x11, 0x18, 0x27, 0x1d, 0x1a, 0x26, 0x0f, 0x0e,
+    0x08, 0x0d, 0x13, 0x12, 0x27, 0x1c, 0x1a, 0x26, 0x0f, 0x0e, 0x08, 0x0d, 0x13, 0x12, 0x00, 0x00,
+    0x00, 0x1f, 0x24, 0x44, 0x24, 0x1f, 0x00, 0x00, 0x00, 0x7f, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00,
+    0x00, 0x3e, 0x41, 0x41, 0x41, 0x22, 0x00, 0x00, 0x00, 0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00,
+    0x00, 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00, 0x7f, 0x48, 0x48, 0x48, 0x40, 0x00, 0x00,
+    0x00, 0x3e, 0x41, 0x41, 0x45, 0x47, 0x00, 0x00, 0x00, 0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x7f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x7e, 0x00, 0x00,
+    0x00, 0x7f, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x7f, 0x20, 0x18, 0x20, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x10, 0x08, 0x04, 0x7f, 0x00, 0x00,
+    0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x7f, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x3e, 0x41, 0x45, 0x42, 0x3d, 0x00, 0x00, 0x00, 0x7f, 0x48, 0x4c, 0x4a, 0x31, 0x00, 0x00,
+    0x00, 0x32, 0x49, 0x49, 0x49, 0x26, 0x00, 0x00, 0x00, 0x40, 0x40, 0x7f, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x7e, 0x01, 0x01, 0x01, 0x7e, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x01, 0x02, 0x7c, 0x00, 0x00,
+    0x00, 0x7f, 0x02, 0x0c, 0x02, 0x7f, 0x00, 0x00, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x00,
+    0x00, 0x60, 0x10, 0x0f, 0x10, 0x60, 0x00, 0x00, 0x00, 0x43, 0x45, 0x49, 0x51, 0x61, 0x00, 0x00,
+    0x00, 0x3e, 0x45, 0x49, 0x51, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x21, 0x7f, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x45, 0x49, 0x49, 0x31, 0x00, 0x00, 0x00, 0x42, 0x41, 0x49, 0x59, 0x66, 0x00, 0x00,
+    0x00, 0x0c, 0x14, 0x24, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x72, 0x51, 0x51, 0x51, 0x4e, 0x00, 0x00,
+    0x00, 0x1e, 0x29, 0x49, 0x49, 0x46, 0x00, 0x00, 0x00, 0x40, 0x47, 0x48, 0x50, 0x60, 0x00, 0x00,
+    0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00, 0x00, 0x31, 0x49, 0x49, 0x4a, 0x3c, 0x00, 0x00,
+    0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+    0x00, 0x22, 0x14, 0x7f, 0x14, 0x22, 0x00, 0x00, 0x00, 0x03, 0x04, 0x78, 0x04, 0x03, 0x00, 0x00,
+    0x24, 0x1b, 0x26, 0x0e, 0x11, 0x26, 0x1c, 0x26, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x12, 0x25,
+    0x26, 0x26, 0x28, 0x1b, 0x26, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x26, 0x26, 0x1b, 0x26, 0x02,
+    0x0e, 0x08, 0x0d, 0x26, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+    0x60, 0x10, 0x0f, 0x10, 0x60, 0x30, 0x18, 0x1a, 0x3d, 0x68, 0xfc, 0xfc, 0x68, 0x3d, 0x1a, 0x00,
+    0x08, 0x0d, 0x12, 0x04, 0x11, 0x13, 0x26, 0x26, 0x02, 0x0e, 0x08, 0x0d, 0x0d, 0x2a, 0x50, 0x1f,
+    0x0a, 0x2a, 0x62, 0x1f, 0x07, 0x2a, 0xe1, 0x1f, 0xff, 0x02, 0x11, 0x04, 0x03, 0x08, 0x13, 0x26,
+    0x00, 0x60, 0x10, 0x0f, 0x10, 0x60, 0x38, 0x19, 0x3a, 0x6d, 0xfa, 0xfa, 0x6d, 0x3a, 0x19, 0x00,
+    0x00, 0x20, 0x40, 0x4d, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0xff, 0x80, 0x1f,
+    0x10, 0x97, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x01, 0xd0, 0x22, 0x20, 0x1c, 0x10, 0x94, 0x00, 0x20,
+    0x1c, 0x28, 0x1c, 0x26, 0x0f, 0x0b, 0x00, 0x18, 0x04, 0x11, 0x12, 0x26, 0x1c, 0x26, 0x02, 0x0e,
+    0x08, 0x0d, 0x12, 0x0f, 0x14, 0x12, 0x07, 0x26, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+};
+
+static const AotBlock blocks[] = {
+    { 0x0000, Block0000 },
+    { 0x0008, Block0008 },
+    { 0x0010, Block0010 },
+    { 0x0019, Block0019 },
+    { 0x0022, Block0022 },
+    { 0x0026, Block0026 },
+    { 0x0029, Block0029 },
+    { 0x002d, Block002d },
+    { 0x0030, Block0030 },
+    { 0x0035, Block0035 },
+    { 0x0038, Block0038 },
+    { 0x003e, Block003e },
+    { 0x003f, Block003f },
+    { 0x0042, Block0042 },
+    { 0x0049, Block0049 },
+    { 0x0050, Block0050 },
+    { 0x0057, Block0057 },
+    { 0x005a, Block005a },
+    { 0x005d, Block005d },
+    { 0x0064, Block0064 },
+    { 0x0067, Block0067 },
+    { 0x006f, Block006f },
+    { 0x0072, Block0072 },
+    { 0x007b, Block007b },
+    { 0x007e, Block007e },
+    { 0x0081, Block0081 },
+    { 0x0082, Block0082 },
+    { 0x008c, Block008c },
+    { 0x0097, Block0097 },
+    { 0x009e, Block009e },
+    { 0x00a5, Block00a5 },
+    { 0x00ab, Block00ab },
+    { 0x00ae, Block00ae },
+    { 0x00b1, Block00b1 },
+    { 0x00b4, Block00b4 },
+    { 0x00c7, Block00c7 },
+    { 0x00c8, Block00c8 },
+    { 0x00d2, Block00d2 },
+    { 0x00d3, Block00d3 },
+    { 0x00d7, Block00d7 },
+    { 0x0100, Block0100 },
+    { 0x0108, Block0108 },
+    { 0x0117, Block0117 },
+    { 0x012e, Block012e },
+    { 0x0136, Block0136 },
+    { 0x013b, Block013b },
+    { 0x0141, Block0141 },
+    { 0x0146, Block0146 },
+    { 0x014b, Block014b },
+    { 0x0154, Block0154 },
+    { 0x015a, Block015a },
+    { 0x0160, Block0160 },
+    { 0x0166, Block0166 },
+    { 0x0170, Block0170 },
+    { 0x017a, Block017a },
+    { 0x0183, Block0183 },
+    { 0x0188, Block0188 },
+    { 0x0194, Block0194 },
+    { 0x0195, Block0195 },
+    { 0x0197, Block0197 },
+    { 0x01a1, Block01a1 },
+    { 0x01a5, Block01a5 },
+    { 0x01b1, Block01b1 },
+    { 0x01c0, Block01c0 },
+    { 0x01c3, Block01c3 },
+    { 0x01c5, Block01c5 },
+    { 0x01cc, Block01cc },
+    { 0x01cd, Block01cd },
+    { 0x01cf, Block01cf },
+    { 0x01d9, Block01d9 },
+    { 0x01e4, Block01e4 },
+    { 0x01e6, Block01e6 },
+    { 0x01ef, Block01ef },
+    { 0x01f5, Block01f5 },
+    { 0x01f8, Block01f8 },
+    { 0x01fd, Block01fd },
+    { 0x0203, Block0203 },
+    { 0x0208, Block0208 },
+    { 0x0209, Block0209 },
+    { 0x020e, Block020e },
+    { 0x0213, Block0213 },
+    { 0x0214, Block0214 },
+    { 0x021a, Block021a },
+    { 0x021b, Block021b },
+    { 0x021e, Block021e },
+    { 0x0229, Block0229 },
+    { 0x0232, Block0232 },
+    { 0x0235, Block0235 },
+    { 0x0239, Block0239 },
+    { 0x0242, Block0242 },
+    { 0x0245, Block0245 },
+    { 0x0248, Block0248 },
+    { 0x024b, Block024b },
+    { 0x024f, Block024f },
+    { 0x0254, Block0254 },
+    { 0x025c, Block025c },
+    { 0x0262, Block0262 },
+    { 0x0277, Block0277 },
+    { 0x027c, Block027c },
+    { 0x027d, Block027d },
+    { 0x0281, Block0281 },
+    { 0x0288, Block0288 },
+    { 0x02ed, Block02ed },
+    { 0x02f5, Block02f5 },
+    { 0x02f8, Block02f8 },
+    { 0x02fb, Block02fb },
+    { 0x0305, Block0305 },
+    { 0x030e, Block030e },
+    { 0x0312, Block0312 },
+    { 0x0318, Block0318 },
+    { 0x031f, Block031f },
+    { 0x0326, Block0326 },
+    { 0x0329, Block0329 },
+    { 0x0332, Block0332 },
+    { 0x0335, Block0335 },
+    { 0x0707, Block0707 },
+    { 0x0765, Block0765 },
+    { 0x0771, Block0771 },
+    { 0x0774, Block0774 },
+    { 0x077f, Block077f },
+    { 0x078b, Block078b },
+    { 0x0793, Block0793 },
+    { 0x0798, Block0798 },
+    { 0x079b, Block079b },
+    { 0x07a3, Block07a3 },
+    { 0x07a9, Block07a9 },
+    { 0x07b5, Block07b5 },
+    { 0x07b8, Block07b8 },
+    { 0x07bb, Block07bb },
+    { 0x07cb, Block07cb },
+    { 0x07ce, Block07ce },
+    { 0x07d1, Block07d1 },
+    { 0x07d4, Block07d4 },
+    { 0x07dd, Block07dd },
+    { 0x07e7, Block07e7 },
+    { 0x07ea, Block07ea },
+    { 0x07f6, Block07f6 },
+    { 0x07f9, Block07f9 },
+    { 0x07fc, Block07fc },
+    { 0x07ff, Block07ff },
+    { 0x0804, Block0804 },
+    { 0x0807, Block0807 },
+    { 0x080e, Block080e },
+    { 0x0811, Block0811 },
+    { 0x0814, Block0814 },
+    { 0x0817, Block0817 },
+    { 0x081a, Block081a },
+    { 0x081f, Block081f },
+    { 0x0822, Block0822 },
+    { 0x0825, Block0825 },
+    { 0x0828, Block0828 },
+    { 0x082b, Block082b },
+    { 0x0832, Block0832 },
+    { 0x0835, Block0835 },
+    { 0x0838, Block0838 },
+    { 0x083b, Block083b },
+    { 0x083e, Block083e },
+    { 0x0841, Block0841 },
+    { 0x0844, Block0844 },
+    { 0x0849, Block0849 },
+    { 0x084e, Block084e },
+    { 0x0851, Block0851 },
+    { 0x0857, Block0857 },
+    { 0x085d, Block085d },
+    { 0x0861, Block0861 },
+    { 0x0866, Block0866 },
+    { 0x086a, Block086a },
+    { 0x086d, Block086d },
+    { 0x0872, Block0872 },
+    { 0x0875, Block0875 },
+    { 0x0878, Block0878 },
+    { 0x0886, Block0886 },
+    { 0x088d, Block088d },
+    { 0x0898, Block0898 },
+    { 0x08a4, Block08a4 },
+    { 0x08a9, Block08a9 },
+    { 0x08ae, Block08ae },
+    { 0x08b3, Block08b3 },
+    { 0x08b6, Block08b6 },
+    { 0x08b9, Block08b9 },
+    { 0x08bc, Block08bc },
+    { 0x08c8, Block08c8 },
+    { 0x08cb, Block08cb },
+    { 0x08ce, Block08ce },
+    { 0x08d3, Block08d3 },
+    { 0x08d8, Block08d8 },
+    { 0x08de, Block08de },
+    { 0x08e4, Block08e4 },
+    { 0x08e9, Block08e9 },
+    { 0x08f3, Block08f3 },
+    { 0x08f8, Block08f8 },
+    { 0x08fe, Block08fe },
+    { 0x08ff, Block08ff },
+    { 0x0910, Block0910 },
+    { 0x0913, Block0913 },
+    { 0x0919, Block0919 },
+    { 0x0921, Block0921 },
+    { 0x0929, Block0929 },
+    { 0x092e, Block092e },
+    { 0x0931, Block0931 },
+    { 0x0935, Block0935 },
+    { 0x0938, Block0938 },
+    { 0x093d, Block093d },
+    { 0x0941, Block0941 },
+    { 0x0946, Block0946 },
+    { 0x0948, Block0948 },
+    { 0x094b, Block094b },
+    { 0x094f, Block094f },
+    { 0x0952, Block0952 },
+    { 0x0958, Block0958 },
+    { 0x095e, Block095e },
+    { 0x0966, Block0966 },
+    { 0x096b, Block096b },
+    { 0x096e, Block096e },
+    { 0x097c, Block097c },
+    { 0x0982, Block0982 },
+    { 0x0986, Block0986 },
+    { 0x0988, Block0988 },
+    { 0x098b, Block098b },
+    { 0x0990, Block0990 },
+    { 0x099d, Block099d },
+    { 0x09a3, Block09a3 },
+    { 0x09ad, Block09ad },
+    { 0x09b1, Block09b1 },
+    { 0x09b2, Block09b2 },
+    { 0x09bd, Block09bd },
+    { 0x09c3, Block09c3 },
+    { 0x09c5, Block09c5 },
+    { 0x09ca, Block09ca },
+    { 0x09d2, Block09d2 },
+    { 0x09d6, Block09d6 },
+    { 0x09d9, Block09d9 },
+    { 0x09e4, Block09e4 },
+    { 0x09e8, Block09e8 },
+    { 0x09ee, Block09ee },
+    { 0x09ef, Block09ef },
+    { 0x09f2, Block09f2 },
+    { 0x09f9, Block09f9 },
+    { 0x0a00, Block0a00 },
+    { 0x0a13, Block0a13 },
+    { 0x0a18, Block0a18 },
+    { 0x0a25, Block0a25 },
+    { 0x0a2d, Block0a2d },
+    { 0x0a30, Block0a30 },
+    { 0x0a33, Block0a33 },
+    { 0x0a36, Block0a36 },
+    { 0x0a39, Block0a39 },
+    { 0x0a3c, Block0a3c },
+    { 0x0a3f, Block0a3f },
+    { 0x0a42, Block0a42 },
+    { 0x0a47, Block0a47 },
+    { 0x0a4c, Block0a4c },
+    { 0x0a4f, Block0a4f },
+    { 0x0a52, Block0a52 },
+    { 0x0a55, Block0a55 },
+    { 0x0a58, Block0a58 },
+    { 0x0a59, Block0a59 },
+    { 0x0a5f, Block0a5f },
+    { 0x0a66, Block0a66 },
+    { 0x0a6c, Block0a6c },
+    { 0x0a71, Block0a71 },
+    { 0x0a7c, Block0a7c },
+    { 0x0a80, Block0a80 },
+    { 0x0a87, Block0a87 },
+    { 0x0a8e, Block0a8e },
+    { 0x0a93, Block0a93 },
+    { 0x0a98, Block0a98 },
+    { 0x0a9e, Block0a9e },
+    { 0x0aa5, Block0aa5 },
+    { 0x0aaa, Block0aaa },
+    { 0x0aab, Block0aab },
+    { 0x0ab1, Block0ab1 },
+    { 0x0ab6, Block0ab6 },
+    { 0x0abb, Block0abb },
+    { 0x0abf, Block0abf },
+    { 0x0ac6, Block0ac6 },
+    { 0x0aca, Block0aca },
+    { 0x0ace, Block0ace },
+    { 0x0acf, Block0acf },
+    { 0x0ad7, Block0ad7 },
+    { 0x0ada, Block0ada },
+    { 0x0ae1, Block0ae1 },
+    { 0x0ae2, Block0ae2 },
+    { 0x0aea, Block0aea },
+    { 0x0aef, Block0aef },
+    { 0x0af2, Block0af2 },
+    { 0x0af6, Block0af6 },
+    { 0x0b02, Block0b02 },
+    { 0x0b08, Block0b08 },
+    { 0x0b0b, Block0b0b },
+    { 0x0b0e, Block0b0e },
+    { 0x0b11, Block0b11 },
+    { 0x0b14, Block0b14 },
+    { 0x0b17, Block0b17 },
+    { 0x0b1e, Block0b1e },
+    { 0x0b24, Block0b24 },
+    { 0x0b27, Block0b27 },
+    { 0x0b2d, Block0b2d },
+    { 0x0b30, Block0b30 },
+    { 0x0b33, Block0b33 },
+    { 0x0b39, Block0b39 },
+    { 0x0b3c, Block0b3c },
+    { 0x0b3f, Block0b3f },
+    { 0x0b47, Block0b47 },
+    { 0x0b4a, Block0b4a },
+    { 0x0b4d, Block0b4d },
+    { 0x0b54, Block0b54 },
+    { 0x0b57, Block0b57 },
+    { 0x0b5d, Block0b5d },
+    { 0x0b60, Block0b60 },
+    { 0x0b63, Block0b63 },
+    { 0x0b66, Block0b66 },
+    { 0x0b69, Block0b69 },
+    { 0x0b71, Block0b71 },
+    { 0x0b74, Block0b74 },
+    { 0x0b79, Block0b79 },
+    { 0x0b7c, Block0b7c },
+    { 0x0b7f, Block0b7f },
+    { 0x0b83, Block0b83 },
+    { 0x0b86, Block0b86 },
+    { 0x0b89, Block0b89 },
+    { 0x0b90, Block0b90 },
+    { 0x0b93, Block0b93 },
+    { 0x0b9e, Block0b9e },
+    { 0x0ba6, Block0ba6 },
+    { 0x0bae, Block0bae },
+    { 0x0bb4, Block0bb4 },
+    { 0x0bb9, Block0bb9 },
+    { 0x0bbd, Block0bbd },
+    { 0x0bc3, Block0bc3 },
+    { 0x0bc6, Block0bc6 },
+    { 0x0bce, Block0bce },
+    { 0x0bd4, Block0bd4 },
+    { 0x0bd7, Block0bd7 },
+    { 0x0bda, Block0bda },
+    { 0x0be5, Block0be5 },
+    { 0x0be8, Block0be8 },
+    { 0x0bee, Block0bee },
+    { 0x0bf1, Block0bf1 },
+    { 0x0bf4, Block0bf4 },
+    { 0x1424, Block1424 },
+    { 0x1427, Block1427 },
+    { 0x1438, Block1438 },
+    { 0x1439, Block1439 },
+    { 0x1446, Block1446 },
+    { 0x1474, Block1474 },
+    { 0x1479, Block1479 },
+    { 0x147c, Block147c },
+    { 0x147e, Block147e },
+    { 0x1486, Block1486 },
+    { 0x1490, Block1490 },
+    { 0x14cb, Block14cb },
+    { 0x14cc, Block14cc },
+    { 0x14d7, Block14d7 },
+    { 0x14d8, Block14d8 },
+    { 0x14de, Block14de },
+    { 0x14e1, Block14e1 },
+    { 0x14ea, Block14ea },
+    { 0x14ef, Block14ef },
+    { 0x14f5, Block14f5 },
+    { 0x1500, Block1500 },
+    { 0x1504, Block1504 },
+    { 0x1508, Block1508 },
+    { 0x150f, Block150f },
+    { 0x151a, Block151a },
+    { 0x151f, Block151f },
+    { 0x1524, Block1524 },
+    { 0x1527, Block1527 },
+    { 0x152a, Block152a },
+    { 0x1530, Block1530 },
+    { 0x1538, Block1538 },
+    { 0x153d, Block153d },
+    { 0x1545, Block1545 },
+    { 0x154a, Block154a },
+    { 0x1554, Block1554 },
+    { 0x155a, Block155a },
+    { 0x155c, Block155c },
+    { 0x1562, Block1562 },
+    { 0x1569, Block1569 },
+    { 0x156f, Block156f },
+    { 0x1575, Block1575 },
+    { 0x1579, Block1579 },
+    { 0x1581, Block1581 },
+    { 0x1590, Block1590 },
+    { 0x1596, Block1596 },
+    { 0x1597, Block1597 },
+    { 0x159e, Block159e },
+    { 0x15a4, Block15a4 },
+    { 0x15a5, Block15a5 },
+    { 0x15a9, Block15a9 },
+    { 0x15b7, Block15b7 },
+    { 0x15bd, Block15bd },
+    { 0x15be, Block15be },
+    { 0x15c1, Block15c1 },
+    { 0x15c5, Block15c5 },
+    { 0x15c7, Block15c7 },
+    { 0x15cc, Block15cc },
+    { 0x15d1, Block15d1 },
+    { 0x15d3, Block15d3 },
+    { 0x15d6, Block15d6 },
+    { 0x15d7, Block15d7 },
+    { 0x15de, Block15de },
+    { 0x15e6, Block15e6 },
+    { 0x15f1, Block15f1 },
+    { 0x15f3, Block15f3 },
+    { 0x15f6, Block15f6 },
+    { 0x15f9, Block15f9 },
+    { 0x15fe, Block15fe },
+    { 0x15ff, Block15ff },
+    { 0x1604, Block1604 },
+    { 0x160b, Block160b },
+    { 0x1611, Block1611 },
+    { 0x1618, Block1618 },
+    { 0x161e, Block161e },
+    { 0x1626, Block1626 },
+    { 0x162b, Block162b },
+    { 0x1632, Block1632 },
+    { 0x1639, Block1639 },
+    { 0x163c, Block163c },
+    { 0x163f, Block163f },
+    { 0x1648, Block1648 },
+    { 0x164b, Block164b },
+    { 0x164e, Block164e },
+    { 0x1652, Block1652 },
+    { 0x1661, Block1661 },
+    { 0x1663, Block1663 },
+    { 0x166b, Block166b },
+    { 0x1671, Block1671 },
+    { 0x1674, Block1674 },
+    { 0x1679, Block1679 },
+    { 0x1685, Block1685 },
+    { 0x1688, Block1688 },
+    { 0x168b, Block168b },
+    { 0x168f, Block168f },
+    { 0x1698, Block1698 },
+    { 0x169f, Block169f },
+    { 0x16aa, Block16aa },
+    { 0x16b5, Block16b5 },
+    { 0x16b7, Block16b7 },
+    { 0x16bb, Block16bb },
+    { 0x16be, Block16be },
+    { 0x16c1, Block16c1 },
+    { 0x16c6, Block16c6 },
+    { 0x16c9, Block16c9 },
+    { 0x16d4, Block16d4 },
+    { 0x16d7, Block16d7 },
+    { 0x16da, Block16da },
+    { 0x16e0, Block16e0 },
+    { 0x16e3, Block16e3 },
+    { 0x16e6, Block16e6 },
+    { 0x16ee, Block16ee },
+    { 0x16f1, Block16f1 },
+    { 0x16f6, Block16f6 },
+    { 0x16f9, Block16f9 },
+    { 0x16fc, Block16fc },
+    { 0x16ff, Block16ff },
+    { 0x1705, Block1705 },
+    { 0x1709, Block1709 },
+    { 0x170e, Block170e },
+    { 0x1711, Block1711 },
+    { 0x171c, Block171c },
+    { 0x1721, Block1721 },
+    { 0x1727, Block1727 },
+    { 0x172c, Block172c },
+    { 0x1734, Block1734 },
+    { 0x1739, Block1739 },
+    { 0x1740, Block1740 },
+    { 0x1747, Block1747 },
+    { 0x174e, Block174e },
+    { 0x1753, Block1753 },
+    { 0x1759, Block1759 },
+    { 0x1760, Block1760 },
+    { 0x176d, Block176d },
+    { 0x1774, Block1774 },
+    { 0x1775, Block1775 },
+    { 0x177c, Block177c },
+    { 0x1785, Block1785 },
+    { 0x1789, Block1789 },
+    { 0x178e, Block178e },
+    { 0x17a2, Block17a2 },
+    { 0x17a4, Block17a4 },
+    { 0x17aa, Block17aa },
+    { 0x17af, Block17af },
+    { 0x17c0, Block17c0 },
+    { 0x17c9, Block17c9 },
+    { 0x17cc, Block17cc },
+    { 0x17cf, Block17cf },
+    { 0x17d2, Block17d2 },
+    { 0x17d7, Block17d7 },
+    { 0x17dc, Block17dc },
+    { 0x17df, Block17df },
+    { 0x17e3, Block17e3 },
+    { 0x17eb, Block17eb },
+    { 0x17f7, Block17f7 },
+    { 0x17fa, Block17fa },
+    { 0x1804, Block1804 },
+    { 0x180c, Block180c },
+    { 0x1810, Block1810 },
+    { 0x1815, Block1815 },
+    { 0x1820, Block1820 },
+    { 0x1828, Block1828 },
+    { 0x182b, Block182b },
+    { 0x182e, Block182e },
+    { 0x1831, Block1831 },
+    { 0x1837, Block1837 },
+    { 0x183a, Block183a },
+    { 0x183d, Block183d },
+    { 0x183e, Block183e },
+    { 0x1841, Block1841 },
+    { 0x1844, Block1844 },
+    { 0x184a, Block184a },
+    { 0x184c, Block184c },
+    { 0x1854, Block1854 },
+    { 0x1856, Block1856 },
+    { 0x185b, Block185b },
+    { 0x1868, Block1868 },
+    { 0x1871, Block1871 },
+    { 0x1879, Block1879 },
+    { 0x1884, Block1884 },
+    { 0x1888, Block1888 },
+    { 0x1891, Block1891 },
+    { 0x1898, Block1898 },
+    { 0x189e, Block189e },
+    { 0x18a9, Block18a9 },
+    { 0x18b8, Block18b8 },
+    { 0x18c0, Block18c0 },
+    { 0x18c8, Block18c8 },
+    { 0x18d1, Block18d1 },
+    { 0x18d4, Block18d4 },
+    { 0x18dc, Block18dc },
+    { 0x18df, Block18df },
+    { 0x18e7, Block18e7 },
+    { 0x18ef, Block18ef },
+    { 0x18f1, Block18f1 },
+    { 0x18f8, Block18f8 },
+    { 0x18fa, Block18fa },
+    { 0x1903, Block1903 },
+    { 0x1904, Block1904 },
+    { 0x190a, Block190a },
+    { 0x190d, Block190d },
+    { 0x1910, Block1910 },
+    { 0x1918, Block1918 },
+    { 0x191a, Block191a },
+    { 0x1925, Block1925 },
+    { 0x192b, Block192b },
+    { 0x1931, Block1931 },
+    { 0x193c, Block193c },
+    { 0x1947, Block1947 },
+    { 0x1950, Block1950 },
+    { 0x1956, Block1956 },
+    { 0x1959, Block1959 },
+    { 0x195c, Block195c },
+    { 0x195f, Block195f },
+    { 0x1962, Block1962 },
+    { 0x1965, Block1965 },
+    { 0x1968, Block1968 },
+    { 0x196b, Block196b },
+    { 0x196e, Block196e },
+    { 0x1971, Block1971 },
+    { 0x1979, Block1979 },
+    { 0x197c, Block197c },
+    { 0x197f, Block197f },
+    { 0x1982, Block1982 },
+    { 0x1988, Block1988 },
+    { 0x199a, Block199a },
+    { 0x19a3, Block19a3 },
+    { 0x19a8, Block19a8 },
+    { 0x19ae, Block19ae },
+    { 0x19b3, Block19b3 },
+    { 0x19d1, Block19d1 },
+    { 0x19d3, Block19d3 },
+    { 0x19d7, Block19d7 },
+    { 0x19dc, Block19dc },
+    { 0x19e5, Block19e5 },
+    { 0x19e6, Block19e6 },
+    { 0x19ec, Block19ec },
+    { 0x19f5, Block19f5 },
+    { 0x19fa, Block19fa },
+    { 0x19ff, Block19ff },
+    { 0x1a05, Block1a05 },
+    { 0x1a32, Block1a32 },
+    { 0x1a3a, Block1a3a },
+    { 0x1a3b, Block1a3b },
+    { 0x1a47, Block1a47 },
+    { 0x1a4a, Block1a4a },
+    { 0x1a54, Block1a54 },
+    { 0x1a5c, Block1a5c },
+    { 0x1a5f, Block1a5f },
+    { 0x1a68, Block1a68 },
+    { 0x1a69, Block1a69 },
+    { 0x1a6b, Block1a6b },
+    { 0x1a74, Block1a74 },
+    { 0x1a7e, Block1a7e },
+    { 0x1a7f, Block1a7f },
+    { 0x1a82, Block1a82 },
+    { 0x1a84, Block1a84 },
+    { 0x1a8a, Block1a8a },
+    { 0x1a8b, Block1a8b },
+};
+
+extern const AotProgram invaders_aot;
+const AotProgram invaders_aot = { 0x0000, 0x2000, image, blocks, sizeof(blocks) / sizeof(blocks[0]) };
@@ -0,0 +1,1338 @@
+#include "invadersbatch.h"
+#include "i8080flags.h"
+#include "machine.h"
+
+#include <string.h>
+
+#include <QDebug>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BATCH_AVX2
+#include <immintrin.h>
+#endif
+
+namespace {
+
+enum Operand { RegB, RegC, RegD, RegE, RegH, RegL, RegM, RegA };
+
+// The instruction a group executes, decoded once for all of its lanes.
+struct Group {
+    const int *lanes;
+    int n;
+    uint16_t next;  // pc of the next instruction
+    int cycles;
+    uint8_t imm;    // d8 operand
+    uint16_t addr;  // d16 or address operand
+};
+
+inline uint8_t *Memory(const BatchLanes &s, int l)
+{
+    return s.mem + ((size_t)l << 14);
+}
+
+// Lane memory is mapped like a Machine's, see Machine::Machine(): the
+// ROM at $0000-$1FFF, where writes are dropped, the RAM at $2000-$3FFF,
+// and $4000- mirroring the RAM.
+inline uint16_t Storage(uint16_t addr)
+{
+    return (addr < 0x4000) ? addr : (0x2000 | (addr & 0x1fff));
+}
+
+inline uint8_t Load(const BatchLanes &s, int l, uint16_t addr)
+{
+    return Memory(s, l)[Storage(addr)];
+}
+
+inline void Store(const BatchLanes &s, int l, uint16_t addr, uint8_t val)
+{
+    const uint16_t at = Storage(addr);
+    if (at >= 0x2000) {
+        Memory(s, l)[at] = val;
+    }
+}
+
+// Runs `f` for every lane of the group, after advancing its pc and
+// cycles as for an instruction that does not branch.
+template<bool All, class F>
+inline void ForLanes(const BatchLanes &s, const Group &g, F f)
+{
+    for (int i = 0; i < g.n; i++) {
+        const int l = All ? i : g.lanes[i];
+        s.pc[l] = g.next;
+        s.cycles[l] += g.cycles;
+        f(l);
+    }
+}
+
+template<int R>
+inline uint8_t Read(const BatchLanes &s, int l)
+{
+    if (R == RegM) {
+        return Load(s, l, (s.r[RegH][l] << 8) | s.r[RegL][l]);
+    }
+    return s.r[R][l];
+}
+
+template<int R>
+inline void Write(const BatchLanes &s, int l, uint8_t val)
+{
+    if (R == RegM) {
+        Store(s, l, (s.r[RegH][l] << 8) | s.r[RegL][l], val);
+    } else {
+        s.r[R][l] = val;
+    }
+}
+
+inline void Push(const BatchLanes &s, int l, uint8_t high, uint8_t low)
+{
+    Store(s, l, s.sp[l]-1, high);
+    Store(s, l, s.sp[l]-2, low);
+    s.sp[l] -= 2;
+}
+
+inline uint16_t Pop(const BatchLanes &s, int l)
+{
+    uint16_t val = (uint16_t)((Load(s, l, s.sp[l]+1) << 8) | Load(s, l, s.sp[l]));
+    s.sp[l] += 2;
+    return val;
+}
+
+// Takes the ALU flags from a flag table entry, see i8080flags.h
+inline void SetFlags(const BatchLanes &s, int l, uint8_t table_flags)
+{
+    s.flags[l] = (s.flags[l] & ~ALU_FLAGS) | table_flags;
+}
+
+inline int Carry(const BatchLanes &s, int l)
+{
+    return (s.flags[l] & FlagCarry) ? 1 : 0;
+}
+
+template<int Flag, bool Set>
+inline bool Condition(const BatchLanes &s, int l)
+{
+    return ((s.flags[l] & Flag) != 0) == Set;
+}
+
+// MOV D,S
+template<bool All, int D, int S>
+inline void Mov(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) { Write<D>(s, l, Read<S>(s, l)); });
+}
+
+// MVI D,d8
+template<bool All, int D>
+inline void Mvi(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) { Write<D>(s, l, g.imm); });
+}
+
+// INR D
+template<bool All, int D>
+inline void Inr(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint8_t res = Read<D>(s, l) + 1;
+        s.flags[l] = (s.flags[l] & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[res];
+        Write<D>(s, l, res);
+    });
+}
+
+// DCR D
+template<bool All, int D>
+inline void Dcr(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint8_t res = Read<D>(s, l) - 1;
+        s.flags[l] = (s.flags[l] & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[res];
+        Write<D>(s, l, res);
+    });
+}
+
+// ADD S, ADC S
+template<bool All, bool WithCarry, int S>
+inline void Add(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint8_t a = s.r[RegA][l], val = Read<S>(s, l);
+        int carry = WithCarry ? Carry(s, l) : 0;
+        SetFlags(s, l, add_flags[carry][a][val]);
+        s.r[RegA][l] = a + val + carry;
+    });
+}
+
+// SUB S, SBB S
+template<bool All, bool WithBorrow, int S>
+inline void Sub(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint8_t a = s.r[RegA][l], val = Read<S>(s, l);
+        int borrow = WithBorrow ? Carry(s, l) : 0;
+        SetFlags(s, l, sub_flags[borrow][a][val]);
+        s.r[RegA][l] = a - val - borrow;
+    });
+}
+
+template<bool All, int S> inline void Adc(const BatchLanes &s, const Group &g) { Add<All, true, S>(s, g); }
+template<bool All, int S> inline void Sbb(const BatchLanes &s, const Group &g) { Sub<All, true, S>(s, g); }
+template<bool All, int S> inline void AddNoCarry(const BatchLanes &s, const Group &g) { Add<All, false, S>(s, g); }
+template<bool All, int S> inline void SubNoBorrow(const BatchLanes &s, const Group &g) { Sub<All, false, S>(s, g); }
+
+// ANA S
+template<bool All, int S>
+inline void Ana(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        s.r[RegA][l] &= Read<S>(s, l);
+        SetFlags(s, l, zsp_flags[s.r[RegA][l]]);
+    });
+}
+
+// XRA S
+template<bool All, int S>
+inline void Xra(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        s.r[RegA][l] ^= Read<S>(s, l);
+        SetFlags(s, l, zsp_flags[s.r[RegA][l]]);
+    });
+}
+
+// ORA S
+template<bool All, int S>
+inline void Ora(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        s.r[RegA][l] |= Read<S>(s, l);
+        SetFlags(s, l, zsp_flags[s.r[RegA][l]]);
+    });
+}
+
+// CMP S
+template<bool All, int S>
+inline void Cmp(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) { SetFlags(s, l, sub_flags[0][s.r[RegA][l]][Read<S>(s, l)]); });
+}
+
+// LXI H,d16 where the pair is H (high) and L (low)
+template<bool All, int H, int L>
+inline void Lxi(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        s.r[L][l] = g.addr & 0xff;
+        s.r[H][l] = g.addr >> 8;
+    });
+}
+
+// INX H
+template<bool All, int H, int L>
+inline void Inx(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint16_t val = ((s.r[H][l] << 8) | s.r[L][l]) + 1;
+        s.r[H][l] = val >> 8;
+        s.r[L][l] = val & 0xff;
+    });
+}
+
+// DCX H
+template<bool All, int H, int L>
+inline void Dcx(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint16_t val = ((s.r[H][l] << 8) | s.r[L][l]) - 1;
+        s.r[H][l] = val >> 8;
+        s.r[L][l] = val & 0xff;
+    });
+}
+
+// DAD H
+template<bool All, int H, int L>
+inline void Dad(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint32_t add = ((s.r[RegH][l] << 8) | s.r[RegL][l]) + ((s.r[H][l] << 8) | s.r[L][l]);
+        s.r[RegH][l] = (add >> 8) & 0xff;
+        s.r[RegL][l] = add & 0xff;
+        s.flags[l] = (s.flags[l] & ~FlagCarry) | ((add >> 16) ? FlagCarry : 0);
+    });
+}
+
+// PUSH H, disables the lane outside of safe memory like PushPair()
+template<bool All, int H, int L>
+inline void PushPair(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        if (((s.sp[l]-2) < 0x2000) || ((s.sp[l]-1) >= 0x4000)) {
+            s.flags[l] &= ~(1 << 6);
+        }
+        Push(s, l, s.r[H][l], s.r[L][l]);
+    });
+}
+
+// POP H
+template<bool All, int H, int L>
+inline void PopPair(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        uint16_t val = Pop(s, l);
+        s.r[H][l] = val >> 8;
+        s.r[L][l] = val & 0xff;
+    });
+}
+
+// Jcc addr
+template<bool All, int Flag, bool Set>
+inline void JumpIf(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        if (Condition<Flag, Set>(s, l)) {
+            s.pc[l] = g.addr;
+        }
+    });
+}
+
+// Ccc addr
+template<bool All, int Flag, bool Set>
+inline void CallIf(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        if (Condition<Flag, Set>(s, l)) {
+            Push(s, l, g.next >> 8, g.next & 0xff);
+            s.pc[l] = g.addr;
+        } else {
+            s.cycles[l] += 11 - g.cycles;
+        }
+    });
+}
+
+// Rcc
+template<bool All, int Flag, bool Set>
+inline void ReturnIf(const BatchLanes &s, const Group &g)
+{
+    ForLanes<All>(s, g, [&](int l) {
+        if (Condition<Flag, Set>(s, l)) {
+            s.pc[l] = Pop(s, l);
+        } else {
+            s.cycles[l] += 5 - g.cycles;
+        }
+    });
+}
+
+#ifdef BATCH_AVX2
+/*
+ AVX2 groups
+
+ The functions are compiled for AVX2 whatever the build's target, and
+ only called if vectorAvailable(). A chunk is 32 lanes from a multiple
+ of 32, a byte per lane in the 8 bit arrays. The arrays are padded to
+ whole chunks, the padding lanes are disabled and never in a group.
+*/
+#define VECTOR __attribute__((target("avx2")))
+
+// The instruction a group executes, for the lanes of `bits`.
+struct VectorGroup {
+    const uint32_t *bits;
+    int chunks;
+    uint16_t next;
+    int cycles;
+    uint8_t imm;
+    uint16_t addr;
+};
+
+// Immediate source operand of Alu
+const int Immediate = 8;
+
+enum AluOp { AluAdd, AluAdc, AluSub, AluSbb, AluAna, AluXra, AluOra, AluCmp };
+
+// 64 bit masks of 4 lanes, indexed by 4 bits of a group
+alignas(32) const uint64_t lane_masks[16][4] = {
+#define M(b) ((b) ? ~0ull : 0ull)
+#define ROW(i) { M((i) & 1), M((i) & 2), M((i) & 4), M((i) & 8) }
+    ROW(0), ROW(1), ROW(2), ROW(3), ROW(4), ROW(5), ROW(6), ROW(7),
+    ROW(8), ROW(9), ROW(10), ROW(11), ROW(12), ROW(13), ROW(14), ROW(15)
+#undef ROW
+#undef M
+};
+
+// A byte per lane, 0xff for the lanes of the 32 `bits`
+VECTOR inline __m256i ByteMask(uint32_t bits)
+{
+    const __m256i spread = _mm256_setr_epi64x(0x0000000000000000, 0x0101010101010101,
+                                              0x0202020202020202, 0x0303030303030303);
+    const __m256i select = _mm256_set1_epi64x(0x8040201008040201);
+    const __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(bits), spread);
+    return _mm256_cmpeq_epi8(_mm256_and_si256(bytes, select), select);
+}
+
+VECTOR inline __m256i Get(const uint8_t *lanes)
+{
+    return _mm256_loadu_si256((const __m256i *)lanes);
+}
+
+// Stores `val` to the lanes of `member`
+VECTOR inline void Put(uint8_t *lanes, __m256i val, __m256i member)
+{
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_blendv_epi8(Get(lanes), val, member));
+}
+
+VECTOR inline __m256i Bytes(uint8_t val)
+{
+    return _mm256_set1_epi8((char)val);
+}
+
+// Sets the pc of the lanes of `member` (bytes) to `pc` (16 bit lanes)
+VECTOR inline void PutPc(uint16_t *lanes, __m256i pc, __m256i member)
+{
+    const __m256i low = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(member));
+    const __m256i high = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(member, 1));
+    _mm256_storeu_si256((__m256i *)lanes,
+                        _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i *)lanes), pc, low));
+    _mm256_storeu_si256((__m256i *)(lanes + 16),
+                        _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i *)(lanes + 16)), pc, high));
+}
+
+// Z, S and P of the result bytes, as zsp_flags
+VECTOR inline __m256i ZspFlags(__m256i res)
+{
+    // P of each nibble, set on odd parity
+    const __m256i parity = _mm256_setr_epi8(
+        0, 4, 4, 0, 4, 0, 0, 4, 4, 0, 0, 4, 0, 4, 4, 0,
+        0, 4, 4, 0, 4, 0, 0, 4, 4, 0, 0, 4, 0, 4, 4, 0);
+    const __m256i nibble = Bytes(0x0f);
+    const __m256i zero = _mm256_and_si256(_mm256_cmpeq_epi8(res, _mm256_setzero_si256()), Bytes(FlagZero));
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi16(res, 6), Bytes(FlagSign));
+    const __m256i odd = _mm256_xor_si256(_mm256_shuffle_epi8(parity, _mm256_and_si256(res, nibble)),
+                                         _mm256_shuffle_epi8(parity, _mm256_and_si256(_mm256_srli_epi16(res, 4), nibble)));
+    return _mm256_or_si256(_mm256_or_si256(zero, sign), _mm256_xor_si256(odd, Bytes(FlagParity)));
+}
+
+// `flag` in the lanes where `a` and `b` differ
+VECTOR inline __m256i FlagIfNot(__m256i a, __m256i b, uint8_t flag)
+{
+    return _mm256_andnot_si256(_mm256_cmpeq_epi8(a, b), Bytes(flag));
+}
+
+// Replaces the `mask` bits of the lanes' flags by `val`
+VECTOR inline void PutFlags(const BatchLanes &s, int base, uint8_t mask, __m256i val, __m256i member)
+{
+    const __m256i flags = _mm256_or_si256(_mm256_andnot_si256(Bytes(mask), Get(s.flags + base)), val);
+    Put(s.flags + base, flags, member);
+}
+
+// Runs `Op` for every chunk with lanes of the group, after advancing
+// their pc and cycles as ForLanes() does.
+template<class Op>
+VECTOR void ForChunks(const BatchLanes &s, const VectorGroup &g)
+{
+    const __m256i next = _mm256_set1_epi16((short)g.next);
+    const __m256i cycles = _mm256_set1_epi64x(g.cycles);
+    for (int c = 0; c < g.chunks; c++) {
+        const uint32_t bits = g.bits[c];
+        if (!bits) {
+            continue;
+        }
+        const int base = c << 5;
+        const __m256i member = ByteMask(bits);
+        PutPc(s.pc + base, next, member);
+        for (int i = 0; i < 8; i++) {
+            __m256i *lanes = (__m256i *)(s.cycles + base + 4*i);
+            const __m256i add = _mm256_and_si256(cycles, _mm256_load_si256((const __m256i *)lane_masks[(bits >> (4*i)) & 15]));
+            _mm256_storeu_si256(lanes, _mm256_add_epi64(_mm256_loadu_si256(lanes), add));
+        }
+        Op::execute(s, g, base, member);
+    }
+}
+
+struct VectorNop {
+    VECTOR static void execute(const BatchLanes &, const VectorGroup &, int, __m256i) {}
+};
+
+// MOV D,S
+template<int D, int S>
+struct VectorMov {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &, int base, __m256i member) {
+        Put(s.r[D] + base, Get(s.r[S] + base), member);
+    }
+};
+
+// MVI D,d8
+template<int D>
+struct VectorMvi {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &g, int base, __m256i member) {
+        Put(s.r[D] + base, Bytes(g.imm), member);
+    }
+};
+
+// LXI H,d16
+template<int H, int L>
+struct VectorLxi {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &g, int base, __m256i member) {
+        Put(s.r[L] + base, Bytes(g.addr & 0xff), member);
+        Put(s.r[H] + base, Bytes(g.addr >> 8), member);
+    }
+};
+
+// INX H, the carry out of L is a compare with 0, -1 where L wrapped
+template<int H, int L>
+struct VectorInx {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &, int base, __m256i member) {
+        const __m256i low = _mm256_add_epi8(Get(s.r[L] + base), Bytes(1));
+        const __m256i wrapped = _mm256_cmpeq_epi8(low, _mm256_setzero_si256());
+        Put(s.r[L] + base, low, member);
+        Put(s.r[H] + base, _mm256_sub_epi8(Get(s.r[H] + base), wrapped), member);
+    }
+};
+
+// DCX H
+template<int H, int L>
+struct VectorDcx {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &, int base, __m256i member) {
+        const __m256i low = Get(s.r[L] + base);
+        const __m256i wraps = _mm256_cmpeq_epi8(low, _mm256_setzero_si256());
+        Put(s.r[L] + base, _mm256_sub_epi8(low, Bytes(1)), member);
+        Put(s.r[H] + base, _mm256_add_epi8(Get(s.r[H] + base), wraps), member);
+    }
+};
+
+// INR D, DCR D
+template<int D, bool Increment>
+struct VectorInr {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &, int base, __m256i member) {
+        const __m256i res = Increment ? _mm256_add_epi8(Get(s.r[D] + base), Bytes(1))
+                                      : _mm256_sub_epi8(Get(s.r[D] + base), Bytes(1));
+        const __m256i low = _mm256_and_si256(res, Bytes(0x0f));
+        const __m256i aux = Increment ? _mm256_andnot_si256(FlagIfNot(low, _mm256_setzero_si256(), FlagAuxCarry), Bytes(FlagAuxCarry))
+                                      : FlagIfNot(low, Bytes(0x0f), FlagAuxCarry);
+        PutFlags(s, base, ALU_FLAGS & ~FlagCarry, _mm256_or_si256(ZspFlags(res), aux), member);
+        Put(s.r[D] + base, res, member);
+    }
+};
+
+/*
+ ADD, ADC, SUB, SBB, ANA, XRA, ORA and CMP of register S, or of the
+ immediate operand, ADI, ACI, SUI, SBI, ANI, XRI, ORI and CPI. A carry
+ or borrow is where the saturating sum or difference differs from the
+ wrapping one, AC is bit 4 of a ^ val ^ res, inverted for a borrow.
+*/
+template<int Op, int S>
+struct VectorAlu {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &g, int base, __m256i member) {
+        const __m256i a = Get(s.r[RegA] + base);
+        const __m256i val = (S == Immediate) ? Bytes(g.imm) : Get(s.r[S & 7] + base);
+        const __m256i carry = _mm256_and_si256(_mm256_srli_epi16(Get(s.flags + base), 3), Bytes(1));
+        __m256i res, flags;
+        uint8_t mask = ALU_FLAGS;
+        switch (Op) {
+        case AluAdd:
+        case AluAdc: {
+            const __m256i sum = _mm256_add_epi8(a, val);
+            flags = FlagIfNot(_mm256_adds_epu8(a, val), sum, FlagCarry);
+            res = sum;
+            if (Op == AluAdc) {
+                res = _mm256_add_epi8(sum, carry);
+                flags = _mm256_or_si256(flags, FlagIfNot(_mm256_adds_epu8(sum, carry), res, FlagCarry));
+            }
+            flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_xor_si256(_mm256_xor_si256(a, val), res), Bytes(FlagAuxCarry)));
+            break;
+        }
+        case AluSub:
+        case AluSbb:
+        case AluCmp: {
+            const __m256i diff = _mm256_sub_epi8(a, val);
+            flags = FlagIfNot(_mm256_subs_epu8(a, val), diff, FlagCarry);
+            res = diff;
+            if (Op == AluSbb) {
+                res = _mm256_sub_epi8(diff, carry);
+                flags = _mm256_or_si256(flags, FlagIfNot(_mm256_subs_epu8(diff, carry), res, FlagCarry));
+            }
+            flags = _mm256_or_si256(flags, _mm256_andnot_si256(_mm256_xor_si256(_mm256_xor_si256(a, val), res), Bytes(FlagAuxCarry)));
+            break;
+        }
+        case AluAna:
+            res = _mm256_and_si256(a, val);
+            flags = _mm256_setzero_si256();
+            break;
+        case AluXra:
+            res = _mm256_xor_si256(a, val);
+            flags = _mm256_setzero_si256();
+            break;
+        default:
+            res = _mm256_or_si256(a, val);
+            flags = _mm256_setzero_si256();
+            break;
+        }
+        // XRI and ORI leave AC alone, as by the switch engine
+        if (S == Immediate && (Op == AluXra || Op == AluOra)) {
+            mask &= ~FlagAuxCarry;
+        }
+        PutFlags(s, base, mask, _mm256_or_si256(flags, ZspFlags(res)), member);
+        if (Op != AluCmp) {
+            Put(s.r[RegA] + base, res, member);
+        }
+    }
+};
+
+// LDA addr, a gather of 8 lanes' bytes at a time from their memory at
+// the same offset. The memory is padded so that the 4 bytes read for
+// the last lane stay in it.
+struct VectorLda {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &g, int base, __m256i member) {
+        const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m128i quarters[4] = {
+            _mm256_castsi256_si128(member), _mm_srli_si128(_mm256_castsi256_si128(member), 8),
+            _mm256_extracti128_si256(member, 1), _mm_srli_si128(_mm256_extracti128_si256(member, 1), 8)
+        };
+        const int *at = (const int *)(s.mem + Storage(g.addr));
+        __m256i bytes[4];
+        for (int i = 0; i < 4; i++) {
+            const __m256i offset = _mm256_slli_epi32(_mm256_add_epi32(lane, _mm256_set1_epi32(base + 8*i)), 14);
+            bytes[i] = _mm256_and_si256(_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), at, offset,
+                                                                     _mm256_cvtepi8_epi32(quarters[i]), 1),
+                                        _mm256_set1_epi32(0xff));
+        }
+        // The packs interleave the 128 bit halves, the permute puts the
+        // lanes back in order.
+        const __m256i packed = _mm256_packus_epi16(_mm256_packus_epi32(bytes[0], bytes[1]),
+                                                   _mm256_packus_epi32(bytes[2], bytes[3]));
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        Put(s.r[RegA] + base, _mm256_permutevar8x32_epi32(packed, order), member);
+    }
+};
+
+// CMA, STC, CMC, EI
+template<int Op>
+struct VectorMisc {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &, int base, __m256i member) {
+        switch (Op) {
+        case 0x2f:
+            Put(s.r[RegA] + base, _mm256_xor_si256(Get(s.r[RegA] + base), Bytes(0xff)), member);
+            break;
+        case 0x37:
+            Put(s.flags + base, _mm256_or_si256(Get(s.flags + base), Bytes(FlagCarry)), member);
+            break;
+        case 0x3f:
+            Put(s.flags + base, _mm256_xor_si256(Get(s.flags + base), Bytes(FlagCarry)), member);
+            break;
+        case 0xfb:
+            Put(s.flags + base, _mm256_or_si256(Get(s.flags + base), Bytes(1 << 5)), member);
+            break;
+        }
+    }
+};
+
+// JMP addr, and Jcc addr on the lanes where the condition holds
+template<int Flag, bool Set>
+struct VectorJump {
+    VECTOR static void execute(const BatchLanes &s, const VectorGroup &g, int base, __m256i member) {
+        __m256i taken = member;
+        if (Flag) {
+            const __m256i flag = _mm256_and_si256(Get(s.flags + base), Bytes(Flag));
+            taken = _mm256_and_si256(taken, _mm256_cmpeq_epi8(flag, Bytes(Set ? Flag : 0)));
+        }
+        PutPc(s.pc + base, _mm256_set1_epi16((short)g.addr), taken);
+    }
+};
+
+// The lanes of the chunk at `base` that are enabled and short of their
+// target. Sets `due` to those of them with a screen interrupt due.
+VECTOR uint32_t ReadyLanes(const BatchLanes &s, const uint64_t *target, int base, uint32_t *due)
+{
+    const __m256i enabled = Bytes(1 << 6);
+    uint32_t ready = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(Get(s.flags + base), enabled), enabled));
+    uint32_t pending = 0, short_of_target = 0;
+    for (int i = 0; i < 8; i++) {
+        const int l = base + 4*i;
+        const __m256i cycles = _mm256_loadu_si256((const __m256i *)(s.cycles + l));
+        const __m256i below = _mm256_cmpgt_epi64(_mm256_loadu_si256((const __m256i *)(target + l)), cycles);
+        const __m256i ahead = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_loadu_si256((const __m256i *)(s.next_mid + l)), cycles),
+                                               _mm256_cmpgt_epi64(_mm256_loadu_si256((const __m256i *)(s.next_end + l)), cycles));
+        short_of_target |= (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(below)) << (4*i);
+        pending |= (uint32_t)(~_mm256_movemask_pd(_mm256_castsi256_pd(ahead)) & 15) << (4*i);
+    }
+    ready &= short_of_target;
+    *due = pending & ready;
+    return ready;
+}
+
+// The lanes of the chunk at `base` at `pc`
+VECTOR uint32_t LanesAt(const BatchLanes &s, int base, uint16_t pc)
+{
+    const __m256i at = _mm256_set1_epi16((short)pc);
+    const __m256i low = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)(s.pc + base)), at);
+    const __m256i high = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)(s.pc + base + 16)), at);
+    return _mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(low, high), 0xd8));
+}
+
+#define VECTOR_SOURCES(base, op) \
+        case (base)+RegB: ForChunks<VectorAlu<op, RegB> >(s, g); break; \
+        case (base)+RegC: ForChunks<VectorAlu<op, RegC> >(s, g); break; \
+        case (base)+RegD: ForChunks<VectorAlu<op, RegD> >(s, g); break; \
+        case (base)+RegE: ForChunks<VectorAlu<op, RegE> >(s, g); break; \
+        case (base)+RegH: ForChunks<VectorAlu<op, RegH> >(s, g); break; \
+        case (base)+RegL: ForChunks<VectorAlu<op, RegL> >(s, g); break; \
+        case (base)+RegA: ForChunks<VectorAlu<op, RegA> >(s, g); break;
+
+#define VECTOR_DESTINATIONS(base, op, ...) \
+        case (base)+(RegB<<3): ForChunks<op<RegB, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegC<<3): ForChunks<op<RegC, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegD<<3): ForChunks<op<RegD, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegE<<3): ForChunks<op<RegE, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegH<<3): ForChunks<op<RegH, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegL<<3): ForChunks<op<RegL, ##__VA_ARGS__> >(s, g); break; \
+        case (base)+(RegA<<3): ForChunks<op<RegA, ##__VA_ARGS__> >(s, g); break;
+
+#define VECTOR_MOVES(D) \
+        case 0x40+(D<<3)+RegB: ForChunks<VectorMov<D, RegB> >(s, g); break; \
+        case 0x40+(D<<3)+RegC: ForChunks<VectorMov<D, RegC> >(s, g); break; \
+        case 0x40+(D<<3)+RegD: ForChunks<VectorMov<D, RegD> >(s, g); break; \
+        case 0x40+(D<<3)+RegE: ForChunks<VectorMov<D, RegE> >(s, g); break; \
+        case 0x40+(D<<3)+RegH: ForChunks<VectorMov<D, RegH> >(s, g); break; \
+        case 0x40+(D<<3)+RegL: ForChunks<VectorMov<D, RegL> >(s, g); break; \
+        case 0x40+(D<<3)+RegA: ForChunks<VectorMov<D, RegA> >(s, g); break;
+
+/*
+ Executes the instruction of `bytes`, at `pc`, on the lanes of `bits`,
+ `chunks` words, if it runs in vectors. Returns false, with the lanes
+ untouched, if it does not.
+*/
+VECTOR bool ExecuteVector(const BatchLanes &s, const uint32_t *bits, int chunks, uint16_t pc, const uint8_t *bytes)
+{
+    const uint8_t op = bytes[0];
+    const InstructionDef &opcode = i8080_instructions[op];
+    const VectorGroup g = {
+        bits, chunks, (uint16_t)(pc + opcode.length), opcode.cycles,
+        bytes[1], (uint16_t)((bytes[2] << 8) | bytes[1])
+    };
+
+    switch (op) {
+    case 0x00: ForChunks<VectorNop>(s, g); break; // NOP
+
+    case 0x01: ForChunks<VectorLxi<RegB, RegC> >(s, g); break; // LXI B,d16
+    case 0x11: ForChunks<VectorLxi<RegD, RegE> >(s, g); break; // LXI D,d16
+    case 0x21: ForChunks<VectorLxi<RegH, RegL> >(s, g); break; // LXI H,d16
+    case 0x03: ForChunks<VectorInx<RegB, RegC> >(s, g); break; // INX B
+    case 0x13: ForChunks<VectorInx<RegD, RegE> >(s, g); break; // INX D
+    case 0x23: ForChunks<VectorInx<RegH, RegL> >(s, g); break; // INX H
+    case 0x0b: ForChunks<VectorDcx<RegB, RegC> >(s, g); break; // DCX B
+    case 0x1b: ForChunks<VectorDcx<RegD, RegE> >(s, g); break; // DCX D
+    case 0x2b: ForChunks<VectorDcx<RegH, RegL> >(s, g); break; // DCX H
+
+    case 0x3a: ForChunks<VectorLda>(s, g); break; // LDA addr
+    VECTOR_DESTINATIONS(0x06, VectorMvi) // MVI D,d8
+    VECTOR_MOVES(RegB) // MOV D,S
+    VECTOR_MOVES(RegC)
+    VECTOR_MOVES(RegD)
+    VECTOR_MOVES(RegE)
+    VECTOR_MOVES(RegH)
+    VECTOR_MOVES(RegL)
+    VECTOR_MOVES(RegA)
+
+    VECTOR_DESTINATIONS(0x04, VectorInr, true) // INR D
+    VECTOR_DESTINATIONS(0x05, VectorInr, false) // DCR D
+    VECTOR_SOURCES(0x80, AluAdd) // ADD S
+    VECTOR_SOURCES(0x88, AluAdc) // ADC S
+    VECTOR_SOURCES(0x90, AluSub) // SUB S
+    VECTOR_SOURCES(0x98, AluSbb) // SBB S
+    VECTOR_SOURCES(0xa0, AluAna) // ANA S
+    VECTOR_SOURCES(0xa8, AluXra) // XRA S
+    VECTOR_SOURCES(0xb0, AluOra) // ORA S
+    VECTOR_SOURCES(0xb8, AluCmp) // CMP S
+    case 0xc6: ForChunks<VectorAlu<AluAdd, Immediate> >(s, g); break; // ADI d8
+    case 0xce: ForChunks<VectorAlu<AluAdc, Immediate> >(s, g); break; // ACI d8
+    case 0xd6: ForChunks<VectorAlu<AluSub, Immediate> >(s, g); break; // SUI d8
+    case 0xde: ForChunks<VectorAlu<AluSbb, Immediate> >(s, g); break; // SBI d8
+    case 0xe6: ForChunks<VectorAlu<AluAna, Immediate> >(s, g); break; // ANI d8
+    case 0xee: ForChunks<VectorAlu<AluXra, Immediate> >(s, g); break; // XRI d8
+    case 0xf6: ForChunks<VectorAlu<AluOra, Immediate> >(s, g); break; // ORI d8
+    case 0xfe: ForChunks<VectorAlu<AluCmp, Immediate> >(s, g); break; // CPI d8
+    case 0x2f: ForChunks<VectorMisc<0x2f> >(s, g); break; // CMA
+    case 0x37: ForChunks<VectorMisc<0x37> >(s, g); break; // STC
+    case 0x3f: ForChunks<VectorMisc<0x3f> >(s, g); break; // CMC
+    case 0xfb: ForChunks<VectorMisc<0xfb> >(s, g); break; // EI
+
+    case 0xc3: ForChunks<VectorJump<0, true> >(s, g); break;            // JMP addr
+    case 0xc2: ForChunks<VectorJump<FlagZero, false> >(s, g); break;   // JNZ addr
+    case 0xca: ForChunks<VectorJump<FlagZero, true> >(s, g); break;    // JZ addr
+    case 0xd2: ForChunks<VectorJump<FlagCarry, false> >(s, g); break;  // JNC addr
+    case 0xda: ForChunks<VectorJump<FlagCarry, true> >(s, g); break;   // JC addr
+    case 0xe2: ForChunks<VectorJump<FlagParity, false> >(s, g); break; // JPO addr
+    case 0xea: ForChunks<VectorJump<FlagParity, true> >(s, g); break;  // JPE addr
+    case 0xf2: ForChunks<VectorJump<FlagSign, false> >(s, g); break;   // JP addr
+    case 0xfa: ForChunks<VectorJump<FlagSign, true> >(s, g); break;    // JM addr
+
+    default:
+        return false;
+    }
+    return true;
+}
+
+#endif // BATCH_AVX2
+
+}
+
+// Expand one case per register operand, in bits 0-2 (source)
+// or bits 3-5 (destination) of the opcode, as in the switch engine.
+#define CASE_SOURCES(base, op) \
+        case (base)+RegB: op<All, RegB>(s, g); break; \
+        case (base)+RegC: op<All, RegC>(s, g); break; \
+        case (base)+RegD: op<All, RegD>(s, g); break; \
+        case (base)+RegE: op<All, RegE>(s, g); break; \
+        case (base)+RegH: op<All, RegH>(s, g); break; \
+        case (base)+RegL: op<All, RegL>(s, g); break; \
+        case (base)+RegM: op<All, RegM>(s, g); break; \
+        case (base)+RegA: op<All, RegA>(s, g); break;
+
+#define CASE_DESTINATIONS(base, op) \
+        case (base)+(RegB<<3): op<All, RegB>(s, g); break; \
+        case (base)+(RegC<<3): op<All, RegC>(s, g); break; \
+        case (base)+(RegD<<3): op<All, RegD>(s, g); break; \
+        case (base)+(RegE<<3): op<All, RegE>(s, g); break; \
+        case (base)+(RegH<<3): op<All, RegH>(s, g); break; \
+        case (base)+(RegL<<3): op<All, RegL>(s, g); break; \
+        case (base)+(RegM<<3): op<All, RegM>(s, g); break; \
+        case (base)+(RegA<<3): op<All, RegA>(s, g); break;
+
+#define CASE_MOVES(D) \
+        case 0x40+(D<<3)+RegB: Mov<All, D, RegB>(s, g); break; \
+        case 0x40+(D<<3)+RegC: Mov<All, D, RegC>(s, g); break; \
+        case 0x40+(D<<3)+RegD: Mov<All, D, RegD>(s, g); break; \
+        case 0x40+(D<<3)+RegE: Mov<All, D, RegE>(s, g); break; \
+        case 0x40+(D<<3)+RegH: Mov<All, D, RegH>(s, g); break; \
+        case 0x40+(D<<3)+RegL: Mov<All, D, RegL>(s, g); break; \
+        case 0x40+(D<<3)+RegA: Mov<All, D, RegA>(s, g); break;
+
+InvadersBatch::InvadersBatch(int lanes, const QByteArray &memory)
+{
+    count = lanes;
+    padded = (count + 31) & ~31;
+    groups = 0;
+    lane_steps = 0;
+    vector_lanes = vectorAvailable();
+
+    for (int r = 0; r < 8; r++) {
+        regs[r].fill(0, padded);
+        s.r[r] = regs[r].data();
+    }
+    pc.fill(0, padded);
+    sp.fill(0, padded);
+    flags.fill(0, padded);
+    for (int l = 0; l < count; l++) {
+        flags[l] = 1 << 6; // Enabled
+    }
+    cycles.fill(0, padded);
+    next_mid.fill(EE::mid_screen_cycle, padded);
+    next_end.fill(EE::cycles_per_frame, padded);
+    target.fill(0, padded);
+    shift_data.fill(0, count);
+    shift_amount.fill(0, count);
+    in_one.fill(0, count);
+    in_two.fill(0, count);
+    group.fill(0, count);
+    group_bits.fill(0, padded / 32);
+    mem.fill(0, count * 0x4000 + 4); // and the bytes VectorLda reads past the last lane
+    for (int l = 0; l < count; l++) {
+        memcpy(mem.data() + ((size_t)l << 14), memory.constData(), qMin(memory.size(), 0x4000));
+    }
+
+    s.pc = pc.data();
+    s.sp = sp.data();
+    s.flags = flags.data();
+    s.cycles = cycles.data();
+    s.next_mid = next_mid.data();
+    s.next_end = next_end.data();
+    s.mem = mem.data();
+    s.shift_data = shift_data.data();
+    s.shift_amount = shift_amount.data();
+    s.in_one = in_one.data();
+    s.in_two = in_two.data();
+}
+
+void InvadersBatch::setInputs(int lane, uint8_t in_port_one, uint8_t in_port_two)
+{
+    s.in_one[lane] = in_port_one;
+    s.in_two[lane] = in_port_two;
+}
+
+InvadersBatch::Registers InvadersBatch::registers(int lane) const
+{
+    return Registers { s.r[RegA][lane], s.r[RegB][lane], s.r[RegC][lane], s.r[RegD][lane],
+                       s.r[RegE][lane], s.r[RegH][lane], s.r[RegL][lane],
+                       s.sp[lane], s.pc[lane], s.flags[lane] };
+}
+
+uint64_t InvadersBatch::cycleCount(int lane) const
+{
+    return s.cycles[lane];
+}
+
+const uint8_t *InvadersBatch::memory(int lane) const
+{
+    return Memory(s, lane);
+}
+
+// The screen interrupts of mid_screen_interrupt() and
+// end_of_screen_interrupt(), fired as CPU::run() fires cycle events.
+void InvadersBatch::fireInterrupts(int l)
+{
+    while (s.next_mid[l] <= s.cycles[l]) {
+        s.next_mid[l] += EE::cycles_per_frame;
+        if (s.flags[l] & (1 << 5)) {
+            Push(s, l, s.pc[l] >> 8, s.pc[l] & 0xff);
+            s.pc[l] = 8 * 1;
+            s.flags[l] &= ~(1 << 5);
+        }
+    }
+    while (s.next_end[l] <= s.cycles[l]) {
+        s.next_end[l] += EE::cycles_per_frame;
+        if (s.flags[l] & (1 << 5)) {
+            Push(s, l, s.pc[l] >> 8, s.pc[l] & 0xff);
+            s.pc[l] = 8 * 2;
+            s.flags[l] &= ~(1 << 5);
+        }
+    }
+}
+
+bool InvadersBatch::vectorAvailable()
+{
+#ifdef BATCH_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+int InvadersBatch::run(int slice)
+{
+    for (int l = 0; l < count; l++) {
+        target[l] = s.cycles[l] + slice;
+    }
+
+    if (vector_lanes) {
+        runVector();
+    } else {
+        runScalar();
+    }
+
+    int enabled = 0;
+    for (int l = 0; l < count; l++) {
+        enabled += (s.flags[l] & (1 << 6)) ? 1 : 0;
+    }
+    return enabled;
+}
+
+// Runs the lanes to their targets, one group at a time.
+void InvadersBatch::runScalar()
+{
+    int *lanes = group.data();
+    const uint64_t *targets = target.constData();
+    forever {
+        // Group the lanes at the leader's instruction, the first lane
+        // that has cycles left. Lanes at other instructions wait.
+        int n = 0, leader = -1, length = 0;
+        uint16_t leader_pc = 0;
+        uint8_t bytes[3] = { 0, 0, 0 };
+        for (int l = 0; l < count; l++) {
+            if (!(s.flags[l] & (1 << 6)) || s.cycles[l] >= targets[l]) {
+                continue;
+            }
+            if (s.next_mid[l] <= s.cycles[l] || s.next_end[l] <= s.cycles[l]) {
+                fireInterrupts(l);
+            }
+            const uint16_t lane_pc = s.pc[l];
+            if (leader < 0) {
+                leader = l;
+                leader_pc = lane_pc;
+                bytes[0] = Load(s, l, lane_pc);
+                bytes[1] = Load(s, l, lane_pc+1);
+                bytes[2] = Load(s, l, lane_pc+2);
+                length = i8080_instructions[bytes[0]].length;
+            } else if (lane_pc != leader_pc) {
+                continue;
+            }
+            // Code in RAM may differ between lanes.
+            if (Load(s, l, lane_pc) != bytes[0] ||
+                    (length > 1 && Load(s, l, lane_pc+1) != bytes[1]) ||
+                    (length > 2 && Load(s, l, lane_pc+2) != bytes[2])) {
+                continue;
+            }
+            lanes[n++] = l;
+        }
+        if (n == 0) {
+            break;
+        }
+
+        groups++;
+        lane_steps += n;
+        if (n == count) {
+            executeGroup<true>(lanes, n, leader_pc);
+        } else {
+            executeGroup<false>(lanes, n, leader_pc);
+        }
+    }
+}
+
+/*
+ Runs the lanes to their targets as runScalar() does, with the groups
+ found and, where the instruction allows, executed 32 lanes at a time.
+ Writes to the ROM are dropped, so it is the same on every lane and only
+ code in RAM is compared lane by lane.
+*/
+void InvadersBatch::runVector()
+{
+#ifdef BATCH_AVX2
+    const int chunks = padded / 32;
+    uint32_t *bits = group_bits.data();
+    forever {
+        int leader = -1;
+        uint16_t leader_pc = 0;
+        for (int c = 0; c < chunks; c++) {
+            uint32_t due;
+            const uint32_t ready = ReadyLanes(s, target.constData(), c << 5, &due);
+            for (; due; due &= due - 1) {
+                fireInterrupts((c << 5) + __builtin_ctz(due));
+            }
+            if (leader < 0 && ready) {
+                leader = (c << 5) + __builtin_ctz(ready);
+                leader_pc = s.pc[leader];
+            }
+            bits[c] = (leader < 0) ? 0 : (ready & LanesAt(s, c << 5, leader_pc));
+        }
+        if (leader < 0) {
+            break;
+        }
+
+        const uint8_t bytes[3] = {
+            Load(s, leader, leader_pc), Load(s, leader, leader_pc+1), Load(s, leader, leader_pc+2)
+        };
+        const int length = i8080_instructions[bytes[0]].length;
+        int n = 0;
+        for (int c = 0; c < chunks; c++) {
+            if (leader_pc + length > 0x2000) {
+                for (uint32_t lanes = bits[c]; lanes; lanes &= lanes - 1) {
+                    const int l = (c << 5) + __builtin_ctz(lanes);
+                    if (Load(s, l, leader_pc) != bytes[0] ||
+                            (length > 1 && Load(s, l, leader_pc+1) != bytes[1]) ||
+                            (length > 2 && Load(s, l, leader_pc+2) != bytes[2])) {
+                        bits[c] &= ~(1u << (l & 31));
+                    }
+                }
+            }
+            n += __builtin_popcount(bits[c]);
+        }
+
+        groups++;
+        lane_steps += n;
+        if (ExecuteVector(s, bits, chunks, leader_pc, bytes)) {
+            continue;
+        }
+        int *lanes = group.data();
+        for (int c = 0, i = 0; c < chunks; c++) {
+            for (uint32_t word = bits[c]; word; word &= word - 1) {
+                lanes[i++] = (c << 5) + __builtin_ctz(word);
+            }
+        }
+        if (n == count) {
+            executeGroup<true>(lanes, n, leader_pc);
+        } else {
+            executeGroup<false>(lanes, n, leader_pc);
+        }
+    }
+#else
+    runScalar();
+#endif
+}
+
+/*
+ Executes the instruction at `pc` on the `n` lanes of `lanes`, which all
+ hold the same instruction bytes there. All is true if the group is every
+ lane in order, the loops then run over the arrays contiguously.
+*/
+template<bool All>
+void InvadersBatch::executeGroup(const int *lanes, int n, uint16_t pc)
+{
+    const BatchLanes s = this->s;
+    const uint8_t op = Load(s, lanes[0], pc);
+    const uint8_t operand[2] = { Load(s, lanes[0], pc+1), Load(s, lanes[0], pc+2) };
+    const InstructionDef &opcode = i8080_instructions[op];
+    const Group g = {
+        lanes, n, (uint16_t)(pc + opcode.length), opcode.cycles,
+        operand[0], (uint16_t)((operand[1] << 8) | operand[0])
+    };
+
+    switch (op) {
+    case 0x00: ForLanes<All>(s, g, [](int) {}); break; // NOP
+    case 0x76: ForLanes<All>(s, g, [&](int l) { s.flags[l] &= ~(1 << 6); }); break; // HLT
+
+    // Register pairs
+    case 0x01: Lxi<All, RegB, RegC>(s, g); break; // LXI B,d16
+    case 0x11: Lxi<All, RegD, RegE>(s, g); break; // LXI D,d16
+    case 0x21: Lxi<All, RegH, RegL>(s, g); break; // LXI H,d16
+    case 0x31: ForLanes<All>(s, g, [&](int l) { s.sp[l] = g.addr; }); break; // LXI SP,d16
+    case 0x03: Inx<All, RegB, RegC>(s, g); break; // INX B
+    case 0x13: Inx<All, RegD, RegE>(s, g); break; // INX D
+    case 0x23: Inx<All, RegH, RegL>(s, g); break; // INX H
+    case 0x33: ForLanes<All>(s, g, [&](int l) { s.sp[l]++; }); break; // INX SP
+    case 0x0b: Dcx<All, RegB, RegC>(s, g); break; // DCX B
+    case 0x1b: Dcx<All, RegD, RegE>(s, g); break; // DCX D
+    case 0x2b: Dcx<All, RegH, RegL>(s, g); break; // DCX H
+    case 0x3b: ForLanes<All>(s, g, [&](int l) { s.sp[l]--; }); break; // DCX SP
+    case 0x09: Dad<All, RegB, RegC>(s, g); break; // DAD B
+    case 0x19: Dad<All, RegD, RegE>(s, g); break; // DAD D
+    case 0x29: Dad<All, RegH, RegL>(s, g); break; // DAD H
+    case 0x39: // DAD SP
+        ForLanes<All>(s, g, [&](int l) {
+            uint32_t add = ((s.r[RegH][l] << 8) | s.r[RegL][l]) + s.sp[l];
+            s.r[RegH][l] = (add >> 8) & 0xff;
+            s.r[RegL][l] = add & 0xff;
+            s.flags[l] = (s.flags[l] & ~FlagCarry) | ((add >> 16) ? FlagCarry : 0);
+        });
+        break;
+    case 0xc5: PushPair<All, RegB, RegC>(s, g); break; // PUSH B
+    case 0xd5: PushPair<All, RegD, RegE>(s, g); break; // PUSH D
+    case 0xe5: PushPair<All, RegH, RegL>(s, g); break; // PUSH H
+    case 0xc1: PopPair<All, RegB, RegC>(s, g); break;  // POP B
+    case 0xd1: PopPair<All, RegD, RegE>(s, g); break;  // POP D
+    case 0xe1: PopPair<All, RegH, RegL>(s, g); break;  // POP H
+    case 0xf5: ForLanes<All>(s, g, [&](int l) { Push(s, l, s.r[RegA][l], s.flags[l]); }); break; // PUSH PSW
+    case 0xf1: // POP PSW
+        ForLanes<All>(s, g, [&](int l) {
+            uint16_t val = Pop(s, l);
+            s.flags[l] = val & 0xff;
+            s.r[RegA][l] = val >> 8;
+        });
+        break;
+    case 0xeb: // XCHG
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t d = s.r[RegD][l], e = s.r[RegE][l];
+            s.r[RegD][l] = s.r[RegH][l];
+            s.r[RegE][l] = s.r[RegL][l];
+            s.r[RegH][l] = d;
+            s.r[RegL][l] = e;
+        });
+        break;
+    case 0xe3: // XTHL
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t h = s.r[RegH][l], low = s.r[RegL][l];
+            s.r[RegH][l] = Load(s, l, s.sp[l]+1);
+            s.r[RegL][l] = Load(s, l, s.sp[l]);
+            Store(s, l, s.sp[l]+1, h);
+            Store(s, l, s.sp[l], low);
+        });
+        break;
+    case 0xf9: ForLanes<All>(s, g, [&](int l) { s.sp[l] = (s.r[RegH][l] << 8) | s.r[RegL][l]; }); break; // SPHL
+
+    // Loads and stores
+    case 0x02: ForLanes<All>(s, g, [&](int l) { Store(s, l, (s.r[RegB][l] << 8) | s.r[RegC][l], s.r[RegA][l]); }); break; // STAX B
+    case 0x12: ForLanes<All>(s, g, [&](int l) { Store(s, l, (s.r[RegD][l] << 8) | s.r[RegE][l], s.r[RegA][l]); }); break; // STAX D
+    case 0x0a: ForLanes<All>(s, g, [&](int l) { s.r[RegA][l] = Load(s, l, (s.r[RegB][l] << 8) | s.r[RegC][l]); }); break; // LDAX B
+    case 0x1a: ForLanes<All>(s, g, [&](int l) { s.r[RegA][l] = Load(s, l, (s.r[RegD][l] << 8) | s.r[RegE][l]); }); break; // LDAX D
+    case 0x32: ForLanes<All>(s, g, [&](int l) { Store(s, l, g.addr, s.r[RegA][l]); }); break; // STA addr
+    case 0x3a: ForLanes<All>(s, g, [&](int l) { s.r[RegA][l] = Load(s, l, g.addr); }); break; // LDA addr
+    case 0x22: // SHLD addr
+        ForLanes<All>(s, g, [&](int l) {
+            Store(s, l, g.addr+1, s.r[RegH][l]);
+            Store(s, l, g.addr, s.r[RegL][l]);
+        });
+        break;
+    case 0x2a: // LHLD addr
+        ForLanes<All>(s, g, [&](int l) {
+            s.r[RegH][l] = Load(s, l, g.addr+1);
+            s.r[RegL][l] = Load(s, l, g.addr);
+        });
+        break;
+    CASE_DESTINATIONS(0x06, Mvi) // MVI D,d8
+
+    // MOV D,S, and MOV M,S but HLT in place of MOV M,M
+    CASE_MOVES(RegB)
+    CASE_MOVES(RegC)
+    CASE_MOVES(RegD)
+    CASE_MOVES(RegE)
+    CASE_MOVES(RegH)
+    CASE_MOVES(RegL)
+    CASE_MOVES(RegA)
+    case 0x46: Mov<All, RegB, RegM>(s, g); break; // MOV B,M
+    case 0x4e: Mov<All, RegC, RegM>(s, g); break; // MOV C,M
+    case 0x56: Mov<All, RegD, RegM>(s, g); break; // MOV D,M
+    case 0x5e: Mov<All, RegE, RegM>(s, g); break; // MOV E,M
+    case 0x66: Mov<All, RegH, RegM>(s, g); break; // MOV H,M
+    case 0x6e: Mov<All, RegL, RegM>(s, g); break; // MOV L,M
+    case 0x7e: Mov<All, RegA, RegM>(s, g); break; // MOV A,M
+    case 0x70: Mov<All, RegM, RegB>(s, g); break; // MOV M,B
+    case 0x71: Mov<All, RegM, RegC>(s, g); break; // MOV M,C
+    case 0x72: Mov<All, RegM, RegD>(s, g); break; // MOV M,D
+    case 0x73: Mov<All, RegM, RegE>(s, g); break; // MOV M,E
+    case 0x74: Mov<All, RegM, RegH>(s, g); break; // MOV M,H
+    case 0x75: Mov<All, RegM, RegL>(s, g); break; // MOV M,L
+    case 0x77: Mov<All, RegM, RegA>(s, g); break; // MOV M,A
+
+    // Arithmetic and logic
+    CASE_DESTINATIONS(0x04, Inr) // INR D
+    CASE_DESTINATIONS(0x05, Dcr) // DCR D
+    CASE_SOURCES(0x80, AddNoCarry) // ADD S
+    CASE_SOURCES(0x88, Adc) // ADC S
+    CASE_SOURCES(0x90, SubNoBorrow) // SUB S
+    CASE_SOURCES(0x98, Sbb) // SBB S
+    CASE_SOURCES(0xa0, Ana) // ANA S
+    CASE_SOURCES(0xa8, Xra) // XRA S
+    CASE_SOURCES(0xb0, Ora) // ORA S
+    CASE_SOURCES(0xb8, Cmp) // CMP S
+    case 0xc6: // ADI d8
+    case 0xce: // ACI d8
+        ForLanes<All>(s, g, [&](int l) {
+            int carry = (op == 0xce) ? Carry(s, l) : 0;
+            SetFlags(s, l, add_flags[carry][s.r[RegA][l]][g.imm]);
+            s.r[RegA][l] += g.imm + carry;
+        });
+        break;
+    case 0xd6: // SUI d8
+    case 0xde: // SBI d8
+    case 0xfe: // CPI d8
+        ForLanes<All>(s, g, [&](int l) {
+            int borrow = (op == 0xde) ? Carry(s, l) : 0;
+            SetFlags(s, l, sub_flags[borrow][s.r[RegA][l]][g.imm]);
+            if (op != 0xfe) {
+                s.r[RegA][l] -= g.imm + borrow;
+            }
+        });
+        break;
+    case 0xe6: // ANI d8
+        ForLanes<All>(s, g, [&](int l) {
+            s.r[RegA][l] &= g.imm;
+            SetFlags(s, l, zsp_flags[s.r[RegA][l]]);
+        });
+        break;
+    case 0xee: // XRI d8
+    case 0xf6: // ORI d8
+        // AC is left alone, as by the switch engine
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t res = (op == 0xee) ? (s.r[RegA][l] ^ g.imm) : (s.r[RegA][l] | g.imm);
+            s.flags[l] = (s.flags[l] & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[res];
+            s.r[RegA][l] = res;
+        });
+        break;
+    case 0x27: // DAA
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t a = s.r[RegA][l], correction = 0;
+            int carry = Carry(s, l);
+            if ((a & 0x0f) > 9 || (s.flags[l] & FlagAuxCarry)) {
+                correction |= 0x06;
+            }
+            if ((a >> 4) > 9 || carry || ((a >> 4) == 9 && (a & 0x0f) > 9)) {
+                correction |= 0x60;
+                carry = 1;
+            }
+            SetFlags(s, l, add_flags[0][a][correction]);
+            s.flags[l] |= (carry << 3);
+            s.r[RegA][l] = a + correction;
+        });
+        break;
+    case 0x2f: ForLanes<All>(s, g, [&](int l) { s.r[RegA][l] = ~s.r[RegA][l]; }); break; // CMA
+    case 0x37: ForLanes<All>(s, g, [&](int l) { s.flags[l] |= FlagCarry; }); break;      // STC
+    case 0x3f: ForLanes<All>(s, g, [&](int l) { s.flags[l] ^= FlagCarry; }); break;      // CMC
+    case 0x07: // RLC
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t val = s.r[RegA][l];
+            s.r[RegA][l] = ((val & 0x80) >> 7) | (val << 1);
+            s.flags[l] = (s.flags[l] & ~FlagCarry) | ((val & 0x80) >> 4);
+        });
+        break;
+    case 0x0f: // RRC
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t val = s.r[RegA][l];
+            s.r[RegA][l] = ((val & 1) << 7) | (val >> 1);
+            s.flags[l] = (s.flags[l] & ~FlagCarry) | ((val & 1) << 3);
+        });
+        break;
+    case 0x17: // RAL
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t val = s.r[RegA][l];
+            s.r[RegA][l] = Carry(s, l) | (val << 1);
+            s.flags[l] = (s.flags[l] & ~FlagCarry) | ((val & 0x80) >> 4);
+        });
+        break;
+    case 0x1f: // RAR
+        ForLanes<All>(s, g, [&](int l) {
+            uint8_t val = s.r[RegA][l];
+            s.r[RegA][l] = (Carry(s, l) << 7) | (val >> 1);
+            s.flags[l] = (s.flags[l] & ~FlagCarry) | ((val & 1) << 3);
+        });
+        break;
+
+    // Jumps, calls and returns
+    case 0xc3: ForLanes<All>(s, g, [&](int l) { s.pc[l] = g.addr; }); break; // JMP addr
+    case 0xe9: ForLanes<All>(s, g, [&](int l) { s.pc[l] = (s.r[RegH][l] << 8) | s.r[RegL][l]; }); break; // PCHL
+    case 0xc2: JumpIf<All, FlagZero, false>(s, g); break;   // JNZ addr
+    case 0xca: JumpIf<All, FlagZero, true>(s, g); break;    // JZ addr
+    case 0xd2: JumpIf<All, FlagCarry, false>(s, g); break;  // JNC addr
+    case 0xda: JumpIf<All, FlagCarry, true>(s, g); break;   // JC addr
+    case 0xe2: JumpIf<All, FlagParity, false>(s, g); break; // JPO addr
+    case 0xea: JumpIf<All, FlagParity, true>(s, g); break;  // JPE addr
+    case 0xf2: JumpIf<All, FlagSign, false>(s, g); break;   // JP addr
+    case 0xfa: JumpIf<All, FlagSign, true>(s, g); break;    // JM addr
+    case 0xcd: // CALL addr
+        ForLanes<All>(s, g, [&](int l) {
+            Push(s, l, g.next >> 8, g.next & 0xff);
+            s.pc[l] = g.addr;
+        });
+        break;
+    case 0xc4: CallIf<All, FlagZero, false>(s, g); break;   // CNZ addr
+    case 0xcc: CallIf<All, FlagZero, true>(s, g); break;    // CZ addr
+    case 0xd4: CallIf<All, FlagCarry, false>(s, g); break;  // CNC addr
+    case 0xdc: CallIf<All, FlagCarry, true>(s, g); break;   // CC addr
+    case 0xe4: CallIf<All, FlagParity, false>(s, g); break; // CPO addr
+    case 0xec: CallIf<All, FlagParity, true>(s, g); break;  // CPE addr
+    case 0xf4: CallIf<All, FlagSign, false>(s, g); break;   // CP addr
+    case 0xfc: CallIf<All, FlagSign, true>(s, g); break;    // CM addr
+    case 0xc9: ForLanes<All>(s, g, [&](int l) { s.pc[l] = Pop(s, l); }); break; // RET
+    case 0xc0: ReturnIf<All, FlagZero, false>(s, g); break;   // RNZ
+    case 0xc8: ReturnIf<All, FlagZero, true>(s, g); break;    // RZ
+    case 0xd0: ReturnIf<All, FlagCarry, false>(s, g); break;  // RNC
+    case 0xd8: ReturnIf<All, FlagCarry, true>(s, g); break;   // RC
+    case 0xe0: ReturnIf<All, FlagParity, false>(s, g); break; // RPO
+    case 0xe8: ReturnIf<All, FlagParity, true>(s, g); break;  // RPE
+    case 0xf0: ReturnIf<All, FlagSign, false>(s, g); break;   // RP
+    case 0xf8: ReturnIf<All, FlagSign, true>(s, g); break;    // RM
+
+    case 0xfb: ForLanes<All>(s, g, [&](int l) { s.flags[l] |= (1 << 5); }); break; // EI
+
+    // Ports, decoded like ReadInvadersPort() and WriteInvadersPort()
+    case 0xdb: // IN port
+        ForLanes<All>(s, g, [&](int l) {
+            switch (g.imm) {
+            case 0:
+                s.r[RegA][l] = s.in_one[l];
+                break;
+            case 2:
+                s.r[RegA][l] = s.in_two[l];
+                break;
+            case 3:
+                s.r[RegA][l] = (uint16_t)((s.shift_data[l] << s.shift_amount[l]) >> 8) & 0xff;
+                break;
+            }
+        });
+        break;
+    case 0xd3: // OUT port
+        ForLanes<All>(s, g, [&](int l) {
+            switch (g.imm) {
+            case 2:
+                s.shift_amount[l] = s.r[RegA][l];
+                break;
+            case 4:
+                s.shift_data[l] = (s.r[RegA][l] << 8) | (s.shift_data[l] >> 8);
+                break;
+            }
+        });
+        break;
+
+    default:
+        qWarning() << "Unknown instruction" << QString::number(op, 16) << "at" << QString::number(pc, 16)
+                   << "disables" << n << "lanes";
+        for (int i = 0; i < n; i++) {
+            s.flags[All ? i : lanes[i]] &= ~(1 << 6);
+        }
+        break;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef INVADERSBATCH_H
+#define INVADERSBATCH_H
+
+#include <stdint.h>
+
+#include <QByteArray>
+#include <QVector>
+
+/*
+ Lockstep batch of Space Invaders machines
+
+ Runs many independent sessions, lanes, that start from the same memory
+ and differ in their inputs, e.g. for searching over input sequences.
+ There is no Qt thread, mutex or UI per lane. The lanes' registers are
+ kept as structure of arrays, BatchLanes, one array per register.
+
+ Lanes at the same pc, with the same instruction bytes, form a group
+ that decodes the instruction once and executes it for all of its
+ lanes. Lanes that diverge run in smaller groups, down to one lane at a
+ time, and join again when their pc meets.
+
+ On hosts with AVX2 the lanes are grouped 32 at a time, with the lanes
+ of a group as a bit mask, and the instructions on registers, MOV, MVI,
+ LXI, INX, DCX, INR, DCR, the arithmetic and logical instructions, JMP
+ and the conditional jumps, run on 32 lanes per vector, with Z, S, P, CY
+ and AC computed in the vector and the lanes outside the group blended
+ back. So does LDA, with gathers. The other instructions, those on M,
+ the stack or the ports, run as a loop over the group's lanes, and so
+ does everything without AVX2 or with vector_lanes cleared. The ROM is
+ the same on every lane, only code in RAM is compared lane by lane.
+ tests/batch benchmarks both against one switch engine processor per
+ session: with 64 lanes in lockstep the vectors run about three times
+ as many lane cycles per second.
+
+ Each lane behaves like a Machine running RunSwitchEngine<InvadersBus>
+ without native routines or idle loop skipping: the same instructions,
+ the same screen interrupts on the lane's own cycle count, and the same
+ port decoding, see ReadInvadersPort(). The sound ports are ignored.
+ Lane memory is mapped the same way too: writes to the ROM, $0000-$1FFF,
+ are dropped and $4000- mirrors the RAM, $2000-$3FFF.
+*/
+
+struct BatchLanes {
+    uint8_t *r[8];          // B, C, D, E, H, L, -, A, indexed by operand code
+    uint16_t *pc, *sp;
+    uint8_t *flags;         // low byte of CPU::flags: ALU flags, IE (bit 5), enabled (bit 6)
+    uint64_t *cycles;       // cycles emulated since power on
+    uint64_t *next_mid;     // cycle of the next mid screen interrupt
+    uint64_t *next_end;     // cycle of the next end of screen interrupt
+    uint8_t *mem;           // $0000-$3FFF of each lane, lane l at mem + (l << 14)
+    uint16_t *shift_data;   // shift register, OUT 4 high << 8 | previous OUT 4
+    uint8_t *shift_amount;  // OUT 2
+    uint8_t *in_one;        // IN 0
+    uint8_t *in_two;        // IN 2
+};
+
+class InvadersBatch
+{
+public:
+    struct Registers {
+        uint8_t a, b, c, d, e, h, l;
+        uint16_t sp, pc;
+        int flags;
+    };
+
+    // `lanes` sessions at pc 0, each with a copy of $0000-$3FFF of `memory`.
+    InvadersBatch(int lanes, const QByteArray &memory);
+
+    int lanes(void) const {
+        return count;
+    }
+    // The values IN 0 and IN 2 read on `lane`.
+    void setInputs(int lane, uint8_t in_port_one, uint8_t in_port_two);
+    // Runs every lane for a slice of at least `cycles` cycles, or until it
+    // is disabled. Returns the number of lanes still enabled.
+    int run(int cycles);
+
+    Registers registers(int lane) const;
+    uint64_t cycleCount(int lane) const;
+    const uint8_t *memory(int lane) const; // $0000-$3FFF, as MemoryMap::data
+
+    // Groups executed and the lanes they covered, lane_steps / groups is
+    // the average width of a group.
+    uint64_t groups;
+    uint64_t lane_steps;
+    bool vector_lanes; // AVX2 groups, set if vectorAvailable()
+
+    // Whether the host runs the AVX2 groups.
+    static bool vectorAvailable(void);
+private:
+    void runScalar(void);
+    void runVector(void);
+    template<bool All> void executeGroup(const int *group, int n, uint16_t pc);
+    void fireInterrupts(int lane);
+    int count;
+    int padded; // count rounded up to a vector of lanes, the padding stays disabled
+    BatchLanes s;
+    QVector<uint8_t> regs[8];
+    QVector<uint16_t> pc, sp, shift_data;
+    QVector<uint8_t> flags, shift_amount, in_one, in_two;
+    QVector<uint64_t> cycles, next_mid, next_end, target;
+    QVector<uint8_t> mem;
+    QVector<int> group;
+    QVector<uint32_t> group_bits; // a bit per lane, lane l at bit l % 32 of word l / 32
+};
+
+#endif // INVADERSBATCH_H
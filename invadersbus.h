@@ -0,0 +1,78 @@
+#ifndef INVADERSBUS_H
+#define INVADERSBUS_H
+
+#include <stdint.h>
+
+#include "i8080bus.h"
+#include "machine.h"
+
+/*
+ Space Invaders bus
+
+ Flat memory with the machine's ports inline, so that IN and OUT cost
+ the switch engine no callback, see i8080bus.h. input_callback() and
+ output_callback() decode the ports the same way for the other engines.
+
+ IN  0  inputs, in_port_one
+ IN  2  inputs and DIP switches, in_port_two
+ IN  3  shift register result
+ OUT 2  shift amount
+ OUT 3  sounds
+ OUT 4  shift data
+ OUT 5  sounds
+*/
+
+// The value IN `port` reads, or `unmapped` for a port the machine does
+// not decode.
+inline uint8_t ReadInvadersPort(uint8_t port, uint8_t unmapped)
+{
+    switch (port) {
+    case 0:
+        return shift_register_hw.in_port_one;
+    case 2:
+        return shift_register_hw.in_port_two;
+    case 3: {
+        uint16_t val = ((((shift_register_hw.out_port_four_high << 8) | shift_register_hw.out_port_four_low) << shift_register_hw.out_port_two) >> 8);
+        return (val & 0xFF);
+    }
+    }
+    return unmapped;
+}
+
+inline void WriteInvadersPort(uint8_t port, uint8_t val)
+{
+    switch (port) {
+    case 2:
+        shift_register_hw.out_port_two = val;
+        break;
+    case 3:
+        shift_register_hw.out_port_three = val;
+        break;
+    case 4:
+        shift_register_hw.out_port_four_low = shift_register_hw.out_port_four_high;
+        shift_register_hw.out_port_four_high = val;
+        break;
+    case 5:
+        shift_register_hw.out_port_five = val;
+        break;
+    }
+}
+
+class InvadersBus : public FlatBus {
+public:
+    static const bool ports = true;
+
+    explicit InvadersBus(CPU *processor) : FlatBus(processor), processor(processor) {}
+
+    // Ports the machine does not decode leave A alone.
+    inline uint8_t in(uint8_t port) {
+        return ReadInvadersPort(port, processor->a);
+    }
+    inline void out(uint8_t port, uint8_t val) {
+        WriteInvadersPort(port, val);
+    }
+private:
+    CPU *processor;
+};
+
+#endif // INVADERSBUS_H
@@ -0,0 +1,488 @@
+#include "invadersroutines.h"
+#include "machine.h"
+#include "i8080.h"
+
+#include <QDebug>
+
+namespace {
+
+// CRC-32 of invaders.h/g/f/e, as listed by MAME
+const uint32_t rom_crcs[4] = { 0x734f5ad8, 0x6bfaca4a, 0x0ccead96, 0x14e538b0 };
+
+uint32_t Crc32(const uint8_t *data, int size)
+{
+    uint32_t crc = 0xffffffff;
+    for (int i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// Every read goes through MemoryMap::read() like the interpreter's, so
+// that mirrors and devices answer as they would to the ROM code.
+inline uint8_t Read(CPU *processor, uint16_t addr)
+{
+    return processor->memory->read(addr);
+}
+
+// Cycles of the instructions from `from` up to `to`, read from the ROM
+// so that they match the interpreter's table.
+int Cycles(CPU *processor, uint16_t from, uint16_t to)
+{
+    int cycles = 0;
+    for (uint16_t addr = from; addr != to; ) {
+        const InstructionDef &opcode = i8080_instructions[Read(processor, addr)];
+        cycles += opcode.cycles;
+        addr += opcode.length;
+    }
+    return cycles;
+}
+
+// True if the `length` bytes from `addr` are RAM. Routines only run
+// natively if they write nothing else, so they never overwrite code,
+// and their PUSHes pass the safe memory check.
+inline bool InRam(int addr, int length)
+{
+    return addr >= 0x2000 && addr + length <= 0x4000;
+}
+
+inline uint16_t HL(CPU *processor)
+{
+    return (uint16_t)((processor->h << 8) | processor->l);
+}
+
+inline uint16_t DE(CPU *processor)
+{
+    return (uint16_t)((processor->d << 8) | processor->e);
+}
+
+inline void Push(CPU *processor, uint8_t high, uint8_t low)
+{
+    processor->memory->write(processor->sp-1, high);
+    processor->memory->write(processor->sp-2, low);
+    processor->sp -= 2;
+}
+
+inline void Pop(CPU *processor, uint8_t *high, uint8_t *low)
+{
+    *low = Read(processor, processor->sp);
+    *high = Read(processor, processor->sp+1);
+    processor->sp += 2;
+}
+
+inline void Ret(CPU *processor)
+{
+    uint8_t high, low;
+    Pop(processor, &high, &low);
+    processor->pc = (uint16_t)((high << 8) | low);
+}
+
+// INX H, INX D
+inline void IncHL(CPU *processor)
+{
+    processor->l++;
+    if (processor->l == 0) processor->h++;
+}
+
+inline void IncDE(CPU *processor)
+{
+    processor->e++;
+    if (processor->e == 0) processor->d++;
+}
+
+// RAR
+inline uint8_t Rar(CPU *processor, uint8_t val)
+{
+    uint8_t res = (((processor->flags&(1 << 3))?1:0) << 7) | (val >> 1);
+    if (val & 1) {
+        processor->flags |= (1 << 3);
+    } else {
+        processor->flags &= ~(1 << 3);
+    }
+    return res;
+}
+
+// OUT 04 and IN 03, as output_callback() and input_callback()
+inline void ShiftOut(uint8_t val)
+{
+    shift_register_hw.out_port_four_low = shift_register_hw.out_port_four_high;
+    shift_register_hw.out_port_four_high = val;
+}
+
+inline uint8_t ShiftIn()
+{
+    uint16_t val = ((((shift_register_hw.out_port_four_high << 8) | shift_register_hw.out_port_four_low) << shift_register_hw.out_port_two) >> 8);
+    return val & 0xFF;
+}
+
+// LXI B,0020, DAD B, POP B, DCR B closing every row of the sprite
+// routines, HL moves to the next row 32 bytes further.
+inline void NextRow(CPU *processor)
+{
+    uint32_t add = HL(processor) + 0x20;
+    processor->b = 0x00;
+    processor->c = 0x20;
+    processor->h = (add & 0xff00) >> 8;
+    processor->l = add & 0xff;
+    if ((add & 0xffff0000) != 0) {
+        processor->flags |= (1 << 3);
+    } else {
+        processor->flags &= ~(1 << 3);
+    }
+    Pop(processor, &processor->b, &processor->c);
+    processor->b--;
+    SetFlagsDcr(processor, processor->b);
+}
+
+// The screen address ConvToScr returns for the pixel number in HL: HL
+// and CY, clear after ANI 07, rotated right by 3 into $2000-$3FFF.
+uint16_t ScreenAddress(uint16_t hl)
+{
+    uint32_t bits = hl; // CY is bit 16
+    for (int i = 0; i < 3; i++) {
+        bits = (bits >> 1) | ((bits & 1) << 16);
+    }
+    return (uint16_t)((((bits >> 8) & 0x3f) | 0x20) << 8 | (bits & 0xff));
+}
+
+// Cycles of the CALL at `call` to CnvtPixNumber, up to its return
+int CnvtPixNumberCycles(CPU *processor, uint16_t call)
+{
+    return Cycles(processor, call, call + 3) + Cycles(processor, 0x1474, 0x147c) +
+           Cycles(processor, 0x1a47, 0x1a4a) + 3 * Cycles(processor, 0x1a4a, 0x1a54) + Cycles(processor, 0x1a54, 0x1a5c);
+}
+
+/*
+ CALL CnvtPixNumber ($1474) returning to `ret`
+
+ 1474: MOV A,L / ANI 07 / OUT 02 / JMP ConvToScr
+ 1A47: PUSH B / MVI B,03
+ 1A4A: MOV A,H / RAR / MOV H,A / MOV A,L / RAR / MOV L,A / DCR B / JNZ 1A4A
+ 1A54: MOV A,H / ANI 3F / ORI 20 / MOV H,A / POP B / RET
+*/
+void CnvtPixNumber(CPU *processor, uint16_t ret)
+{
+    Push(processor, ret >> 8, ret & 0xff);
+
+    processor->a = processor->l & 0x07;
+    SetFlagsAfterLogicalOperation(processor);
+    shift_register_hw.out_port_two = processor->a;
+
+    Push(processor, processor->b, processor->c);
+    processor->b = 3;
+    do {
+        processor->h = Rar(processor, processor->h);
+        processor->a = processor->l = Rar(processor, processor->l);
+        processor->b--;
+        SetFlagsDcr(processor, processor->b);
+    } while (processor->b);
+
+    processor->a = processor->h & 0x3f;
+    SetFlagsAfterLogicalOperation(processor);
+    processor->a |= 0x20;
+    SetFlagsZSP(processor, processor->a);
+    processor->flags &= ~(1 << 3);
+    processor->h = processor->a;
+    Pop(processor, &processor->b, &processor->c);
+    processor->sp += 2; // RET to `ret`
+}
+
+/*
+ Rows of the sprite routines, each ends with DCR B
+
+ 1405: PUSH B / PUSH H / LDAX D / OUT 04 / IN 03 / ORA M / MOV M,A / INX H / INX D
+       XRA A / OUT 04 / IN 03 / ORA M / MOV M,A
+       POP H / LXI B,0020 / DAD B / POP B / DCR B / JNZ 1405
+*/
+void DrawShiftedSpriteRow(CPU *processor)
+{
+    Push(processor, processor->b, processor->c);
+    Push(processor, processor->h, processor->l);
+    ShiftOut(Read(processor, DE(processor)));
+    processor->a = ShiftIn() | Read(processor, HL(processor));
+    processor->memory->write(HL(processor), processor->a);
+    IncHL(processor);
+    IncDE(processor);
+    ShiftOut(0);
+    processor->a = ShiftIn() | Read(processor, HL(processor));
+    SetFlagsAfterLogicalOperation(processor);
+    processor->memory->write(HL(processor), processor->a);
+    Pop(processor, &processor->h, &processor->l);
+    NextRow(processor);
+}
+
+/*
+ 1427: PUSH B / PUSH H / XRA A / MOV M,A / INX H / MOV M,A / INX H
+       POP H / LXI B,0020 / DAD B / POP B / DCR B / JNZ 1427
+*/
+void EraseSimpleSpriteRow(CPU *processor)
+{
+    Push(processor, processor->b, processor->c);
+    Push(processor, processor->h, processor->l);
+    processor->a = 0;
+    processor->memory->write(HL(processor), 0);
+    IncHL(processor);
+    processor->memory->write(HL(processor), 0);
+    Pop(processor, &processor->h, &processor->l);
+    NextRow(processor);
+}
+
+/*
+ 1439: PUSH B / LDAX D / MOV M,A / INX D / LXI B,0020 / DAD B / POP B
+       DCR B / JNZ 1439
+*/
+void DrawSimpleSpriteRow(CPU *processor)
+{
+    Push(processor, processor->b, processor->c);
+    processor->a = Read(processor, DE(processor));
+    processor->memory->write(HL(processor), processor->a);
+    IncDE(processor);
+    NextRow(processor);
+}
+
+/*
+ 1455: PUSH B / PUSH H / LDAX D / OUT 04 / IN 03 / CMA / ANA M / MOV M,A / INX H / INX D
+       XRA A / OUT 04 / IN 03 / CMA / ANA M / MOV M,A
+       POP H / LXI B,0020 / DAD B / POP B / DCR B / JNZ 1455
+*/
+void EraseShiftedRow(CPU *processor)
+{
+    Push(processor, processor->b, processor->c);
+    Push(processor, processor->h, processor->l);
+    ShiftOut(Read(processor, DE(processor)));
+    processor->a = ~ShiftIn() & Read(processor, HL(processor));
+    processor->memory->write(HL(processor), processor->a);
+    IncHL(processor);
+    IncDE(processor);
+    ShiftOut(0);
+    processor->a = ~ShiftIn() & Read(processor, HL(processor));
+    SetFlagsAfterLogicalOperation(processor);
+    processor->memory->write(HL(processor), processor->a);
+    Pop(processor, &processor->h, &processor->l);
+    NextRow(processor);
+}
+
+/*
+ 15D7: PUSH B / PUSH H / LDAX D / OUT 04 / IN 03 / MOV M,A / INX H / INX D
+       XRA A / OUT 04 / IN 03 / MOV M,A
+       POP H / LXI B,0020 / DAD B / POP B / DCR B / JNZ 15D7
+*/
+void DrawSpriteRow(CPU *processor)
+{
+    Push(processor, processor->b, processor->c);
+    Push(processor, processor->h, processor->l);
+    ShiftOut(Read(processor, DE(processor)));
+    processor->a = ShiftIn();
+    processor->memory->write(HL(processor), processor->a);
+    IncHL(processor);
+    IncDE(processor);
+    processor->a = 0;
+    SetFlagsAfterLogicalOperation(processor);
+    ShiftOut(0);
+    processor->a = ShiftIn();
+    processor->memory->write(HL(processor), processor->a);
+    Pop(processor, &processor->h, &processor->l);
+    NextRow(processor);
+}
+
+/*
+ The row loop from `Loop` up to its JNZ, which ends before `End`, resumed
+ wherever the sprite routine is: as many rows as fit in `cycles` run, and
+ pc is left at `Loop`, or at `End` after the last row. A row writes
+ `Width` bytes and pushes `Stack` bytes.
+*/
+template<void (*Row)(CPU *), uint16_t Loop, uint16_t End, int Width, int Stack>
+int SpriteRows(CPU *processor, int cycles)
+{
+    int row = Cycles(processor, Loop, End);
+    int rows = qMin(processor->b ? (int)processor->b : 0x100, cycles / row);
+    if (rows == 0 || !InRam(processor->sp - Stack, Stack) || !InRam(HL(processor), (rows - 1) * 0x20 + Width)) {
+        return 0;
+    }
+
+    for (int i = 0; i < rows; i++) {
+        (*Row)(processor);
+    }
+    processor->pc = processor->b ? Loop : End;
+
+    return rows * row;
+}
+
+/*
+ Whole sprite routines, from their entry to the RET, if they fit in
+ `cycles`. Otherwise the CALL of CnvtPixNumber is interpreted and
+ SpriteRows() picks up at the loop.
+
+ 1400: NOP / CALL CnvtPixNumber / NOP / rows at 1405 / RET
+*/
+int DrawShiftedSprite(CPU *processor, int cycles)
+{
+    int rows = processor->b ? processor->b : 0x100;
+    int total = Cycles(processor, 0x1400, 0x1401) + CnvtPixNumberCycles(processor, 0x1401) + Cycles(processor, 0x1404, 0x1405) +
+                rows * Cycles(processor, 0x1405, 0x1421) + Cycles(processor, 0x1421, 0x1422);
+    if (total > cycles || !InRam(processor->sp - 4, 4) ||
+            !InRam(ScreenAddress(HL(processor)), (rows - 1) * 0x20 + 2)) {
+        return 0;
+    }
+
+    CnvtPixNumber(processor, 0x1404);
+    do {
+        DrawShiftedSpriteRow(processor);
+    } while (processor->b);
+    Ret(processor);
+
+    return total;
+}
+
+// 1424: CALL CnvtPixNumber / rows at 1427 / RET
+int EraseSimpleSprite(CPU *processor, int cycles)
+{
+    int rows = processor->b ? processor->b : 0x100;
+    int total = CnvtPixNumberCycles(processor, 0x1424) + rows * Cycles(processor, 0x1427, 0x1438) + Cycles(processor, 0x1438, 0x1439);
+    if (total > cycles || !InRam(processor->sp - 4, 4) ||
+            !InRam(ScreenAddress(HL(processor)), (rows - 1) * 0x20 + 2)) {
+        return 0;
+    }
+
+    CnvtPixNumber(processor, 0x1427);
+    do {
+        EraseSimpleSpriteRow(processor);
+    } while (processor->b);
+    Ret(processor);
+
+    return total;
+}
+
+// 1452: CALL CnvtPixNumber / rows at 1455 / RET
+int EraseShifted(CPU *processor, int cycles)
+{
+    int rows = processor->b ? processor->b : 0x100;
+    int total = CnvtPixNumberCycles(processor, 0x1452) + rows * Cycles(processor, 0x1455, 0x1473) + Cycles(processor, 0x1473, 0x1474);
+    if (total > cycles || !InRam(processor->sp - 4, 4) ||
+            !InRam(ScreenAddress(HL(processor)), (rows - 1) * 0x20 + 2)) {
+        return 0;
+    }
+
+    CnvtPixNumber(processor, 0x1455);
+    do {
+        EraseShiftedRow(processor);
+    } while (processor->b);
+    Ret(processor);
+
+    return total;
+}
+
+// 15D3: CALL CnvtPixNumber / PUSH H / rows at 15D7 / POP H / RET
+int DrawSprite(CPU *processor, int cycles)
+{
+    int rows = processor->b ? processor->b : 0x100;
+    int total = CnvtPixNumberCycles(processor, 0x15d3) + Cycles(processor, 0x15d6, 0x15d7) +
+                rows * Cycles(processor, 0x15d7, 0x15f1) + Cycles(processor, 0x15f1, 0x15f3);
+    if (total > cycles || !InRam(processor->sp - 6, 6) ||
+            !InRam(ScreenAddress(HL(processor)), (rows - 1) * 0x20 + 2)) {
+        return 0;
+    }
+
+    CnvtPixNumber(processor, 0x15d6);
+    Push(processor, processor->h, processor->l);
+    do {
+        DrawSpriteRow(processor);
+    } while (processor->b);
+    Pop(processor, &processor->h, &processor->l);
+    Ret(processor);
+
+    return total;
+}
+
+/*
+ BlockCopy, resumed like the sprite rows
+
+ 1A32: LDAX D / MOV M,A / INX H / INX D / DCR B / JNZ 1A32
+ 1A3A: RET
+*/
+int BlockCopy(CPU *processor, int cycles)
+{
+    int pass = Cycles(processor, 0x1a32, 0x1a3a);
+    int passes = qMin(processor->b ? (int)processor->b : 0x100, cycles / pass);
+    if (passes == 0 || !InRam(HL(processor), passes)) {
+        return 0;
+    }
+
+    for (int i = 0; i < passes; i++) {
+        processor->a = Read(processor, DE(processor));
+        processor->memory->write(HL(processor), processor->a);
+        IncHL(processor);
+        IncDE(processor);
+        processor->b--;
+    }
+    SetFlagsDcr(processor, processor->b);
+    processor->pc = processor->b ? 0x1a32 : 0x1a3a;
+
+    return passes * pass;
+}
+
+/*
+ ClearScreen, resumed like the sprite rows. It runs for about eight
+ frames, so it is never replaced as a whole.
+
+ 1A5C: LXI H,2400
+ 1A5F: MVI M,00 / INX H / MOV A,H / CPI 40 / JNZ 1A5F
+ 1A68: RET
+*/
+int ClearScreen(CPU *processor, int cycles)
+{
+    int pass = Cycles(processor, 0x1a5f, 0x1a68);
+
+    // Passes until H is $40 after the INX.
+    uint16_t next = HL(processor) + 1;
+    int left = (next >> 8) == 0x40 ? 1 : 1 + (uint16_t)(0x4000 - next);
+    int passes = qMin(left, cycles / pass);
+    if (passes == 0 || !InRam(HL(processor), passes)) {
+        return 0;
+    }
+
+    for (int i = 0; i < passes; i++) {
+        processor->memory->write(HL(processor), 0);
+        IncHL(processor);
+    }
+    processor->a = processor->h;
+    SetFlagsSub(processor, processor->a, 0x40, 0);
+    processor->pc = passes == left ? 0x1a68 : 0x1a5f;
+
+    return passes * pass;
+}
+
+const NativeRoutine invaders_routines[] = {
+    { 0x1400, "DrawShiftedSprite", DrawShiftedSprite },
+    { 0x1405, "DrawShiftedSprite rows", SpriteRows<DrawShiftedSpriteRow, 0x1405, 0x1421, 2, 4> },
+    { 0x1424, "EraseSimpleSprite", EraseSimpleSprite },
+    { 0x1427, "EraseSimpleSprite rows", SpriteRows<EraseSimpleSpriteRow, 0x1427, 0x1438, 2, 4> },
+    { 0x1439, "DrawSimpleSprite", SpriteRows<DrawSimpleSpriteRow, 0x1439, 0x1446, 1, 2> },
+    { 0x1452, "EraseShifted", EraseShifted },
+    { 0x1455, "EraseShifted rows", SpriteRows<EraseShiftedRow, 0x1455, 0x1473, 2, 4> },
+    { 0x15d3, "DrawSprite", DrawSprite },
+    { 0x15d7, "DrawSprite rows", SpriteRows<DrawSpriteRow, 0x15d7, 0x15f1, 2, 4> },
+    { 0x1a32, "BlockCopy", BlockCopy },
+    { 0x1a5f, "ClearScreen", ClearScreen },
+};
+
+}
+
+bool AddInvadersRoutines(CPU *processor)
+{
+    const uint8_t *mem = processor->memory->data;
+    for (int chip = 0; chip < 4; chip++) {
+        if (Crc32(mem + chip * 0x800, 0x800) != rom_crcs[chip]) {
+            qWarning() << "Unknown Space Invaders ROM, native routines disabled";
+            return false;
+        }
+    }
+
+    for (const NativeRoutine &routine : invaders_routines) {
+        processor->addRoutine(routine);
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+#ifndef INVADERSROUTINES_H
+#define INVADERSROUTINES_H
+
+#include "cpu.h"
+
+/*
+ Native Space Invaders routines
+
+ The screen clear, the sprite draw and erase routines and the block copy
+ are the busiest code of the Space Invaders ROM outside of its idle loop.
+ They are replaced by C++ that leaves the same registers,
+ flags, memory, stack and shift register behind, see CPU::addRoutine().
+
+ $1400  DrawShiftedSprite  ORs a sprite through the shift register
+ $1424  EraseSimpleSprite  clears a 2 byte wide sprite
+ $1439  DrawSimpleSprite   copies a 1 byte wide sprite
+ $1452  EraseShifted       masks a sprite out through the shift register
+ $15D3  DrawSprite         copies a sprite through the shift register
+ $1A32  BlockCopy          copies B bytes from DE to HL
+ $1A5F  ClearScreen        the loop clearing video RAM
+
+ A routine only runs natively if it writes nothing but RAM, and only as
+ far as the cycles left in the run() batch allow. It reads and writes
+ through the MemoryMap, mirrors and devices included. The sprite routines
+ run as a whole when they fit, their row loops are registered as well
+ and run as many whole rows as fit. BlockCopy and ClearScreen are loops
+ themselves and resume the same way, the ROM code interprets the rest.
+*/
+
+// Registers the routines if $0000-$1FFF holds the ROM they were written
+// against, checked by the CRC-32 of each ROM chip. Returns false otherwise.
+bool AddInvadersRoutines(CPU *processor);
+
+#endif // INVADERSROUTINES_H
@@ -1,4 +1,21 @@
 #include "machine.h"
+#include "blockcache.h"
+#include "i8080jit.h"
+#include "i8080aot.h"
+#include "invadersroutines.h"
+#include "opcodeprofile.h"
+#include "invadersbus.h"
+#include "i8080switchengine.h"
+#include "romimage.h"
+#include "memoryheatmap.h"
+
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include <QFile>
 #include <QDebug>
@@ -6,88 +23,587 @@
 using namespace EE;
 
 ShiftRegister shift_register_hw;
+static ShiftRegister saved_shift_register;
+
+// The header and storage of a new shared memory segment `name`, zeroed, or 0.
+static MemoryExportHeader *CreateExport(const QByteArray &name)
+{
+#ifndef _WIN32
+    long data_offset = qMax(sysconf(_SC_PAGESIZE), (long)sizeof(MemoryExportHeader));
+    int shm = shm_open(name.constData(), O_RDWR | O_CREAT, 0644);
+    if (shm < 0) {
+        return 0;
+    }
+    // Emptied first, a segment left behind by a crashed run starts zeroed.
+    void *mapped = MAP_FAILED;
+    if (ftruncate(shm, 0) == 0 && ftruncate(shm, data_offset + 0x10000) == 0) {
+        mapped = mmap(0, data_offset + 0x10000, PROT_READ | PROT_WRITE, MAP_SHARED, shm, 0);
+    }
+    close(shm);
+    if (mapped == MAP_FAILED) {
+        shm_unlink(name.constData());
+        return 0;
+    }
+    MemoryExportHeader *header = (MemoryExportHeader *)mapped;
+    header->version = 1;
+    header->data_offset = data_offset;
+    header->data_size = 0x10000;
+    header->sequence.store(0, std::memory_order_relaxed);
+    // Last, readers check the magic before anything else.
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(header->magic, "EE80", 4);
+    return header;
+#else
+    Q_UNUSED(name);
+    return 0;
+#endif
+}
 
-MemoryMap::MemoryMap()
+MemoryMap::MemoryMap(const QString &export_name)
 {
+    // 16 address pins, for 2^16=65536 (0x10000 in hex)
+    export_header = 0;
+    if (!export_name.isEmpty()) {
+        this->export_name = export_name.toLocal8Bit();
+        export_header = CreateExport(this->export_name);
+        if (!export_header) {
+            qWarning() << "Cannot export the memory map as" << export_name << ", its storage stays private";
+        }
+    }
+#ifndef _WIN32
+    // Zeroed pages of its own, which mapRom() can map a shared RomImage
+    // over. Only the pages written take memory.
+    data = (uint8_t *)mmap(0, 0x10000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        qFatal("Cannot allocate the memory map's storage");
+    }
+#else
+    data = (uint8_t *)qMallocAligned(0x10000, 0x1000);
+    memset(data, 0, 0x10000);
+#endif
+    code_cache = 0;
+    jit = 0;
+    aot = 0;
+    processor = 0;
+    heatmap = 0;
+    memset(code_pages, 0, sizeof(code_pages));
+    memset(watch_entries, 0, sizeof(watch_entries));
+    watch_count = 0;
+    memset(shared_pages, 0, sizeof(shared_pages));
+    code_writes = 0;
+    for (int i = 0; i < 0x10000 / 64; i++) {
+        dirty[i].store(0, std::memory_order_relaxed);
+    }
+    mapRam(0, 0x10000);
 }
 
 MemoryMap::~MemoryMap()
 {
+    qDeleteAll(devices);
+#ifndef _WIN32
+    if (export_header) {
+        // Readers still mapping the segment keep it until they unmap it.
+        munmap(export_header, export_header->data_offset + 0x10000);
+        shm_unlink(export_name.constData());
+    }
+    munmap(data, 0x10000);
+#else
+    qFreeAligned(data);
+#endif
 }
 
-int input_callback(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
-
-    uint8_t port = processor->memory->data.at(processor->pc+1);
-    switch (port) {
-        case 0:
-            processor->a = shift_register_hw.in_port_one;
-            break;
-        case 2:
-            processor->a = shift_register_hw.in_port_two;
-            break;
-        case 3:
-            uint16_t val = ((((shift_register_hw.out_port_four_high << 8) | shift_register_hw.out_port_four_low) << shift_register_hw.out_port_two) >> 8);
-            processor->a = (val & 0xFF);
-            break;
+void MemoryMap::mapPages(uint16_t addr, int size, const uint8_t *read, uint8_t *write)
+{
+    Q_ASSERT((addr & 0xff) == 0 && (size & 0xff) == 0 && addr + size <= 0x10000);
+    for (int page = addr >> 8; page < (addr + size) >> 8; page++) {
+        int offset = (page << 8) - addr;
+        mapped_read[page] = read ? read + offset : 0;
+        mapped_write[page] = write ? write + offset : 0;
+        page_devices[page].clear();
+        updatePage(page);
+    }
+}
+
+// Derives the direct access to `page` from its mapping and watchpoints.
+void MemoryMap::updatePage(int page)
+{
+    bool read_watched = false, write_watched = false;
+    for (int i = page << 5; watch_count && i < (page + 1) << 5; i++) {
+        read_watched = read_watched || watch_entries[0][i];
+        write_watched = write_watched || watch_entries[1][i];
+    }
+    // A heatmap counts the accesses to every page, the way watchpoints stop on them.
+    if (heatmap) {
+        read_watched = write_watched = true;
+    }
+
+    bool device = !page_devices[page].isEmpty();
+    uint8_t *write = mapped_write[page];
+    bool shared = write && shared_pages[(write - data) >> 8];
+
+    read_pages[page] = read_watched || device ? 0 : mapped_read[page];
+    write_pages[page] = write_watched || device || shared ? 0 : write;
+
+    indirect_pages[page] = (device || mapped_read[page] != data + (page << 8)) | (read_watched ? 2 : 0);
+    // Only RAM at its own address may be written directly.
+    code_pages[page] &= ~(8 | 32 | 64);
+    if (device || write != data + (page << 8)) {
+        code_pages[page] |= 8;
+    }
+    if (write_watched) {
+        code_pages[page] |= 32;
+    }
+    if (shared) {
+        code_pages[page] |= 64;
+    }
+}
+
+void MemoryMap::mapRam(uint16_t addr, int size)
+{
+    mapPages(addr, size, data + addr, data + addr);
+}
+
+void MemoryMap::mapRom(uint16_t addr, int size)
+{
+    mapPages(addr, size, data + addr, 0);
+}
+
+void MemoryMap::mapRom(uint16_t addr, const RomImage *image)
+{
+    Q_ASSERT(addr + image->size <= 0x10000);
+#ifndef _WIN32
+    long host_page = sysconf(_SC_PAGESIZE);
+    if (image->fd >= 0 && addr % host_page == 0 && image->size % host_page == 0 &&
+            mmap(data + addr, image->size, PROT_READ, MAP_SHARED | MAP_FIXED, image->fd, 0) != MAP_FAILED) {
+        mapRom(addr, image->size);
+        return;
+    }
+#endif
+    memcpy(data + addr, image->data, image->size);
+    mapRom(addr, image->size);
+}
+
+void MemoryMap::unmap(uint16_t addr, int size)
+{
+    mapPages(addr, size, 0, 0);
+}
+
+void MemoryMap::mapDevice(uint16_t addr, int size,
+                          uint8_t (*read)(void *context, uint16_t addr),
+                          void (*write)(void *context, uint16_t addr, uint8_t val),
+                          void *context)
+{
+    Q_ASSERT(size > 0 && addr + size <= 0x10000);
+    MemoryDevice *device = new MemoryDevice { addr, size, read, write, context };
+    devices.append(device);
+    for (int page = addr >> 8; page <= (addr + size - 1) >> 8; page++) {
+        page_devices[page].append(device);
+        updatePage(page);
+    }
+}
+
+void MemoryMap::mirror(uint16_t addr, int end, uint16_t target, int size)
+{
+    for (int from = addr; from < end; from += size) {
+        int page = target >> 8;
+        // The mirrored pages' own mapping, RAM or ROM.
+        mapPages(from, qMin(size, end - from), mapped_read[page], mapped_write[page]);
+    }
+}
+
+void MemoryMap::trackWrites(uint16_t addr, int size)
+{
+    Q_ASSERT((addr & 0xff) == 0 && (size & 0xff) == 0 && addr + size <= 0x10000);
+    for (int page = 0; page < 0x100; page++) {
+        if (mapped_write[page] && mapped_write[page] >= data + addr && mapped_write[page] < data + addr + size) {
+            code_pages[page] |= 16;
+        }
+    }
+    for (int i = addr >> 6; i < (addr + size) >> 6; i++) {
+        dirty[i].store(~(uint64_t)0, std::memory_order_relaxed);
+    }
+}
+
+void MemoryMap::takeDirty(uint16_t addr, int size, uint64_t *bits)
+{
+    for (int i = 0; i < size >> 6; i++) {
+        bits[i] = dirty[(addr >> 6) + i].exchange(0, std::memory_order_acquire);
+    }
+}
+
+void MemoryMap::addWatchpoint(uint16_t addr, int size, int kinds)
+{
+    for (int i = addr; i < addr + size && i < 0x10000; i++) {
+        for (int kind = WatchRead; kind <= WatchWrite; kind++) {
+            if ((kinds & kind) && !isWatched(i, kind)) {
+                watch_entries[kind >> 1][i >> 3] |= 1 << (i & 7);
+                watch_count++;
+            }
+        }
+    }
+    for (int page = addr >> 8; page <= (qMin(addr + size, 0x10000) - 1) >> 8; page++) {
+        updatePage(page);
+    }
+}
+
+void MemoryMap::removeWatchpoint(uint16_t addr, int size, int kinds)
+{
+    for (int i = addr; i < addr + size && i < 0x10000; i++) {
+        for (int kind = WatchRead; kind <= WatchWrite; kind++) {
+            if ((kinds & kind) && isWatched(i, kind)) {
+                watch_entries[kind >> 1][i >> 3] &= ~(1 << (i & 7));
+                watch_count--;
+            }
+        }
+    }
+    for (int page = addr >> 8; page <= (qMin(addr + size, 0x10000) - 1) >> 8; page++) {
+        updatePage(page);
+    }
+}
+
+void MemoryMap::setHeatmap(MemoryHeatmap *counts)
+{
+    heatmap = counts;
+    for (int page = 0; page < 0x100; page++) {
+        updatePage(page);
+    }
+}
+
+// Open, device, watched and counted pages, whose reads have no direct pointer.
+uint8_t MemoryMap::readSlow(uint16_t addr) const
+{
+    if (heatmap) {
+        heatmap->read(addr);
+    }
+    if (processor && isWatched(addr, WatchRead)) {
+        processor->watchpointHit(addr, false);
+    }
+    const MemoryDevice *device = deviceAt(addr);
+    if (device) {
+        return device->read ? device->read(device->context, addr) : 0xff;
+    }
+    const uint8_t *page = mapped_read[addr >> 8];
+    if (page) {
+        return page[addr & 0xff];
+    }
+    return 0xff; // open bus
+}
+
+// ROM, open, device, watched, counted and shared pages. Writes to ROM and
+// open pages are dropped.
+void MemoryMap::writeSlow(uint16_t addr, uint8_t val)
+{
+    if (heatmap) {
+        heatmap->written(addr);
     }
+    if (processor && isWatched(addr, WatchWrite)) {
+        processor->watchpointHit(addr, true);
+    }
+    const MemoryDevice *device = deviceAt(addr);
+    if (device) {
+        if (device->write) {
+            device->write(device->context, addr, val);
+        }
+        return;
+    }
+    uint8_t *page = mapped_write[addr >> 8];
+    if (page) {
+        if (shared_pages[(page - data) >> 8]) {
+            unshare((page - data) >> 8);
+        }
+        page[addr & 0xff] = val;
+        wrote(page, addr);
+    }
+}
+
+void MemoryMap::invalidateCode(uint16_t addr)
+{
+    code_writes++;
+    if (code_cache) {
+        code_cache->invalidate(addr);
+    }
+    if (jit && (code_pages[addr >> 8] & 2)) {
+        jit->invalidate(addr);
+    }
+    if (aot && (code_pages[addr >> 8] & 4)) {
+        aot->invalidate(addr);
+    }
+}
+
+// Marks every writable page shared with the new `snapshot`.
+void MemoryMap::share(MemorySnapshot *snapshot)
+{
+    snapshots.append(snapshot);
+    memset(shared_pages, 1, sizeof(shared_pages));
+    for (int page = 0; page < 0x100; page++) {
+        updatePage(page);
+    }
+}
+
+// Copies the storage page for the snapshots still sharing it, before it
+// is written. The pages mapped onto it are written directly again.
+void MemoryMap::unshare(int storage_page)
+{
+    shared_pages[storage_page] = 0;
+    QByteArray copy;
+    for (MemorySnapshot *snapshot : snapshots) {
+        if (snapshot->pages[storage_page].isNull()) {
+            if (copy.isNull()) {
+                copy = QByteArray((const char *)data + (storage_page << 8), 0x100);
+            }
+            snapshot->pages[storage_page] = copy;
+        }
+    }
+    for (int page = 0; page < 0x100; page++) {
+        if (mapped_write[page] == data + (storage_page << 8)) {
+            updatePage(page);
+        }
+    }
+}
+
+void MemoryMap::restore(MemorySnapshot *snapshot)
+{
+    for (int storage_page = 0; storage_page < 0x100; storage_page++) {
+        QByteArray &copy = snapshot->pages[storage_page];
+        if (copy.isNull()) {
+            continue; // not written since
+        }
+        if (shared_pages[storage_page]) {
+            unshare(storage_page);
+        }
+        uint8_t *storage = data + (storage_page << 8);
+        // Changed bytes reach pre-decoded code and dirty like writes do,
+        // see wrote().
+        bool code = code_pages[storage_page] & 7, tracked = false;
+        for (int page = 0; page < 0x100; page++) {
+            tracked = tracked || (mapped_write[page] == storage && (code_pages[page] & 16));
+        }
+        for (int i = 0; (code || tracked) && i < 0x100; i++) {
+            if (storage[i] != (uint8_t)copy.at(i)) {
+                if (code) {
+                    invalidateCode((storage_page << 8) | i);
+                }
+                if (tracked) {
+                    markDirty((storage_page << 8) | i);
+                }
+            }
+        }
+        memcpy(storage, copy.constData(), 0x100);
+        copy = QByteArray();
+        shared_pages[storage_page] = 1;
+        for (int page = 0; page < 0x100; page++) {
+            if (mapped_write[page] == storage) {
+                updatePage(page);
+            }
+        }
+    }
+}
+
+// A seqlock write, see memoryexport.h, the sequence is odd only for the copy.
+void MemoryMap::exportStorage(uint64_t cycle_count)
+{
+    if (!export_header) {
+        return;
+    }
+    std::atomic<uint32_t> &sequence = export_header->sequence;
+    uint32_t start = sequence.load(std::memory_order_relaxed);
+    sequence.store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy((uint8_t *)export_header + export_header->data_offset, data, 0x10000);
+    export_header->frame++;
+    export_header->cycle_count = cycle_count;
+    sequence.store(start + 2, std::memory_order_release);
+}
+
+MemorySnapshot::MemorySnapshot(MemoryMap *memory) : memory(memory)
+{
+    memory->share(this);
+}
+
+// The last snapshot gone, every page is written directly again.
+MemorySnapshot::~MemorySnapshot()
+{
+    memory->snapshots.removeOne(this);
+    if (memory->snapshots.isEmpty()) {
+        memset(memory->shared_pages, 0, sizeof(memory->shared_pages));
+        for (int page = 0; page < 0x100; page++) {
+            memory->updatePage(page);
+        }
+    }
+}
+
+void MemorySnapshot::copy(uint8_t *storage) const
+{
+    for (int page = 0; page < 0x100; page++) {
+        const uint8_t *from = pages[page].isNull() ? memory->data + (page << 8) : (const uint8_t *)pages[page].constData();
+        memcpy(storage + (page << 8), from, 0x100);
+    }
+}
+
+int MemorySnapshot::copiedPages() const
+{
+    int copied = 0;
+    for (int page = 0; page < 0x100; page++) {
+        copied += !pages[page].isNull();
+    }
+    return copied;
+}
+
+int input_callback(INSTDEF) {
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
+
+    uint8_t port = processor->memory->read(processor->pc+1);
+    processor->a = ReadInvadersPort(port, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
 }
 int output_callback(INSTDEF) {
-    int inst_length = opcode.at(1).toInt();
-    int inst_cycles = opcode.at(2).toInt();
-
-    uint8_t port = processor->memory->data.at(processor->pc+1);
-
-    switch (port) {
-        case 2:
-            shift_register_hw.out_port_two = processor->a;
-        break;
-    case 3:
-        shift_register_hw.out_port_three = processor->a;
-        break;
-    case 4:
-        shift_register_hw.out_port_four_low = shift_register_hw.out_port_four_high;
-        shift_register_hw.out_port_four_high = processor->a;
-        break;
-    case 5:
-        shift_register_hw.out_port_five = processor->a;
-        break;
-    }
+    int inst_length = opcode.length;
+    int inst_cycles = opcode.cycles;
+
+    uint8_t port = processor->memory->read(processor->pc+1);
+    WriteInvadersPort(port, processor->a);
 
     processor->pc += inst_length;
     return inst_cycles;
 }
 
+// RST 1 and RST 2 are only taken while interrupts are enabled.
+void mid_screen_interrupt(CPU *processor, void *context) {
+    Q_UNUSED(context);
+    if (processor->flags&(1 << 5)) {
+        processor->interrupt(1);
+    }
+}
+void end_of_screen_interrupt(CPU *processor, void *context) {
+    TripleBuffer *video_frames = (TripleBuffer *)context;
+    processor->memory->exportStorage(processor->cycle_count);
+    // The frame is complete, the video RAM is published only when written.
+    uint64_t dirty[video_ram_size / 64];
+    uint64_t written = 0;
+    processor->memory->takeDirty(video_ram, video_ram_size, dirty);
+    for (int i = 0; i < video_ram_size / 64; i++) {
+        written |= dirty[i];
+    }
+    if (written) {
+        memcpy(video_frames->back(), processor->memory->data + video_ram, video_ram_size);
+        video_frames->publish();
+    }
+    if (processor->flags&(1 << 5)) {
+        processor->interrupt(2);
+    }
+}
+
+// A CPU/Watchpoints entry, "first[-last][:rw]"
+static void AddWatchpoint(CPU *processor, const QString &entry)
+{
+    QString range = entry.section(':', 0, 0);
+    QString access = entry.section(':', 1, 1);
+    bool first_ok, last_ok = true;
+    uint16_t first = range.section('-', 0, 0).toUShort(&first_ok, 16);
+    uint16_t last = range.contains('-') ? range.section('-', 1, 1).toUShort(&last_ok, 16) : first;
+    int kinds = 0;
+    if (access.isEmpty() || access.contains('r')) {
+        kinds |= MemoryMap::WatchRead;
+    }
+    if (access.isEmpty() || access.contains('w')) {
+        kinds |= MemoryMap::WatchWrite;
+    }
+    if (!first_ok || !last_ok || last < first || !kinds) {
+        qWarning() << "Ignoring watchpoint" << entry;
+        return;
+    }
+    processor->addWatchpoint(first, last - first + 1, kinds);
+}
+
+// Device snapshot for CPU::verify_routines
+void save_shift_register(void) {
+    saved_shift_register = shift_register_hw;
+}
+void restore_shift_register(void) {
+    shift_register_hw = saved_shift_register;
+}
+
 Machine::Machine(QObject *parent) : QObject(parent)
 {
     mutex = new QMutex();
-    memory = new MemoryMap();
+    // Copy the RAM into a POSIX shared memory segment, e.g. "/ee-ram", every
+    // frame, for analyzers running as other processes, see memoryexport.h.
+    memory = new MemoryMap(settings.value("Memory/Export").toString());
     cpu = new CPU(mutex, memory);
+    video_frames = new TripleBuffer(video_ram_size);
     //cpu->flags |= (1 << 6); // Enable the processor
     //cpu->flags |= (1 << 7); // Diagnostic mode
     //cpu->flags |= (1 << 8); // Capture cpu state changes
 
+    // "table" dispatches through CPU::instruction_handlers,
+    // "switch" runs the single loop switch engine,
+    // "block" runs the handlers from pre-decoded basic blocks,
+    // "jit" translates hot blocks into x86-64 code,
+    // "aot" runs the ROM recompiled by tools/recompilerom.py.
+    QString engine = settings.value("CPU/Engine", "table").toString();
+    if (engine == "switch") {
+        cpu->engine = CPU::SwitchEngine;
+    } else if (engine == "block") {
+        cpu->engine = CPU::BlockEngine;
+    } else if (engine == "jit") {
+        if (!Jit::available()) {
+            qWarning() << "CPU/Engine jit needs an x86-64 host, falling back to the handler table";
+        }
+        cpu->engine = CPU::JitEngine;
+    } else if (engine == "aot") {
+        cpu->engine = CPU::StaticEngine;
+    }
+
+    // The switch engine reaches memory and ports through a bus, see i8080bus.h.
+    // "flat" inlines the machine's ports, "checked" takes every access
+    // through MemoryMap and runs no native routines.
+    bool checked_bus = settings.value("CPU/Bus", "flat").toString() == "checked";
+    if (checked_bus) {
+        cpu->switch_engine = RunSwitchEngine<CheckedBus>;
+    } else {
+        cpu->switch_engine = RunSwitchEngine<InvadersBus>;
+    }
+
+    // Stop on accesses to e.g. the score, "20f8", "20f8-20fb" or
+    // "2400-3fff:w", hex and inclusive, r, w or rw (the default).
+    for (const QString &entry : settings.value("CPU/Watchpoints").toStringList()) {
+        AddWatchpoint(cpu, entry);
+    }
+
+    // Evaluate Z, S and P only when read, off for comparing against eager flags.
+    cpu->lazy_flags = settings.value("CPU/LazyFlags", true).toBool();
+
+    // Run paced at 2MHz, or as fast as the host allows.
+    cpu->throttled = settings.value("CPU/Throttle", true).toBool();
+
+    // Fast-forward spin loops that wait for an interrupt, see CPU::skipIdleLoop().
+    cpu->skip_idle_loops = settings.value("CPU/SkipIdleLoops", true).toBool();
+
+    // Record the opcode sequences the interpreter executes, for
+    // tools/genfusedhandlers.py. Saved when the machine is destroyed.
+    opcode_profile = settings.value("CPU/OpcodeProfile", "").toString();
+    if (!opcode_profile.isEmpty()) {
+        cpu->profile = new OpcodeProfile();
+    }
+
     cpu->setCallback(0xd3, output_callback);
     cpu->setCallback(0xdb, input_callback);
 
-    // Load Space Invaders rom files.
-    QFile invaders_h("://assets/roms/invaders.h");
-    QFile invaders_g("://assets/roms/invaders.g");
-    QFile invaders_f("://assets/roms/invaders.f");
-    QFile invaders_e("://assets/roms/invaders.e");
+    cpu->addCycleEvent(mid_screen_cycle, cycles_per_frame, mid_screen_interrupt, 0);
+    cpu->addCycleEvent(cycles_per_frame, cycles_per_frame, end_of_screen_interrupt, video_frames);
+
+    // Space Invaders ROM, loaded once for all the machines of the process.
+    const RomImage *rom = RomImage::load(QStringList()
+                                         << "://assets/roms/invaders.h"
+                                         << "://assets/roms/invaders.g"
+                                         << "://assets/roms/invaders.f"
+                                         << "://assets/roms/invaders.e");
     QFile diag("://assets/roms/cpudiag.bin");
 
-    bool opened = true;
-    opened = opened && invaders_h.open(QIODevice::ReadOnly);
-    opened = opened && invaders_g.open(QIODevice::ReadOnly);
-    opened = opened && invaders_f.open(QIODevice::ReadOnly);
-    opened = opened && invaders_e.open(QIODevice::ReadOnly);
-    opened = opened && diag.open(QIODevice::ReadOnly);
-    if (!opened) {
+    if (!rom || !diag.open(QIODevice::ReadOnly)) {
       qDebug() << "This machine needs space invaders rom files to emulate.";
       exit(1);
     }
@@ -95,15 +611,12 @@ Machine::Machine(QObject *parent) : QObject(parent)
     // ROMs are mapped to memory at 0x0000 - 0x1FFF
     // 0x2000-0x23ff working RAM, 0x2400-0x3FFF video RAM
     mutex->lock();
-    char *mem = memory->data.data();
-
-    memcpy(mem,          invaders_h.readAll().data(), invaders_h.size());
-    memcpy(mem + 0x800,  invaders_g.readAll().data(), invaders_g.size());
-    memcpy(mem + 0x1000, invaders_f.readAll().data(), invaders_f.size());
-    memcpy(mem + 0x1800, invaders_e.readAll().data(), invaders_e.size());
+    uint8_t *mem = memory->data;
 
     // Load a diagnostic binary for diagnostic mode.
     if (cpu->flags&(1 << 7))  {
+        // Diagnostic mode keeps the whole 64KB as RAM, with a copy of the ROM.
+        memcpy(mem, rom->data, rom->size);
         memcpy(mem + 0x100, diag.readAll().data(), diag.size());
         mem[0] = 0xc3;
         mem[1] = 0;
@@ -112,6 +625,21 @@ Machine::Machine(QObject *parent) : QObject(parent)
         mem[0x59c] = 0xc3;
         mem[0x59d] = 0xc2;
         mem[0x59e] = 0x05;
+    } else {
+        // Writes to the ROMs are dropped and $4000- mirrors the RAM, see machine.h.
+        memory->mapRom(0x0000, rom);
+        memory->mirror(0x4000, 0x10000, 0x2000, 0x2000);
+    }
+
+    // Frames are published only when the video RAM was written, see
+    // end_of_screen_interrupt().
+    memory->trackWrites(video_ram, video_ram_size);
+
+    // Run the screen clear, sprite and block copy routines natively, and
+    // optionally check them against the ROM code, see invadersroutines.h.
+    if (!checked_bus && settings.value("CPU/NativeRoutines", true).toBool() && AddInvadersRoutines(cpu)) {
+        cpu->verify_routines = settings.value("CPU/VerifyRoutines", false).toBool();
+        cpu->setDeviceSnapshot(save_shift_register, restore_shift_register);
     }
     mutex->unlock();
 
@@ -128,9 +656,13 @@ Machine::~Machine()
     //thread.requestInterruption();
     mutex->lock();
     cpu->flags &= ~(1<<6); // disable processor
+    if (cpu->profile) {
+        cpu->profile->save(opcode_profile);
+    }
     mutex->unlock();
     thread.quit();
     thread.wait();
+    delete video_frames;
     delete memory;
     delete mutex;
 }
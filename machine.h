@@ -10,11 +10,10 @@
 #include <QTime>
 
 #include "cpu.h"
+#include "triplebuffer.h"
 
 namespace EE {
 
-class Disassembler;
-
 /*
  Space Invaders arcade machine.
 
@@ -38,8 +37,20 @@ class Disassembler;
   $2400-$3fff:    video RAM
 
   $4000-:     RAM mirror
+
+ Every end of screen interrupt publishes a copy of the video RAM to the
+ machine's video_frames, frames the UI draws without reading the RAM the
+ processor is writing.
 */
 
+// 2MHz / 60Hz, the mid screen interrupt fires halfway through a frame
+// and the end of screen interrupt at its end.
+const int cycles_per_frame = 33333;
+const int mid_screen_cycle = cycles_per_frame / 2;
+
+const uint16_t video_ram = 0x2400;
+const int video_ram_size = 256 * 224 / 8;
+
 class ShiftRegister {
 public:
     uint8_t out_port_two, out_port_three,
@@ -54,8 +65,10 @@ public:
     Machine(QObject *parent = 0);
     ~Machine();
     CPU *cpu;
+    TripleBuffer *video_frames; // video RAM as of the last end of screen, see end_of_screen_interrupt()
 private:
     uint8_t shift_high, shift_low, shift_offset;
+    QString opcode_profile;  // file CPU::profile is saved to, or empty
     QSettings settings;
     QThread thread;
     QMutex *mutex;
@@ -66,8 +79,15 @@ signals:
 
 }
 
+extern EE::ShiftRegister shift_register_hw;
+
 extern "C" {
     int input_callback(INSTDEF);
     int output_callback(INSTDEF);
+    void mid_screen_interrupt(CPU *processor, void *context);
+    // `context` is the TripleBuffer the video RAM is published to.
+    void end_of_screen_interrupt(CPU *processor, void *context);
+    void save_shift_register(void);
+    void restore_shift_register(void);
 }
 #endif // MACHINE_H
@@ -0,0 +1,62 @@
+#ifndef MEMORYEXPORT_H
+#define MEMORYEXPORT_H
+
+#include <stdint.h>
+
+#include <atomic>
+
+/*
+ Memory map export
+
+ A MemoryMap created with an export name keeps a POSIX shared memory
+ segment of that name, e.g. "/ee-ram", which other processes map read
+ only, see tools/watchram.py. The segment starts with a
+ MemoryExportHeader, a copy of the 64KB of storage follows at
+ data_offset, a multiple of the host page size. Readers see the storage
+ as MemoryMap::data, not through the page table: ROM and RAM at their
+ own addresses, mirrors not repeated, devices not at all.
+
+ The machine copies the storage into the segment at the end of every
+ frame, see MemoryMap::exportStorage(), and `sequence` is odd for that
+ copy only, then even again, whether or not the processor is throttled.
+ Until the first frame the copy is zeroed. A reader reads the copy in
+ place and knows it was consistent, no write in between, if `sequence`
+ was even and unchanged before and after:
+
+   do {
+       do { start = sequence.load(acquire); } while (start & 1);
+       ... read the storage ...
+       fence(acquire);
+   } while (sequence.load(relaxed) != start);
+
+ The processor never waits for readers, a reader that takes too long
+ tries again. The copy takes a few microseconds of every frame, so a
+ reader that finds it odd can back off briefly.
+
+ The layout is fixed, for readers in any language. Offsets in bytes,
+ host byte order:
+
+    0  magic        "EE80"
+    4  version      1
+    8  data_offset  where the storage starts
+   12  data_size    0x10000
+   16  sequence     uint32, odd while the storage is copied
+   24  frame        uint64, frames the machine completed
+   32  cycle_count  uint64, processor cycles when the storage was copied
+*/
+
+struct MemoryExportHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t data_offset;
+    uint32_t data_size;
+    std::atomic<uint32_t> sequence;
+    uint32_t reserved;
+    uint64_t frame;
+    uint64_t cycle_count;
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == 4, "sequence must be a plain 32 bit word");
+static_assert(sizeof(MemoryExportHeader) == 40, "the header layout is read by other processes");
+
+#endif // MEMORYEXPORT_H
@@ -0,0 +1,54 @@
+#include "memoryheatmap.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <QFile>
+#include <QDebug>
+
+MemoryHeatmap::MemoryHeatmap()
+{
+    clear();
+}
+
+void MemoryHeatmap::clear()
+{
+    memset(reads, 0, sizeof(reads));
+    memset(writes, 0, sizeof(writes));
+    memset(executes, 0, sizeof(executes));
+    instruction = 0;
+    instruction_length = 0;
+}
+
+bool MemoryHeatmap::save(const QString &path) const
+{
+    bool json = path.endsWith(".json");
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qWarning() << "Cannot write the memory heatmap to" << path;
+        return false;
+    }
+
+    file.write(json ? "[\n" : "address,reads,writes,executes\n");
+    bool first = true;
+    for (int addr = 0; addr < 0x10000; addr++) {
+        if (!reads[addr] && !writes[addr] && !executes[addr]) {
+            continue;
+        }
+        char line[128];
+        if (json) {
+            snprintf(line, sizeof(line), "%s  { \"address\": \"%04x\", \"reads\": %u, \"writes\": %u, \"executes\": %u }",
+                     first ? "" : ",\n", addr, reads[addr], writes[addr], executes[addr]);
+        } else {
+            snprintf(line, sizeof(line), "%04x,%u,%u,%u\n", addr, reads[addr], writes[addr], executes[addr]);
+        }
+        file.write(line);
+        first = false;
+    }
+    if (json) {
+        file.write(first ? "]\n" : "\n]\n");
+    }
+
+    return true;
+}
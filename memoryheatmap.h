@@ -0,0 +1,74 @@
+#ifndef MEMORYHEATMAP_H
+#define MEMORYHEATMAP_H
+
+#include <stdint.h>
+
+#include <QString>
+
+/*
+ Memory access heatmap
+
+ Counts the reads, writes and executed instructions at each of the 64KB
+ of addresses, as the processor sees them, so a mirror counts apart
+ from the RAM it mirrors. The counts saturate at 2^32-1.
+
+ While CPU::setHeatmap() has one set, MemoryMap takes every page's reads
+ and writes through readSlow() and writeSlow(), which count them, and
+ the processor runs in CPU::HeatmapMode, through step(), without native
+ routines or idle loop skipping. Reads of the bytes of the instruction
+ being executed, its opcode and operands, are not counted as data
+ reads. Nothing is counted, and nothing costs, while none is set.
+
+ The counts are written by the processor's thread and may be read by
+ others while it runs, e.g. by MemoryHeatmapView, seeing counts a few
+ instructions old.
+
+ save() writes the addresses with any count, as CSV
+
+   address,reads,writes,executes
+   20f8,1203,96,0
+
+ or as JSON, for a path ending in .json
+
+   [ { "address": "20f8", "reads": 1203, "writes": 96, "executes": 0 }, ... ]
+*/
+
+class MemoryHeatmap
+{
+public:
+    MemoryHeatmap();
+
+    // An instruction starts executing at `pc`, its bytes are read next.
+    inline void executed(uint16_t pc) {
+        count(executes[pc]);
+        instruction = pc;
+        instruction_length = 3;
+    }
+    // The instruction at executed()'s pc is `length` bytes long.
+    inline void decoded(int length) {
+        instruction_length = length;
+    }
+    inline void read(uint16_t addr) {
+        if ((uint16_t)(addr - instruction) >= instruction_length) {
+            count(reads[addr]);
+        }
+    }
+    inline void written(uint16_t addr) {
+        count(writes[addr]);
+    }
+
+    void clear(void);
+    bool save(const QString &path) const;
+
+    uint32_t reads[0x10000];
+    uint32_t writes[0x10000];
+    uint32_t executes[0x10000];
+private:
+    static inline void count(uint32_t &counter) {
+        counter += counter != UINT32_MAX;
+    }
+    uint16_t instruction;       // pc of the instruction being executed
+    int instruction_length;
+};
+
+#endif // MEMORYHEATMAP_H
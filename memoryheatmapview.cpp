@@ -0,0 +1,116 @@
+#include "memoryheatmapview.h"
+
+#include <QFileDialog>
+#include <QPixmap>
+#include <QtAlgorithms>
+
+MemoryHeatmapView::MemoryHeatmapView(QWidget *parent, CPU *cpu)
+    : QWidget(parent)
+{
+    processor = cpu;
+    heatmap = new MemoryHeatmap();
+
+    image = QImage(256, 256, QImage::Format_RGB32);
+    image.fill(0xff000000);
+
+    count_button = new QToolButton(this);
+    count_button->setText("Count");
+    count_button->setCheckable(true);
+    clear_button = new QToolButton(this);
+    clear_button->setText("Clear");
+    export_button = new QToolButton(this);
+    export_button->setText("Export");
+
+    view = new QLabel(this);
+    view->setPixmap(QPixmap::fromImage(image));
+
+    buttons_layout = new QHBoxLayout();
+    buttons_layout->addWidget(count_button);
+    buttons_layout->addWidget(clear_button);
+    buttons_layout->addWidget(export_button);
+    buttons_layout->addStretch();
+
+    layout = new QVBoxLayout(this);
+    layout->addLayout(buttons_layout);
+    layout->addWidget(view);
+    layout->addStretch();
+    setLayout(layout);
+
+    setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Minimum);
+
+    connect(count_button,
+            &QAbstractButton::toggled,
+            this,
+            &MemoryHeatmapView::countToggled);
+    connect(clear_button,
+            &QAbstractButton::clicked,
+            this,
+            &MemoryHeatmapView::clearCounts);
+    connect(export_button,
+            &QAbstractButton::clicked,
+            this,
+            &MemoryHeatmapView::exportCounts);
+
+    update_timer = new QTimer(this);
+    connect(update_timer,
+            &QTimer::timeout,
+            this,
+            &MemoryHeatmapView::updateHeatmap);
+    update_timer->start(1000/4);
+}
+
+// AppFrame destroys its machine before its widgets, nothing counts into
+// the heatmap by now.
+MemoryHeatmapView::~MemoryHeatmapView()
+{
+    delete heatmap;
+}
+
+// 0 for no accesses, then brighter by the number of bits in `count`.
+static inline uint32_t Level(uint32_t count)
+{
+    if (!count) {
+        return 0;
+    }
+    return 63 + 6 * (32 - qCountLeadingZeroBits(count));
+}
+
+// Reads the counts while the processor may be updating them, see
+// memoryheatmap.h.
+void MemoryHeatmapView::updateHeatmap(void)
+{
+    for (int page = 0; page < 0x100; page++) {
+        uint *scanline = (uint *)image.scanLine(page);
+        for (int i = 0; i < 0x100; i++) {
+            const int addr = (page << 8) | i;
+            scanline[i] = 0xff000000 |
+                          (Level(heatmap->writes[addr]) << 16) |
+                          (Level(heatmap->executes[addr]) << 8) |
+                          Level(heatmap->reads[addr]);
+        }
+    }
+    view->setPixmap(QPixmap::fromImage(image));
+}
+
+void MemoryHeatmapView::countToggled(bool checked)
+{
+    processor->setHeatmap(checked ? heatmap : 0);
+}
+
+void MemoryHeatmapView::clearCounts(void)
+{
+    // Stopped, so that no access is counted halfway through the clear.
+    processor->setHeatmap(0);
+    heatmap->clear();
+    processor->setHeatmap(count_button->isChecked() ? heatmap : 0);
+    updateHeatmap();
+}
+
+void MemoryHeatmapView::exportCounts(void)
+{
+    QString path = QFileDialog::getSaveFileName(this, "Export memory heatmap", "heatmap.csv",
+                                                "CSV (*.csv);;JSON (*.json)");
+    if (!path.isEmpty()) {
+        heatmap->save(path);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef MEMORYHEATMAPVIEW_H
+#define MEMORYHEATMAPVIEW_H
+
+#include <QWidget>
+#include <QTimer>
+#include <QImage>
+#include <QLabel>
+#include <QToolButton>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+
+#include "cpu.h"
+#include "memoryheatmap.h"
+
+/*
+ Memory heatmap panel
+
+ Shows a MemoryHeatmap, one pixel per address and a row per 256 byte
+ page, $0000 at the top left. Reads are blue, writes red and executed
+ instructions green, brighter on a log scale the more often they
+ happen. "Count" starts and stops counting, see CPU::setHeatmap(),
+ "Clear" zeroes the counts and "Export" saves them, see
+ MemoryHeatmap::save().
+*/
+
+class MemoryHeatmapView : public QWidget
+{
+    Q_OBJECT
+public:
+    MemoryHeatmapView(QWidget *parent = nullptr, CPU *processor = 0);
+    ~MemoryHeatmapView();
+
+public slots:
+    void updateHeatmap(void);
+    void countToggled(bool checked);
+    void clearCounts(void);
+    void exportCounts(void);
+
+private:
+    CPU *processor;
+    MemoryHeatmap *heatmap;
+    QImage image;
+    QTimer *update_timer;
+    QLabel *view;
+    QToolButton *count_button, *clear_button, *export_button;
+    QHBoxLayout *buttons_layout;
+    QVBoxLayout *layout;
+};
+
+#endif // MEMORYHEATMAPVIEW_H
@@ -0,0 +1,66 @@
+#include "opcodeprofile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <QFile>
+#include <QVector>
+#include <QDebug>
+
+OpcodeProfile::OpcodeProfile()
+{
+    memset(pairs, 0, sizeof(pairs));
+    restart();
+}
+
+void OpcodeProfile::restart()
+{
+    previous[0] = 0;
+    previous[1] = 0;
+    length = 0;
+}
+
+bool OpcodeProfile::save(const QString &path) const
+{
+    struct Sequence {
+        uint64_t count;
+        uint32_t ops;
+        int length;
+    };
+    QVector<Sequence> sequences;
+
+    for (uint32_t ops = 0; ops < 0x10000; ops++) {
+        if (pairs[ops]) {
+            sequences.append(Sequence { pairs[ops], ops, 2 });
+        }
+    }
+    for (QHash<uint32_t, uint64_t>::const_iterator it = triples.constBegin(); it != triples.constEnd(); ++it) {
+        sequences.append(Sequence { it.value(), it.key(), 3 });
+    }
+    std::sort(sequences.begin(), sequences.end(), [](const Sequence &x, const Sequence &y) {
+        return x.count > y.count;
+    });
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qWarning() << "Cannot write the opcode profile to" << path;
+        return false;
+    }
+
+    file.write("# Opcode sequence profile, see opcodeprofile.h\n");
+    for (const Sequence &sequence : sequences) {
+        char line[64];
+        if (sequence.length == 2) {
+            snprintf(line, sizeof(line), "%llu %02x %02x\n", (unsigned long long)sequence.count,
+                     sequence.ops >> 8, sequence.ops & 0xff);
+        } else {
+            snprintf(line, sizeof(line), "%llu %02x %02x %02x\n", (unsigned long long)sequence.count,
+                     sequence.ops >> 16, (sequence.ops >> 8) & 0xff, sequence.ops & 0xff);
+        }
+        file.write(line);
+    }
+
+    return true;
+}
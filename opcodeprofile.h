@@ -0,0 +1,51 @@
+#ifndef OPCODEPROFILE_H
+#define OPCODEPROFILE_H
+
+#include <stdint.h>
+
+#include <QHash>
+#include <QString>
+
+/*
+ Opcode sequence profile
+
+ Counts how often each pair and each triple of opcodes executes back to
+ back. CPU::step() records every instruction while CPU::profile is set,
+ and the engines are bypassed so that every instruction goes through it.
+ An interrupt starts a new sequence. Native routines and the idle loop
+ passes CPU::skipIdleLoop() skips are not recorded.
+
+ save() writes one sequence per line, the most frequent first:
+
+   <count> <opcode> <opcode> [<opcode>]
+
+ tools/genfusedhandlers.py turns the profile into the fused handlers of
+ i8080fused.cpp.
+*/
+
+class OpcodeProfile
+{
+public:
+    OpcodeProfile();
+    inline void record(uint8_t op) {
+        if (length >= 1) {
+            pairs[(previous[0] << 8) | op]++;
+        }
+        if (length >= 2) {
+            triples[(previous[1] << 16) | (previous[0] << 8) | op]++;
+        }
+        previous[1] = previous[0];
+        previous[0] = op;
+        length++;
+    }
+    // Starts a new sequence, the next opcode does not follow the last one.
+    void restart(void);
+    bool save(const QString &path) const;
+private:
+    uint64_t pairs[0x10000];
+    QHash<uint32_t, uint64_t> triples;
+    uint8_t previous[2];  // last and second to last opcode
+    int length;           // of the current sequence
+};
+
+#endif // OPCODEPROFILE_H
@@ -0,0 +1,96 @@
+#include "romimage.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <QByteArray>
+#include <QFile>
+#include <QMap>
+#include <QMutex>
+
+RomImage::RomImage()
+{
+    data = 0;
+    size = 0;
+    fd = -1;
+}
+
+// `contents` in a shared memory file, mapped read only, with the file in
+// `fd`. Hosts without one get a heap copy and -1.
+static const uint8_t *Share(const QByteArray &contents, int *fd)
+{
+    *fd = -1;
+#ifndef _WIN32
+    static int count = 0;
+    char name[64];
+    snprintf(name, sizeof(name), "/ee-rom-%d-%d", (int)getpid(), count++);
+    int shm = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (shm >= 0) {
+        shm_unlink(name);
+        void *mapped = MAP_FAILED;
+        if (ftruncate(shm, contents.size()) == 0) {
+            mapped = mmap(0, contents.size(), PROT_READ | PROT_WRITE, MAP_SHARED, shm, 0);
+        }
+        if (mapped != MAP_FAILED) {
+            memcpy(mapped, contents.constData(), contents.size());
+            mprotect(mapped, contents.size(), PROT_READ);
+            *fd = shm;
+            return (const uint8_t *)mapped;
+        }
+        close(shm);
+    }
+#endif
+    uint8_t *copy = new uint8_t[contents.size()];
+    memcpy(copy, contents.constData(), contents.size());
+    return copy;
+}
+
+const RomImage *RomImage::load(const QStringList &files)
+{
+    // Machines are created from any thread.
+    static QMutex mutex;
+    static QMap<QString, RomImage *> images;
+
+    QString key;
+    for (const QString &file : files) {
+        key += file + "\n";
+    }
+
+    mutex.lock();
+    RomImage *image = images.value(key);
+    if (!image) {
+        QByteArray contents;
+        bool read = true;
+        for (const QString &name : files) {
+            QFile file(name);
+            if (!file.open(QIODevice::ReadOnly)) {
+                read = false;
+                break;
+            }
+            // Uncompressed resources and files map in place, which saves
+            // readAll()'s copy.
+            uchar *mapped = file.map(0, file.size());
+            if (mapped) {
+                contents.append((const char *)mapped, file.size());
+                file.unmap(mapped);
+            } else {
+                contents.append(file.readAll());
+            }
+        }
+        if (read) {
+            image = new RomImage();
+            image->size = contents.size();
+            image->data = Share(contents, &image->fd);
+            images.insert(key, image);
+        }
+    }
+    mutex.unlock();
+
+    return image;
+}
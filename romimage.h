@@ -0,0 +1,34 @@
+#ifndef ROMIMAGE_H
+#define ROMIMAGE_H
+
+#include <stdint.h>
+
+#include <QStringList>
+
+/*
+ ROM image shared by the machines of a process
+
+ load() reads a set of ROM files once, mapping them where QFile can, Qt
+ resources included, and keeps the image for the life of the process.
+ Machines that load the same files get the same image.
+
+ On POSIX hosts the image is held in an unlinked shared memory file, and
+ MemoryMap::mapRom() maps its pages over the ROM's storage read only, so
+ every machine shares the same physical pages. Elsewhere, or where the
+ ROM is not aligned to host pages, mapRom() copies it.
+*/
+
+class RomImage
+{
+public:
+    // The files' contents, one after the other, or 0 if one cannot be read.
+    static const RomImage *load(const QStringList &files);
+
+    const uint8_t *data;
+    int size;
+    int fd;     // shared memory file holding `data`, or -1
+private:
+    RomImage();
+};
+
+#endif // ROMIMAGE_H
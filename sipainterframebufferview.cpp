@@ -1,11 +1,17 @@
 #include "sipainterframebufferview.h"
 
-SIPainterFrameBufferView::SIPainterFrameBufferView(QWidget *parent, MemoryMap *memory_map)
+#include <string.h>
+
+#include <QtAlgorithms>
+
+SIPainterFrameBufferView::SIPainterFrameBufferView(QWidget *parent, TripleBuffer *video_frames)
     : QWidget(parent)
 {
-    memory = memory_map;
+    frames = video_frames;
 
     image = QImage(224, 256, QImage::Format_RGB32);
+    image.fill(0xff000000);
+    shown = QByteArray(frames->size, 0);
 
     setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 
@@ -14,7 +20,7 @@ SIPainterFrameBufferView::SIPainterFrameBufferView(QWidget *parent, MemoryMap *m
             &QTimer::timeout,
             this,
             &SIPainterFrameBufferView::updateFrameBufferTexture);
-    fb_update_timer->start((1/60)*1000);
+    fb_update_timer->start(1000/60);
 
     installEventFilter(this);
 }
@@ -33,34 +39,75 @@ void SIPainterFrameBufferView::paintEvent(QPaintEvent *event)
     painter.drawImage(0, 0, image);
 }
 
+// Converts the video RAM bytes that changed in the latest complete
+// frame, see EE::Machine::video_frames, and repaints only the columns
+// they cover.
 void SIPainterFrameBufferView::updateFrameBufferTexture(void)
 {
+    const uint8_t *frame = frames->take();
+    if (!frame) {
+        return;
+    }
+    uint64_t dirty[256 * 224 / 8 / 64];
+    uint8_t *last = (uint8_t *)shown.data();
+    for (int word = 0; word < 256 * 224 / 8 / 64; word++) {
+        uint64_t bits = 0;
+        for (int i = 0; i < 64; i++) {
+            bits |= (uint64_t)(frame[word * 64 + i] != last[word * 64 + i]) << i;
+        }
+        dirty[word] = bits;
+    }
+    memcpy(last, frame, frames->size);
+
+    QRegion changed;
     uchar *scanline;
-    for (int i = 0; i < 256 * 224 / 8; i++) {
-        const int y = i * 8 / 256;
-        const int x = (i * 8) % 256;
-        const uint8_t eight_pixels = memory->data[0x2400 + i];
+    for (int word = 0; word < 256 * 224 / 8 / 64; word++) {
+        uint64_t bits = dirty[word];
+        if (!bits) {
+            continue;
+        }
+        // A word covers two columns, 32 bytes each.
+        int top[2] = { 256, 256 }, bottom[2] = { -1, -1 };
+        while (bits) {
+            const int i = word * 64 + qCountTrailingZeroBits(bits);
+            bits &= bits - 1;
+
+            const int y = i * 8 / 256;
+            const int x = (i * 8) % 256;
+            const uint8_t eight_pixels = frame[i];
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                const int pixel_x = x + bit;
+                const int pixel_y = y;
 
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            const int pixel_x = x + bit;
-            const int pixel_y = y;
+                // The X and Y coordinates are being swapped because
+                // the framebuffer image is rotated 90degrees in memory.
+                // The image is rotated in memory because the physical
+                // display is rotated -90degrees in the arcade cabinet.
 
-            // The X and Y coordinates are being swapped because
-            // the framebuffer image is rotated 90degrees in memory.
-            // The image is rotated in memory because the physical
-            // display is rotated -90degrees in the arcade cabinet.
+                scanline = image.scanLine(255 - pixel_x);
 
-            scanline = image.scanLine(255 - pixel_x);
+                ((uint*)scanline)[pixel_y] = 0xff000000; // Black pixel
 
-            ((uint*)scanline)[pixel_y] = 0xff000000; // Black pixel
+                if ((eight_pixels >> bit) & 1) {
+                    ((uint*)scanline)[pixel_y] = 0xffffffff; // White pixel
+                }
+            }
 
-            if ((eight_pixels >> bit) & 1) {
-                ((uint*)scanline)[pixel_y] = 0xffffffff; // White pixel
+            const int column = y & 1;
+            top[column] = qMin(top[column], 255 - x - 7);
+            bottom[column] = qMax(bottom[column], 255 - x);
+        }
+        for (int column = 0; column < 2; column++) {
+            if (bottom[column] >= 0) {
+                changed += QRect(word * 2 + column, top[column], 1, bottom[column] - top[column] + 1);
             }
         }
     }
-    update();
+    if (!changed.isEmpty()) {
+        update(changed);
+    }
 }
 
 QSize SIPainterFrameBufferView::minimumSizeHint() const
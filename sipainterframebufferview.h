@@ -6,14 +6,15 @@
 #include <QImage>
 #include <QPainter>
 #include <QDebug>
+#include <QByteArray>
 
-#include "cpu.h"
+#include "triplebuffer.h"
 
 class SIPainterFrameBufferView : public QWidget
 {
     Q_OBJECT
 public:
-    SIPainterFrameBufferView(QWidget *parent = nullptr, MemoryMap *memory = 0);
+    SIPainterFrameBufferView(QWidget *parent = nullptr, TripleBuffer *frames = 0);
 
     QSize minimumSizeHint() const override;
     QSize sizeHint() const override;
@@ -29,7 +30,8 @@ public slots:
 private:
     QImage image;
     QTimer *fb_update_timer;
-    MemoryMap *memory;
+    TripleBuffer *frames;
+    QByteArray shown;   // the video RAM image shows
 };
 
 #endif // SIPAINTERFRAMEBUFFERVIEW_H
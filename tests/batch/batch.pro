@@ -0,0 +1,15 @@
+include(../core.pri)
+
+TARGET = tst_batch
+TEMPLATE = app
+
+SOURCES += \
+    tst_batch.cpp \
+    $$PWD/../../invadersbatch.cpp
+
+HEADERS += \
+    $$PWD/../../invadersbatch.h
+
+# The Space Invaders ROM, at the same resource paths as for the emulator
+RESOURCES += \
+    $$PWD/../../ee.qrc
@@ -0,0 +1,362 @@
+#include <QtTest>
+
+#include "cpu.h"
+#include "i8080switchengine.h"
+#include "invadersbatch.h"
+#include "invadersbus.h"
+#include "machine.h"
+#include "romimage.h"
+
+/*
+ Batch lanes against machines
+
+ Runs InvadersBatch lanes next to processors set up like a Machine's on
+ the switch engine, each with its own memory map, ROM at $0000-$1FFF and
+ $4000- mirroring the RAM, and its own shift register, and compares
+ registers, flags, cycles and the storage after every slice. Both with
+ the AVX2 groups, where the host has AVX2, and with scalar ones, and the
+ two against each other for every pair of ALU operands.
+*/
+
+// A slice, as Machine runs them
+static const int slice_cycles = 2000;
+
+struct Reference {
+    QMutex mutex;
+    MemoryMap memory;
+    CPU cpu;
+    EE::ShiftRegister shift;
+    TripleBuffer video_frames;
+
+    // `image` is the storage, $0000-$3FFF.
+    Reference(const QByteArray &image) : cpu(&mutex, &memory), video_frames(EE::video_ram_size) {
+        memcpy(memory.data, image.constData(), 0x4000);
+        memory.mapRom(0x0000, 0x2000);
+        memory.mirror(0x4000, 0x10000, 0x2000, 0x2000);
+        cpu.a = cpu.b = cpu.c = cpu.d = cpu.e = cpu.h = cpu.l = 0;
+        cpu.flags = 1 << 6;
+        cpu.engine = CPU::SwitchEngine;
+        cpu.switch_engine = RunSwitchEngine<InvadersBus>;
+        cpu.skip_idle_loops = false;
+        cpu.setCallback(0xd3, output_callback);
+        cpu.setCallback(0xdb, input_callback);
+        cpu.addCycleEvent(EE::mid_screen_cycle, EE::cycles_per_frame, mid_screen_interrupt, 0);
+        cpu.addCycleEvent(EE::cycles_per_frame, EE::cycles_per_frame, end_of_screen_interrupt, &video_frames);
+        shift = EE::ShiftRegister();
+        shift.out_port_two = shift.out_port_four_low = shift.out_port_four_high = 0;
+        shift.in_port_one = 0;
+    }
+
+    void setInputs(uint8_t in_port_one, uint8_t in_port_two) {
+        shift.in_port_one = in_port_one;
+        shift.in_port_two = in_port_two;
+    }
+
+    // The ports are the process's, see output_callback().
+    void run(int cycles) {
+        shift_register_hw = shift;
+        cpu.run(cycles);
+        shift = shift_register_hw;
+    }
+};
+
+// Returns a description of the first difference between `lane` and
+// `reference`, or an empty string.
+static QByteArray Compare(const InvadersBatch &batch, int lane, const Reference &reference)
+{
+    char message[256];
+    const InvadersBatch::Registers b = batch.registers(lane);
+    const CPU &r = reference.cpu;
+    if (batch.cycleCount(lane) != r.cycle_count || b.pc != r.pc || b.sp != r.sp || b.flags != (r.flags & 0xff) ||
+            b.a != r.a || b.b != r.b || b.c != r.c || b.d != r.d || b.e != r.e || b.h != r.h || b.l != r.l) {
+        qsnprintf(message, sizeof(message),
+                  "lane %d: cycles %llu/%llu pc %04x/%04x sp %04x/%04x flags %x/%x a %02x/%02x "
+                  "bc %02x%02x/%02x%02x de %02x%02x/%02x%02x hl %02x%02x/%02x%02x", lane,
+                  (unsigned long long)batch.cycleCount(lane), (unsigned long long)r.cycle_count,
+                  b.pc, r.pc, b.sp, r.sp, b.flags, r.flags & 0xff, b.a, r.a,
+                  b.b, b.c, r.b, r.c, b.d, b.e, r.d, r.e, b.h, b.l, r.h, r.l);
+        return QByteArray(message);
+    }
+    const uint8_t *storage = batch.memory(lane);
+    if (memcmp(storage, reference.memory.data, 0x4000)) {
+        int addr = 0;
+        while (storage[addr] == reference.memory.data[addr]) {
+            addr++;
+        }
+        qsnprintf(message, sizeof(message), "lane %d: memory at %04x %02x/%02x",
+                  lane, addr, storage[addr], reference.memory.data[addr]);
+        return QByteArray(message);
+    }
+    return QByteArray();
+}
+
+// The Space Invaders ROM followed by zeroed RAM, or an empty array.
+static QByteArray InvadersImage()
+{
+    const RomImage *rom = RomImage::load(QStringList()
+                                         << "://assets/roms/invaders.h"
+                                         << "://assets/roms/invaders.g"
+                                         << "://assets/roms/invaders.f"
+                                         << "://assets/roms/invaders.e");
+    if (!rom) {
+        return QByteArray();
+    }
+    QByteArray image(0x4000, 0);
+    memcpy(image.data(), rom->data, rom->size);
+    return image;
+}
+
+// How throughput() runs the sessions
+enum Sessions { VectorLanes, ScalarLanes, SwitchEngines };
+
+class TestBatch : public QObject
+{
+    Q_OBJECT
+private slots:
+    void game_data();
+    void game();
+    void memoryMap_data();
+    void memoryMap();
+    void alu();
+    void throughput_data();
+    void throughput();
+};
+
+// The lanes with AVX2 groups, skipped without AVX2, and with scalar ones
+static void AddLaneRows()
+{
+    QTest::addColumn<bool>("vector");
+
+    QTest::newRow("vector lanes") << true;
+    QTest::newRow("scalar lanes") << false;
+}
+
+void TestBatch::game_data()
+{
+    AddLaneRows();
+}
+
+void TestBatch::game()
+{
+    QFETCH(bool, vector);
+
+    if (vector && !InvadersBatch::vectorAvailable()) {
+        QSKIP("The host has no AVX2");
+    }
+    const QByteArray image = InvadersImage();
+    QVERIFY2(!image.isEmpty(), "Cannot load the ROM");
+
+    // A coin on some lanes and other DIP switches on others, so that the
+    // lanes split into groups and meet again, over more than one vector.
+    const int lanes = 40;
+    InvadersBatch batch(lanes, image);
+    batch.vector_lanes = vector;
+    QVector<Reference *> references;
+    for (int l = 0; l < lanes; l++) {
+        uint8_t in_port_one = (l % 3 == 1) ? 0x01 : 0x00;
+        uint8_t in_port_two = (l % 4 == 2) ? 0x03 : 0x00;
+        batch.setInputs(l, in_port_one, in_port_two);
+        references << new Reference(image);
+        references[l]->setInputs(in_port_one, in_port_two);
+    }
+
+    // About three seconds of the attract mode
+    for (int slice = 0; slice < 3000; slice++) {
+        batch.run(slice_cycles);
+        for (int l = 0; l < lanes; l++) {
+            references[l]->run(slice_cycles);
+            QByteArray failure = Compare(batch, l, *references[l]);
+            if (!failure.isEmpty()) {
+                qDeleteAll(references);
+                char message[320];
+                qsnprintf(message, sizeof(message), "slice %d, %s", slice, failure.constData());
+                QFAIL(message);
+            }
+        }
+    }
+    qDeleteAll(references);
+}
+
+void TestBatch::memoryMap_data()
+{
+    AddLaneRows();
+}
+
+void TestBatch::memoryMap()
+{
+    QFETCH(bool, vector);
+
+    if (vector && !InvadersBatch::vectorAvailable()) {
+        QSKIP("The host has no AVX2");
+    }
+    // Writes to the ROM, and through the mirror to the RAM and the stack.
+    static const uint8_t program[] = {
+        0x21, 0x00, 0x01,   // LXI H,$0100
+        0x36, 0x55,         // MVI M,$55        dropped
+        0x32, 0x01, 0x01,   // STA $0101        dropped
+        0x21, 0x10, 0x60,   // LXI H,$6010
+        0x36, 0xaa,         // MVI M,$aa        $2010
+        0x3a, 0x10, 0x20,   // LDA $2010
+        0x32, 0x11, 0x40,   // STA $4011        $2011
+        0x22, 0x12, 0xe0,   // SHLD $e012       $2012
+        0x2a, 0x00, 0x01,   // LHLD $0100
+        0x31, 0x00, 0x44,   // LXI SP,$4400     $2400
+        0xe5,               // PUSH H
+        0x01, 0x20, 0xa0,   // LXI B,$a020
+        0x02,               // STAX B           $2020
+        0x0a,               // LDAX B
+        0xe3,               // XTHL
+        0x76                // HLT
+    };
+    QByteArray image(0x4000, 0);
+    memcpy(image.data(), program, sizeof(program));
+
+    InvadersBatch batch(1, image);
+    batch.vector_lanes = vector;
+    Reference reference(image);
+    batch.run(slice_cycles);
+    reference.run(slice_cycles);
+    QByteArray failure = Compare(batch, 0, reference);
+    QVERIFY2(failure.isEmpty(), failure.constData());
+    QCOMPARE((int)batch.memory(0)[0x0100], 0x00);
+    QCOMPARE((int)batch.memory(0)[0x2011], 0xaa);
+}
+
+/*
+ Every instruction the AVX2 groups execute, on a lane for every A and
+ 16 operands B, those at the edges of the nibbles and the sign and 8
+ spread over the rest. A = IN 2 and B = IN 0, BC as a pair, once after
+ STC and once after ANA A. Each result is pushed, A and the flags, BC, and the
+ lanes with the carry set skip an instruction, so that the groups split
+ and join. The stack and registers must match scalar lanes'.
+*/
+void TestBatch::alu()
+{
+    if (!InvadersBatch::vectorAvailable()) {
+        QSKIP("The host has no AVX2");
+    }
+    static const uint8_t tested[][3] = {
+        { 0x80 }, { 0x88 }, { 0x90 }, { 0x98 },         // ADD B, ADC B, SUB B, SBB B
+        { 0xa0 }, { 0xa8 }, { 0xb0 }, { 0xb8 },         // ANA B, XRA B, ORA B, CMP B
+        { 0xc6, 0x9c }, { 0xce, 0x9c }, { 0xd6, 0x9c }, // ADI, ACI, SUI
+        { 0xde, 0x9c }, { 0xe6, 0x9c }, { 0xee, 0x9c }, // SBI, ANI, XRI
+        { 0xf6, 0x9c }, { 0xfe, 0x9c },                 // ORI, CPI
+        { 0x04 }, { 0x05 }, { 0x3c }, { 0x3d },         // INR B, DCR B, INR A, DCR A
+        { 0x03 }, { 0x0b }, { 0x2f }, { 0x3f },         // INX B, DCX B, CMA, CMC
+        { 0x48 }, { 0x0e, 0x81 },                       // MOV C,B, MVI C,$81
+        { 0x3a, 0x00, 0x60 }                            // LDA $6000, after STA $2000
+    };
+    QByteArray image(0x4000, 0);
+    uint8_t *code = (uint8_t *)image.data();
+    int at = 0;
+    const uint8_t prologue[] = { 0x31, 0x00, 0x24 };    // LXI SP,$2400
+    memcpy(code, prologue, sizeof(prologue));
+    at += sizeof(prologue);
+    for (const uint8_t *instruction : tested) {
+        for (int carry = 0; carry < 2; carry++) {
+            const uint8_t setup[] = {
+                0xdb, 0x02,                             // IN 2
+                0x32, 0x00, 0x20,                       // STA $2000
+                0xdb, 0x00,                             // IN 0
+                0x47,                                   // MOV B,A
+                0xdb, 0x02,                             // IN 2
+                0x4f,                                   // MOV C,A
+                (uint8_t)(carry ? 0x37 : 0xa7)          // STC or ANA A
+            };
+            memcpy(code + at, setup, sizeof(setup));
+            at += sizeof(setup);
+            const int length = i8080_instructions[instruction[0]].length;
+            memcpy(code + at, instruction, length);
+            at += length;
+            const uint8_t results[] = {
+                0xf5,                                   // PUSH PSW
+                0xc5,                                   // PUSH B
+                0xda, (uint8_t)(at + 6), (uint8_t)((at + 6) >> 8), // JC over the INR
+                0x04                                    // INR B
+            };
+            memcpy(code + at, results, sizeof(results));
+            at += sizeof(results);
+        }
+    }
+    code[at++] = 0x76; // HLT
+
+    static const uint8_t edges[8] = { 0x00, 0x01, 0x0f, 0x10, 0x7f, 0x80, 0xf0, 0xff };
+    const int lanes = 0x100 * 16;
+    InvadersBatch vector(lanes, image), scalar(lanes, image);
+    scalar.vector_lanes = false;
+    for (int l = 0; l < lanes; l++) {
+        const uint8_t a = l & 0xff, k = l >> 8;
+        const uint8_t b = (k < 8) ? edges[k] : (uint8_t)(a * 0x3b + k * 0x65);
+        vector.setInputs(l, b, a);
+        scalar.setInputs(l, b, a);
+    }
+    vector.run(slice_cycles * 4);
+    scalar.run(slice_cycles * 4);
+    for (int l = 0; l < lanes; l++) {
+        const InvadersBatch::Registers v = vector.registers(l), r = scalar.registers(l);
+        if (v.pc != at || v.pc != r.pc || v.flags != r.flags || v.a != r.a || v.b != r.b || v.c != r.c ||
+                vector.cycleCount(l) != scalar.cycleCount(l) ||
+                memcmp(vector.memory(l) + 0x2000, scalar.memory(l) + 0x2000, 0x400)) {
+            int addr = 0x2000;
+            while (addr < 0x2400 && vector.memory(l)[addr] == scalar.memory(l)[addr]) {
+                addr++;
+            }
+            char message[256];
+            qsnprintf(message, sizeof(message),
+                      "lane %d: pc %04x/%04x flags %x/%x a %02x/%02x bc %02x%02x/%02x%02x, "
+                      "first difference at %04x", l,
+                      v.pc, r.pc, v.flags, r.flags, v.a, r.a, v.b, v.c, r.b, r.c, addr);
+            QFAIL(message);
+        }
+    }
+}
+
+void TestBatch::throughput_data()
+{
+    QTest::addColumn<int>("sessions");
+
+    QTest::newRow("vector lanes") << (int)VectorLanes;
+    QTest::newRow("scalar lanes") << (int)ScalarLanes;
+    QTest::newRow("switch engine") << (int)SwitchEngines;
+}
+
+// 64 sessions for a second of the attract mode, in lanes of one batch
+// or on one processor each.
+void TestBatch::throughput()
+{
+    QFETCH(int, sessions);
+
+    if (sessions == VectorLanes && !InvadersBatch::vectorAvailable()) {
+        QSKIP("The host has no AVX2");
+    }
+    const QByteArray image = InvadersImage();
+    QVERIFY2(!image.isEmpty(), "Cannot load the ROM");
+    const int count = 64, slices = EE::cycles_per_frame * 60 / slice_cycles;
+
+    if (sessions != SwitchEngines) {
+        QBENCHMARK {
+            InvadersBatch batch(count, image);
+            batch.vector_lanes = (sessions == VectorLanes);
+            for (int slice = 0; slice < slices; slice++) {
+                batch.run(slice_cycles);
+            }
+        }
+    } else {
+        QBENCHMARK {
+            QVector<Reference *> references;
+            for (int l = 0; l < count; l++) {
+                references << new Reference(image);
+            }
+            for (int slice = 0; slice < slices; slice++) {
+                for (Reference *reference : references) {
+                    reference->run(slice_cycles);
+                }
+            }
+            qDeleteAll(references);
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestBatch)
+
+#include "tst_batch.moc"
@@ -0,0 +1,57 @@
+# The emulator without its user interface, for the test projects.
+# Run them with `make check`.
+
+QT       += core testlib
+QT       -= gui
+
+CONFIG   += console testcase
+CONFIG   -= app_bundle
+
+# shm_open() for RomImage and exported memory maps, in librt before glibc 2.34
+unix:!macx: LIBS += -lrt
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += $$PWD/..
+DEPENDPATH += $$PWD/..
+
+SOURCES += \
+    $$PWD/../machine.cpp \
+    $$PWD/../cpu.cpp \
+    $$PWD/../blockcache.cpp \
+    $$PWD/../disassembler.cpp \
+    $$PWD/../i8080.cpp \
+    $$PWD/../i8080aot.cpp \
+    $$PWD/../i8080flags.cpp \
+    $$PWD/../i8080fused.cpp \
+    $$PWD/../i8080jit.cpp \
+    $$PWD/../invadersaot.cpp \
+    $$PWD/../invadersroutines.cpp \
+    $$PWD/../opcodeprofile.cpp \
+    $$PWD/../memoryheatmap.cpp \
+    $$PWD/../romimage.cpp \
+    $$PWD/../triplebuffer.cpp \
+    $$PWD/../i8080switchengine.cpp \
+    $$PWD/../executedinstructionslistmodel.cpp
+
+HEADERS += \
+    $$PWD/../machine.h \
+    $$PWD/../cpu.h \
+    $$PWD/../blockcache.h \
+    $$PWD/../disassembler.h \
+    $$PWD/../i8080.h \
+    $$PWD/../i8080aot.h \
+    $$PWD/../i8080bus.h \
+    $$PWD/../i8080flags.h \
+    $$PWD/../i8080fused.h \
+    $$PWD/../i8080jit.h \
+    $$PWD/../i8080switchengine.h \
+    $$PWD/../i8080instructiontable.h \
+    $$PWD/../invadersbus.h \
+    $$PWD/../invadersroutines.h \
+    $$PWD/../opcodeprofile.h \
+    $$PWD/../memoryheatmap.h \
+    $$PWD/../memoryexport.h \
+    $$PWD/../romimage.h \
+    $$PWD/../triplebuffer.h \
+    $$PWD/../executedinstructionslistmodel.h
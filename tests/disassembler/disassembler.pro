@@ -0,0 +1,11 @@
+include(../core.pri)
+
+TARGET = tst_disassembler
+TEMPLATE = app
+
+SOURCES += \
+    tst_disassembler.cpp
+
+# The Space Invaders ROM, at the same resource paths as for the emulator
+RESOURCES += \
+    $$PWD/../../ee.qrc
@@ -0,0 +1,87 @@
+#include <QtTest>
+
+#include "disassembler.h"
+#include "romimage.h"
+
+/*
+ Disassembler
+
+ Checks Format() on known instructions of the Space Invaders ROM and
+ times disassembling the whole ROM, as a listing would.
+*/
+
+static const RomImage *InvadersRom()
+{
+    return RomImage::load(QStringList()
+                          << "://assets/roms/invaders.h"
+                          << "://assets/roms/invaders.g"
+                          << "://assets/roms/invaders.f"
+                          << "://assets/roms/invaders.e");
+}
+
+class TestDisassembler : public QObject
+{
+    Q_OBJECT
+private slots:
+    void format_data();
+    void format();
+    void listing();
+};
+
+void TestDisassembler::format_data()
+{
+    QTest::addColumn<int>("addr");
+    QTest::addColumn<int>("length");
+    QTest::addColumn<QByteArray>("text");
+
+    QTest::newRow("none") << 0x0000 << 1 << QByteArray("0000 00 NOP");
+    QTest::newRow("address") << 0x0003 << 3 << QByteArray("0003 C3 JMP $18d4");
+    QTest::newRow("data16") << 0x18d4 << 3 << QByteArray("18D4 31 LXI SP,#$2400");
+    QTest::newRow("data8") << 0x024c << 2 << QByteArray("024C FE CPI #$ff");
+    QTest::newRow("undefined") << 0x00b3 << 0 << QByteArray("00B3 08");
+}
+
+void TestDisassembler::format()
+{
+    QFETCH(int, addr);
+    QFETCH(int, length);
+    QFETCH(QByteArray, text);
+
+    const RomImage *rom = InvadersRom();
+    QVERIFY2(rom, "Cannot load the ROM");
+    char formatted[Disassembler::text_size];
+    QCOMPARE(Disassembler::Format(addr, rom->data + addr, formatted), length);
+    QCOMPARE(QByteArray(formatted), text);
+}
+
+// Every instruction of the ROM to one buffer, a line each.
+void TestDisassembler::listing()
+{
+    const RomImage *rom = InvadersRom();
+    QVERIFY2(rom, "Cannot load the ROM");
+    const uint8_t *code = rom->data;
+    const int size = rom->size;
+    QByteArray listing(size * Disassembler::text_size, 0);
+    int lines = 0;
+
+    QBENCHMARK {
+        char *out = listing.data();
+        lines = 0;
+        for (int i = 0; i < size; lines++) {
+            // The last instructions' operands may run past the end.
+            uint8_t bytes[3] = { code[i], 0, 0 };
+            for (int j = 1; j < 3 && i + j < size; j++) {
+                bytes[j] = code[i + j];
+            }
+            int length = Disassembler::Format(i, bytes, out);
+            out += strlen(out);
+            *out++ = '\n';
+            i += length ? length : 1;
+        }
+    }
+    QVERIFY(lines > size / 3 && lines <= size);
+}
+
+QTEST_APPLESS_MAIN(TestDisassembler)
+
+#include "tst_disassembler.moc"
@@ -0,0 +1,3874 @@
+// Generated by tools/recompilerom.py from tests/flags/genaluimage.py.
+// Do not edit by hand, re-run the generator. See i8080aot.h.
+
+#include "i8080aot.h"
+#include "i8080flags.h"
+
+#define HL ((uint16_t)((h << 8) | l))
+#define EXIT(next) do { pc = (next); goto exit; } while (0)
+// Continues in the block at `next` while there is budget left, native
+// routines are dispatched by Aot::run(), see CPU::addRoutine().
+#define CHAIN(next, block) do { if (cyc >= budget || processor->hasRoutine(next)) EXIT(next); pc = (next); STORE return block(processor, mem, cyc, budget); } while (0)
+#define ACCOUNT(cycles, next) do { cyc += (cycles); if (cyc >= budget) EXIT(next); } while (0)
+// Leaves before the instruction at `at` if it would write to the image,
+// another page that is not plain RAM, or a watched or shared page, the
+// interpreter writes through MemoryMap::write(). Aot marks the image in
+// MemoryMap::code_pages.
+#define CHECK_WRITE(addr, at) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & (7 | 8 | 32 | 64)) EXIT(at); } while (0)
+// Sets the dirty bit of a byte just written to a page that CHECK_WRITE
+// leaves native, if MemoryMap::trackWrites() tracks it.
+#define WRITTEN(addr) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & 16) processor->memory->markDirty(addr); } while (0)
+// Leaves before the instruction at `at` if it would read a mirrored or
+// device page, see MemoryMap::indirect_pages.
+#define CHECK_READ(addr, at) do { if (processor->memory->indirect_pages[(uint16_t)(addr) >> 8]) EXIT(at); } while (0)
+
+#define ENTER \
+    uint8_t a = processor->a, b = processor->b, c = processor->c, d = processor->d, \
+            e = processor->e, h = processor->h, l = processor->l; \
+    uint16_t sp = processor->sp, pc; \
+    int f = processor->flags;
+
+#define STORE \
+    processor->a = a; processor->b = b; processor->c = c; processor->d = d; \
+    processor->e = e; processor->h = h; processor->l = l; \
+    processor->sp = sp; processor->pc = pc; \
+    processor->flags = f;
+
+#define LEAVE \
+    STORE \
+    return cyc;
+
+static int Block0000(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0004(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0008(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block000c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0010(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0014(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0018(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block001c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0020(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0024(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0028(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block002c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0030(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0034(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0038(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block003c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0040(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0044(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0048(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block004c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0050(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0054(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0058(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block005c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0060(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0064(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0068(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block006c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0070(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0074(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0078(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block007c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0080(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0084(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0088(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block008c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0090(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0094(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0098(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block009c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00a0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00a8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00ac(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00b0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00b4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00bc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00c4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00e0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00e8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00ec(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00f0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00f4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block00fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0100(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0104(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0108(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block010c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0110(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0114(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0118(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block011c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0120(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0124(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0128(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block012c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0130(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0134(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0138(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block013c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0144(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0148(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block014c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0150(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0154(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0158(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block015c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0160(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0164(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0168(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block016c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0170(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0174(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0178(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block017c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0180(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0184(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0188(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block018c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0190(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0194(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0198(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block019c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01a0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01a8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01ac(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01b0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01b4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01bc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01d0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01e0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01e8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01ec(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01f0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01f4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block01fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0200(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0204(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0208(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block020c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0210(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0214(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0218(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block021c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0220(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0224(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0228(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block022c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0230(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0234(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0238(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block023c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0240(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0244(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0248(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block024c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0250(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0254(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0258(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block025c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0260(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0264(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0268(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block026c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0270(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0274(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0278(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block027c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0280(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0284(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0288(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block028c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0290(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0294(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0298(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block029c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02a0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02a8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02ac(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02b0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02b4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02bc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02c4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02d0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02e0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02e8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02ec(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02f0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02f4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block02fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0300(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0304(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0308(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block030c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0310(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0314(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0318(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block031c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0320(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0324(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0328(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block032c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0330(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0334(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0338(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block033c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0340(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0344(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0348(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block034c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0350(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0354(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0358(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block035c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0360(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0364(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0368(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block036c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0370(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0374(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0378(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block037c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0380(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0384(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0388(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block038c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0390(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0394(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0398(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block039c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03a0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03a4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03a8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03ac(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03b0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03b4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03b8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03bc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03c0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03c4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03c8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03cc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03d0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03d4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03d8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03dc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03e0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03e4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03e8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03ec(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03f0(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03f4(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03f8(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block03fc(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0400(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0404(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0408(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block040c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0410(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0414(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0418(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block041c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0420(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0424(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0428(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block042c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0430(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0434(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0438(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block043c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0440(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0444(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0448(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block044c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0450(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0454(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0458(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block045c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0460(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0464(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0468(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block046c(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0470(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0474(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block0478(CPU *processor, uint8_t *mem, int cyc, int budget);
+static int Block047c(CPU *processor, uint8_t *mem, int cyc, int budget);
+
+static int Block0000(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0000 80
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x0001);
+    EXIT(0x0001);
+exit:
+    LEAVE
+}
+
+static int Block0004(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0004 81
+    { uint8_t v = c; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x0005);
+    EXIT(0x0005);
+exit:
+    LEAVE
+}
+
+static int Block0008(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0008 82
+    { uint8_t v = d; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x0009);
+    EXIT(0x0009);
+exit:
+    LEAVE
+}
+
+static int Block000c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 000c 83
+    { uint8_t v = e; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x000d);
+    EXIT(0x000d);
+exit:
+    LEAVE
+}
+
+static int Block0010(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0010 84
+    { uint8_t v = h; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x0011);
+    EXIT(0x0011);
+exit:
+    LEAVE
+}
+
+static int Block0014(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0014 85
+    { uint8_t v = l; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x0015);
+    EXIT(0x0015);
+exit:
+    LEAVE
+}
+
+static int Block0018(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0018 86
+    CHECK_READ(HL, 0x0018);
+    { uint8_t v = mem[HL]; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0019);
+    EXIT(0x0019);
+exit:
+    LEAVE
+}
+
+static int Block001c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 001c 87
+    { uint8_t v = a; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(4, 0x001d);
+    EXIT(0x001d);
+exit:
+    LEAVE
+}
+
+static int Block0020(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0020 88
+    { uint8_t v = b; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x0021);
+    EXIT(0x0021);
+exit:
+    LEAVE
+}
+
+static int Block0024(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0024 89
+    { uint8_t v = c; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x0025);
+    EXIT(0x0025);
+exit:
+    LEAVE
+}
+
+static int Block0028(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0028 8a
+    { uint8_t v = d; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x0029);
+    EXIT(0x0029);
+exit:
+    LEAVE
+}
+
+static int Block002c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 002c 8b
+    { uint8_t v = e; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x002d);
+    EXIT(0x002d);
+exit:
+    LEAVE
+}
+
+static int Block0030(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0030 8c
+    { uint8_t v = h; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x0031);
+    EXIT(0x0031);
+exit:
+    LEAVE
+}
+
+static int Block0034(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0034 8d
+    { uint8_t v = l; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x0035);
+    EXIT(0x0035);
+exit:
+    LEAVE
+}
+
+static int Block0038(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0038 8e
+    CHECK_READ(HL, 0x0038);
+    { uint8_t v = mem[HL]; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0039);
+    EXIT(0x0039);
+exit:
+    LEAVE
+}
+
+static int Block003c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 003c 8f
+    { uint8_t v = a; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(4, 0x003d);
+    EXIT(0x003d);
+exit:
+    LEAVE
+}
+
+static int Block0040(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0040 90
+    { uint8_t v = b; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x0041);
+    EXIT(0x0041);
+exit:
+    LEAVE
+}
+
+static int Block0044(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0044 91
+    { uint8_t v = c; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x0045);
+    EXIT(0x0045);
+exit:
+    LEAVE
+}
+
+static int Block0048(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0048 92
+    { uint8_t v = d; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x0049);
+    EXIT(0x0049);
+exit:
+    LEAVE
+}
+
+static int Block004c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 004c 93
+    { uint8_t v = e; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x004d);
+    EXIT(0x004d);
+exit:
+    LEAVE
+}
+
+static int Block0050(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0050 94
+    { uint8_t v = h; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x0051);
+    EXIT(0x0051);
+exit:
+    LEAVE
+}
+
+static int Block0054(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0054 95
+    { uint8_t v = l; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x0055);
+    EXIT(0x0055);
+exit:
+    LEAVE
+}
+
+static int Block0058(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0058 96
+    CHECK_READ(HL, 0x0058);
+    { uint8_t v = mem[HL]; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0059);
+    EXIT(0x0059);
+exit:
+    LEAVE
+}
+
+static int Block005c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 005c 97
+    { uint8_t v = a; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(4, 0x005d);
+    EXIT(0x005d);
+exit:
+    LEAVE
+}
+
+static int Block0060(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0060 98
+    { uint8_t v = b; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0061);
+    EXIT(0x0061);
+exit:
+    LEAVE
+}
+
+static int Block0064(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0064 99
+    { uint8_t v = c; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0065);
+    EXIT(0x0065);
+exit:
+    LEAVE
+}
+
+static int Block0068(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0068 9a
+    { uint8_t v = d; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0069);
+    EXIT(0x0069);
+exit:
+    LEAVE
+}
+
+static int Block006c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 006c 9b
+    { uint8_t v = e; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x006d);
+    EXIT(0x006d);
+exit:
+    LEAVE
+}
+
+static int Block0070(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0070 9c
+    { uint8_t v = h; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0071);
+    EXIT(0x0071);
+exit:
+    LEAVE
+}
+
+static int Block0074(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0074 9d
+    { uint8_t v = l; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0075);
+    EXIT(0x0075);
+exit:
+    LEAVE
+}
+
+static int Block0078(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0078 9e
+    CHECK_READ(HL, 0x0078);
+    { uint8_t v = mem[HL]; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x0079);
+    EXIT(0x0079);
+exit:
+    LEAVE
+}
+
+static int Block007c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 007c 9f
+    { uint8_t v = a; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(4, 0x007d);
+    EXIT(0x007d);
+exit:
+    LEAVE
+}
+
+static int Block0080(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0080 a0
+    a &= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0081);
+    EXIT(0x0081);
+exit:
+    LEAVE
+}
+
+static int Block0084(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0084 a1
+    a &= c; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0085);
+    EXIT(0x0085);
+exit:
+    LEAVE
+}
+
+static int Block0088(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0088 a2
+    a &= d; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0089);
+    EXIT(0x0089);
+exit:
+    LEAVE
+}
+
+static int Block008c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 008c a3
+    a &= e; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x008d);
+    EXIT(0x008d);
+exit:
+    LEAVE
+}
+
+static int Block0090(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0090 a4
+    a &= h; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0091);
+    EXIT(0x0091);
+exit:
+    LEAVE
+}
+
+static int Block0094(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0094 a5
+    a &= l; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x0095);
+    EXIT(0x0095);
+exit:
+    LEAVE
+}
+
+static int Block0098(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0098 a6
+    CHECK_READ(HL, 0x0098);
+    a &= mem[HL]; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0099);
+    EXIT(0x0099);
+exit:
+    LEAVE
+}
+
+static int Block009c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 009c a7
+    a &= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x009d);
+    EXIT(0x009d);
+exit:
+    LEAVE
+}
+
+static int Block00a0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00a0 a8
+    a ^= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00a1);
+    EXIT(0x00a1);
+exit:
+    LEAVE
+}
+
+static int Block00a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00a4 a9
+    a ^= c; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00a5);
+    EXIT(0x00a5);
+exit:
+    LEAVE
+}
+
+static int Block00a8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00a8 aa
+    a ^= d; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00a9);
+    EXIT(0x00a9);
+exit:
+    LEAVE
+}
+
+static int Block00ac(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00ac ab
+    a ^= e; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00ad);
+    EXIT(0x00ad);
+exit:
+    LEAVE
+}
+
+static int Block00b0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00b0 ac
+    a ^= h; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00b1);
+    EXIT(0x00b1);
+exit:
+    LEAVE
+}
+
+static int Block00b4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00b4 ad
+    a ^= l; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00b5);
+    EXIT(0x00b5);
+exit:
+    LEAVE
+}
+
+static int Block00b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00b8 ae
+    CHECK_READ(HL, 0x00b8);
+    a ^= mem[HL]; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x00b9);
+    EXIT(0x00b9);
+exit:
+    LEAVE
+}
+
+static int Block00bc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00bc af
+    a ^= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00bd);
+    EXIT(0x00bd);
+exit:
+    LEAVE
+}
+
+static int Block00c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00c0 b0
+    a |= b; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00c1);
+    EXIT(0x00c1);
+exit:
+    LEAVE
+}
+
+static int Block00c4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00c4 b1
+    a |= c; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00c5);
+    EXIT(0x00c5);
+exit:
+    LEAVE
+}
+
+static int Block00c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00c8 b2
+    a |= d; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00c9);
+    EXIT(0x00c9);
+exit:
+    LEAVE
+}
+
+static int Block00cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00cc b3
+    a |= e; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00cd);
+    EXIT(0x00cd);
+exit:
+    LEAVE
+}
+
+static int Block00d0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d0 b4
+    a |= h; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00d1);
+    EXIT(0x00d1);
+exit:
+    LEAVE
+}
+
+static int Block00d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d4 b5
+    a |= l; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00d5);
+    EXIT(0x00d5);
+exit:
+    LEAVE
+}
+
+static int Block00d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00d8 b6
+    CHECK_READ(HL, 0x00d8);
+    a |= mem[HL]; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x00d9);
+    EXIT(0x00d9);
+exit:
+    LEAVE
+}
+
+static int Block00dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00dc b7
+    a |= a; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(4, 0x00dd);
+    EXIT(0x00dd);
+exit:
+    LEAVE
+}
+
+static int Block00e0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00e0 b8
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][b];
+    ACCOUNT(4, 0x00e1);
+    EXIT(0x00e1);
+exit:
+    LEAVE
+}
+
+static int Block00e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00e4 b9
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][c];
+    ACCOUNT(4, 0x00e5);
+    EXIT(0x00e5);
+exit:
+    LEAVE
+}
+
+static int Block00e8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00e8 ba
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][d];
+    ACCOUNT(4, 0x00e9);
+    EXIT(0x00e9);
+exit:
+    LEAVE
+}
+
+static int Block00ec(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00ec bb
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][e];
+    ACCOUNT(4, 0x00ed);
+    EXIT(0x00ed);
+exit:
+    LEAVE
+}
+
+static int Block00f0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00f0 bc
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][h];
+    ACCOUNT(4, 0x00f1);
+    EXIT(0x00f1);
+exit:
+    LEAVE
+}
+
+static int Block00f4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00f4 bd
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][l];
+    ACCOUNT(4, 0x00f5);
+    EXIT(0x00f5);
+exit:
+    LEAVE
+}
+
+static int Block00f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00f8 be
+    CHECK_READ(HL, 0x00f8);
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][mem[HL]];
+    ACCOUNT(7, 0x00f9);
+    EXIT(0x00f9);
+exit:
+    LEAVE
+}
+
+static int Block00fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 00fc bf
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][a];
+    ACCOUNT(4, 0x00fd);
+    EXIT(0x00fd);
+exit:
+    LEAVE
+}
+
+static int Block0100(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0100 04
+    b = (uint8_t)(b + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[b];
+    ACCOUNT(5, 0x0101);
+    EXIT(0x0101);
+exit:
+    LEAVE
+}
+
+static int Block0104(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0104 05
+    b = (uint8_t)(b - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[b];
+    ACCOUNT(5, 0x0105);
+    EXIT(0x0105);
+exit:
+    LEAVE
+}
+
+static int Block0108(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0108 0c
+    c = (uint8_t)(c + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[c];
+    ACCOUNT(5, 0x0109);
+    EXIT(0x0109);
+exit:
+    LEAVE
+}
+
+static int Block010c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 010c 0d
+    c = (uint8_t)(c - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[c];
+    ACCOUNT(5, 0x010d);
+    EXIT(0x010d);
+exit:
+    LEAVE
+}
+
+static int Block0110(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0110 14
+    d = (uint8_t)(d + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[d];
+    ACCOUNT(5, 0x0111);
+    EXIT(0x0111);
+exit:
+    LEAVE
+}
+
+static int Block0114(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0114 15
+    d = (uint8_t)(d - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[d];
+    ACCOUNT(5, 0x0115);
+    EXIT(0x0115);
+exit:
+    LEAVE
+}
+
+static int Block0118(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0118 1c
+    e = (uint8_t)(e + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[e];
+    ACCOUNT(5, 0x0119);
+    EXIT(0x0119);
+exit:
+    LEAVE
+}
+
+static int Block011c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 011c 1d
+    e = (uint8_t)(e - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[e];
+    ACCOUNT(5, 0x011d);
+    EXIT(0x011d);
+exit:
+    LEAVE
+}
+
+static int Block0120(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0120 24
+    h = (uint8_t)(h + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[h];
+    ACCOUNT(5, 0x0121);
+    EXIT(0x0121);
+exit:
+    LEAVE
+}
+
+static int Block0124(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0124 25
+    h = (uint8_t)(h - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[h];
+    ACCOUNT(5, 0x0125);
+    EXIT(0x0125);
+exit:
+    LEAVE
+}
+
+static int Block0128(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0128 2c
+    l = (uint8_t)(l + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[l];
+    ACCOUNT(5, 0x0129);
+    EXIT(0x0129);
+exit:
+    LEAVE
+}
+
+static int Block012c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 012c 2d
+    l = (uint8_t)(l - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[l];
+    ACCOUNT(5, 0x012d);
+    EXIT(0x012d);
+exit:
+    LEAVE
+}
+
+static int Block0130(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0130 34
+    CHECK_READ(HL, 0x0130);
+    CHECK_WRITE(HL, 0x0130);
+    { uint8_t v = (uint8_t)(mem[HL] + 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0131);
+    EXIT(0x0131);
+exit:
+    LEAVE
+}
+
+static int Block0134(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0134 35
+    CHECK_READ(HL, 0x0134);
+    CHECK_WRITE(HL, 0x0134);
+    { uint8_t v = (uint8_t)(mem[HL] - 1); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[v]; }
+    WRITTEN(HL);
+    ACCOUNT(10, 0x0135);
+    EXIT(0x0135);
+exit:
+    LEAVE
+}
+
+static int Block0138(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0138 3c
+    a = (uint8_t)(a + 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | inr_flags[a];
+    ACCOUNT(5, 0x0139);
+    EXIT(0x0139);
+exit:
+    LEAVE
+}
+
+static int Block013c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 013c 3d
+    a = (uint8_t)(a - 1); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | dcr_flags[a];
+    ACCOUNT(5, 0x013d);
+    EXIT(0x013d);
+exit:
+    LEAVE
+}
+
+static int Block0144(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0144 07
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0145);
+    EXIT(0x0145);
+exit:
+    LEAVE
+}
+
+static int Block0148(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0148 0f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0149);
+    EXIT(0x0149);
+exit:
+    LEAVE
+}
+
+static int Block014c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 014c 17
+    { int cy = a >> 7; a = (uint8_t)((a << 1) | ((f >> 3) & 1)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x014d);
+    EXIT(0x014d);
+exit:
+    LEAVE
+}
+
+static int Block0150(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0150 1f
+    { int cy = a & 1; a = (uint8_t)((a >> 1) | (((f >> 3) & 1) << 7)); f = (f & ~FlagCarry) | (cy << 3); }
+    ACCOUNT(4, 0x0151);
+    EXIT(0x0151);
+exit:
+    LEAVE
+}
+
+static int Block0154(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0154 2f
+    a = ~a;
+    ACCOUNT(4, 0x0155);
+    EXIT(0x0155);
+exit:
+    LEAVE
+}
+
+static int Block0158(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0158 37
+    f |= FlagCarry;
+    ACCOUNT(4, 0x0159);
+    EXIT(0x0159);
+exit:
+    LEAVE
+}
+
+static int Block015c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 015c 3f
+    f ^= FlagCarry;
+    ACCOUNT(4, 0x015d);
+    EXIT(0x015d);
+exit:
+    LEAVE
+}
+
+static int Block0160(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0160 c6 00
+    { uint8_t v = 0x00; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0162);
+    EXIT(0x0162);
+exit:
+    LEAVE
+}
+
+static int Block0164(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0164 c6 01
+    { uint8_t v = 0x01; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0166);
+    EXIT(0x0166);
+exit:
+    LEAVE
+}
+
+static int Block0168(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0168 c6 07
+    { uint8_t v = 0x07; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x016a);
+    EXIT(0x016a);
+exit:
+    LEAVE
+}
+
+static int Block016c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 016c c6 08
+    { uint8_t v = 0x08; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x016e);
+    EXIT(0x016e);
+exit:
+    LEAVE
+}
+
+static int Block0170(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0170 c6 0f
+    { uint8_t v = 0x0f; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0172);
+    EXIT(0x0172);
+exit:
+    LEAVE
+}
+
+static int Block0174(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0174 c6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0176);
+    EXIT(0x0176);
+exit:
+    LEAVE
+}
+
+static int Block0178(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0178 c6 11
+    { uint8_t v = 0x11; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x017a);
+    EXIT(0x017a);
+exit:
+    LEAVE
+}
+
+static int Block017c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 017c c6 22
+    { uint8_t v = 0x22; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x017e);
+    EXIT(0x017e);
+exit:
+    LEAVE
+}
+
+static int Block0180(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0180 c6 33
+    { uint8_t v = 0x33; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0182);
+    EXIT(0x0182);
+exit:
+    LEAVE
+}
+
+static int Block0184(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0184 c6 44
+    { uint8_t v = 0x44; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0186);
+    EXIT(0x0186);
+exit:
+    LEAVE
+}
+
+static int Block0188(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0188 c6 55
+    { uint8_t v = 0x55; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x018a);
+    EXIT(0x018a);
+exit:
+    LEAVE
+}
+
+static int Block018c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 018c c6 66
+    { uint8_t v = 0x66; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x018e);
+    EXIT(0x018e);
+exit:
+    LEAVE
+}
+
+static int Block0190(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0190 c6 77
+    { uint8_t v = 0x77; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0192);
+    EXIT(0x0192);
+exit:
+    LEAVE
+}
+
+static int Block0194(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0194 c6 7f
+    { uint8_t v = 0x7f; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x0196);
+    EXIT(0x0196);
+exit:
+    LEAVE
+}
+
+static int Block0198(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0198 c6 80
+    { uint8_t v = 0x80; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x019a);
+    EXIT(0x019a);
+exit:
+    LEAVE
+}
+
+static int Block019c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 019c c6 88
+    { uint8_t v = 0x88; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x019e);
+    EXIT(0x019e);
+exit:
+    LEAVE
+}
+
+static int Block01a0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01a0 c6 99
+    { uint8_t v = 0x99; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01a2);
+    EXIT(0x01a2);
+exit:
+    LEAVE
+}
+
+static int Block01a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01a4 c6 aa
+    { uint8_t v = 0xaa; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01a6);
+    EXIT(0x01a6);
+exit:
+    LEAVE
+}
+
+static int Block01a8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01a8 c6 bb
+    { uint8_t v = 0xbb; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01aa);
+    EXIT(0x01aa);
+exit:
+    LEAVE
+}
+
+static int Block01ac(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01ac c6 cc
+    { uint8_t v = 0xcc; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01ae);
+    EXIT(0x01ae);
+exit:
+    LEAVE
+}
+
+static int Block01b0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01b0 c6 dd
+    { uint8_t v = 0xdd; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01b2);
+    EXIT(0x01b2);
+exit:
+    LEAVE
+}
+
+static int Block01b4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01b4 c6 ee
+    { uint8_t v = 0xee; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01b6);
+    EXIT(0x01b6);
+exit:
+    LEAVE
+}
+
+static int Block01b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01b8 c6 f0
+    { uint8_t v = 0xf0; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01ba);
+    EXIT(0x01ba);
+exit:
+    LEAVE
+}
+
+static int Block01bc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01bc c6 fe
+    { uint8_t v = 0xfe; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01be);
+    EXIT(0x01be);
+exit:
+    LEAVE
+}
+
+static int Block01c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c0 c6 ff
+    { uint8_t v = 0xff; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }
+    ACCOUNT(7, 0x01c2);
+    EXIT(0x01c2);
+exit:
+    LEAVE
+}
+
+static int Block01c4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c4 ce 00
+    { uint8_t v = 0x00; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01c6);
+    EXIT(0x01c6);
+exit:
+    LEAVE
+}
+
+static int Block01c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01c8 ce 01
+    { uint8_t v = 0x01; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01ca);
+    EXIT(0x01ca);
+exit:
+    LEAVE
+}
+
+static int Block01cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01cc ce 07
+    { uint8_t v = 0x07; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01ce);
+    EXIT(0x01ce);
+exit:
+    LEAVE
+}
+
+static int Block01d0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01d0 ce 08
+    { uint8_t v = 0x08; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01d2);
+    EXIT(0x01d2);
+exit:
+    LEAVE
+}
+
+static int Block01d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01d4 ce 0f
+    { uint8_t v = 0x0f; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01d6);
+    EXIT(0x01d6);
+exit:
+    LEAVE
+}
+
+static int Block01d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01d8 ce 10
+    { uint8_t v = 0x10; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01da);
+    EXIT(0x01da);
+exit:
+    LEAVE
+}
+
+static int Block01dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01dc ce 11
+    { uint8_t v = 0x11; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01de);
+    EXIT(0x01de);
+exit:
+    LEAVE
+}
+
+static int Block01e0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01e0 ce 22
+    { uint8_t v = 0x22; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01e2);
+    EXIT(0x01e2);
+exit:
+    LEAVE
+}
+
+static int Block01e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01e4 ce 33
+    { uint8_t v = 0x33; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01e6);
+    EXIT(0x01e6);
+exit:
+    LEAVE
+}
+
+static int Block01e8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01e8 ce 44
+    { uint8_t v = 0x44; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01ea);
+    EXIT(0x01ea);
+exit:
+    LEAVE
+}
+
+static int Block01ec(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01ec ce 55
+    { uint8_t v = 0x55; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01ee);
+    EXIT(0x01ee);
+exit:
+    LEAVE
+}
+
+static int Block01f0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01f0 ce 66
+    { uint8_t v = 0x66; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01f2);
+    EXIT(0x01f2);
+exit:
+    LEAVE
+}
+
+static int Block01f4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01f4 ce 77
+    { uint8_t v = 0x77; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01f6);
+    EXIT(0x01f6);
+exit:
+    LEAVE
+}
+
+static int Block01f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01f8 ce 7f
+    { uint8_t v = 0x7f; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01fa);
+    EXIT(0x01fa);
+exit:
+    LEAVE
+}
+
+static int Block01fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 01fc ce 80
+    { uint8_t v = 0x80; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x01fe);
+    EXIT(0x01fe);
+exit:
+    LEAVE
+}
+
+static int Block0200(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0200 ce 88
+    { uint8_t v = 0x88; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0202);
+    EXIT(0x0202);
+exit:
+    LEAVE
+}
+
+static int Block0204(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0204 ce 99
+    { uint8_t v = 0x99; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0206);
+    EXIT(0x0206);
+exit:
+    LEAVE
+}
+
+static int Block0208(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0208 ce aa
+    { uint8_t v = 0xaa; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x020a);
+    EXIT(0x020a);
+exit:
+    LEAVE
+}
+
+static int Block020c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 020c ce bb
+    { uint8_t v = 0xbb; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x020e);
+    EXIT(0x020e);
+exit:
+    LEAVE
+}
+
+static int Block0210(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0210 ce cc
+    { uint8_t v = 0xcc; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0212);
+    EXIT(0x0212);
+exit:
+    LEAVE
+}
+
+static int Block0214(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0214 ce dd
+    { uint8_t v = 0xdd; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0216);
+    EXIT(0x0216);
+exit:
+    LEAVE
+}
+
+static int Block0218(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0218 ce ee
+    { uint8_t v = 0xee; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x021a);
+    EXIT(0x021a);
+exit:
+    LEAVE
+}
+
+static int Block021c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 021c ce f0
+    { uint8_t v = 0xf0; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x021e);
+    EXIT(0x021e);
+exit:
+    LEAVE
+}
+
+static int Block0220(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0220 ce fe
+    { uint8_t v = 0xfe; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0222);
+    EXIT(0x0222);
+exit:
+    LEAVE
+}
+
+static int Block0224(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0224 ce ff
+    { uint8_t v = 0xff; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }
+    ACCOUNT(7, 0x0226);
+    EXIT(0x0226);
+exit:
+    LEAVE
+}
+
+static int Block0228(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0228 d6 00
+    { uint8_t v = 0x00; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x022a);
+    EXIT(0x022a);
+exit:
+    LEAVE
+}
+
+static int Block022c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 022c d6 01
+    { uint8_t v = 0x01; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x022e);
+    EXIT(0x022e);
+exit:
+    LEAVE
+}
+
+static int Block0230(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0230 d6 07
+    { uint8_t v = 0x07; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0232);
+    EXIT(0x0232);
+exit:
+    LEAVE
+}
+
+static int Block0234(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0234 d6 08
+    { uint8_t v = 0x08; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0236);
+    EXIT(0x0236);
+exit:
+    LEAVE
+}
+
+static int Block0238(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0238 d6 0f
+    { uint8_t v = 0x0f; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x023a);
+    EXIT(0x023a);
+exit:
+    LEAVE
+}
+
+static int Block023c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 023c d6 10
+    { uint8_t v = 0x10; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x023e);
+    EXIT(0x023e);
+exit:
+    LEAVE
+}
+
+static int Block0240(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0240 d6 11
+    { uint8_t v = 0x11; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0242);
+    EXIT(0x0242);
+exit:
+    LEAVE
+}
+
+static int Block0244(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0244 d6 22
+    { uint8_t v = 0x22; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0246);
+    EXIT(0x0246);
+exit:
+    LEAVE
+}
+
+static int Block0248(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0248 d6 33
+    { uint8_t v = 0x33; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x024a);
+    EXIT(0x024a);
+exit:
+    LEAVE
+}
+
+static int Block024c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 024c d6 44
+    { uint8_t v = 0x44; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x024e);
+    EXIT(0x024e);
+exit:
+    LEAVE
+}
+
+static int Block0250(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0250 d6 55
+    { uint8_t v = 0x55; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0252);
+    EXIT(0x0252);
+exit:
+    LEAVE
+}
+
+static int Block0254(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0254 d6 66
+    { uint8_t v = 0x66; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0256);
+    EXIT(0x0256);
+exit:
+    LEAVE
+}
+
+static int Block0258(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0258 d6 77
+    { uint8_t v = 0x77; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x025a);
+    EXIT(0x025a);
+exit:
+    LEAVE
+}
+
+static int Block025c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 025c d6 7f
+    { uint8_t v = 0x7f; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x025e);
+    EXIT(0x025e);
+exit:
+    LEAVE
+}
+
+static int Block0260(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0260 d6 80
+    { uint8_t v = 0x80; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0262);
+    EXIT(0x0262);
+exit:
+    LEAVE
+}
+
+static int Block0264(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0264 d6 88
+    { uint8_t v = 0x88; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0266);
+    EXIT(0x0266);
+exit:
+    LEAVE
+}
+
+static int Block0268(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0268 d6 99
+    { uint8_t v = 0x99; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x026a);
+    EXIT(0x026a);
+exit:
+    LEAVE
+}
+
+static int Block026c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 026c d6 aa
+    { uint8_t v = 0xaa; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x026e);
+    EXIT(0x026e);
+exit:
+    LEAVE
+}
+
+static int Block0270(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0270 d6 bb
+    { uint8_t v = 0xbb; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0272);
+    EXIT(0x0272);
+exit:
+    LEAVE
+}
+
+static int Block0274(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0274 d6 cc
+    { uint8_t v = 0xcc; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0276);
+    EXIT(0x0276);
+exit:
+    LEAVE
+}
+
+static int Block0278(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0278 d6 dd
+    { uint8_t v = 0xdd; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x027a);
+    EXIT(0x027a);
+exit:
+    LEAVE
+}
+
+static int Block027c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 027c d6 ee
+    { uint8_t v = 0xee; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x027e);
+    EXIT(0x027e);
+exit:
+    LEAVE
+}
+
+static int Block0280(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0280 d6 f0
+    { uint8_t v = 0xf0; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0282);
+    EXIT(0x0282);
+exit:
+    LEAVE
+}
+
+static int Block0284(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0284 d6 fe
+    { uint8_t v = 0xfe; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x0286);
+    EXIT(0x0286);
+exit:
+    LEAVE
+}
+
+static int Block0288(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0288 d6 ff
+    { uint8_t v = 0xff; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }
+    ACCOUNT(7, 0x028a);
+    EXIT(0x028a);
+exit:
+    LEAVE
+}
+
+static int Block028c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 028c de 00
+    { uint8_t v = 0x00; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x028e);
+    EXIT(0x028e);
+exit:
+    LEAVE
+}
+
+static int Block0290(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0290 de 01
+    { uint8_t v = 0x01; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x0292);
+    EXIT(0x0292);
+exit:
+    LEAVE
+}
+
+static int Block0294(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0294 de 07
+    { uint8_t v = 0x07; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x0296);
+    EXIT(0x0296);
+exit:
+    LEAVE
+}
+
+static int Block0298(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0298 de 08
+    { uint8_t v = 0x08; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x029a);
+    EXIT(0x029a);
+exit:
+    LEAVE
+}
+
+static int Block029c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 029c de 0f
+    { uint8_t v = 0x0f; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x029e);
+    EXIT(0x029e);
+exit:
+    LEAVE
+}
+
+static int Block02a0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02a0 de 10
+    { uint8_t v = 0x10; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02a2);
+    EXIT(0x02a2);
+exit:
+    LEAVE
+}
+
+static int Block02a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02a4 de 11
+    { uint8_t v = 0x11; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02a6);
+    EXIT(0x02a6);
+exit:
+    LEAVE
+}
+
+static int Block02a8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02a8 de 22
+    { uint8_t v = 0x22; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02aa);
+    EXIT(0x02aa);
+exit:
+    LEAVE
+}
+
+static int Block02ac(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02ac de 33
+    { uint8_t v = 0x33; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ae);
+    EXIT(0x02ae);
+exit:
+    LEAVE
+}
+
+static int Block02b0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02b0 de 44
+    { uint8_t v = 0x44; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02b2);
+    EXIT(0x02b2);
+exit:
+    LEAVE
+}
+
+static int Block02b4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02b4 de 55
+    { uint8_t v = 0x55; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02b6);
+    EXIT(0x02b6);
+exit:
+    LEAVE
+}
+
+static int Block02b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02b8 de 66
+    { uint8_t v = 0x66; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ba);
+    EXIT(0x02ba);
+exit:
+    LEAVE
+}
+
+static int Block02bc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02bc de 77
+    { uint8_t v = 0x77; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02be);
+    EXIT(0x02be);
+exit:
+    LEAVE
+}
+
+static int Block02c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02c0 de 7f
+    { uint8_t v = 0x7f; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02c2);
+    EXIT(0x02c2);
+exit:
+    LEAVE
+}
+
+static int Block02c4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02c4 de 80
+    { uint8_t v = 0x80; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02c6);
+    EXIT(0x02c6);
+exit:
+    LEAVE
+}
+
+static int Block02c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02c8 de 88
+    { uint8_t v = 0x88; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ca);
+    EXIT(0x02ca);
+exit:
+    LEAVE
+}
+
+static int Block02cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02cc de 99
+    { uint8_t v = 0x99; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ce);
+    EXIT(0x02ce);
+exit:
+    LEAVE
+}
+
+static int Block02d0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02d0 de aa
+    { uint8_t v = 0xaa; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02d2);
+    EXIT(0x02d2);
+exit:
+    LEAVE
+}
+
+static int Block02d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02d4 de bb
+    { uint8_t v = 0xbb; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02d6);
+    EXIT(0x02d6);
+exit:
+    LEAVE
+}
+
+static int Block02d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02d8 de cc
+    { uint8_t v = 0xcc; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02da);
+    EXIT(0x02da);
+exit:
+    LEAVE
+}
+
+static int Block02dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02dc de dd
+    { uint8_t v = 0xdd; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02de);
+    EXIT(0x02de);
+exit:
+    LEAVE
+}
+
+static int Block02e0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02e0 de ee
+    { uint8_t v = 0xee; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02e2);
+    EXIT(0x02e2);
+exit:
+    LEAVE
+}
+
+static int Block02e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02e4 de f0
+    { uint8_t v = 0xf0; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02e6);
+    EXIT(0x02e6);
+exit:
+    LEAVE
+}
+
+static int Block02e8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02e8 de fe
+    { uint8_t v = 0xfe; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ea);
+    EXIT(0x02ea);
+exit:
+    LEAVE
+}
+
+static int Block02ec(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02ec de ff
+    { uint8_t v = 0xff; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }
+    ACCOUNT(7, 0x02ee);
+    EXIT(0x02ee);
+exit:
+    LEAVE
+}
+
+static int Block02f0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02f0 e6 00
+    a &= 0x00; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x02f2);
+    EXIT(0x02f2);
+exit:
+    LEAVE
+}
+
+static int Block02f4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02f4 e6 01
+    a &= 0x01; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x02f6);
+    EXIT(0x02f6);
+exit:
+    LEAVE
+}
+
+static int Block02f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02f8 e6 07
+    a &= 0x07; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x02fa);
+    EXIT(0x02fa);
+exit:
+    LEAVE
+}
+
+static int Block02fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 02fc e6 08
+    a &= 0x08; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x02fe);
+    EXIT(0x02fe);
+exit:
+    LEAVE
+}
+
+static int Block0300(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0300 e6 0f
+    a &= 0x0f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0302);
+    EXIT(0x0302);
+exit:
+    LEAVE
+}
+
+static int Block0304(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0304 e6 10
+    a &= 0x10; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0306);
+    EXIT(0x0306);
+exit:
+    LEAVE
+}
+
+static int Block0308(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0308 e6 11
+    a &= 0x11; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x030a);
+    EXIT(0x030a);
+exit:
+    LEAVE
+}
+
+static int Block030c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 030c e6 22
+    a &= 0x22; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x030e);
+    EXIT(0x030e);
+exit:
+    LEAVE
+}
+
+static int Block0310(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0310 e6 33
+    a &= 0x33; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0312);
+    EXIT(0x0312);
+exit:
+    LEAVE
+}
+
+static int Block0314(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0314 e6 44
+    a &= 0x44; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0316);
+    EXIT(0x0316);
+exit:
+    LEAVE
+}
+
+static int Block0318(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0318 e6 55
+    a &= 0x55; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x031a);
+    EXIT(0x031a);
+exit:
+    LEAVE
+}
+
+static int Block031c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 031c e6 66
+    a &= 0x66; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x031e);
+    EXIT(0x031e);
+exit:
+    LEAVE
+}
+
+static int Block0320(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0320 e6 77
+    a &= 0x77; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0322);
+    EXIT(0x0322);
+exit:
+    LEAVE
+}
+
+static int Block0324(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0324 e6 7f
+    a &= 0x7f; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0326);
+    EXIT(0x0326);
+exit:
+    LEAVE
+}
+
+static int Block0328(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0328 e6 80
+    a &= 0x80; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x032a);
+    EXIT(0x032a);
+exit:
+    LEAVE
+}
+
+static int Block032c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 032c e6 88
+    a &= 0x88; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x032e);
+    EXIT(0x032e);
+exit:
+    LEAVE
+}
+
+static int Block0330(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0330 e6 99
+    a &= 0x99; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0332);
+    EXIT(0x0332);
+exit:
+    LEAVE
+}
+
+static int Block0334(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0334 e6 aa
+    a &= 0xaa; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0336);
+    EXIT(0x0336);
+exit:
+    LEAVE
+}
+
+static int Block0338(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0338 e6 bb
+    a &= 0xbb; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x033a);
+    EXIT(0x033a);
+exit:
+    LEAVE
+}
+
+static int Block033c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 033c e6 cc
+    a &= 0xcc; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x033e);
+    EXIT(0x033e);
+exit:
+    LEAVE
+}
+
+static int Block0340(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0340 e6 dd
+    a &= 0xdd; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0342);
+    EXIT(0x0342);
+exit:
+    LEAVE
+}
+
+static int Block0344(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0344 e6 ee
+    a &= 0xee; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0346);
+    EXIT(0x0346);
+exit:
+    LEAVE
+}
+
+static int Block0348(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0348 e6 f0
+    a &= 0xf0; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x034a);
+    EXIT(0x034a);
+exit:
+    LEAVE
+}
+
+static int Block034c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 034c e6 fe
+    a &= 0xfe; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x034e);
+    EXIT(0x034e);
+exit:
+    LEAVE
+}
+
+static int Block0350(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0350 e6 ff
+    a &= 0xff; f = (f & ~ALU_FLAGS) | zsp_flags[a];
+    ACCOUNT(7, 0x0352);
+    EXIT(0x0352);
+exit:
+    LEAVE
+}
+
+static int Block0354(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0354 ee 00
+    a ^= 0x00; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0356);
+    EXIT(0x0356);
+exit:
+    LEAVE
+}
+
+static int Block0358(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0358 ee 01
+    a ^= 0x01; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x035a);
+    EXIT(0x035a);
+exit:
+    LEAVE
+}
+
+static int Block035c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 035c ee 07
+    a ^= 0x07; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x035e);
+    EXIT(0x035e);
+exit:
+    LEAVE
+}
+
+static int Block0360(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0360 ee 08
+    a ^= 0x08; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0362);
+    EXIT(0x0362);
+exit:
+    LEAVE
+}
+
+static int Block0364(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0364 ee 0f
+    a ^= 0x0f; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0366);
+    EXIT(0x0366);
+exit:
+    LEAVE
+}
+
+static int Block0368(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0368 ee 10
+    a ^= 0x10; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x036a);
+    EXIT(0x036a);
+exit:
+    LEAVE
+}
+
+static int Block036c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 036c ee 11
+    a ^= 0x11; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x036e);
+    EXIT(0x036e);
+exit:
+    LEAVE
+}
+
+static int Block0370(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0370 ee 22
+    a ^= 0x22; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0372);
+    EXIT(0x0372);
+exit:
+    LEAVE
+}
+
+static int Block0374(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0374 ee 33
+    a ^= 0x33; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0376);
+    EXIT(0x0376);
+exit:
+    LEAVE
+}
+
+static int Block0378(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0378 ee 44
+    a ^= 0x44; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x037a);
+    EXIT(0x037a);
+exit:
+    LEAVE
+}
+
+static int Block037c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 037c ee 55
+    a ^= 0x55; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x037e);
+    EXIT(0x037e);
+exit:
+    LEAVE
+}
+
+static int Block0380(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0380 ee 66
+    a ^= 0x66; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0382);
+    EXIT(0x0382);
+exit:
+    LEAVE
+}
+
+static int Block0384(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0384 ee 77
+    a ^= 0x77; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0386);
+    EXIT(0x0386);
+exit:
+    LEAVE
+}
+
+static int Block0388(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0388 ee 7f
+    a ^= 0x7f; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x038a);
+    EXIT(0x038a);
+exit:
+    LEAVE
+}
+
+static int Block038c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 038c ee 80
+    a ^= 0x80; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x038e);
+    EXIT(0x038e);
+exit:
+    LEAVE
+}
+
+static int Block0390(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0390 ee 88
+    a ^= 0x88; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0392);
+    EXIT(0x0392);
+exit:
+    LEAVE
+}
+
+static int Block0394(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0394 ee 99
+    a ^= 0x99; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0396);
+    EXIT(0x0396);
+exit:
+    LEAVE
+}
+
+static int Block0398(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0398 ee aa
+    a ^= 0xaa; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x039a);
+    EXIT(0x039a);
+exit:
+    LEAVE
+}
+
+static int Block039c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 039c ee bb
+    a ^= 0xbb; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x039e);
+    EXIT(0x039e);
+exit:
+    LEAVE
+}
+
+static int Block03a0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03a0 ee cc
+    a ^= 0xcc; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03a2);
+    EXIT(0x03a2);
+exit:
+    LEAVE
+}
+
+static int Block03a4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03a4 ee dd
+    a ^= 0xdd; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03a6);
+    EXIT(0x03a6);
+exit:
+    LEAVE
+}
+
+static int Block03a8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03a8 ee ee
+    a ^= 0xee; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03aa);
+    EXIT(0x03aa);
+exit:
+    LEAVE
+}
+
+static int Block03ac(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03ac ee f0
+    a ^= 0xf0; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ae);
+    EXIT(0x03ae);
+exit:
+    LEAVE
+}
+
+static int Block03b0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03b0 ee fe
+    a ^= 0xfe; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03b2);
+    EXIT(0x03b2);
+exit:
+    LEAVE
+}
+
+static int Block03b4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03b4 ee ff
+    a ^= 0xff; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03b6);
+    EXIT(0x03b6);
+exit:
+    LEAVE
+}
+
+static int Block03b8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03b8 f6 00
+    a |= 0x00; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ba);
+    EXIT(0x03ba);
+exit:
+    LEAVE
+}
+
+static int Block03bc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03bc f6 01
+    a |= 0x01; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03be);
+    EXIT(0x03be);
+exit:
+    LEAVE
+}
+
+static int Block03c0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03c0 f6 07
+    a |= 0x07; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03c2);
+    EXIT(0x03c2);
+exit:
+    LEAVE
+}
+
+static int Block03c4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03c4 f6 08
+    a |= 0x08; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03c6);
+    EXIT(0x03c6);
+exit:
+    LEAVE
+}
+
+static int Block03c8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03c8 f6 0f
+    a |= 0x0f; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ca);
+    EXIT(0x03ca);
+exit:
+    LEAVE
+}
+
+static int Block03cc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03cc f6 10
+    a |= 0x10; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ce);
+    EXIT(0x03ce);
+exit:
+    LEAVE
+}
+
+static int Block03d0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03d0 f6 11
+    a |= 0x11; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03d2);
+    EXIT(0x03d2);
+exit:
+    LEAVE
+}
+
+static int Block03d4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03d4 f6 22
+    a |= 0x22; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03d6);
+    EXIT(0x03d6);
+exit:
+    LEAVE
+}
+
+static int Block03d8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03d8 f6 33
+    a |= 0x33; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03da);
+    EXIT(0x03da);
+exit:
+    LEAVE
+}
+
+static int Block03dc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03dc f6 44
+    a |= 0x44; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03de);
+    EXIT(0x03de);
+exit:
+    LEAVE
+}
+
+static int Block03e0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03e0 f6 55
+    a |= 0x55; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03e2);
+    EXIT(0x03e2);
+exit:
+    LEAVE
+}
+
+static int Block03e4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03e4 f6 66
+    a |= 0x66; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03e6);
+    EXIT(0x03e6);
+exit:
+    LEAVE
+}
+
+static int Block03e8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03e8 f6 77
+    a |= 0x77; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ea);
+    EXIT(0x03ea);
+exit:
+    LEAVE
+}
+
+static int Block03ec(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03ec f6 7f
+    a |= 0x7f; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03ee);
+    EXIT(0x03ee);
+exit:
+    LEAVE
+}
+
+static int Block03f0(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03f0 f6 80
+    a |= 0x80; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03f2);
+    EXIT(0x03f2);
+exit:
+    LEAVE
+}
+
+static int Block03f4(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03f4 f6 88
+    a |= 0x88; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03f6);
+    EXIT(0x03f6);
+exit:
+    LEAVE
+}
+
+static int Block03f8(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03f8 f6 99
+    a |= 0x99; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03fa);
+    EXIT(0x03fa);
+exit:
+    LEAVE
+}
+
+static int Block03fc(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 03fc f6 aa
+    a |= 0xaa; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x03fe);
+    EXIT(0x03fe);
+exit:
+    LEAVE
+}
+
+static int Block0400(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0400 f6 bb
+    a |= 0xbb; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0402);
+    EXIT(0x0402);
+exit:
+    LEAVE
+}
+
+static int Block0404(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0404 f6 cc
+    a |= 0xcc; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0406);
+    EXIT(0x0406);
+exit:
+    LEAVE
+}
+
+static int Block0408(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0408 f6 dd
+    a |= 0xdd; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x040a);
+    EXIT(0x040a);
+exit:
+    LEAVE
+}
+
+static int Block040c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 040c f6 ee
+    a |= 0xee; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x040e);
+    EXIT(0x040e);
+exit:
+    LEAVE
+}
+
+static int Block0410(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0410 f6 f0
+    a |= 0xf0; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0412);
+    EXIT(0x0412);
+exit:
+    LEAVE
+}
+
+static int Block0414(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0414 f6 fe
+    a |= 0xfe; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x0416);
+    EXIT(0x0416);
+exit:
+    LEAVE
+}
+
+static int Block0418(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0418 f6 ff
+    a |= 0xff; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];
+    ACCOUNT(7, 0x041a);
+    EXIT(0x041a);
+exit:
+    LEAVE
+}
+
+static int Block041c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 041c fe 00
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x00];
+    ACCOUNT(7, 0x041e);
+    EXIT(0x041e);
+exit:
+    LEAVE
+}
+
+static int Block0420(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0420 fe 01
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x01];
+    ACCOUNT(7, 0x0422);
+    EXIT(0x0422);
+exit:
+    LEAVE
+}
+
+static int Block0424(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0424 fe 07
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x07];
+    ACCOUNT(7, 0x0426);
+    EXIT(0x0426);
+exit:
+    LEAVE
+}
+
+static int Block0428(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0428 fe 08
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x08];
+    ACCOUNT(7, 0x042a);
+    EXIT(0x042a);
+exit:
+    LEAVE
+}
+
+static int Block042c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 042c fe 0f
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x0f];
+    ACCOUNT(7, 0x042e);
+    EXIT(0x042e);
+exit:
+    LEAVE
+}
+
+static int Block0430(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0430 fe 10
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x10];
+    ACCOUNT(7, 0x0432);
+    EXIT(0x0432);
+exit:
+    LEAVE
+}
+
+static int Block0434(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0434 fe 11
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x11];
+    ACCOUNT(7, 0x0436);
+    EXIT(0x0436);
+exit:
+    LEAVE
+}
+
+static int Block0438(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0438 fe 22
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x22];
+    ACCOUNT(7, 0x043a);
+    EXIT(0x043a);
+exit:
+    LEAVE
+}
+
+static int Block043c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 043c fe 33
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x33];
+    ACCOUNT(7, 0x043e);
+    EXIT(0x043e);
+exit:
+    LEAVE
+}
+
+static int Block0440(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0440 fe 44
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x44];
+    ACCOUNT(7, 0x0442);
+    EXIT(0x0442);
+exit:
+    LEAVE
+}
+
+static int Block0444(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0444 fe 55
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x55];
+    ACCOUNT(7, 0x0446);
+    EXIT(0x0446);
+exit:
+    LEAVE
+}
+
+static int Block0448(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0448 fe 66
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x66];
+    ACCOUNT(7, 0x044a);
+    EXIT(0x044a);
+exit:
+    LEAVE
+}
+
+static int Block044c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 044c fe 77
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x77];
+    ACCOUNT(7, 0x044e);
+    EXIT(0x044e);
+exit:
+    LEAVE
+}
+
+static int Block0450(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0450 fe 7f
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x7f];
+    ACCOUNT(7, 0x0452);
+    EXIT(0x0452);
+exit:
+    LEAVE
+}
+
+static int Block0454(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0454 fe 80
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x80];
+    ACCOUNT(7, 0x0456);
+    EXIT(0x0456);
+exit:
+    LEAVE
+}
+
+static int Block0458(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0458 fe 88
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x88];
+    ACCOUNT(7, 0x045a);
+    EXIT(0x045a);
+exit:
+    LEAVE
+}
+
+static int Block045c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 045c fe 99
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0x99];
+    ACCOUNT(7, 0x045e);
+    EXIT(0x045e);
+exit:
+    LEAVE
+}
+
+static int Block0460(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0460 fe aa
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xaa];
+    ACCOUNT(7, 0x0462);
+    EXIT(0x0462);
+exit:
+    LEAVE
+}
+
+static int Block0464(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0464 fe bb
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xbb];
+    ACCOUNT(7, 0x0466);
+    EXIT(0x0466);
+exit:
+    LEAVE
+}
+
+static int Block0468(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0468 fe cc
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xcc];
+    ACCOUNT(7, 0x046a);
+    EXIT(0x046a);
+exit:
+    LEAVE
+}
+
+static int Block046c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 046c fe dd
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xdd];
+    ACCOUNT(7, 0x046e);
+    EXIT(0x046e);
+exit:
+    LEAVE
+}
+
+static int Block0470(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0470 fe ee
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xee];
+    ACCOUNT(7, 0x0472);
+    EXIT(0x0472);
+exit:
+    LEAVE
+}
+
+static int Block0474(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0474 fe f0
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xf0];
+    ACCOUNT(7, 0x0476);
+    EXIT(0x0476);
+exit:
+    LEAVE
+}
+
+static int Block0478(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 0478 fe fe
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xfe];
+    ACCOUNT(7, 0x047a);
+    EXIT(0x047a);
+exit:
+    LEAVE
+}
+
+static int Block047c(CPU *processor, uint8_t *mem, int cyc, int budget)
+{
+    ENTER
+    // 047c fe ff
+    f = (f & ~ALU_FLAGS) | sub_flags[0][a][0xff];
+    ACCOUNT(7, 0x047e);
+    EXIT(0x047e);
+exit:
+    LEAVE
+}
+
+static const uint8_t image[0x0500] = {
+    0x80, 0x76, 0x76, 0x76, 0x81, 0x76, 0x76, 0x76, 0x82, 0x76, 0x76, 0x76, 0x83, 0x76, 0x76, 0x76,
+    0x84, 0x76, 0x76, 0x76, 0x85, 0x76, 0x76, 0x76, 0x86, 0x76, 0x76, 0x76, 0x87, 0x76, 0x76, 0x76,
+    0x88, 0x76, 0x76, 0x76, 0x89, 0x76, 0x76, 0x76, 0x8a, 0x76, 0x76, 0x76, 0x8b, 0x76, 0x76, 0x76,
+    0x8c, 0x76, 0x76, 0x76, 0x8d, 0x76, 0x76, 0x76, 0x8e, 0x76, 0x76, 0x76, 0x8f, 0x76, 0x76, 0x76,
+    0x90, 0x76, 0x76, 0x76, 0x91, 0x76, 0x76, 0x76, 0x92, 0x76, 0x76, 0x76, 0x93, 0x76, 0x76, 0x76,
+    0x94, 0x76, 0x76, 0x76, 0x95, 0x76, 0x76, 0x76, 0x96, 0x76, 0x76, 0x76, 0x97, 0x76, 0x76, 0x76,
+    0x98, 0x76, 0x76, 0x76, 0x99, 0x76, 0x76, 0x76, 0x9a, 0x76, 0x76, 0x76, 0x9b, 0x76, 0x76, 0x76,
+    0x9c, 0x76, 0x76, 0x76, 0x9d, 0x76, 0x76, 0x76, 0x9e, 0x76, 0x76, 0x76, 0x9f, 0x76, 0x76, 0x76,
+    0xa0, 0x76, 0x76, 0x76, 0xa1, 0x76, 0x76, 0x76, 0xa2, 0x76, 0x76, 0x76, 0xa3, 0x76, 0x76, 0x76,
+    0xa4, 0x76, 0x76, 0x76, 0xa5, 0x76, 0x76, 0x76, 0xa6, 0x76, 0x76, 0x76, 0xa7, 0x76, 0x76, 0x76,
+    0xa8, 0x76, 0x76, 0x76, 0xa9, 0x76, 0x76, 0x76, 0xaa, 0x76, 0x76, 0x76, 0xab, 0x76, 0x76, 0x76,
+    0xac, 0x76, 0x76, 0x76, 0xad, 0x76, 0x76, 0x76, 0xae, 0x76, 0x76, 0x76, 0xaf, 0x76, 0x76, 0x76,
+    0xb0, 0x76, 0x76, 0x76, 0xb1, 0x76, 0x76, 0x76, 0xb2, 0x76, 0x76, 0x76, 0xb3, 0x76, 0x76, 0x76,
+    0xb4, 0x76, 0x76, 0x76, 0xb5, 0x76, 0x76, 0x76, 0xb6, 0x76, 0x76, 0x76, 0xb7, 0x76, 0x76, 0x76,
+    0xb8, 0x76, 0x76, 0x76, 0xb9, 0x76, 0x76, 0x76, 0xba, 0x76, 0x76, 0x76, 0xbb, 0x76, 0x76, 0x76,
+    0xbc, 0x76, 0x76, 0x76, 0xbd, 0x76, 0x76, 0x76, 0xbe, 0x76, 0x76, 0x76, 0xbf, 0x76, 0x76, 0x76,
+    0x04, 0x76, 0x76, 0x76, 0x05, 0x76, 0x76, 0x76, 0x0c, 0x76, 0x76, 0x76, 0x0d, 0x76, 0x76, 0x76,
+    0x14, 0x76, 0x76, 0x76, 0x15, 0x76, 0x76, 0x76, 0x1c, 0x76, 0x76, 0x76, 0x1d, 0x76, 0x76, 0x76,
+    0x24, 0x76, 0x76, 0x76, 0x25, 0x76, 0x76, 0x76, 0x2c, 0x76, 0x76, 0x76, 0x2d, 0x76, 0x76, 0x76,
+    0x34, 0x76, 0x76, 0x76, 0x35, 0x76, 0x76, 0x76, 0x3c, 0x76, 0x76, 0x76, 0x3d, 0x76, 0x76, 0x76,
+    0x27, 0x76, 0x76, 0x76, 0x07, 0x76, 0x76, 0x76, 0x0f, 0x76, 0x76, 0x76, 0x17, 0x76, 0x76, 0x76,
+    0x1f, 0x76, 0x76, 0x76, 0x2f, 0x76, 0x76, 0x76, 0x37, 0x76, 0x76, 0x76, 0x3f, 0x76, 0x76, 0x76,
+    0xc6, 0x00, 0x76, 0x76, 0xc6, 0x01, 0x76, 0x76, 0xc6, 0x07, 0x76, 0x76, 0xc6, 0x08, 0x76, 0x76,
+    0xc6, 0x0f, 0x76, 0x76, 0xc6, 0x10, 0x76, 0x76, 0xc6, 0x11, 0x76, 0x76, 0xc6, 0x22, 0x76, 0x76,
+    0xc6, 0x33, 0x76, 0x76, 0xc6, 0x44, 0x76, 0x76, 0xc6, 0x55, 0x76, 0x76, 0xc6, 0x66, 0x76, 0x76,
+    0xc6, 0x77, 0x76, 0x76, 0xc6, 0x7f, 0x76, 0x76, 0xc6, 0x80, 0x76, 0x76, 0xc6, 0x88, 0x76, 0x76,
+    0xc6, 0x99, 0x76, 0x76, 0xc6, 0xaa, 0x76, 0x76, 0xc6, 0xbb, 0x76, 0x76, 0xc6, 0xcc, 0x76, 0x76,
+    0xc6, 0xdd, 0x76, 0x76, 0xc6, 0xee, 0x76, 0x76, 0xc6, 0xf0, 0x76, 0x76, 0xc6, 0xfe, 0x76, 0x76,
+    0xc6, 0xff, 0x76, 0x76, 0xce, 0x00, 0x76, 0x76, 0xce, 0x01, 0x76, 0x76, 0xce, 0x07, 0x76, 0x76,
+    0xce, 0x08, 0x76, 0x76, 0xce, 0x0f, 0x76, 0x76, 0xce, 0x10, 0x76, 0x76, 0xce, 0x11, 0x76, 0x76,
+    0xce, 0x22, 0x76, 0x76, 0xce, 0x33, 0x76, 0x76, 0xce, 0x44, 0x76, 0x76, 0xce, 0x55, 0x76, 0x76,
+    0xce, 0x66, 0x76, 0x76, 0xce, 0x77, 0x76, 0x76, 0xce, 0x7f, 0x76, 0x76, 0xce, 0x80, 0x76, 0x76,
+    0xce, 0x88, 0x76, 0x76, 0xce, 0x99, 0x76, 0x76, 0xce, 0xaa, 0x76, 0x76, 0xce, 0xbb, 0x76, 0x76,
+    0xce, 0xcc, 0x76, 0x76, 0xce, 0xdd, 0x76, 0x76, 0xce, 0xee, 0x76, 0x76, 0xce, 0xf0, 0x76, 0x76,
+    0xce, 0xfe, 0x76, 0x76, 0xce, 0xff, 0x76, 0x76, 0xd6, 0x00, 0x76, 0x76, 0xd6, 0x01, 0x76, 0x76,
+    0xd6, 0x07, 0x76, 0x76, 0xd6, 0x08, 0x76, 0x76, 0xd6, 0x0f, 0x76, 0x76, 0xd6, 0x10, 0x76, 0x76,
+    0xd6, 0x11, 0x76, 0x76, 0xd6, 0x22, 0x76, 0x76, 0xd6, 0x33, 0x76, 0x76, 0xd6, 0x44, 0x76, 0x76,
+    0xd6, 0x55, 0x76, 0x76, 0xd6, 0x66, 0x76, 0x76, 0xd6, 0x77, 0x76, 0x76, 0xd6, 0x7f, 0x76, 0x76,
+    0xd6, 0x80, 0x76, 0x76, 0xd6, 0x88, 0x76, 0x76, 0xd6, 0x99, 0x76, 0x76, 0xd6, 0xaa, 0x76, 0x76,
+    0xd6, 0xbb, 0x76, 0x76, 0xd6, 0xcc, 0x76, 0x76, 0xd6, 0xdd, 0x76, 0x76, 0xd6, 0xee, 0x76, 0x76,
+    0xd6, 0xf0, 0x76, 0x76, 0xd6, 0xfe, 0x76, 0x76, 0xd6, 0xff, 0x76, 0x76, 0xde, 0x00, 0x76, 0x76,
+    0xde, 0x01, 0x76, 0x76, 0xde, 0x07, 0x76, 0x76, 0xde, 0x08, 0x76, 0x76, 0xde, 0x0f, 0x76, 0x76,
+    0xde, 0x10, 0x76, 0x76, 0xde, 0x11, 0x76, 0x76, 0xde, 0x22, 0x76, 0x76, 0xde, 0x33, 0x76, 0x76,
+    0xde, 0x44, 0x76, 0x76, 0xde, 0x55, 0x76, 0x76, 0xde, 0x66, 0x76, 0x76, 0xde, 0x77, 0x76, 0x76,
+    0xde, 0x7f, 0x76, 0x76, 0xde, 0x80, 0x76, 0x76, 0xde, 0x88, 0x76, 0x76, 0xde, 0x99, 0x76, 0x76,
+    0xde, 0xaa, 0x76, 0x76, 0xde, 0xbb, 0x76, 0x76, 0xde, 0xcc, 0x76, 0x76, 0xde, 0xdd, 0x76, 0x76,
+    0xde, 0xee, 0x76, 0x76, 0xde, 0xf0, 0x76, 0x76, 0xde, 0xfe, 0x76, 0x76, 0xde, 0xff, 0x76, 0x76,
+    0xe6, 0x00, 0x76, 0x76, 0xe6, 0x01, 0x76, 0x76, 0xe6, 0x07, 0x76, 0x76, 0xe6, 0x08, 0x76, 0x76,
+    0xe6, 0x0f, 0x76, 0x76, 0xe6, 0x10, 0x76, 0x76, 0xe6, 0x11, 0x76, 0x76, 0xe6, 0x22, 0x76, 0x76,
+    0xe6, 0x33, 0x76, 0x76, 0xe6, 0x44, 0x76, 0x76, 0xe6, 0x55, 0x76, 0x76, 0xe6, 0x66, 0x76, 0x76,
+    0xe6, 0x77, 0x76, 0x76, 0xe6, 0x7f, 0x76, 0x76, 0xe6, 0x80, 0x76, 0x76, 0xe6, 0x88, 0x76, 0x76,
+    0xe6, 0x99, 0x76, 0x76, 0xe6, 0xaa, 0x76, 0x76, 0xe6, 0xbb, 0x76, 0x76, 0xe6, 0xcc, 0x76, 0x76,
+    0xe6, 0xdd, 0x76, 0x76, 0xe6, 0xee, 0x76, 0x76, 0xe6, 0xf0, 0x76, 0x76, 0xe6, 0xfe, 0x76, 0x76,
+    0xe6, 0xff, 0x76, 0x76, 0xee, 0x00, 0x76, 0x76, 0xee, 0x01, 0x76, 0x76, 0xee, 0x07, 0x76, 0x76,
+    0xee, 0x08, 0x76, 0x76, 0xee, 0x0f, 0x76, 0x76, 0xee, 0x10, 0x76, 0x76, 0xee, 0x11, 0x76, 0x76,
+    0xee, 0x22, 0x76, 0x76, 0xee, 0x33, 0x76, 0x76, 0xee, 0x44, 0x76, 0x76, 0xee, 0x55, 0x76, 0x76,
+    0xee, 0x66, 0x76, 0x76, 0xee, 0x77, 0x76, 0x76, 0xee, 0x7f, 0x76, 0x76, 0xee, 0x80, 0x76, 0x76,
+    0xee, 0x88, 0x76, 0x76, 0xee, 0x99, 0x76, 0x76, 0xee, 0xaa, 0x76, 0x76, 0xee, 0xbb, 0x76, 0x76,
+    0xee, 0xcc, 0x76, 0x76, 0xee, 0xdd, 0x76, 0x76, 0xee, 0xee, 0x76, 0x76, 0xee, 0xf0, 0x76, 0x76,
+    0xee, 0xfe, 0x76, 0x76, 0xee, 0xff, 0x76, 0x76, 0xf6, 0x00, 0x76, 0x76, 0xf6, 0x01, 0x76, 0x76,
+    0xf6, 0x07, 0x76, 0x76, 0xf6, 0x08, 0x76, 0x76, 0xf6, 0x0f, 0x76, 0x76, 0xf6, 0x10, 0x76, 0x76,
+    0xf6, 0x11, 0x76, 0x76, 0xf6, 0x22, 0x76, 0x76, 0xf6, 0x33, 0x76, 0x76, 0xf6, 0x44, 0x76, 0x76,
+    0xf6, 0x55, 0x76, 0x76, 0xf6, 0x66, 0x76, 0x76, 0xf6, 0x77, 0x76, 0x76, 0xf6, 0x7f, 0x76, 0x76,
+    0xf6, 0x80, 0x76, 0x76, 0xf6, 0x88, 0x76, 0x76, 0xf6, 0x99, 0x76, 0x76, 0xf6, 0xaa, 0x76, 0x76,
+    0xf6, 0xbb, 0x76, 0x76, 0xf6, 0xcc, 0x76, 0x76, 0xf6, 0xdd, 0x76, 0x76, 0xf6, 0xee, 0x76, 0x76,
+    0xf6, 0xf0, 0x76, 0x76, 0xf6, 0xfe, 0x76, 0x76, 0xf6, 0xff, 0x76, 0x76, 0xfe, 0x00, 0x76, 0x76,
+    0xfe, 0x01, 0x76, 0x76, 0xfe, 0x07, 0x76, 0x76, 0xfe, 0x08, 0x76, 0x76, 0xfe, 0x0f, 0x76, 0x76,
+    0xfe, 0x10, 0x76, 0x76, 0xfe, 0x11, 0x76, 0x76, 0xfe, 0x22, 0x76, 0x76, 0xfe, 0x33, 0x76, 0x76,
+    0xfe, 0x44, 0x76, 0x76, 0xfe, 0x55, 0x76, 0x76, 0xfe, 0x66, 0x76, 0x76, 0xfe, 0x77, 0x76, 0x76,
+    0xfe, 0x7f, 0x76, 0x76, 0xfe, 0x80, 0x76, 0x76, 0xfe, 0x88, 0x76, 0x76, 0xfe, 0x99, 0x76, 0x76,
+    0xfe, 0xaa, 0x76, 0x76, 0xfe, 0xbb, 0x76, 0x76, 0xfe, 0xcc, 0x76, 0x76, 0xfe, 0xdd, 0x76, 0x76,
+    0xfe, 0xee, 0x76, 0x76, 0xfe, 0xf0, 0x76, 0x76, 0xfe, 0xfe, 0x76, 0x76, 0xfe, 0xff, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
+};
+
+static const AotBlock blocks[] = {
+    { 0x0000, Block0000 },
+    { 0x0004, Block0004 },
+    { 0x0008, Block0008 },
+    { 0x000c, Block000c },
+    { 0x0010, Block0010 },
+    { 0x0014, Block0014 },
+    { 0x0018, Block0018 },
+    { 0x001c, Block001c },
+    { 0x0020, Block0020 },
+    { 0x0024, Block0024 },
+    { 0x0028, Block0028 },
+    { 0x002c, Block002c },
+    { 0x0030, Block0030 },
+    { 0x0034, Block0034 },
+    { 0x0038, Block0038 },
+    { 0x003c, Block003c },
+    { 0x0040, Block0040 },
+    { 0x0044, Block0044 },
+    { 0x0048, Block0048 },
+    { 0x004c, Block004c },
+    { 0x0050, Block0050 },
+    { 0x0054, Block0054 },
+    { 0x0058, Block0058 },
+    { 0x005c, Block005c },
+    { 0x0060, Block0060 },
+    { 0x0064, Block0064 },
+    { 0x0068, Block0068 },
+    { 0x006c, Block006c },
+    { 0x0070, Block0070 },
+    { 0x0074, Block0074 },
+    { 0x0078, Block0078 },
+    { 0x007c, Block007c },
+    { 0x0080, Block0080 },
+    { 0x0084, Block0084 },
+    { 0x0088, Block0088 },
+    { 0x008c, Block008c },
+    { 0x0090, Block0090 },
+    { 0x0094, Block0094 },
+    { 0x0098, Block0098 },
+    { 0x009c, Block009c },
+    { 0x00a0, Block00a0 },
+    { 0x00a4, Block00a4 },
+    { 0x00a8, Block00a8 },
+    { 0x00ac, Block00ac },
+    { 0x00b0, Block00b0 },
+    { 0x00b4, Block00b4 },
+    { 0x00b8, Block00b8 },
+    { 0x00bc, Block00bc },
+    { 0x00c0, Block00c0 },
+    { 0x00c4, Block00c4 },
+    { 0x00c8, Block00c8 },
+    { 0x00cc, Block00cc },
+    { 0x00d0, Block00d0 },
+    { 0x00d4, Block00d4 },
+    { 0x00d8, Block00d8 },
+    { 0x00dc, Block00dc },
+    { 0x00e0, Block00e0 },
+    { 0x00e4, Block00e4 },
+    { 0x00e8, Block00e8 },
+    { 0x00ec, Block00ec },
+    { 0x00f0, Block00f0 },
+    { 0x00f4, Block00f4 },
+    { 0x00f8, Block00f8 },
+    { 0x00fc, Block00fc },
+    { 0x0100, Block0100 },
+    { 0x0104, Block0104 },
+    { 0x0108, Block0108 },
+    { 0x010c, Block010c },
+    { 0x0110, Block0110 },
+    { 0x0114, Block0114 },
+    { 0x0118, Block0118 },
+    { 0x011c, Block011c },
+    { 0x0120, Block0120 },
+    { 0x0124, Block0124 },
+    { 0x0128, Block0128 },
+    { 0x012c, Block012c },
+    { 0x0130, Block0130 },
+    { 0x0134, Block0134 },
+    { 0x0138, Block0138 },
+    { 0x013c, Block013c },
+    { 0x0144, Block0144 },
+    { 0x0148, Block0148 },
+    { 0x014c, Block014c },
+    { 0x0150, Block0150 },
+    { 0x0154, Block0154 },
+    { 0x0158, Block0158 },
+    { 0x015c, Block015c },
+    { 0x0160, Block0160 },
+    { 0x0164, Block0164 },
+    { 0x0168, Block0168 },
+    { 0x016c, Block016c },
+    { 0x0170, Block0170 },
+    { 0x0174, Block0174 },
+    { 0x0178, Block0178 },
+    { 0x017c, Block017c },
+    { 0x0180, Block0180 },
+    { 0x0184, Block0184 },
+    { 0x0188, Block0188 },
+    { 0x018c, Block018c },
+    { 0x0190, Block0190 },
+    { 0x0194, Block0194 },
+    { 0x0198, Block0198 },
+    { 0x019c, Block019c },
+    { 0x01a0, Block01a0 },
+    { 0x01a4, Block01a4 },
+    { 0x01a8, Block01a8 },
+    { 0x01ac, Block01ac },
+    { 0x01b0, Block01b0 },
+    { 0x01b4, Block01b4 },
+    { 0x01b8, Block01b8 },
+    { 0x01bc, Block01bc },
+    { 0x01c0, Block01c0 },
+    { 0x01c4, Block01c4 },
+    { 0x01c8, Block01c8 },
+    { 0x01cc, Block01cc },
+    { 0x01d0, Block01d0 },
+    { 0x01d4, Block01d4 },
+    { 0x01d8, Block01d8 },
+    { 0x01dc, Block01dc },
+    { 0x01e0, Block01e0 },
+    { 0x01e4, Block01e4 },
+    { 0x01e8, Block01e8 },
+    { 0x01ec, Block01ec },
+    { 0x01f0, Block01f0 },
+    { 0x01f4, Block01f4 },
+    { 0x01f8, Block01f8 },
+    { 0x01fc, Block01fc },
+    { 0x0200, Block0200 },
+    { 0x0204, Block0204 },
+    { 0x0208, Block0208 },
+    { 0x020c, Block020c },
+    { 0x0210, Block0210 },
+    { 0x0214, Block0214 },
+    { 0x0218, Block0218 },
+    { 0x021c, Block021c },
+    { 0x0220, Block0220 },
+    { 0x0224, Block0224 },
+    { 0x0228, Block0228 },
+    { 0x022c, Block022c },
+    { 0x0230, Block0230 },
+    { 0x0234, Block0234 },
+    { 0x0238, Block0238 },
+    { 0x023c, Block023c },
+    { 0x0240, Block0240 },
+    { 0x0244, Block0244 },
+    { 0x0248, Block0248 },
+    { 0x024c, Block024c },
+    { 0x0250, Block0250 },
+    { 0x0254, Block0254 },
+    { 0x0258, Block0258 },
+    { 0x025c, Block025c },
+    { 0x0260, Block0260 },
+    { 0x0264, Block0264 },
+    { 0x0268, Block0268 },
+    { 0x026c, Block026c },
+    { 0x0270, Block0270 },
+    { 0x0274, Block0274 },
+    { 0x0278, Block0278 },
+    { 0x027c, Block027c },
+    { 0x0280, Block0280 },
+    { 0x0284, Block0284 },
+    { 0x0288, Block0288 },
+    { 0x028c, Block028c },
+    { 0x0290, Block0290 },
+    { 0x0294, Block0294 },
+    { 0x0298, Block0298 },
+    { 0x029c, Block029c },
+    { 0x02a0, Block02a0 },
+    { 0x02a4, Block02a4 },
+    { 0x02a8, Block02a8 },
+    { 0x02ac, Block02ac },
+    { 0x02b0, Block02b0 },
+    { 0x02b4, Block02b4 },
+    { 0x02b8, Block02b8 },
+    { 0x02bc, Block02bc },
+    { 0x02c0, Block02c0 },
+    { 0x02c4, Block02c4 },
+    { 0x02c8, Block02c8 },
+    { 0x02cc, Block02cc },
+    { 0x02d0, Block02d0 },
+    { 0x02d4, Block02d4 },
+    { 0x02d8, Block02d8 },
+    { 0x02dc, Block02dc },
+    { 0x02e0, Block02e0 },
+    { 0x02e4, Block02e4 },
+    { 0x02e8, Block02e8 },
+    { 0x02ec, Block02ec },
+    { 0x02f0, Block02f0 },
+    { 0x02f4, Block02f4 },
+    { 0x02f8, Block02f8 },
+    { 0x02fc, Block02fc },
+    { 0x0300, Block0300 },
+    { 0x0304, Block0304 },
+    { 0x0308, Block0308 },
+    { 0x030c, Block030c },
+    { 0x0310, Block0310 },
+    { 0x0314, Block0314 },
+    { 0x0318, Block0318 },
+    { 0x031c, Block031c },
+    { 0x0320, Block0320 },
+    { 0x0324, Block0324 },
+    { 0x0328, Block0328 },
+    { 0x032c, Block032c },
+    { 0x0330, Block0330 },
+    { 0x0334, Block0334 },
+    { 0x0338, Block0338 },
+    { 0x033c, Block033c },
+    { 0x0340, Block0340 },
+    { 0x0344, Block0344 },
+    { 0x0348, Block0348 },
+    { 0x034c, Block034c },
+    { 0x0350, Block0350 },
+    { 0x0354, Block0354 },
+    { 0x0358, Block0358 },
+    { 0x035c, Block035c },
+    { 0x0360, Block0360 },
+    { 0x0364, Block0364 },
+    { 0x0368, Block0368 },
+    { 0x036c, Block036c },
+    { 0x0370, Block0370 },
+    { 0x0374, Block0374 },
+    { 0x0378, Block0378 },
+    { 0x037c, Block037c },
+    { 0x0380, Block0380 },
+    { 0x0384, Block0384 },
+    { 0x0388, Block0388 },
+    { 0x038c, Block038c },
+    { 0x0390, Block0390 },
+    { 0x0394, Block0394 },
+    { 0x0398, Block0398 },
+    { 0x039c, Block039c },
+    { 0x03a0, Block03a0 },
+    { 0x03a4, Block03a4 },
+    { 0x03a8, Block03a8 },
+    { 0x03ac, Block03ac },
+    { 0x03b0, Block03b0 },
+    { 0x03b4, Block03b4 },
+    { 0x03b8, Block03b8 },
+    { 0x03bc, Block03bc },
+    { 0x03c0, Block03c0 },
+    { 0x03c4, Block03c4 },
+    { 0x03c8, Block03c8 },
+    { 0x03cc, Block03cc },
+    { 0x03d0, Block03d0 },
+    { 0x03d4, Block03d4 },
+    { 0x03d8, Block03d8 },
+    { 0x03dc, Block03dc },
+    { 0x03e0, Block03e0 },
+    { 0x03e4, Block03e4 },
+    { 0x03e8, Block03e8 },
+    { 0x03ec, Block03ec },
+    { 0x03f0, Block03f0 },
+    { 0x03f4, Block03f4 },
+    { 0x03f8, Block03f8 },
+    { 0x03fc, Block03fc },
+    { 0x0400, Block0400 },
+    { 0x0404, Block0404 },
+    { 0x0408, Block0408 },
+    { 0x040c, Block040c },
+    { 0x0410, Block0410 },
+    { 0x0414, Block0414 },
+    { 0x0418, Block0418 },
+    { 0x041c, Block041c },
+    { 0x0420, Block0420 },
+    { 0x0424, Block0424 },
+    { 0x0428, Block0428 },
+    { 0x042c, Block042c },
+    { 0x0430, Block0430 },
+    { 0x0434, Block0434 },
+    { 0x0438, Block0438 },
+    { 0x043c, Block043c },
+    { 0x0440, Block0440 },
+    { 0x0444, Block0444 },
+    { 0x0448, Block0448 },
+    { 0x044c, Block044c },
+    { 0x0450, Block0450 },
+    { 0x0454, Block0454 },
+    { 0x0458, Block0458 },
+    { 0x045c, Block045c },
+    { 0x0460, Block0460 },
+    { 0x0464, Block0464 },
+    { 0x0468, Block0468 },
+    { 0x046c, Block046c },
+    { 0x0470, Block0470 },
+    { 0x0474, Block0474 },
+    { 0x0478, Block0478 },
+    { 0x047c, Block047c },
+};
+
+extern const AotProgram alu_aot;
+const AotProgram alu_aot = { 0x0000, 0x0500, image, blocks, sizeof(blocks) / sizeof(blocks[0]) };
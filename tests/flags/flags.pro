@@ -0,0 +1,11 @@
+include(../core.pri)
+
+TARGET = tst_flags
+TEMPLATE = app
+
+SOURCES += \
+    tst_flags.cpp \
+    aluaot.cpp
+
+DISTFILES += \
+    genaluimage.py
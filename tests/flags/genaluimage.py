@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+#
+# Generates aluaot.cpp, the test image of tst_flags.cpp recompiled by
+# tools/recompilerom.py, so that the static engine runs every ALU
+# instruction from recompiled code like the others run it from memory.
+#
+# The image is a row of 4 byte slots from $0000, each holding one
+# instruction, its immediate if it has one, and HLT in the remaining
+# bytes. HLT fills the rest of the image. Immediate instructions get a
+# slot for each value in IMMEDIATES, the recompiled code has them built
+# in.
+#
+# Usage: tests/flags/genaluimage.py [output]
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "..", "tools"))
+
+import recompilerom
+
+HLT = 0x76
+
+REGISTER_OPS = (
+    list(range(0x80, 0xc0))                                    # ADD to CMP
+    + [op for r in range(8) for op in (0x04 | r << 3, 0x05 | r << 3)]  # INR, DCR
+    + [0x27, 0x07, 0x0f, 0x17, 0x1f, 0x2f, 0x37, 0x3f]         # DAA, rotates, CMA, STC, CMC
+)
+IMMEDIATE_OPS = [0xc6, 0xce, 0xd6, 0xde, 0xe6, 0xee, 0xf6, 0xfe]  # ADI to CPI
+# Nibble edges and both signs, plus a spread over the rest
+IMMEDIATES = sorted(set(range(0x00, 0x100, 0x11)) | {0x01, 0x07, 0x08, 0x0f, 0x10, 0x7f, 0x80, 0xf0, 0xfe})
+
+
+def build_image():
+    slots = [[op] for op in REGISTER_OPS]
+    slots += [[op, imm] for op in IMMEDIATE_OPS for imm in IMMEDIATES]
+
+    size = (len(slots) * 4 + 0xff) & ~0xff
+    image = bytearray([HLT]) * size
+    for i, slot in enumerate(slots):
+        image[i * 4:i * 4 + len(slot)] = bytes(slot)
+    return image, [i * 4 for i in range(len(slots))]
+
+
+def main():
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(HERE, "aluaot.cpp")
+
+    image, entries = build_image()
+    recompilerom.generate(out_path, image, 0x0000, entries, "alu_aot", "tests/flags/genaluimage.py")
+
+
+if __name__ == "__main__":
+    main()
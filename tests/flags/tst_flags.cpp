@@ -0,0 +1,335 @@
+#include <QtTest>
+
+#include "cpu.h"
+#include "i8080aot.h"
+#include "i8080flags.h"
+#include "i8080jit.h"
+
+/*
+ ALU flag conformance
+
+ Checks every entry of the flag tables, see i8080flags.h, and every ALU
+ instruction on every engine against a model of the 8080 that adds one
+ bit at a time through a ripple carry adder. The instructions run one at
+ a time from the slots of the test image, see genaluimage.py, which the
+ static engine runs recompiled as alu_aot.
+
+ Register operands sweep all 256 values against all 256 values of A,
+ with the flags all clear and all set before the instruction. DAA also
+ sweeps CY and AC on their own.
+
+ The logical instructions follow the core: ANA, XRA, ORA and ANI clear
+ CY and AC, XRI and ORI clear CY and leave AC alone.
+*/
+
+// aluaot.cpp, generated by genaluimage.py
+extern const AotProgram alu_aot;
+
+// M operands, outside of the image
+static const uint16_t operand_addr = 0x9000;
+
+// Returns the sum, the carry out of bit 3 in aux and out of bit 7 in carry.
+static uint8_t RippleAdd(uint8_t x, uint8_t y, int carry_in, int *aux, int *carry) {
+    uint8_t sum = 0;
+    int c = carry_in;
+
+    for (int bit = 0; bit < 8; bit++) {
+        int xb = (x >> bit) & 1;
+        int yb = (y >> bit) & 1;
+        sum |= (xb ^ yb ^ c) << bit;
+        c = (xb & yb) | (c & (xb ^ yb));
+        if (bit == 3) {
+            *aux = c;
+        }
+    }
+
+    *carry = c;
+    return sum;
+}
+
+static int ReferenceFlags(uint8_t res, int carry, int aux) {
+    int ones = 0;
+    for (int bit = 0; bit < 8; bit++) {
+        ones += (res >> bit) & 1;
+    }
+
+    return (res == 0 ? FlagZero : 0) |
+           ((res >> 7) ? FlagSign : 0) |
+           ((ones % 2) == 0 ? FlagParity : 0) |
+           (carry ? FlagCarry : 0) |
+           (aux ? FlagAuxCarry : 0);
+}
+
+// What an ALU instruction reads and writes: B, C, D, E, H, L, M and A
+// in the order of the opcode bits, M being the byte at HL, and flags.
+struct State {
+    uint8_t r[8];
+    int flags;
+};
+
+enum { RegH = 4, RegL = 5, RegM = 6, RegA = 7 };
+
+// Executes `op`, with the immediate `imm`, on `s` the way the 8080 does.
+static void Reference(uint8_t op, uint8_t imm, State *s) {
+    uint8_t &a = s->r[RegA];
+    int cy = (s->flags & FlagCarry) ? 1 : 0;
+    int aux = 0, carry = 0;
+    uint8_t res;
+
+    if ((op >= 0x80 && op < 0xc0) || (op & 0xc7) == 0xc6) {
+        uint8_t val = (op < 0xc0) ? s->r[op & 7] : imm;
+        int kind = (op >> 3) & 7;
+        switch (kind) {
+        case 0: // ADD
+        case 1: // ADC
+            res = RippleAdd(a, val, (kind == 1) ? cy : 0, &aux, &carry);
+            break;
+        case 2: // SUB
+        case 3: // SBB
+        case 7: // CMP
+            // Adds the two's complement, CY is the inverted carry out, a borrow
+            res = RippleAdd(a, ~val, (kind == 3) ? !cy : 1, &aux, &carry);
+            carry = !carry;
+            break;
+        case 4: // ANA
+            res = a & val;
+            break;
+        case 5: // XRA
+            res = a ^ val;
+            break;
+        default: // ORA
+            res = a | val;
+            break;
+        }
+        if (op == 0xee || op == 0xf6) {
+            aux = (s->flags & FlagAuxCarry) ? 1 : 0; // XRI and ORI leave AC alone
+        }
+        s->flags = (s->flags & ~ALU_FLAGS) | ReferenceFlags(res, carry, aux);
+        if (kind != 7) {
+            a = res;
+        }
+        return;
+    }
+
+    if ((op & 0xc6) == 0x04) {
+        // INR and DCR leave CY alone, DCR adds the two's complement of 1
+        uint8_t &reg = s->r[(op >> 3) & 7];
+        res = (op & 1) ? RippleAdd(reg, 0xfe, 1, &aux, &carry) : RippleAdd(reg, 1, 0, &aux, &carry);
+        s->flags = (s->flags & ~ALU_FLAGS) | ReferenceFlags(res, cy, aux);
+        reg = res;
+        return;
+    }
+
+    switch (op) {
+    case 0x27: // DAA
+        // The manual's two steps: 6 is added to the low digit if it is above
+        // 9 or AC is set, then to the high digit if that is now above 9 or
+        // CY is set. A carry out of either step sets CY, AC is the carry out
+        // of bit 3 of the first.
+        res = a;
+        if ((res & 0x0f) > 9 || (s->flags & FlagAuxCarry)) {
+            res = RippleAdd(res, 0x06, 0, &aux, &carry);
+            cy |= carry;
+        }
+        if ((res >> 4) > 9 || cy) {
+            int high_aux;
+            res = RippleAdd(res, 0x60, 0, &high_aux, &carry);
+            cy |= carry;
+        }
+        s->flags = (s->flags & ~ALU_FLAGS) | ReferenceFlags(res, cy, aux);
+        a = res;
+        return;
+    case 0x07: // RLC
+        carry = a >> 7;
+        a = (a << 1) | carry;
+        break;
+    case 0x0f: // RRC
+        carry = a & 1;
+        a = (a >> 1) | (carry << 7);
+        break;
+    case 0x17: // RAL
+        carry = a >> 7;
+        a = (a << 1) | cy;
+        break;
+    case 0x1f: // RAR
+        carry = a & 1;
+        a = (a >> 1) | (cy << 7);
+        break;
+    case 0x2f: // CMA
+        a = ~a;
+        return;
+    case 0x37: // STC
+        carry = 1;
+        break;
+    case 0x3f: // CMC
+        carry = !cy;
+        break;
+    }
+    s->flags = (s->flags & ~FlagCarry) | (carry ? FlagCarry : 0);
+}
+
+class TestFlags : public QObject
+{
+    Q_OBJECT
+private slots:
+    void tables();
+    void instructions_data();
+    void instructions();
+};
+
+void TestFlags::tables()
+{
+    int aux, carry;
+    char message[128];
+
+    for (int x = 0; x < 0x100; x++) {
+        if (zsp_flags[x] != (ReferenceFlags(x, 0, 0) & ~FlagAuxCarry)) {
+            qsnprintf(message, sizeof(message), "zsp_flags[%02x] %02x", x, zsp_flags[x]);
+            QFAIL(message);
+        }
+
+        uint8_t res = RippleAdd(x, 1, 0, &aux, &carry);
+        if (inr_flags[res] != ReferenceFlags(res, 0, aux)) {
+            qsnprintf(message, sizeof(message), "inr_flags[%02x] %02x", res, inr_flags[res]);
+            QFAIL(message);
+        }
+        res = RippleAdd(x, 0xfe, 1, &aux, &carry);
+        if (dcr_flags[res] != ReferenceFlags(res, 0, aux)) {
+            qsnprintf(message, sizeof(message), "dcr_flags[%02x] %02x", res, dcr_flags[res]);
+            QFAIL(message);
+        }
+    }
+
+    for (int cy = 0; cy < 2; cy++) {
+        for (int a = 0; a < 0x100; a++) {
+            for (int val = 0; val < 0x100; val++) {
+                uint8_t res = RippleAdd(a, val, cy, &aux, &carry);
+                int expected = ReferenceFlags(res, carry, aux);
+                if (add_flags[cy][a][val] != expected) {
+                    qsnprintf(message, sizeof(message), "add_flags[%d][%02x][%02x] %02x, expected %02x",
+                              cy, a, val, add_flags[cy][a][val], expected);
+                    QFAIL(message);
+                }
+
+                res = RippleAdd(a, ~val, !cy, &aux, &carry);
+                expected = ReferenceFlags(res, !carry, aux);
+                if (sub_flags[cy][a][val] != expected) {
+                    qsnprintf(message, sizeof(message), "sub_flags[%d][%02x][%02x] %02x, expected %02x",
+                              cy, a, val, sub_flags[cy][a][val], expected);
+                    QFAIL(message);
+                }
+            }
+        }
+    }
+}
+
+void TestFlags::instructions_data()
+{
+    QTest::addColumn<int>("engine");
+    QTest::addColumn<bool>("lazy_flags");
+
+    QTest::newRow("table") << (int)CPU::HandlerTableEngine << false;
+    QTest::newRow("switch") << (int)CPU::SwitchEngine << false;
+    QTest::newRow("switch, lazy flags") << (int)CPU::SwitchEngine << true;
+    QTest::newRow("block") << (int)CPU::BlockEngine << false;
+    QTest::newRow("jit") << (int)CPU::JitEngine << false;
+    QTest::newRow("aot") << (int)CPU::StaticEngine << false;
+}
+
+void TestFlags::instructions()
+{
+    QFETCH(int, engine);
+    QFETCH(bool, lazy_flags);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+
+    QMutex mutex;
+    MemoryMap memory;
+    CPU cpu(&mutex, &memory);
+    cpu.engine = (CPU::Engine)engine;
+    cpu.lazy_flags = lazy_flags;
+    cpu.skip_idle_loops = false;
+    cpu.aot_program = &alu_aot;
+    memcpy(memory.data + alu_aot.base, alu_aot.image, alu_aot.size);
+
+    char message[160];
+    int slot_count = 0;
+
+    for (uint16_t pc = alu_aot.base; pc < alu_aot.base + alu_aot.size; pc += 4) {
+        uint8_t op = memory.data[pc];
+        if (op == 0x76) {
+            break; // HLT fills the image after the last slot
+        }
+        const InstructionDef &opcode = i8080_instructions[op];
+        uint8_t imm = (opcode.length > 1) ? memory.data[pc + 1] : 0;
+        slot_count++;
+
+        // The register the sweep goes through, besides A
+        int operand = -1;
+        if (op >= 0x80 && op < 0xc0 && (op & 7) != RegA) {
+            operand = op & 7;
+        } else if ((op & 0xc6) == 0x04) {
+            operand = (op >> 3) & 7;
+        }
+        bool uses_m = (op >= 0x80 && op < 0xc0 && (op & 7) == RegM) || ((op & 0xc6) == 0x04 && operand == RegM);
+        int flag_inputs[4] = { 0, ALU_FLAGS, FlagCarry, FlagAuxCarry };
+        int flag_input_count = (op == 0x27) ? 4 : 2;
+
+        for (int a = 0; a < 0x100; a++) {
+            for (int val = 0; val < ((operand >= 0) ? 0x100 : 1); val++) {
+                for (int i = 0; i < flag_input_count; i++) {
+                    State in = { { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0, (uint8_t)a }, flag_inputs[i] };
+                    if (uses_m) {
+                        in.r[RegH] = operand_addr >> 8;
+                        in.r[RegL] = operand_addr & 0xff;
+                    }
+                    if (operand >= 0) {
+                        in.r[operand] = val;
+                    }
+
+                    cpu.a = in.r[RegA];
+                    cpu.b = in.r[0];
+                    cpu.c = in.r[1];
+                    cpu.d = in.r[2];
+                    cpu.e = in.r[3];
+                    cpu.h = in.r[RegH];
+                    cpu.l = in.r[RegL];
+                    cpu.sp = 0xf000;
+                    cpu.pc = pc;
+                    cpu.flags = (1 << 6) | in.flags;
+                    if (uses_m) {
+                        memory.write(operand_addr, in.r[RegM]);
+                    }
+
+                    int cycles = cpu.run(1);
+
+                    State out = { { cpu.b, cpu.c, cpu.d, cpu.e, cpu.h, cpu.l, 0, cpu.a }, cpu.flags };
+                    if (uses_m) {
+                        out.r[RegM] = memory.read(operand_addr);
+                    }
+                    State expected = in;
+                    expected.flags |= (1 << 6);
+                    Reference(op, imm, &expected);
+
+                    if (memcmp(out.r, expected.r, sizeof(out.r)) || out.flags != expected.flags ||
+                            cpu.pc != pc + opcode.length || cpu.sp != 0xf000 || cycles != opcode.cycles) {
+                        qsnprintf(message, sizeof(message),
+                                  "%s %02x: a=%02x val=%02x flags %02x: a=%02x flags %02x pc %04x cycles %d, "
+                                  "expected a=%02x flags %02x pc %04x cycles %d",
+                                  opcode.mnemonic, imm, a, val, in.flags, out.r[RegA], out.flags, cpu.pc, cycles,
+                                  expected.r[RegA], expected.flags, pc + opcode.length, opcode.cycles);
+                        QFAIL(message);
+                    }
+                }
+            }
+        }
+    }
+
+    QVERIFY(slot_count > 0);
+}
+
+QTEST_APPLESS_MAIN(TestFlags)
+
+#include "tst_flags.moc"
@@ -0,0 +1,11 @@
+include(../core.pri)
+
+TARGET = tst_idle
+TEMPLATE = app
+
+SOURCES += \
+    tst_idle.cpp
+
+# The Space Invaders ROM, at the same resource paths as for the emulator
+RESOURCES += \
+    $$PWD/../../ee.qrc
@@ -0,0 +1,234 @@
+#include <QtTest>
+
+#include "cpu.h"
+#include "i8080jit.h"
+#include "i8080switchengine.h"
+#include "invadersbus.h"
+#include "machine.h"
+#include "romimage.h"
+
+/*
+ Idle loop skipping
+
+ Runs two processors on the same engine, one skipping idle loops and one
+ not, see CPU::skipIdleLoop(), and compares registers, flags, cycles and
+ the storage after every slice. game() runs the Space Invaders ROM set
+ up like a Machine's through the attract mode, whose main loop waits for
+ the interrupts. polling() runs a loop that polls a device, or RAM
+ through a mirror that an event writes, which must not be skipped past
+ a change.
+*/
+
+// Emulated frames per game() run
+static const int frames = 600;
+
+// Engines and their names, for the rows.
+static const char *const engine_names[] = { "table", "switch", "block", "jit", "aot" };
+static const CPU::Engine engines[] = { CPU::HandlerTableEngine, CPU::SwitchEngine, CPU::BlockEngine,
+                                       CPU::JitEngine, CPU::StaticEngine };
+
+struct Session {
+    QMutex mutex;
+    MemoryMap memory;
+    CPU cpu;
+    EE::ShiftRegister shift;
+    TripleBuffer video_frames;
+
+    Session(CPU::Engine engine, bool skip_idle_loops)
+        : cpu(&mutex, &memory), video_frames(EE::video_ram_size) {
+        cpu.a = cpu.b = cpu.c = cpu.d = cpu.e = cpu.h = cpu.l = 0;
+        cpu.flags = 1 << 6;
+        cpu.engine = engine;
+        cpu.switch_engine = RunSwitchEngine<InvadersBus>;
+        cpu.throttled = false;
+        cpu.skip_idle_loops = skip_idle_loops;
+        shift = EE::ShiftRegister();
+        shift.out_port_two = shift.out_port_three = shift.out_port_four_low = shift.out_port_four_high = 0;
+        shift.out_port_five = shift.in_port_one = 0;
+    }
+
+    // Maps the ROM, the mirror, the ports and the screen interrupts as
+    // a Machine does.
+    void setUpMachine(const RomImage *rom) {
+        memory.mapRom(0x0000, rom);
+        memory.mirror(0x4000, 0x10000, 0x2000, 0x2000);
+        memory.trackWrites(EE::video_ram, EE::video_ram_size);
+        cpu.setCallback(0xd3, output_callback);
+        cpu.setCallback(0xdb, input_callback);
+        cpu.addCycleEvent(EE::mid_screen_cycle, EE::cycles_per_frame, mid_screen_interrupt, 0);
+        cpu.addCycleEvent(EE::cycles_per_frame, EE::cycles_per_frame, end_of_screen_interrupt, &video_frames);
+    }
+
+    // The ports are the process's, see output_callback().
+    int run(int cycles) {
+        shift_register_hw = shift;
+        int ran = cpu.run(cycles);
+        shift = shift_register_hw;
+        return ran;
+    }
+};
+
+// Returns a description of the first difference between `skipping` and
+// `interpreted`, or an empty string.
+static QByteArray Compare(const Session &skipping, const Session &interpreted)
+{
+    char message[256];
+    const CPU &s = skipping.cpu, &i = interpreted.cpu;
+    if (s.cycle_count != i.cycle_count || s.pc != i.pc || s.sp != i.sp || s.flags != i.flags ||
+            s.a != i.a || s.b != i.b || s.c != i.c || s.d != i.d || s.e != i.e || s.h != i.h || s.l != i.l) {
+        qsnprintf(message, sizeof(message),
+                  "cycles %llu/%llu pc %04x/%04x sp %04x/%04x flags %x/%x a %02x/%02x "
+                  "bc %02x%02x/%02x%02x de %02x%02x/%02x%02x hl %02x%02x/%02x%02x",
+                  (unsigned long long)s.cycle_count, (unsigned long long)i.cycle_count,
+                  s.pc, i.pc, s.sp, i.sp, s.flags, i.flags, s.a, i.a,
+                  s.b, s.c, i.b, i.c, s.d, s.e, i.d, i.e, s.h, s.l, i.h, i.l);
+        return QByteArray(message);
+    }
+    if (memcmp(skipping.memory.data, interpreted.memory.data, 0x10000)) {
+        int addr = 0;
+        while (skipping.memory.data[addr] == interpreted.memory.data[addr]) {
+            addr++;
+        }
+        qsnprintf(message, sizeof(message), "memory at %04x %02x/%02x",
+                  addr, skipping.memory.data[addr], interpreted.memory.data[addr]);
+        return QByteArray(message);
+    }
+    return QByteArray();
+}
+
+// A status register that reads 0 until it was read `ready` times, then 5.
+struct StatusDevice {
+    int reads;
+    int ready;
+
+    static uint8_t read(void *context, uint16_t addr) {
+        Q_UNUSED(addr);
+        StatusDevice *device = (StatusDevice *)context;
+        return ++device->reads > device->ready ? 5 : 0;
+    }
+};
+
+// Counts the RAM polled through the mirror up, as an interrupt handler
+// would.
+static void CountUp(CPU *processor, void *context)
+{
+    Q_UNUSED(context);
+    processor->memory->write(0x2400, processor->memory->read(0x2400) + 1);
+}
+
+class TestIdle : public QObject
+{
+    Q_OBJECT
+private slots:
+    void game_data();
+    void game();
+    void polling_data();
+    void polling();
+};
+
+void TestIdle::game_data()
+{
+    QTest::addColumn<int>("engine");
+
+    for (int i = 0; i < 5; i++) {
+        QTest::newRow(engine_names[i]) << (int)engines[i];
+    }
+}
+
+void TestIdle::game()
+{
+    QFETCH(int, engine);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+    const RomImage *rom = RomImage::load(QStringList()
+                                         << "://assets/roms/invaders.h"
+                                         << "://assets/roms/invaders.g"
+                                         << "://assets/roms/invaders.f"
+                                         << "://assets/roms/invaders.e");
+    QVERIFY2(rom, "Cannot load the ROM");
+
+    Session skipping((CPU::Engine)engine, true), interpreted((CPU::Engine)engine, false);
+    skipping.setUpMachine(rom);
+    interpreted.setUpMachine(rom);
+
+    // Slices of 1 to 2000 cycles, so that loops are skipped up to every
+    // kind of budget.
+    for (int slice = 0; skipping.cpu.cycle_count < (uint64_t)frames * EE::cycles_per_frame; slice++) {
+        int cycles = 1 + (slice * 7919) % 2000;
+        skipping.run(cycles);
+        interpreted.run(cycles);
+        QByteArray failure = Compare(skipping, interpreted);
+        if (!failure.isEmpty()) {
+            char message[320];
+            qsnprintf(message, sizeof(message), "slice %d, frame %d: %s", slice,
+                      (int)(skipping.cpu.cycle_count / EE::cycles_per_frame), failure.constData());
+            QFAIL(message);
+        }
+    }
+    QVERIFY(skipping.cpu.idle_cycles > 0);
+}
+
+void TestIdle::polling_data()
+{
+    QTest::addColumn<int>("engine");
+    QTest::addColumn<bool>("mirror");
+
+    // Not the static engine, it only runs the ROM.
+    for (int i = 0; i < 4; i++) {
+        char name[32];
+        qsnprintf(name, sizeof(name), "%s, device", engine_names[i]);
+        QTest::newRow(name) << (int)engines[i] << false;
+        qsnprintf(name, sizeof(name), "%s, mirror", engine_names[i]);
+        QTest::newRow(name) << (int)engines[i] << true;
+    }
+}
+
+void TestIdle::polling()
+{
+    QFETCH(int, engine);
+    QFETCH(bool, mirror);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+
+    // LDA $2400 or $6400, CPI 5, JNZ back, then HLT, at $1000
+    const uint8_t program[] = { 0x3a, 0x00, (uint8_t)(mirror ? 0x64 : 0x24), 0xfe, 0x05, 0xc2, 0x00, 0x10, 0x76 };
+    Session skipping((CPU::Engine)engine, true), interpreted((CPU::Engine)engine, false);
+    StatusDevice devices[2] = { { 0, 50 }, { 0, 50 } };
+    Session *sessions[2] = { &skipping, &interpreted };
+    for (int s = 0; s < 2; s++) {
+        MemoryMap &memory = sessions[s]->memory;
+        memcpy(memory.data + 0x1000, program, sizeof(program));
+        if (mirror) {
+            memory.mirror(0x6400, 0x6500, 0x2400, 0x100);
+            sessions[s]->cpu.addCycleEvent(1000, 1000, CountUp, 0);
+        } else {
+            memory.mapDevice(0x2400, 0x100, StatusDevice::read, 0, &devices[s]);
+        }
+        sessions[s]->cpu.pc = 0x1000;
+        sessions[s]->cpu.sp = 0x2300;
+    }
+
+    for (int slice = 0; slice < 200 && (interpreted.cpu.flags & (1 << 6)); slice++) {
+        skipping.run(100);
+        interpreted.run(100);
+        QByteArray failure = Compare(skipping, interpreted);
+        char message[320];
+        if (!failure.isEmpty()) {
+            qsnprintf(message, sizeof(message), "slice %d: %s", slice, failure.constData());
+            QFAIL(message);
+        }
+        if (devices[0].reads != devices[1].reads) {
+            qsnprintf(message, sizeof(message), "slice %d: device reads %d/%d", slice, devices[0].reads, devices[1].reads);
+            QFAIL(message);
+        }
+    }
+    QCOMPARE((int)interpreted.cpu.pc, 0x1009);
+}
+
+QTEST_APPLESS_MAIN(TestIdle)
+
+#include "tst_idle.moc"
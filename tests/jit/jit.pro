@@ -0,0 +1,7 @@
+include(../core.pri)
+
+TARGET = tst_jit
+TEMPLATE = app
+
+SOURCES += \
+    tst_jit.cpp
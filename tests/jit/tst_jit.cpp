@@ -0,0 +1,264 @@
+#include <QtTest>
+
+#include <random>
+
+#include "cpu.h"
+#include "i8080jit.h"
+
+/*
+ JIT against the interpreter
+
+ Runs the same code on a JitEngine processor and on a handler table
+ processor, each with its own memory, and compares registers, flags,
+ cycles and the whole memory after every slice. mirrorWrites() runs on
+ the block engine too, readWatchpoints() stops both processors on a
+ watched read. Code runs more often
+ than the JIT's hot threshold from the same address, so that the later
+ slices run translated code.
+*/
+
+// Runs from the same address, enough for the JIT to translate the block
+static const int warm_runs = 16;
+
+struct Pair {
+    QMutex reference_mutex, jit_mutex;
+    MemoryMap reference_memory, jit_memory;
+    CPU reference, jit;
+
+    Pair() : reference(&reference_mutex, &reference_memory), jit(&jit_mutex, &jit_memory) {
+        reference.skip_idle_loops = false;
+        jit.skip_idle_loops = false;
+        jit.engine = CPU::JitEngine;
+    }
+
+    void load(const uint8_t *image) {
+        memcpy(reference_memory.data, image, 0x10000);
+        memcpy(jit_memory.data, image, 0x10000);
+    }
+
+    void setState(uint16_t pc, uint16_t sp, const uint8_t regs[7], int flags) {
+        for (CPU *cpu : { &reference, &jit }) {
+            cpu->pc = pc;
+            cpu->sp = sp;
+            cpu->a = regs[0];
+            cpu->b = regs[1];
+            cpu->c = regs[2];
+            cpu->d = regs[3];
+            cpu->e = regs[4];
+            cpu->h = regs[5];
+            cpu->l = regs[6];
+            cpu->flags = flags;
+        }
+    }
+
+    // Runs both for `cycles`, returns a description of the first
+    // difference, or an empty string.
+    QByteArray run(int cycles) {
+        int reference_cycles = reference.run(cycles);
+        int jit_cycles = jit.run(cycles);
+
+        char message[256];
+        const CPU &r = reference, &j = jit;
+        if (reference_cycles != jit_cycles || r.pc != j.pc || r.sp != j.sp || r.flags != j.flags ||
+                r.a != j.a || r.b != j.b || r.c != j.c || r.d != j.d || r.e != j.e || r.h != j.h || r.l != j.l) {
+            qsnprintf(message, sizeof(message),
+                      "cycles %d/%d pc %04x/%04x sp %04x/%04x flags %x/%x a %02x/%02x "
+                      "bc %02x%02x/%02x%02x de %02x%02x/%02x%02x hl %02x%02x/%02x%02x",
+                      reference_cycles, jit_cycles, r.pc, j.pc, r.sp, j.sp, r.flags, j.flags, r.a, j.a,
+                      r.b, r.c, j.b, j.c, r.d, r.e, j.d, j.e, r.h, r.l, j.h, j.l);
+            return QByteArray(message);
+        }
+        if (memcmp(reference_memory.data, jit_memory.data, 0x10000)) {
+            int addr = 0;
+            while (reference_memory.data[addr] == jit_memory.data[addr]) {
+                addr++;
+            }
+            qsnprintf(message, sizeof(message), "memory at %04x %02x/%02x",
+                      addr, reference_memory.data[addr], jit_memory.data[addr]);
+            return QByteArray(message);
+        }
+        return QByteArray();
+    }
+};
+
+class TestJit : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void pushBounds_data();
+    void pushBounds();
+    void mirrorWrites_data();
+    void mirrorWrites();
+    void readWatchpoints_data();
+    void readWatchpoints();
+    void randomCode();
+};
+
+void TestJit::init()
+{
+    if (!Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+}
+
+void TestJit::pushBounds_data()
+{
+    QTest::addColumn<int>("op");
+    QTest::addColumn<int>("sp");
+
+    // Below, at and above both bounds of safe memory, $2000-$3FFF, and
+    // where SP - 2 or SP - 1 wraps.
+    const int stack_pointers[] = { 0x0000, 0x0001, 0x0002, 0x1fff, 0x2000, 0x2001, 0x2002,
+                                   0x3fff, 0x4000, 0x4001, 0x4002, 0xffff };
+    const int ops[] = { 0xc5, 0xd5, 0xe5 };
+    for (int op : ops) {
+        for (int sp : stack_pointers) {
+            char name[32];
+            qsnprintf(name, sizeof(name), "%02x sp %04x", op, sp);
+            QTest::newRow(name) << op << sp;
+        }
+    }
+}
+
+void TestJit::pushBounds()
+{
+    QFETCH(int, op);
+    QFETCH(int, sp);
+
+    // PUSH, then HLT, at $1000
+    static uint8_t image[0x10000];
+    memset(image, 0, sizeof(image));
+    image[0x1000] = op;
+    image[0x1001] = 0x76;
+
+    Pair pair;
+    pair.load(image);
+    const uint8_t regs[7] = { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde };
+
+    // Translated at a safe SP, then pushed at `sp`
+    for (int run = 0; run <= warm_runs; run++) {
+        pair.setState(0x1000, (run < warm_runs) ? 0x3000 : sp, regs, 1 << 6);
+        QByteArray failure = pair.run(i8080_instructions[op].cycles);
+        QVERIFY2(failure.isEmpty(), failure.constData());
+    }
+}
+
+void TestJit::mirrorWrites_data()
+{
+    QTest::addColumn<int>("engine");
+
+    QTest::newRow("block") << (int)CPU::BlockEngine;
+    QTest::newRow("jit") << (int)CPU::JitEngine;
+}
+
+// Code in RAM overwritten through the mirror at $4000-, as the machine
+// maps it, is translated again.
+void TestJit::mirrorWrites()
+{
+    QFETCH(int, engine);
+
+    // INR B, then STA $4000 over it, then HLT, at $2000
+    static uint8_t image[0x10000];
+    memset(image, 0, sizeof(image));
+    const uint8_t code[] = { 0x04, 0x32, 0x00, 0x40, 0x76 };
+    memcpy(image + 0x2000, code, sizeof(code));
+
+    Pair pair;
+    pair.jit.engine = (CPU::Engine)engine;
+    pair.load(image);
+    pair.reference_memory.mirror(0x4000, 0x10000, 0x2000, 0x2000);
+    pair.jit_memory.mirror(0x4000, 0x10000, 0x2000, 0x2000);
+
+    // A alternates between INR B and INR C, each run stores the other.
+    for (int run = 0; run <= 2 * warm_runs; run++) {
+        const uint8_t regs[7] = { (uint8_t)((run & 1) ? 0x04 : 0x0c), 0, 0, 0, 0, 0, 0 };
+        pair.setState(0x2000, 0x3000, regs, 1 << 6);
+        QByteArray failure = pair.run(100);
+        if (!failure.isEmpty()) {
+            char message[320];
+            qsnprintf(message, sizeof(message), "run %d: %s", run, failure.constData());
+            QFAIL(message);
+        }
+    }
+}
+
+void TestJit::readWatchpoints_data()
+{
+    QTest::addColumn<int>("op");
+    QTest::addColumn<int>("watched");
+
+    QTest::newRow("XTHL low") << 0xe3 << 0x3000;
+    QTest::newRow("XTHL high") << 0xe3 << 0x3001;
+    QTest::newRow("INR M") << 0x34 << 0x3100;
+    QTest::newRow("DCR M") << 0x35 << 0x3100;
+}
+
+// Instructions that read and write memory stop on a watchpoint for
+// reads only, after translation.
+void TestJit::readWatchpoints()
+{
+    QFETCH(int, op);
+    QFETCH(int, watched);
+
+    // The instruction, then HLT, at $1000, SP at $3000 and HL at $3100
+    static uint8_t image[0x10000];
+    memset(image, 0, sizeof(image));
+    image[0x1000] = op;
+    image[0x1001] = 0x76;
+
+    Pair pair;
+    pair.load(image);
+    const uint8_t regs[7] = { 0x12, 0x34, 0x56, 0x78, 0x9a, 0x31, 0x00 };
+
+    for (int run = 0; run <= warm_runs; run++) {
+        if (run == warm_runs) {
+            pair.reference.addWatchpoint(watched, 1, MemoryMap::WatchRead);
+            pair.jit.addWatchpoint(watched, 1, MemoryMap::WatchRead);
+        }
+        pair.setState(0x1000, 0x3000, regs, 1 << 6);
+        QByteArray failure = pair.run(i8080_instructions[op].cycles);
+        QVERIFY2(failure.isEmpty(), failure.constData());
+    }
+    QVERIFY(!(pair.jit.flags & (1 << 6)));
+    QCOMPARE((int)pair.jit.pc, 0x1001);
+}
+
+void TestJit::randomCode()
+{
+    std::mt19937 random(8080);
+    static uint8_t image[0x10000];
+
+    for (int trial = 0; trial < 500; trial++) {
+        for (int addr = 0; addr < 0x10000; addr++) {
+            image[addr] = random();
+        }
+        uint16_t pc = random();
+        uint16_t sp = random();
+        uint8_t regs[7];
+        for (int i = 0; i < 7; i++) {
+            regs[i] = random();
+        }
+        // ALU flags and interrupt enable. Diagnostic mode would not run
+        // on the engine, see CPU::Mode.
+        int flags = (random() & 0x3f) | (1 << 6);
+        int cycles = 1 + random() % 300;
+
+        Pair pair;
+        pair.load(image);
+        for (int run = 0; run <= warm_runs; run++) {
+            pair.setState(pc, sp, regs, flags);
+            QByteArray failure = pair.run(cycles);
+            if (!failure.isEmpty()) {
+                char message[400];
+                qsnprintf(message, sizeof(message), "trial %d from %04x, %d cycles, run %d: %s",
+                          trial, pc, cycles, run, failure.constData());
+                QFAIL(message);
+            }
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestJit)
+
+#include "tst_jit.moc"
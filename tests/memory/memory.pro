@@ -0,0 +1,7 @@
+include(../core.pri)
+
+TARGET = tst_memory
+TEMPLATE = app
+
+SOURCES += \
+    tst_memory.cpp
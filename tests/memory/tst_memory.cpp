@@ -0,0 +1,369 @@
+#include <QtTest>
+
+#include "cpu.h"
+#include "i8080jit.h"
+
+/*
+ Memory map
+
+ Checks the copy-on-write rules of MemorySnapshot: writes through a
+ mirror, snapshots sharing pages with each other, ROM, and restores
+ reaching pre-decoded and translated code and the dirty bits. Then the
+ devices of mapDevice(): which one of several takes an access, the rest
+ of their pages, and every engine reaching them.
+*/
+
+// Runs from the same address, enough for the JIT to translate the block
+static const int warm_runs = 16;
+
+// ROM at $0000-$1FFF and $4000- mirroring the RAM, as a Machine maps it.
+static void MapLikeMachine(MemoryMap *memory)
+{
+    for (int addr = 0; addr < 0x2000; addr++) {
+        memory->data[addr] = addr >> 8;
+    }
+    memory->mapRom(0x0000, 0x2000);
+    memory->mirror(0x4000, 0x10000, 0x2000, 0x2000);
+}
+
+// A device that answers reads with its tag and the low address byte and
+// logs its writes.
+struct TestDevice {
+    uint8_t tag;
+    int reads;
+    QVector<QPair<uint16_t, uint8_t> > writes;
+
+    explicit TestDevice(uint8_t tag) : tag(tag), reads(0) {}
+
+    static uint8_t read(void *context, uint16_t addr) {
+        TestDevice *device = (TestDevice *)context;
+        device->reads++;
+        return device->tag | (addr & 0x0f);
+    }
+    static void write(void *context, uint16_t addr, uint8_t val) {
+        ((TestDevice *)context)->writes.append(qMakePair(addr, val));
+    }
+};
+
+class TestMemory : public QObject
+{
+    Q_OBJECT
+private slots:
+    void snapshotMirrorWrite();
+    void overlappingSnapshots_data();
+    void overlappingSnapshots();
+    void romNeverCopied();
+    void restoreCode_data();
+    void restoreCode();
+    void restoreDirty();
+    void devicePrecedence();
+    void partialPageDevices();
+    void enginesReachDevices_data();
+    void enginesReachDevices();
+};
+
+// A write through the mirror copies the page it reaches for the snapshot.
+void TestMemory::snapshotMirrorWrite()
+{
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+    memory.write(0x2100, 0x11);
+
+    MemorySnapshot snapshot(&memory);
+    QCOMPARE(snapshot.copiedPages(), 0);
+    memory.write(0x6100, 0x22);
+    memory.write(0xe101, 0x23);
+    QCOMPARE((int)memory.read(0x2100), 0x22);
+    QCOMPARE((int)memory.read(0x2101), 0x23);
+    QCOMPARE((int)snapshot.read(0x2100), 0x11);
+    QCOMPARE((int)snapshot.read(0x2101), 0x00);
+    QCOMPARE(snapshot.copiedPages(), 1);
+
+    memory.restore(&snapshot);
+    QCOMPARE((int)memory.read(0x2100), 0x11);
+    QCOMPARE((int)memory.read(0x6100), 0x11);
+    QCOMPARE((int)memory.read(0xe101), 0x00);
+    QCOMPARE(snapshot.copiedPages(), 0);
+
+    // Shared again, the next write copies the page again.
+    memory.write(0x6100, 0x33);
+    QCOMPARE(snapshot.copiedPages(), 1);
+    QCOMPARE((int)snapshot.read(0x2100), 0x11);
+    memory.restore(&snapshot);
+    QCOMPARE((int)memory.read(0x2100), 0x11);
+}
+
+void TestMemory::overlappingSnapshots_data()
+{
+    QTest::addColumn<bool>("older_first");
+
+    QTest::newRow("older first") << true;
+    QTest::newRow("newer first") << false;
+}
+
+// Two snapshots sharing pages, restored in either order, each restore
+// copying the pages the other one still shares.
+void TestMemory::overlappingSnapshots()
+{
+    QFETCH(bool, older_first);
+
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+    memory.write(0x2000, 1);
+
+    MemorySnapshot older(&memory);
+    memory.write(0x2000, 2);
+    memory.write(0x2200, 2);
+    MemorySnapshot newer(&memory);
+    memory.write(0x2000, 3);
+    memory.write(0x2300, 3);
+
+    // $2000, $2200 and $2300 in each snapshot
+    const uint16_t addrs[3] = { 0x2000, 0x2200, 0x2300 };
+    const int older_values[3] = { 1, 0, 0 };
+    const int newer_values[3] = { 2, 2, 0 };
+    MemorySnapshot *snapshots[2] = { &older, &newer };
+    const int *values[2] = { older_values, newer_values };
+    static uint8_t storage[0x10000];
+
+    for (int round = 0; round < 2; round++) {
+        int restored = (round == 0) == older_first ? 0 : 1;
+        memory.restore(snapshots[restored]);
+        for (int s = 0; s < 2; s++) {
+            snapshots[s]->copy(storage);
+            for (int i = 0; i < 3; i++) {
+                if (s == restored) {
+                    QCOMPARE((int)memory.read(addrs[i]), values[s][i]);
+                }
+                QCOMPARE((int)snapshots[s]->read(addrs[i]), values[s][i]);
+                QCOMPARE((int)storage[addrs[i]], values[s][i]);
+            }
+        }
+        memory.write(0x2000, 4);
+    }
+}
+
+// Writes to ROM are dropped, so its pages are never copied.
+void TestMemory::romNeverCopied()
+{
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+
+    MemorySnapshot snapshot(&memory);
+    for (int addr = 0; addr < 0x2000; addr += 0x80) {
+        memory.write(addr, 0xaa);
+    }
+    QCOMPARE(snapshot.copiedPages(), 0);
+    memory.write(0x2000, 0xaa);
+    QCOMPARE(snapshot.copiedPages(), 1);
+    for (int addr = 0; addr < 0x2000; addr += 0x80) {
+        QCOMPARE((int)memory.read(addr), addr >> 8);
+    }
+}
+
+void TestMemory::restoreCode_data()
+{
+    QTest::addColumn<int>("engine");
+
+    QTest::newRow("block") << (int)CPU::BlockEngine;
+    QTest::newRow("jit") << (int)CPU::JitEngine;
+}
+
+// Code restored by a snapshot runs as restored, not as it was decoded or
+// translated before.
+void TestMemory::restoreCode()
+{
+    QFETCH(int, engine);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+    QMutex mutex;
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+    CPU cpu(&mutex, &memory);
+    cpu.engine = (CPU::Engine)engine;
+    cpu.skip_idle_loops = false;
+
+    // INR A, then HLT, at $2000
+    memory.write(0x2000, 0x3c);
+    memory.write(0x2001, 0x76);
+    MemorySnapshot snapshot(&memory);
+
+    // DCR A, run until it is translated
+    memory.write(0x6000, 0x3d);
+    for (int run = 0; run < warm_runs; run++) {
+        cpu.pc = 0x2000;
+        cpu.a = 0;
+        cpu.flags = 1 << 6;
+        cpu.run(100);
+        QCOMPARE((int)cpu.a, 0xff);
+    }
+
+    memory.restore(&snapshot);
+    cpu.pc = 0x2000;
+    cpu.a = 0;
+    cpu.flags = 1 << 6;
+    cpu.run(100);
+    QCOMPARE((int)cpu.a, 0x01);
+}
+
+// Bytes a restore changes in tracked pages are dirty, the others are not.
+void TestMemory::restoreDirty()
+{
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+    memory.trackWrites(0x2400, 0x100);
+    uint64_t bits[4];
+    memory.takeDirty(0x2400, 0x100, bits);
+
+    MemorySnapshot snapshot(&memory);
+    memory.write(0x6440, 0x55);
+    memory.write(0x6441, 0x00);
+    memory.takeDirty(0x2400, 0x100, bits);
+    memory.restore(&snapshot);
+    memory.takeDirty(0x2400, 0x100, bits);
+    QCOMPARE(bits[0], (uint64_t)0);
+    QCOMPARE(bits[1], (uint64_t)1);
+    QCOMPARE(bits[2] | bits[3], (uint64_t)0);
+}
+
+// A device mapped later over part of an earlier one takes its addresses.
+void TestMemory::devicePrecedence()
+{
+    MemoryMap memory;
+    TestDevice earlier(0x10), later(0x20);
+    memory.mapDevice(0x3000, 0x100, TestDevice::read, TestDevice::write, &earlier);
+    memory.mapDevice(0x3040, 0x20, TestDevice::read, TestDevice::write, &later);
+
+    QCOMPARE((int)memory.read(0x303f), 0x1f);
+    QCOMPARE((int)memory.read(0x3040), 0x20);
+    QCOMPARE((int)memory.read(0x305f), 0x2f);
+    QCOMPARE((int)memory.read(0x3060), 0x10);
+    memory.write(0x3041, 0x01);
+    memory.write(0x3061, 0x02);
+    QCOMPARE(later.writes.size(), 1);
+    QCOMPARE((int)later.writes[0].first, 0x3041);
+    QCOMPARE(earlier.writes.size(), 1);
+    QCOMPARE((int)earlier.writes[0].first, 0x3061);
+
+    // Mapping the page again drops both.
+    memory.mapRam(0x3000, 0x100);
+    memory.write(0x3041, 0x03);
+    QCOMPARE((int)memory.read(0x3041), 0x03);
+    QCOMPARE(later.writes.size(), 1);
+}
+
+// The addresses of a device's pages it does not cover reach the pages'
+// ROM, RAM or mirror.
+void TestMemory::partialPageDevices()
+{
+    MemoryMap memory;
+    MapLikeMachine(&memory);
+    TestDevice rom_device(0x10), ram_device(0x20), mirror_device(0x30);
+    memory.mapDevice(0x1010, 0x10, TestDevice::read, TestDevice::write, &rom_device);
+    memory.mapDevice(0x2010, 0x10, TestDevice::read, TestDevice::write, &ram_device);
+    memory.mapDevice(0x6020, 0x10, TestDevice::read, TestDevice::write, &mirror_device);
+
+    QCOMPARE((int)memory.read(0x100f), 0x10);
+    QCOMPARE((int)memory.read(0x1010), 0x10);
+    QCOMPARE((int)memory.read(0x1020), 0x10);
+    memory.write(0x1020, 0xaa);
+    QCOMPARE((int)memory.read(0x1020), 0x10);
+    QCOMPARE((int)memory.data[0x1020], 0x10);
+
+    memory.write(0x2000, 0x55);
+    memory.write(0x2010, 0x66);
+    memory.write(0x6020, 0x77);
+    memory.write(0x6030, 0x88);
+    QCOMPARE((int)memory.data[0x2000], 0x55);
+    QCOMPARE((int)memory.data[0x2010], 0x00);
+    QCOMPARE((int)memory.data[0x2020], 0x00);
+    QCOMPARE((int)memory.data[0x2030], 0x88);
+    QCOMPARE((int)memory.read(0x2010), 0x20);
+    QCOMPARE((int)memory.read(0x6010), 0x00);
+    QCOMPARE((int)memory.read(0x2020), 0x00);
+    QCOMPARE((int)memory.read(0x6021), 0x31);
+    QCOMPARE((int)memory.read(0x6030), 0x88);
+    QCOMPARE(ram_device.writes.size(), 1);
+    QCOMPARE(mirror_device.writes.size(), 1);
+}
+
+void TestMemory::enginesReachDevices_data()
+{
+    QTest::addColumn<int>("engine");
+
+    QTest::newRow("table") << (int)CPU::HandlerTableEngine;
+    QTest::newRow("switch") << (int)CPU::SwitchEngine;
+    QTest::newRow("block") << (int)CPU::BlockEngine;
+    QTest::newRow("jit") << (int)CPU::JitEngine;
+}
+
+// Code reading and writing a device on its own page, and on the second
+// half of the code's page, through every kind of access. Run often
+// enough to be translated, every run reaches the devices.
+void TestMemory::enginesReachDevices()
+{
+    QFETCH(int, engine);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+    static const uint8_t program[] = {
+        0x3a, 0x01, 0x30,   // LDA $3001
+        0x47,               // MOV B,A
+        0x21, 0x82, 0x20,   // LXI H,$2082
+        0x4e,               // MOV C,M
+        0x86,               // ADD M
+        0x11, 0x03, 0x30,   // LXI D,$3003
+        0x1a,               // LDAX D
+        0x2a, 0x04, 0x30,   // LHLD $3004
+        0x57,               // MOV D,A
+        0x32, 0x06, 0x30,   // STA $3006
+        0x21, 0x87, 0x20,   // LXI H,$2087
+        0x36, 0x99,         // MVI M,$99
+        0x34,               // INR M
+        0x70,               // MOV M,B
+        0x76                // HLT
+    };
+    QMutex mutex;
+    MemoryMap memory;
+    CPU cpu(&mutex, &memory);
+    cpu.engine = (CPU::Engine)engine;
+    cpu.skip_idle_loops = false;
+    memcpy(memory.data + 0x2000, program, sizeof(program));
+    TestDevice own_page(0x10), code_page(0x20);
+    memory.mapDevice(0x3000, 0x100, TestDevice::read, TestDevice::write, &own_page);
+    memory.mapDevice(0x2080, 0x80, TestDevice::read, TestDevice::write, &code_page);
+
+    for (int run = 0; run < warm_runs; run++) {
+        own_page.reads = code_page.reads = 0;
+        own_page.writes.clear();
+        code_page.writes.clear();
+        cpu.pc = 0x2000;
+        cpu.flags = 1 << 6;
+        cpu.run(1000);
+
+        QCOMPARE((int)cpu.pc, 0x2000 + (int)sizeof(program));
+        QCOMPARE((int)cpu.b, 0x11);
+        QCOMPARE((int)cpu.c, 0x22);
+        QCOMPARE((int)cpu.a, 0x13);
+        QCOMPARE((int)cpu.d, 0x13);
+        QCOMPARE((int)cpu.l, 0x87);
+        QCOMPARE(own_page.reads, 4);
+        QCOMPARE(code_page.reads, 3);
+        QCOMPARE(own_page.writes.size(), 1);
+        QCOMPARE((int)own_page.writes[0].first, 0x3006);
+        QCOMPARE((int)own_page.writes[0].second, 0x13);
+        QCOMPARE(code_page.writes.size(), 3);
+        QCOMPARE((int)code_page.writes[0].second, 0x99);
+        QCOMPARE((int)code_page.writes[1].second, 0x28);
+        QCOMPARE((int)code_page.writes[2].second, 0x11);
+        QCOMPARE((int)memory.data[0x3006], 0x00);
+        QCOMPARE((int)memory.data[0x2087], 0x00);
+    }
+}
+
+QTEST_APPLESS_MAIN(TestMemory)
+
+#include "tst_memory.moc"
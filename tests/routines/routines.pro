@@ -0,0 +1,11 @@
+include(../core.pri)
+
+TARGET = tst_routines
+TEMPLATE = app
+
+SOURCES += \
+    tst_routines.cpp
+
+# The Space Invaders ROM, at the same resource paths as for the emulator
+RESOURCES += \
+    $$PWD/../../ee.qrc
@@ -0,0 +1,179 @@
+#include <QtTest>
+
+#include "cpu.h"
+#include "i8080jit.h"
+#include "i8080switchengine.h"
+#include "invadersbus.h"
+#include "invadersroutines.h"
+#include "machine.h"
+#include "romimage.h"
+
+/*
+ Native routines against the ROM code
+
+ Runs two processors set up like a Machine's on the same engine, one
+ with the native routines of invadersroutines.h and one without, and
+ compares registers, flags, cycles, the storage and the shift register
+ after every slice. The slices vary in length, so that routines and
+ their row loops are cut short by the budget as well. The attract mode
+ runs on to its demo game, which draws and erases every kind of sprite.
+*/
+
+// Emulated frames per run, past the start of the demo game
+static const int frames = 2000;
+
+// The storage of part of the video RAM, a device over $2400-$2BFF.
+struct VideoDevice {
+    static const uint16_t addr = 0x2400;
+    static const int size = 0x800;
+    uint8_t bytes[size];
+
+    static uint8_t read(void *context, uint16_t addr) {
+        return ((VideoDevice *)context)->bytes[addr - VideoDevice::addr];
+    }
+    static void write(void *context, uint16_t addr, uint8_t val) {
+        ((VideoDevice *)context)->bytes[addr - VideoDevice::addr] = val;
+    }
+};
+
+struct Session {
+    QMutex mutex;
+    MemoryMap memory;
+    CPU cpu;
+    EE::ShiftRegister shift;
+    TripleBuffer video_frames;
+    VideoDevice device;
+
+    Session(const RomImage *rom, CPU::Engine engine, bool device_over_video_ram)
+        : cpu(&mutex, &memory), video_frames(EE::video_ram_size) {
+        memory.mapRom(0x0000, rom);
+        memory.mirror(0x4000, 0x10000, 0x2000, 0x2000);
+        memset(device.bytes, 0, sizeof(device.bytes));
+        if (device_over_video_ram) {
+            memory.mapDevice(VideoDevice::addr, VideoDevice::size, VideoDevice::read, VideoDevice::write, &device);
+        }
+        memory.trackWrites(EE::video_ram, EE::video_ram_size);
+        cpu.a = cpu.b = cpu.c = cpu.d = cpu.e = cpu.h = cpu.l = 0;
+        cpu.flags = 1 << 6;
+        cpu.engine = engine;
+        cpu.switch_engine = RunSwitchEngine<InvadersBus>;
+        cpu.throttled = false;
+        cpu.setCallback(0xd3, output_callback);
+        cpu.setCallback(0xdb, input_callback);
+        cpu.addCycleEvent(EE::mid_screen_cycle, EE::cycles_per_frame, mid_screen_interrupt, 0);
+        cpu.addCycleEvent(EE::cycles_per_frame, EE::cycles_per_frame, end_of_screen_interrupt, &video_frames);
+        shift = EE::ShiftRegister();
+        shift.out_port_two = shift.out_port_three = shift.out_port_four_low = shift.out_port_four_high = 0;
+        shift.out_port_five = shift.in_port_one = 0;
+    }
+
+    // The ports are the process's, see output_callback().
+    int run(int cycles) {
+        shift_register_hw = shift;
+        int ran = cpu.run(cycles);
+        shift = shift_register_hw;
+        return ran;
+    }
+};
+
+// Returns a description of the first difference between `native` and
+// `rom`, or an empty string.
+static QByteArray Compare(const Session &native, const Session &rom)
+{
+    char message[256];
+    const CPU &n = native.cpu, &r = rom.cpu;
+    if (n.cycle_count != r.cycle_count || n.pc != r.pc || n.sp != r.sp || n.flags != r.flags ||
+            n.a != r.a || n.b != r.b || n.c != r.c || n.d != r.d || n.e != r.e || n.h != r.h || n.l != r.l) {
+        qsnprintf(message, sizeof(message),
+                  "cycles %llu/%llu pc %04x/%04x sp %04x/%04x flags %x/%x a %02x/%02x "
+                  "bc %02x%02x/%02x%02x de %02x%02x/%02x%02x hl %02x%02x/%02x%02x",
+                  (unsigned long long)n.cycle_count, (unsigned long long)r.cycle_count,
+                  n.pc, r.pc, n.sp, r.sp, n.flags, r.flags, n.a, r.a,
+                  n.b, n.c, r.b, r.c, n.d, n.e, r.d, r.e, n.h, n.l, r.h, r.l);
+        return QByteArray(message);
+    }
+    if (memcmp(&native.shift, &rom.shift, sizeof(native.shift))) {
+        qsnprintf(message, sizeof(message), "shift register %02x%02x>>%d/%02x%02x>>%d",
+                  native.shift.out_port_four_high, native.shift.out_port_four_low, native.shift.out_port_two,
+                  rom.shift.out_port_four_high, rom.shift.out_port_four_low, rom.shift.out_port_two);
+        return QByteArray(message);
+    }
+    const uint8_t *storages[2][2] = { { native.memory.data, rom.memory.data },
+                                      { native.device.bytes, rom.device.bytes } };
+    const int sizes[2] = { 0x10000, VideoDevice::size };
+    const int bases[2] = { 0, VideoDevice::addr };
+    for (int s = 0; s < 2; s++) {
+        if (memcmp(storages[s][0], storages[s][1], sizes[s])) {
+            int addr = 0;
+            while (storages[s][0][addr] == storages[s][1][addr]) {
+                addr++;
+            }
+            qsnprintf(message, sizeof(message), "%s at %04x %02x/%02x", s ? "device" : "memory",
+                      bases[s] + addr, storages[s][0][addr], storages[s][1][addr]);
+            return QByteArray(message);
+        }
+    }
+    return QByteArray();
+}
+
+class TestRoutines : public QObject
+{
+    Q_OBJECT
+private slots:
+    void game_data();
+    void game();
+};
+
+void TestRoutines::game_data()
+{
+    QTest::addColumn<int>("engine");
+    QTest::addColumn<bool>("device");
+
+    const char *names[] = { "table", "switch", "block", "jit", "aot" };
+    const CPU::Engine engines[] = { CPU::HandlerTableEngine, CPU::SwitchEngine, CPU::BlockEngine,
+                                    CPU::JitEngine, CPU::StaticEngine };
+    for (int i = 0; i < 5; i++) {
+        char name[48];
+        qsnprintf(name, sizeof(name), "%s", names[i]);
+        QTest::newRow(name) << (int)engines[i] << false;
+        qsnprintf(name, sizeof(name), "%s, device over video RAM", names[i]);
+        QTest::newRow(name) << (int)engines[i] << true;
+    }
+}
+
+void TestRoutines::game()
+{
+    QFETCH(int, engine);
+    QFETCH(bool, device);
+
+    if (engine == CPU::JitEngine && !Jit::available()) {
+        QSKIP("JitEngine needs an x86-64 host");
+    }
+    const RomImage *rom = RomImage::load(QStringList()
+                                         << "://assets/roms/invaders.h"
+                                         << "://assets/roms/invaders.g"
+                                         << "://assets/roms/invaders.f"
+                                         << "://assets/roms/invaders.e");
+    QVERIFY2(rom, "Cannot load the ROM");
+
+    Session native(rom, (CPU::Engine)engine, device), interpreted(rom, (CPU::Engine)engine, device);
+    QVERIFY2(AddInvadersRoutines(&native.cpu), "The ROM has no native routines");
+
+    // Slices of 1 to 2000 cycles, as uneven as the budget of a batch gets
+    for (int slice = 0; native.cpu.cycle_count < (uint64_t)frames * EE::cycles_per_frame; slice++) {
+        int cycles = 1 + (slice * 7919) % 2000;
+        native.run(cycles);
+        interpreted.run(cycles);
+        QByteArray failure = Compare(native, interpreted);
+        if (!failure.isEmpty()) {
+            char message[320];
+            qsnprintf(message, sizeof(message), "slice %d, frame %d: %s", slice,
+                      (int)(native.cpu.cycle_count / EE::cycles_per_frame), failure.constData());
+            QFAIL(message);
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestRoutines)
+
+#include "tst_routines.moc"
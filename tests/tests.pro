@@ -0,0 +1,10 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    batch \
+    disassembler \
+    flags \
+    idle \
+    jit \
+    memory \
+    routines
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Generates i8080fused.cpp from an opcode sequence profile.
+#
+# The profile is written by OpcodeProfile::save() while the emulator runs
+# with CPU/OpcodeProfile set, see opcodeprofile.h. The sequences saving
+# the most dispatches become fused handlers, which call the handlers
+# cpu.cpp installs in instruction_handlers one after the other, see
+# i8080fused.h for what a sequence may contain.
+#
+# Usage: tools/genfusedhandlers.py [profile] [output]
+
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Fused handlers generated, at most
+MAX_HANDLERS = 32
+
+# Instructions that may leave a sequence or disable the processor, only
+# allowed last: JMP, CALL, RET, PCHL, HLT, Jcc, Ccc, Rcc, RST and PUSH.
+def ends_sequence(op):
+    return (op in (0xc3, 0xcd, 0xc9, 0xe9, 0x76) or
+            (op & 0xc7) in (0xc2, 0xc4, 0xc0, 0xc7) or
+            (op & 0xcf) == 0xc5)
+
+# Instructions writing memory, a write to code ends a sequence early:
+# STAX, SHLD, STA, INR M, DCR M, MVI M, MOV M,r and XTHL.
+def writes_memory(op):
+    return (op in (0x02, 0x12, 0x22, 0x32, 0x34, 0x35, 0x36, 0xe3) or
+            (0x70 <= op <= 0x77 and op != 0x76))
+
+HEADER = """\
+// Generated by tools/genfusedhandlers.py from %s.
+// Do not edit by hand, re-run the generator. See i8080fused.h.
+
+#include "i8080fused.h"
+#include "i8080.h"
+"""
+
+
+def load_mnemonics():
+    with open(os.path.join(ROOT, "assets", "8080_instructions.json")) as f:
+        opcodes = json.load(f)["opcodes"]
+    return {int(op, 16): definition[0] for op, definition in opcodes.items()}
+
+
+def load_handlers():
+    """Core handler names by opcode, as installed by CPU::CPU()."""
+    handlers = {}
+    with open(os.path.join(ROOT, "cpu.cpp")) as f:
+        for match in re.finditer(r"instruction_handlers\[0x([0-9a-f]+)\] = (\w+);", f.read()):
+            handlers[int(match.group(1), 16)] = match.group(2)
+    return handlers
+
+
+def load_profile(path):
+    sequences = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split()
+            sequences.append((int(fields[0]), tuple(int(op, 16) for op in fields[1:])))
+    return sequences
+
+
+def fusable(ops, handlers):
+    if any(op not in handlers for op in ops):
+        return False
+    return not any(ends_sequence(op) for op in ops[:-1])
+
+
+def generate(ops, handlers, mnemonics):
+    name = "fused_" + "_".join("%02x" % op for op in ops)
+    lines = ["// " + " / ".join(mnemonics[op] for op in ops),
+             "static int %s(INSTDEF)" % name,
+             "{"]
+    checked = any(writes_memory(op) for op in ops[:-1])
+    if checked:
+        lines.append("    uint32_t code_writes = processor->memory->code_writes;")
+    for i, op in enumerate(ops):
+        opcode = "opcode" if i == 0 else "i8080_instructions[0x%02x]" % op
+        lines.append("    %s %s(processor, %s);" % ("int cycles =" if i == 0 else "cycles +=", handlers[op], opcode))
+        if i < len(ops) - 1 and writes_memory(op):
+            lines.append("    if (processor->memory->code_writes != code_writes) {")
+            lines.append("        return cycles;")
+            lines.append("    }")
+    lines.append("    return cycles;")
+    lines.append("}")
+    return name, "\n".join(lines) + "\n"
+
+
+def main():
+    profile_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, "assets", "opcodeprofile.txt")
+    out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, "i8080fused.cpp")
+
+    mnemonics = load_mnemonics()
+    handlers = load_handlers()
+
+    # Rank by the dispatches a fused handler saves.
+    candidates = [(count * (len(ops) - 1), ops) for count, ops in load_profile(profile_path)
+                  if fusable(ops, handlers)]
+    candidates.sort(key=lambda candidate: -candidate[0])
+    chosen = [ops for saved, ops in candidates[:MAX_HANDLERS]]
+    chosen.sort(key=lambda ops: -len(ops)) # stable, keeps the ranking per length
+
+    functions = []
+    table = []
+    for ops in chosen:
+        name, function = generate(ops, handlers, mnemonics)
+        functions.append(function)
+        padded = list(ops) + [0] * (3 - len(ops))
+        table.append("    { { %s }, %d, %s }," % (", ".join("0x%02x" % op for op in padded), len(ops), name))
+
+    with open(out_path, "w") as f:
+        f.write(HEADER % os.path.relpath(profile_path, ROOT))
+        f.write("\n")
+        f.write("\n".join(functions))
+        f.write("\nconst FusedHandler fused_handlers[] = {\n")
+        f.write("\n".join(table))
+        f.write("\n};\n\n")
+        f.write("const int fused_handler_count = sizeof(fused_handlers) / sizeof(fused_handlers[0]);\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# Generates i8080instructiontable.h from assets/8080_instructions.json.
+#
+# The JSON file remains the single source of truth for instruction
+# lengths, cycle counts, addressing modes and flag effects. The CPU
+# core reads the generated constexpr table instead of parsing the JSON
+# at runtime, so that decoding an instruction is a single array index.
+#
+# Usage: tools/geninstructiontable.py [json] [header]
+
+import json
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+MODES = {
+    "IMP": "AddressingImplied",
+    "IMM": "AddressingImmediate",
+}
+
+# Flag letters used by the JSON, mapped to the CPU::flags bits.
+FLAGS = {
+    "z": "FlagZero",
+    "s": "FlagSign",
+    "p": "FlagParity",
+    "c": "FlagCarry",
+    "a": "FlagAuxCarry",
+}
+
+HEADER = """\
+#ifndef I8080INSTRUCTIONTABLE_H
+#define I8080INSTRUCTIONTABLE_H
+
+// Generated by tools/geninstructiontable.py from assets/8080_instructions.json.
+// Do not edit by hand, edit the JSON file and re-run the generator.
+
+#include <stdint.h>
+
+enum InstructionAddressingMode : uint8_t {
+    AddressingImplied,
+    AddressingImmediate
+};
+
+// Bits match the condition flag bits of CPU::flags.
+enum InstructionFlagEffect : uint8_t {
+    FlagZero     = (1 << 0),
+    FlagSign     = (1 << 1),
+    FlagParity   = (1 << 2),
+    FlagCarry    = (1 << 3),
+    FlagAuxCarry = (1 << 4)
+};
+
+struct InstructionDef {
+    const char *mnemonic;
+    uint8_t length;
+    uint8_t cycles;
+    uint8_t mode;
+    uint8_t affected_flags;
+    bool defined;
+};
+
+constexpr InstructionDef i8080_instructions[0x100] = {
+"""
+
+FOOTER = """\
+};
+
+#endif // I8080INSTRUCTIONTABLE_H
+"""
+
+
+def flag_expr(effects):
+    if effects == "None":
+        return "0"
+    return "|".join(FLAGS[f] for f in effects)
+
+
+def main():
+    json_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, "assets", "8080_instructions.json")
+    header_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, "i8080instructiontable.h")
+
+    with open(json_path) as f:
+        opcodes = json.load(f)["opcodes"]
+
+    rows = []
+    for op in range(0x100):
+        definition = opcodes.get("0x%02x" % op)
+        if definition is None:
+            rows.append('    /* 0x%02x */ { "", 0, 0, AddressingImplied, 0, false },' % op)
+            continue
+        mnemonic, mode, length, cycles, effects = definition
+        rows.append('    /* 0x%02x */ { "%s", %d, %d, %s, %s, true },'
+                    % (op, mnemonic, int(length), int(cycles), MODES[mode], flag_expr(effects)))
+
+    with open(header_path, "w") as f:
+        f.write(HEADER)
+        f.write("\n".join(rows))
+        f.write("\n")
+        f.write(FOOTER)
+
+
+if __name__ == "__main__":
+    main()
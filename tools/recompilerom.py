@@ -0,0 +1,469 @@
+#!/usr/bin/env python3
+#
+# Statically recompiles the Space Invaders ROM into invadersaot.cpp.
+# Other images, e.g. the test image of tests/flags, go through generate().
+#
+# Basic blocks are discovered by following the control flow from the
+# reset and RST vectors through jumps, calls and their return addresses.
+# Each block becomes one C++ function with the 8080 registers in locals,
+# see i8080aot.h for the calling convention and for what is left to the
+# interpreter. Instruction lengths and cycle counts come from
+# assets/8080_instructions.json, like i8080instructiontable.h.
+#
+# Usage: tools/recompilerom.py [output]
+
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Files and load addresses, as in Machine::Machine()
+ROMS = [
+    ("invaders.h", 0x0000),
+    ("invaders.g", 0x0800),
+    ("invaders.f", 0x1000),
+    ("invaders.e", 0x1800),
+]
+BASE = 0x0000
+SIZE = 0x2000
+
+REGS = ["b", "c", "d", "e", "h", "l", "M", "a"]
+PAIRS = [("b", "c"), ("d", "e"), ("h", "l")]
+
+# Condition of Jcc, Ccc and Rcc by bits 3-5
+CONDITIONS = [
+    "!(f & FlagZero)", "(f & FlagZero)",
+    "!(f & FlagCarry)", "(f & FlagCarry)",
+    "!(f & FlagParity)", "(f & FlagParity)",
+    "!(f & FlagSign)", "(f & FlagSign)",
+]
+
+# Left to the interpreter: IN, OUT, HLT, DAA and RIM, which has no core
+# handler. RST, DI and the same register MOVs are not defined in the JSON.
+INTERPRETED = {0xdb, 0xd3, 0x76, 0x27, 0x20}
+
+HEADER = """\
+// Generated by tools/recompilerom.py from SOURCE.
+// Do not edit by hand, re-run the generator. See i8080aot.h.
+
+#include "i8080aot.h"
+#include "i8080flags.h"
+
+#define HL ((uint16_t)((h << 8) | l))
+#define EXIT(next) do { pc = (next); goto exit; } while (0)
+// Continues in the block at `next` while there is budget left, native
+// routines are dispatched by Aot::run(), see CPU::addRoutine().
+#define CHAIN(next, block) do { if (cyc >= budget || processor->hasRoutine(next)) EXIT(next); pc = (next); STORE return block(processor, mem, cyc, budget); } while (0)
+#define ACCOUNT(cycles, next) do { cyc += (cycles); if (cyc >= budget) EXIT(next); } while (0)
+// Leaves before the instruction at `at` if it would write to the image,
+// another page that is not plain RAM, or a watched or shared page, the
+// interpreter writes through MemoryMap::write(). Aot marks the image in
+// MemoryMap::code_pages.
+#define CHECK_WRITE(addr, at) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & (7 | 8 | 32 | 64)) EXIT(at); } while (0)
+// Sets the dirty bit of a byte just written to a page that CHECK_WRITE
+// leaves native, if MemoryMap::trackWrites() tracks it.
+#define WRITTEN(addr) do { if (processor->memory->code_pages[(uint16_t)(addr) >> 8] & 16) processor->memory->markDirty(addr); } while (0)
+// Leaves before the instruction at `at` if it would read a mirrored or
+// device page, see MemoryMap::indirect_pages.
+#define CHECK_READ(addr, at) do { if (processor->memory->indirect_pages[(uint16_t)(addr) >> 8]) EXIT(at); } while (0)
+
+#define ENTER \\
+    uint8_t a = processor->a, b = processor->b, c = processor->c, d = processor->d, \\
+            e = processor->e, h = processor->h, l = processor->l; \\
+    uint16_t sp = processor->sp, pc; \\
+    int f = processor->flags;
+
+#define STORE \\
+    processor->a = a; processor->b = b; processor->c = c; processor->d = d; \\
+    processor->e = e; processor->h = h; processor->l = l; \\
+    processor->sp = sp; processor->pc = pc; \\
+    processor->flags = f;
+
+#define LEAVE \\
+    STORE \\
+    return cyc;
+"""
+
+
+def load_opcodes():
+    with open(os.path.join(ROOT, "assets", "8080_instructions.json")) as f:
+        opcodes = json.load(f)["opcodes"]
+    table = {}
+    for op in range(0x100):
+        definition = opcodes.get("0x%02x" % op)
+        if definition is not None:
+            table[op] = (int(definition[2]), int(definition[3]))
+    return table
+
+
+def load_image():
+    image = bytearray(SIZE)
+    for name, addr in ROMS:
+        with open(os.path.join(ROOT, "assets", "roms", name), "rb") as f:
+            data = f.read()
+        image[addr - BASE:addr - BASE + len(data)] = data
+    return image
+
+
+class Rom:
+    def __init__(self, image, opcodes, base):
+        self.image = image
+        self.opcodes = opcodes
+        self.base = base
+
+    def inside(self, pc, length=1):
+        return self.base <= pc and pc + length <= self.base + len(self.image)
+
+    def byte(self, pc):
+        return self.image[pc - self.base]
+
+    def word(self, pc):
+        return self.byte(pc) | (self.byte(pc + 1) << 8)
+
+    def decode(self, pc):
+        """Returns (op, length, cycles), or None outside of the image or
+        for an undefined opcode."""
+        if not self.inside(pc):
+            return None
+        op = self.byte(pc)
+        if op not in self.opcodes:
+            return None
+        length, cycles = self.opcodes[op]
+        if not self.inside(pc, length):
+            return None
+        return op, length, cycles
+
+
+def is_jump(op):
+    return op == 0xc3 or (op & 0xc7) == 0xc2
+
+
+def is_call(op):
+    return op == 0xcd or (op & 0xc7) == 0xc4
+
+
+def ends_flow(op):
+    """No fall through to the next instruction."""
+    return op in (0xc3, 0xc9, 0xe9, 0x76)
+
+
+def discover(rom, entries):
+    """Addresses that start a block: the entries, branch targets, return
+    addresses and instructions after the interpreted ones."""
+    leaders = set(pc for pc in entries if rom.inside(pc))
+    seen = set()
+    work = sorted(leaders)
+
+    while work:
+        pc = work.pop()
+        while pc not in seen:
+            decoded = rom.decode(pc)
+            if decoded is None:
+                break
+            seen.add(pc)
+            op, length, _ = decoded
+            next_pc = pc + length
+
+            if is_jump(op) or is_call(op):
+                target = rom.word(pc + 1)
+                if rom.inside(target) and target not in leaders:
+                    leaders.add(target)
+                    work.append(target)
+            if op != 0xc3 and (is_jump(op) or is_call(op) or op in INTERPRETED or (op & 0xc7) == 0xc0):
+                if next_pc not in leaders:
+                    leaders.add(next_pc)
+            if ends_flow(op):
+                break
+            pc = next_pc
+
+    return sorted(pc for pc in leaders if rom.decode(pc) is not None)
+
+
+def write_check(addr, pc):
+    return "CHECK_WRITE(%s, 0x%04x);" % (addr, pc)
+
+
+def written(addr):
+    return "WRITTEN(%s);" % addr
+
+
+def read_check(addr, pc):
+    return "CHECK_READ(%s, 0x%04x);" % (addr, pc)
+
+
+def push_code(high, low, pc):
+    # PUSH B/D/H and calls store through the same sequence
+    return [
+        write_check("sp - 1", pc),
+        write_check("sp - 2", pc),
+        "mem[(uint16_t)(sp - 1)] = %s;" % high,
+        written("sp - 1"),
+        "mem[(uint16_t)(sp - 2)] = %s;" % low,
+        written("sp - 2"),
+        "sp -= 2;",
+    ]
+
+
+def pop_code(pc):
+    return [
+        read_check("sp", pc),
+        read_check("sp + 1", pc),
+        "{ uint8_t low = mem[sp], high = mem[(uint16_t)(sp + 1)]; sp += 2;",
+    ]
+
+
+def operand(reg):
+    return "mem[HL]" if reg == "M" else reg
+
+
+def operand_check(reg, pc):
+    return [read_check("HL", pc)] if reg == "M" else []
+
+
+def alu(kind, val):
+    if kind == "ADD":
+        return ["{ uint8_t v = %s; f = (f & ~ALU_FLAGS) | add_flags[0][a][v]; a = (uint8_t)(a + v); }" % val]
+    if kind == "ADC":
+        return ["{ uint8_t v = %s; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | add_flags[cy][a][v]; a = (uint8_t)(a + v + cy); }" % val]
+    if kind == "SUB":
+        return ["{ uint8_t v = %s; f = (f & ~ALU_FLAGS) | sub_flags[0][a][v]; a = (uint8_t)(a - v); }" % val]
+    if kind == "SBB":
+        return ["{ uint8_t v = %s; int cy = (f >> 3) & 1; f = (f & ~ALU_FLAGS) | sub_flags[cy][a][v]; a = (uint8_t)(a - v - cy); }" % val]
+    if kind == "CMP":
+        return ["f = (f & ~ALU_FLAGS) | sub_flags[0][a][%s];" % val]
+    symbol = {"ANA": "&", "XRA": "^", "ORA": "|"}[kind]
+    return ["a %s= %s; f = (f & ~ALU_FLAGS) | zsp_flags[a];" % (symbol, val)]
+
+
+ALU_KINDS = ["ADD", "ADC", "SUB", "SBB", "ANA", "XRA", "ORA", "CMP"]
+
+
+def translate(rom, pc):
+    """Returns (lines, ends) for the instruction at pc, lines being None
+    if it is left to the interpreter. The lines do the accounting and
+    leave the block if the instruction does not continue."""
+    op, length, cycles = rom.decode(pc)
+    next_pc = pc + length
+    imm = rom.byte(pc + 1) if length > 1 else 0
+    addr = rom.word(pc + 1) if length > 2 else 0
+    dst = (op >> 3) & 7
+    src = op & 7
+    account = ["ACCOUNT(%d, 0x%04x);" % (cycles, next_pc)]
+
+    if op in INTERPRETED or (op == 0xcd and addr == 5):
+        return None, True
+
+    code = []
+    if op == 0x00:  # NOP
+        pass
+    elif op in (0x01, 0x11, 0x21):  # LXI rp
+        high, low = PAIRS[op >> 4]
+        code = ["%s = 0x%02x; %s = 0x%02x;" % (high, addr >> 8, low, addr & 0xff)]
+    elif op == 0x31:
+        code = ["sp = 0x%04x;" % addr]
+    elif op in (0x03, 0x13, 0x23, 0x0b, 0x1b, 0x2b):  # INX, DCX
+        high, low = PAIRS[op >> 4]
+        step = "- 1" if op & 0x08 else "+ 1"
+        code = ["{ uint16_t v = (uint16_t)(((%s << 8) | %s) %s); %s = v >> 8; %s = v & 0xff; }" % (high, low, step, high, low)]
+    elif op in (0x33, 0x3b):
+        code = ["sp %s= 1;" % ("-" if op & 0x08 else "+")]
+    elif op in (0x09, 0x19, 0x29, 0x39):  # DAD
+        rp = "sp" if op == 0x39 else "((%s << 8) | %s)" % PAIRS[op >> 4]
+        code = ["{ uint32_t v = HL + %s; f = (f & ~FlagCarry) | ((v >> 16) ? FlagCarry : 0); h = (v >> 8) & 0xff; l = v & 0xff; }" % rp]
+    elif op in (0x02, 0x12):  # STAX
+        rp = "(uint16_t)((%s << 8) | %s)" % PAIRS[op >> 4]
+        code = [write_check(rp, pc), "mem[%s] = a;" % rp, written(rp)]
+    elif op in (0x0a, 0x1a):  # LDAX
+        rp = "(uint16_t)((%s << 8) | %s)" % PAIRS[op >> 4]
+        code = [read_check(rp, pc), "a = mem[%s];" % rp]
+    elif op == 0x32:  # STA
+        code = [write_check("0x%04x" % addr, pc), "mem[0x%04x] = a;" % addr, written("0x%04x" % addr)]
+    elif op == 0x3a:  # LDA
+        code = [read_check("0x%04x" % addr, pc), "a = mem[0x%04x];" % addr]
+    elif op == 0x22:  # SHLD
+        code = [write_check("0x%04x" % addr, pc), write_check("0x%04x" % ((addr + 1) & 0xffff), pc),
+                "mem[0x%04x] = l; mem[0x%04x] = h;" % (addr, (addr + 1) & 0xffff),
+                written("0x%04x" % addr), written("0x%04x" % ((addr + 1) & 0xffff))]
+    elif op == 0x2a:  # LHLD
+        code = [read_check("0x%04x" % addr, pc), read_check("0x%04x" % ((addr + 1) & 0xffff), pc),
+                "l = mem[0x%04x]; h = mem[0x%04x];" % (addr, (addr + 1) & 0xffff)]
+    elif (op & 0xc7) == 0x06:  # MVI
+        if REGS[dst] == "M":
+            code = [write_check("HL", pc), "mem[HL] = 0x%02x;" % imm, written("HL")]
+        else:
+            code = ["%s = 0x%02x;" % (REGS[dst], imm)]
+    elif (op & 0xc6) == 0x04:  # INR, DCR
+        table, step = ("dcr_flags", "- 1") if op & 1 else ("inr_flags", "+ 1")
+        reg = REGS[dst]
+        if reg == "M":
+            code = [read_check("HL", pc), write_check("HL", pc),
+                    "{ uint8_t v = (uint8_t)(mem[HL] %s); mem[HL] = v; f = (f & ~(ALU_FLAGS & ~FlagCarry)) | %s[v]; }" % (step, table),
+                    written("HL")]
+        else:
+            code = ["%s = (uint8_t)(%s %s); f = (f & ~(ALU_FLAGS & ~FlagCarry)) | %s[%s];" % (reg, reg, step, table, reg)]
+    elif op == 0x07:  # RLC
+        code = ["{ int cy = a >> 7; a = (uint8_t)((a << 1) | cy); f = (f & ~FlagCarry) | (cy << 3); }"]
+    elif op == 0x0f:  # RRC
+        code = ["{ int cy = a & 1; a = (uint8_t)((a >> 1) | (cy << 7)); f = (f & ~FlagCarry) | (cy << 3); }"]
+    elif op == 0x17:  # RAL
+        code = ["{ int cy = a >> 7; a = (uint8_t)((a << 1) | ((f >> 3) & 1)); f = (f & ~FlagCarry) | (cy << 3); }"]
+    elif op == 0x1f:  # RAR
+        code = ["{ int cy = a & 1; a = (uint8_t)((a >> 1) | (((f >> 3) & 1) << 7)); f = (f & ~FlagCarry) | (cy << 3); }"]
+    elif op == 0x2f:  # CMA
+        code = ["a = ~a;"]
+    elif op == 0x37:  # STC
+        code = ["f |= FlagCarry;"]
+    elif op == 0x3f:  # CMC
+        code = ["f ^= FlagCarry;"]
+    elif 0x40 <= op < 0x80:  # MOV
+        if REGS[dst] == "M":
+            code = [write_check("HL", pc), "mem[HL] = %s;" % REGS[src], written("HL")]
+        else:
+            code = operand_check(REGS[src], pc) + ["%s = %s;" % (REGS[dst], operand(REGS[src]))]
+    elif 0x80 <= op < 0xc0:  # ADD to CMP
+        code = operand_check(REGS[src], pc) + alu(ALU_KINDS[dst], operand(REGS[src]))
+    elif op in (0xc6, 0xce, 0xd6, 0xde, 0xe6, 0xfe):  # ADI, ACI, SUI, SBI, ANI, CPI
+        code = alu(ALU_KINDS[dst], "0x%02x" % imm)
+    elif op in (0xee, 0xf6):  # XRI, ORI leave AC alone
+        symbol = "^" if op == 0xee else "|"
+        code = ["a %s= 0x%02x; f = (f & ~(FlagZero|FlagSign|FlagParity|FlagCarry)) | zsp_flags[a];" % (symbol, imm)]
+    elif op in (0xc5, 0xd5, 0xe5):  # PUSH B/D/H
+        high, low = PAIRS[(op >> 4) & 3]
+        code = ["if (!(f & (1 << 7)) && (sp - 2 < 0x2000 || sp - 1 >= 0x4000)) EXIT(0x%04x);" % pc]
+        code += push_code(high, low, pc)
+    elif op == 0xf5:  # PUSH PSW
+        code = push_code("a", "(uint8_t)f", pc)
+    elif op in (0xc1, 0xd1, 0xe1):  # POP B/D/H
+        high, low = PAIRS[(op >> 4) & 3]
+        code = pop_code(pc) + ["%s = high; %s = low; }" % (high, low)]
+    elif op == 0xf1:  # POP PSW, which may disable the processor
+        code = pop_code(pc) + ["a = high; f = (f & 0xff00) | low; }"]
+        code += account
+        code += ["if (!(f & (1 << 6))) EXIT(0x%04x);" % next_pc]
+        return code, False
+    elif op == 0xeb:  # XCHG
+        code = ["{ uint8_t t = d; d = h; h = t; t = e; e = l; l = t; }"]
+    elif op == 0xe3:  # XTHL
+        code = [read_check("sp", pc), read_check("sp + 1", pc),
+                write_check("sp", pc), write_check("sp + 1", pc),
+                "{ uint8_t t = mem[sp]; mem[sp] = l; l = t; t = mem[(uint16_t)(sp + 1)]; mem[(uint16_t)(sp + 1)] = h; h = t; }",
+                written("sp"), written("sp + 1")]
+    elif op == 0xf9:  # SPHL
+        code = ["sp = HL;"]
+    elif op == 0xfb:  # EI
+        code = ["f |= (1 << 5);"]
+    elif op == 0xc3:  # JMP
+        return ["cyc += %d;" % cycles, "NEXT(0x%04x);" % addr], True
+    elif op == 0xe9:  # PCHL
+        return ["cyc += %d;" % cycles, "EXIT(HL);"], True
+    elif (op & 0xc7) == 0xc2:  # Jcc, same cycles either way
+        return ["cyc += %d;" % cycles,
+                "if (%s) NEXT(0x%04x);" % (CONDITIONS[dst], addr),
+                "NEXT(0x%04x);" % next_pc], True
+    elif op == 0xcd:  # CALL
+        code = push_code("0x%02x" % (next_pc >> 8), "0x%02x" % (next_pc & 0xff), pc)
+        return code + ["cyc += %d;" % cycles, "NEXT(0x%04x);" % addr], True
+    elif (op & 0xc7) == 0xc4:  # Ccc
+        code = ["if (%s) {" % CONDITIONS[dst]]
+        code += ["    " + line for line in push_code("0x%02x" % (next_pc >> 8), "0x%02x" % (next_pc & 0xff), pc)]
+        code += ["    cyc += %d;" % cycles, "    NEXT(0x%04x);" % addr, "}", "cyc += 11;", "NEXT(0x%04x);" % next_pc]
+        return code, True
+    elif op == 0xc9:  # RET
+        return pop_code(pc) + ["pc = (uint16_t)((high << 8) | low); }", "cyc += %d;" % cycles, "goto exit;"], True
+    elif (op & 0xc7) == 0xc0:  # Rcc
+        code = ["if (%s) {" % CONDITIONS[dst]]
+        code += ["    " + line for line in pop_code(pc) + ["pc = (uint16_t)((high << 8) | low); }"]]
+        code += ["    cyc += %d;" % cycles, "    goto exit;", "}", "cyc += 5;", "NEXT(0x%04x);" % next_pc]
+        return code, True
+    else:
+        return None, True
+
+    return code + account, False
+
+
+def block_code(rom, start, leaders):
+    """Lines of the function for the block at start. NEXT() marks where
+    the block continues at another block."""
+    lines = []
+    pc = start
+    while True:
+        code, ends = translate(rom, pc) if rom.decode(pc) else (None, True)
+        if code is None:
+            # Interpreted, returns before the instruction.
+            lines.append("EXIT(0x%04x);" % pc)
+            break
+        op, length, _ = rom.decode(pc)
+        lines.append("// %04x %s" % (pc, " ".join("%02x" % rom.byte(pc + i) for i in range(length))))
+        lines += code
+        if ends:
+            break
+        pc += length
+        if pc in leaders or rom.decode(pc) is None:
+            lines.append("NEXT(0x%04x);" % pc)
+            break
+    return lines
+
+
+def generate(out_path, image, base, entries, name, source):
+    """Writes the AotProgram `name` for `image` loaded at `base` to
+    out_path, following the control flow from the `entries`. `source`
+    names what the image was made from in the generated file."""
+    rom = Rom(image, load_opcodes(), base)
+    leaders = discover(rom, entries)
+    leader_set = set(leaders)
+
+    bodies = {}
+    for start in leaders:
+        lines = block_code(rom, start, leader_set)
+        if not lines[0].startswith("EXIT"):  # else starts with an interpreted instruction
+            bodies[start] = lines
+
+    def link(match):
+        target = int(match.group(1), 16)
+        if target in bodies:
+            return "CHAIN(0x%04x, Block%04x)" % (target, target)
+        return "EXIT(0x%04x)" % target
+
+    declarations = []
+    functions = []
+    table = []
+    for start, lines in sorted(bodies.items()):
+        block = "Block%04x" % start
+        body = "\n".join("    " + re.sub(r"NEXT\(0x([0-9a-f]{4})\)", link, line) for line in lines)
+        declarations.append("static int %s(CPU *processor, uint8_t *mem, int cyc, int budget);" % block)
+        functions.append("static int %s(CPU *processor, uint8_t *mem, int cyc, int budget)\n{\n    ENTER\n%s\nexit:\n    LEAVE\n}\n"
+                         % (block, body))
+        table.append("    { 0x%04x, %s }," % (start, block))
+
+    image_rows = []
+    for offset in range(0, len(image), 16):
+        image_rows.append("    " + " ".join("0x%02x," % b for b in image[offset:offset + 16]))
+
+    with open(out_path, "w") as f:
+        f.write(HEADER.replace("SOURCE", source))
+        f.write("\n")
+        f.write("\n".join(declarations))
+        f.write("\n\n")
+        f.write("\n".join(functions))
+        f.write("\nstatic const uint8_t image[0x%04x] = {\n" % len(image))
+        f.write("\n".join(image_rows))
+        f.write("\n};\n\nstatic const AotBlock blocks[] = {\n")
+        f.write("\n".join(table))
+        f.write("\n};\n\n")
+        # Declared again for programs without a declaration in i8080aot.h
+        f.write("extern const AotProgram %s;\n" % name)
+        f.write("const AotProgram %s = { 0x%04x, 0x%04x, image, blocks, sizeof(blocks) / sizeof(blocks[0]) };\n"
+                % (name, base, len(image)))
+
+
+def main():
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, "invadersaot.cpp")
+
+    # The reset and RST vectors
+    generate(out_path, load_image(), BASE, range(0, 0x40, 8), "invaders_aot", "assets/roms/invaders.h/g/f/e")
+
+
+if __name__ == "__main__":
+    main()
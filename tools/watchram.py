@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+#
+# Prints a range of the emulated memory once per frame, read from the
+# shared memory segment the emulator exports with Memory/Export set, see
+# memoryexport.h. An example reader for analyzers: it maps the segment
+# read only and never makes the emulator wait.
+#
+# Usage: tools/watchram.py [name] [first-last]
+#
+#   tools/watchram.py /ee-ram 20f8-20fb
+
+import mmap
+import os
+import struct
+import sys
+import time
+
+HEADER = struct.Struct("=4sIII I I Q Q")
+
+def main():
+    name = sys.argv[1] if len(sys.argv) > 1 else "/ee-ram"
+    first, last = (int(x, 16) for x in (sys.argv[2] if len(sys.argv) > 2 else "2000-203f").split("-"))
+
+    fd = os.open("/dev/shm/" + name.lstrip("/"), os.O_RDONLY)
+    segment = mmap.mmap(fd, 0, prot=mmap.PROT_READ)
+    os.close(fd)
+
+    magic, version, data_offset, data_size, _, _, _, _ = HEADER.unpack_from(segment)
+    if magic != b"EE80" or version != 1:
+        sys.exit("%s is not an exported memory map" % name)
+
+    last_frame = None
+    while True:
+        # Seqlock read: an even sequence, unchanged after the copy. The
+        # emulator copies the storage in for a few microseconds a frame.
+        sequence = HEADER.unpack_from(segment)[4]
+        if sequence & 1:
+            time.sleep(0.0001)
+            continue
+        _, _, _, _, _, _, frame, cycles = HEADER.unpack_from(segment)
+        data = segment[data_offset + first:data_offset + last + 1]
+        if HEADER.unpack_from(segment)[4] != sequence:
+            continue
+        if frame != last_frame:
+            print("frame %d cycle %d %04x: %s" % (frame, cycles, first, data.hex()))
+            last_frame = frame
+        time.sleep(0.001)
+
+if __name__ == "__main__":
+    main()
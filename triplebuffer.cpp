@@ -0,0 +1,19 @@
+#include "triplebuffer.h"
+
+#include <string.h>
+
+TripleBuffer::TripleBuffer(int size) : size(size)
+{
+    buffers[0] = new uint8_t[3 * size];
+    buffers[1] = buffers[0] + size;
+    buffers[2] = buffers[1] + size;
+    memset(buffers[0], 0, 3 * size);
+    back_index = 0;
+    front_index = 1;
+    latest.store(2, std::memory_order_relaxed);
+}
+
+TripleBuffer::~TripleBuffer()
+{
+    delete[] buffers[0];
+}
@@ -0,0 +1,55 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <stdint.h>
+
+#include <atomic>
+
+/*
+ Triple buffer
+
+ Hands whole buffers of `size` bytes from one producer thread to one
+ consumer thread without locks. The producer fills back() and
+ publish()es it, the consumer take()s the latest buffer published and
+ reads it until its next take(). Of the three buffers one is the
+ producer's, one the consumer's and one the latest published, swapped
+ with a single atomic exchange, so neither thread ever waits for the
+ other and the consumer never sees a buffer being filled. Buffers
+ published while the consumer is busy replace each other, the consumer
+ only ever sees the latest.
+*/
+
+class TripleBuffer
+{
+public:
+    explicit TripleBuffer(int size);
+    ~TripleBuffer();
+
+    // The producer's buffer, its contents as of three publish() calls ago.
+    inline uint8_t *back(void) {
+        return buffers[back_index];
+    }
+    inline void publish(void) {
+        back_index = latest.exchange(back_index | fresh, std::memory_order_acq_rel) & ~fresh;
+    }
+
+    // The latest buffer published since the last call, or 0 when there is
+    // none, the buffer taken before is then still the latest.
+    inline const uint8_t *take(void) {
+        if (!(latest.load(std::memory_order_relaxed) & fresh)) {
+            return 0;
+        }
+        front_index = latest.exchange(front_index, std::memory_order_acq_rel) & ~fresh;
+        return buffers[front_index];
+    }
+
+    const int size;
+private:
+    static const int fresh = 4;  // in latest, published and not taken yet
+    uint8_t *buffers[3];
+    int back_index;              // the producer's
+    int front_index;             // the consumer's
+    alignas(64) std::atomic<int> latest; // the third buffer, | fresh
+};
+
+#endif // TRIPLEBUFFER_H